@@ -0,0 +1,40 @@
+// bulk operations on float-based arrays
+// (float[], complex[], polar[], vec2[], vec3[], vec4[])
+// each is one call over the whole array, instead of a loop
+
+// two buffers
+float a[8]; float b[8];
+for( 0 => int i; i < a.size(); i++ ) { i => a[i]; 1.0 => b[i]; }
+
+// in place: a = (a + b) * 0.5
+a.add( b );
+a.scale( .5 );
+<<< "a:", a[0], a[1], a[7] >>>;
+
+// into another array (resized to match)
+float out[0];
+a.interp( b, .25, out );
+<<< "interp:", out[0], out[7], "size:", out.size() >>>;
+
+// reductions
+<<< "sum:", a.sum(), "dot:", a.dot( b ), "min:", a.min(), "max:", a.max() >>>;
+
+// limit, and copy part of an array onto itself
+a.clamp( 1, 3 );
+a.copyRange( 0, 4, 4 );
+<<< "a:", a[0], a[4], a[7] >>>;
+
+// vec elements are processed per component
+vec3 pos[4]; vec3 vel[4];
+for( 0 => int i; i < pos.size(); i++ ) @( i, 0, -i ) => vel[i];
+// one step of motion
+vel.scale( .1, vel );
+pos.add( vel );
+<<< "pos[3]:", pos[3] >>>;
+
+// complex[] has the linear operations (add, scale, interp) and copyRange;
+// polar[] only copyRange
+complex z[2]; complex w[2];
+#( 1, 2 ) => z[0]; #( 0, 1 ) => w[0];
+z.add( w ); z.scale( 2 );
+<<< "z[0]:", z[0] >>>;
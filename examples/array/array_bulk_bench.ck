@@ -0,0 +1,43 @@
+// time a bulk array operation against the same loop in ChucK code
+//
+// usage (time each from the shell):
+//     chuck --silent array_bulk_bench.ck:loop
+//     chuck --silent array_bulk_bench.ck:bulk
+
+// which one to run
+"bulk" => string mode;
+if( me.args() ) me.arg(0) => mode;
+
+// buffers (same contents each run)
+Math.srandom( 1234 );
+4096 => int N;
+1000 => int ROUNDS;
+float a[N]; float b[N]; float out[N];
+for( 0 => int i; i < N; i++ ) { Math.random2f(-1,1) => a[i]; Math.random2f(-1,1) => b[i]; }
+
+0.0 => float acc;
+if( mode == "loop" )
+{
+    for( 0 => int r; r < ROUNDS; r++ )
+    {
+        // out = (a + b) * 0.5, limited to [-.5,.5]; then its dot with a
+        for( 0 => int i; i < N; i++ )
+            Math.max( -.5, Math.min( ( a[i] + b[i] ) * .5, .5 ) ) => out[i];
+        0.0 => float dot;
+        for( 0 => int i; i < N; i++ ) out[i] * a[i] +=> dot;
+        dot +=> acc;
+    }
+}
+else
+{
+    for( 0 => int r; r < ROUNDS; r++ )
+    {
+        // the same, in bulk
+        a.add( b, out );
+        out.scale( .5 );
+        out.clamp( -.5, .5 );
+        out.dot( a ) +=> acc;
+    }
+}
+
+<<< mode, "result:", acc >>>;
@@ -0,0 +1,31 @@
+// double-ended queues: IntDeque, FloatDeque, ObjectDeque
+// push and pop at either end take the same (short) time, however
+// many elements there are; compare with array popFront(), which
+// moves every element that remains
+
+// a FIFO of note numbers
+IntDeque notes;
+notes.pushBack( 60 ); notes.pushBack( 64 ); notes.pushBack( 67 );
+while( notes.size() ) <<< "next note:", notes.popFront() >>>;
+
+// a history of the last 4 values; when full, the oldest is dropped
+FloatDeque history;
+history.capacity( 4 );
+history.fixed( true );
+for( 1 => int i; i <= 6; i++ ) history.pushBack( i * .5 );
+<<< "oldest:", history.front(), "newest:", history.back(), "size:", history.size() >>>;
+// negative indices count from the back
+<<< "second newest:", history.get( -2 ) >>>;
+
+// preallocate, so nothing is allocated while the sound plays
+ObjectDeque events;
+events.capacity( 256 );
+SinOsc s => dac; .2 => s.gain;
+// events to play, in order
+for( 0 => int i; i < 4; i++ ) { Event e; events.pushBack( e ); }
+while( events.size() )
+{
+    events.popFront() $ Event @=> Event e;
+    Math.random2f( 300, 600 ) => s.freq;
+    200::ms => now;
+}
@@ -0,0 +1,33 @@
+// band-limited oscillators: as SawOsc, SqrOsc, TriOsc, PulseOsc,
+// but without aliasing -- listen to a sweep on each, naive then
+// band-limited; the naive ones fold high harmonics back down as
+// audible "birdies" moving against the sweep
+
+// patch
+Gain g => dac; .2 => g.gain;
+
+// pairs: naive, band-limited
+[ new SawOsc, new BLSawOsc,
+  new SqrOsc, new BLSqrOsc,
+  new TriOsc, new BLTriOsc,
+  new PulseOsc, new BLPulseOsc ] @=> Osc oscs[];
+[ "SawOsc", "BLSawOsc", "SqrOsc", "BLSqrOsc",
+  "TriOsc", "BLTriOsc", "PulseOsc", "BLPulseOsc" ] @=> string names[];
+
+for( 0 => int i; i < oscs.size(); i++ )
+{
+    // connect
+    oscs[i] => g;
+    // print
+    <<< "sweeping", names[i] >>>;
+    // sweep from 100 to 5000 Hz over 3 seconds
+    for( 0 => int t; t < 300; t++ )
+    {
+        Math.pow( 50, t / 300.0 ) * 100 => oscs[i].freq;
+        10::ms => now;
+    }
+    // disconnect
+    oscs[i] =< g;
+    // rest
+    200::ms => now;
+}
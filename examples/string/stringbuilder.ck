@@ -0,0 +1,21 @@
+// StringBuilder: build a string piece by piece, in place
+// each + on strings makes a new string; a builder appends to its
+// own storage, which is kept (and reused) across clear()
+
+// build a message
+StringBuilder sb;
+sb.append( "voice " ).append( 3 ).append( ": freq=" ).append( 440.0, 1 );
+<<< sb.toString() >>>;
+
+// an address, rebuilt every tick without new strings:
+// reserve ahead, clear, and copy into a string variable
+string address;
+sb.reserve( 64 );
+for( 0 => int i; i < 4; i++ )
+{
+    sb.clear();
+    sb.append( "/synth/" ).append( i ).appendChar( '/' ).append( "gain" );
+    sb.copyTo( address );
+    <<< address, sb.length() >>>;
+    10::ms => now;
+}
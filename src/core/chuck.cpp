@@ -48,6 +48,8 @@
 #include "chuck_errmsg.h"
 #include "chuck_io.h"
 #include "chuck_globals.h" // added 1.4.1.0
+#include "chuck_reclaim.h"
+#include "chuck_cycle.h"
 
 #ifndef __DISABLE_OTF_SERVER__
 #include "chuck_otf.h"
@@ -79,6 +81,13 @@
 #define CHUCK_PARAM_OUTPUT_CHANNELS_DEFAULT        "2"
 #define CHUCK_PARAM_VM_ADAPTIVE_DEFAULT            "0"
 #define CHUCK_PARAM_VM_HALT_DEFAULT                "0"
+#define CHUCK_PARAM_VM_DISPATCH_DEFAULT            "0"
+#define CHUCK_PARAM_VM_SHRED_POOL_DEFAULT          "128"
+#define CHUCK_PARAM_VM_RECLAIM_DEFAULT             "0"
+#define CHUCK_PARAM_VM_COLLECT_DEFAULT             "0"
+#define CHUCK_PARAM_VM_REPORT_REALLOC_DEFAULT      "0"
+#define CHUCK_PARAM_VM_POLL_DEFAULT                "1"
+#define CHUCK_PARAM_VM_THREADS_DEFAULT             "1"
 #define CHUCK_PARAM_OTF_ENABLE_DEFAULT             "0"
 #define CHUCK_PARAM_OTF_PORT_DEFAULT               "8888"
 #define CHUCK_PARAM_OTF_PRINT_WARNINGS_DEFAULT     "0"
@@ -100,6 +109,7 @@
 #define CHUCK_PARAM_USER_CHUGINS_DEFAULT        std::list<std::string>()
 #define CHUCK_PARAM_USER_CHUGIN_DIRECTORIES_DEFAULT std::list<std::string>()
 #define CHUCK_PARAM_COMPILER_HIGHLIGHT_ON_ERROR_DEFAULT "1"
+#define CHUCK_PARAM_COMPILER_OPTIMIZE_DEFAULT      "0"
 #define CHUCK_PARAM_TTY_COLOR_DEFAULT              "0"
 #define CHUCK_PARAM_TTY_WIDTH_HINT_DEFAULT         "80"
 
@@ -196,6 +206,13 @@ void ChucK::initDefaultParams()
     initParam( CHUCK_PARAM_OUTPUT_CHANNELS, CHUCK_PARAM_OUTPUT_CHANNELS_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_VM_ADAPTIVE, CHUCK_PARAM_VM_ADAPTIVE_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_VM_HALT, CHUCK_PARAM_VM_HALT_DEFAULT, ck_param_int );
+    initParam( CHUCK_PARAM_VM_DISPATCH, CHUCK_PARAM_VM_DISPATCH_DEFAULT, ck_param_int );
+    initParam( CHUCK_PARAM_VM_SHRED_POOL, CHUCK_PARAM_VM_SHRED_POOL_DEFAULT, ck_param_int );
+    initParam( CHUCK_PARAM_VM_RECLAIM, CHUCK_PARAM_VM_RECLAIM_DEFAULT, ck_param_int );
+    initParam( CHUCK_PARAM_VM_COLLECT, CHUCK_PARAM_VM_COLLECT_DEFAULT, ck_param_int );
+    initParam( CHUCK_PARAM_VM_REPORT_REALLOC, CHUCK_PARAM_VM_REPORT_REALLOC_DEFAULT, ck_param_int );
+    initParam( CHUCK_PARAM_VM_POLL, CHUCK_PARAM_VM_POLL_DEFAULT, ck_param_int );
+    initParam( CHUCK_PARAM_VM_THREADS, CHUCK_PARAM_VM_THREADS_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_OTF_ENABLE, CHUCK_PARAM_OTF_ENABLE_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_OTF_PORT, CHUCK_PARAM_OTF_PORT_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_OTF_PRINT_WARNINGS, CHUCK_PARAM_OTF_PRINT_WARNINGS_DEFAULT, ck_param_int );
@@ -207,6 +224,7 @@ void ChucK::initDefaultParams()
     initParam( CHUCK_PARAM_CHUGIN_ENABLE, CHUCK_PARAM_CHUGIN_ENABLE_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_IS_REALTIME_AUDIO_HINT, CHUCK_PARAM_IS_REALTIME_AUDIO_HINT_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_COMPILER_HIGHLIGHT_ON_ERROR, CHUCK_PARAM_COMPILER_HIGHLIGHT_ON_ERROR_DEFAULT, ck_param_int );
+    initParam( CHUCK_PARAM_COMPILER_OPTIMIZE, CHUCK_PARAM_COMPILER_OPTIMIZE_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_TTY_COLOR, CHUCK_PARAM_TTY_COLOR_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_TTY_WIDTH_HINT, CHUCK_PARAM_TTY_WIDTH_HINT_DEFAULT, ck_param_int );
 
@@ -283,6 +301,52 @@ void ChucK::enactParam( const std::string & name, t_CKINT value )
         // set default
         ck_ttywidth_setdefault( value );
     }
+    else if( matchParam(name,CHUCK_PARAM_VM_DISPATCH) )
+    {
+        // if VM already running, switch dispatch mode | 1.5.1.7
+        if( m_carrier && m_carrier->vm ) m_carrier->vm->set_dispatch( value );
+    }
+    else if( matchParam(name,CHUCK_PARAM_VM_SHRED_POOL) )
+    {
+        // if VM already running, resize its pool | 1.5.1.7
+        if( m_carrier && m_carrier->vm ) m_carrier->vm->set_shred_pool( value < 0 ? 0 : value );
+    }
+    else if( matchParam(name,CHUCK_PARAM_VM_RECLAIM) )
+    {
+        // if VM already running and deferring, change its budget; turning
+        // deferral on or off takes effect at VM init | 1.5.1.7
+        if( m_carrier && m_carrier->vm && m_carrier->vm->reclaimer() && value > 0 )
+            m_carrier->vm->reclaimer()->set_budget( value );
+    }
+    else if( matchParam(name,CHUCK_PARAM_VM_COLLECT) )
+    {
+        // if VM already running and collecting, change its budget; turning
+        // collection on or off takes effect at VM init | 1.5.1.7
+        if( m_carrier && m_carrier->vm && m_carrier->vm->collector() && value > 0 )
+            m_carrier->vm->collector()->set_budget( value );
+    }
+    else if( matchParam(name,CHUCK_PARAM_VM_REPORT_REALLOC) )
+    {
+        // report reallocations of array storage from now on | 1.5.1.7
+        if( m_carrier && m_carrier->vm ) m_carrier->vm->set_realloc_report( value != 0 );
+    }
+    else if( matchParam(name,CHUCK_PARAM_VM_POLL) )
+    {
+        // if VM already running, change how often it takes in queued
+        // msgs, global requests, and event broadcasts | 1.5.1.7
+        if( m_carrier && m_carrier->vm ) m_carrier->vm->set_poll( value < 0 ? 0 : value );
+    }
+    else if( matchParam(name,CHUCK_PARAM_VM_THREADS) )
+    {
+        // if VM already running, change how many threads tick the ugen
+        // graph, from the next block | 1.5.1.7
+        if( m_carrier && m_carrier->vm ) m_carrier->vm->set_threads( value < 1 ? 1 : value );
+    }
+    else if( matchParam(name,CHUCK_PARAM_COMPILER_OPTIMIZE) )
+    {
+        // applies to subsequent compilations | 1.5.1.7
+        if( m_carrier && m_carrier->compiler ) m_carrier->compiler->set_optimize_level( value );
+    }
 }
 
 
@@ -532,6 +596,13 @@ t_CKBOOL ChucK::initVM()
     t_CKUINT ins = getParamInt( CHUCK_PARAM_INPUT_CHANNELS );
     t_CKUINT adaptiveSize = getParamInt( CHUCK_PARAM_VM_ADAPTIVE );
     t_CKBOOL halt = getParamInt( CHUCK_PARAM_VM_HALT ) != 0;
+    t_CKUINT dispatch = getParamInt( CHUCK_PARAM_VM_DISPATCH );
+    t_CKINT shredPool = getParamInt( CHUCK_PARAM_VM_SHRED_POOL );
+    t_CKINT reclaim = getParamInt( CHUCK_PARAM_VM_RECLAIM );
+    t_CKINT collect = getParamInt( CHUCK_PARAM_VM_COLLECT );
+    t_CKBOOL reportRealloc = getParamInt( CHUCK_PARAM_VM_REPORT_REALLOC ) != 0;
+    t_CKINT poll = getParamInt( CHUCK_PARAM_VM_POLL );
+    t_CKINT threads = getParamInt( CHUCK_PARAM_VM_THREADS );
 
     // instantiate VM
     m_carrier->vm = new Chuck_VM();
@@ -545,6 +616,20 @@ t_CKBOOL ChucK::initVM()
         EM_error2( 0, "%s", m_carrier->vm->last_error() );
         return false;
     }
+    // set instruction dispatch mode | 1.5.1.7
+    m_carrier->vm->set_dispatch( dispatch );
+    // set how many finished shreds to keep for reuse | 1.5.1.7
+    m_carrier->vm->set_shred_pool( shredPool < 0 ? 0 : shredPool );
+    // set how many released objects to delete per block, if deferred | 1.5.1.7
+    m_carrier->vm->set_reclaim( reclaim < 0 ? 0 : reclaim );
+    // set how many objects to scan per block for reference cycles | 1.5.1.7
+    m_carrier->vm->set_collect( collect < 0 ? 0 : collect );
+    // whether to print each reallocation of array storage | 1.5.1.7
+    m_carrier->vm->set_realloc_report( reportRealloc );
+    // how often to take in what other threads queued (0: once per block) | 1.5.1.7
+    m_carrier->vm->set_poll( poll < 0 ? 0 : poll );
+    // how many threads tick the ugen graph, in blocks (adaptive) | 1.5.1.7
+    m_carrier->vm->set_threads( threads < 1 ? 1 : threads );
 
     return true;
 }
@@ -562,6 +647,7 @@ t_CKBOOL ChucK::initCompiler()
     t_CKBOOL dump = getParamInt( CHUCK_PARAM_DUMP_INSTRUCTIONS ) != 0;
     t_CKBOOL auto_depend = getParamInt( CHUCK_PARAM_AUTO_DEPEND ) != 0;
     t_CKUINT deprecate = getParamInt( CHUCK_PARAM_DEPRECATE_LEVEL );
+    t_CKUINT optimize = getParamInt( CHUCK_PARAM_COMPILER_OPTIMIZE );
     std::string workingDir = getParamString( CHUCK_PARAM_WORKING_DIRECTORY );
 
     // log
@@ -584,6 +670,8 @@ t_CKBOOL ChucK::initCompiler()
     m_carrier->compiler->emitter->dump = dump;
     // set auto depend flag (for type checker) | currently must be FALSE
     m_carrier->compiler->set_auto_depend( auto_depend );
+    // set AST optimization level | 1.5.1.7
+    m_carrier->compiler->set_optimize_level( optimize );
     // set deprecation level
     m_carrier->env->deprecate_level = deprecate;
 
@@ -985,6 +1073,12 @@ t_CKBOOL ChucK::shutdown()
         {
             ck_usleep(1000);
         }
+
+        // free unreachable cycles, then delete deferred objects now and
+        // the rest right away, while the compiler and type system are
+        // still around | 1.5.1.7
+        m_carrier->vm->set_collect( 0 );
+        m_carrier->vm->set_reclaim( 0 );
     }
 
     // free vm, compiler, friends
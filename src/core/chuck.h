@@ -83,6 +83,13 @@
 #define CHUCK_PARAM_OUTPUT_CHANNELS             "OUTPUT_CHANNELS"
 #define CHUCK_PARAM_VM_ADAPTIVE                 "VM_ADAPTIVE"
 #define CHUCK_PARAM_VM_HALT                     "VM_HALT"
+#define CHUCK_PARAM_VM_DISPATCH                 "VM_DISPATCH"
+#define CHUCK_PARAM_VM_SHRED_POOL               "VM_SHRED_POOL"
+#define CHUCK_PARAM_VM_RECLAIM                  "VM_RECLAIM"
+#define CHUCK_PARAM_VM_COLLECT                  "VM_COLLECT"
+#define CHUCK_PARAM_VM_REPORT_REALLOC           "VM_REPORT_REALLOC"
+#define CHUCK_PARAM_VM_POLL                     "VM_POLL"
+#define CHUCK_PARAM_VM_THREADS                  "VM_THREADS"
 #define CHUCK_PARAM_OTF_ENABLE                  "OTF_ENABLE"
 #define CHUCK_PARAM_OTF_PORT                    "OTF_PORT"
 #define CHUCK_PARAM_OTF_PRINT_WARNINGS          "OTF_PRINT_WARNINGS"
@@ -96,6 +103,7 @@
 #define CHUCK_PARAM_USER_CHUGIN_DIRECTORIES     "USER_CHUGIN_DIRECTORIES"
 #define CHUCK_PARAM_IS_REALTIME_AUDIO_HINT      "IS_REALTIME_AUDIO_HINT"
 #define CHUCK_PARAM_COMPILER_HIGHLIGHT_ON_ERROR "COMPILER_HIGHLIGHT_ON_ERROR"
+#define CHUCK_PARAM_COMPILER_OPTIMIZE           "COMPILER_OPTIMIZE"
 #define CHUCK_PARAM_TTY_COLOR                   "TTY_COLOR"
 #define CHUCK_PARAM_TTY_WIDTH_HINT              "TTY_WIDTH_HINT"
 
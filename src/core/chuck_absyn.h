@@ -263,6 +263,8 @@ void delete_stmt_from_label( a_Stmt stmt );
 
 // delete an exp
 void delete_exp( a_Exp exp );
+// delete what an exp points to, but not the exp itself | 1.5.1.7
+void delete_exp_contents( a_Exp e );
 void delete_exp_from_binary( a_Exp e );
 void delete_exp_from_unary( a_Exp e );
 void delete_exp_from_cast( a_Exp e );
@@ -303,7 +305,8 @@ struct a_Exp_Unary_ { ae_Operator op; a_Exp exp; a_Type_Decl type; a_Array_Sub a
                       a_Stmt code; t_CKFUNC ck_overload_func; uint32_t line; uint32_t where; a_Exp self; };
 struct a_Exp_Postfix_ { a_Exp exp; ae_Operator op; t_CKFUNC ck_overload_func; uint32_t line; uint32_t where; a_Exp self; };
 struct a_Exp_Dur_ { a_Exp base; a_Exp unit; uint32_t line; uint32_t where; a_Exp self; };
-struct a_Exp_Array_ { a_Exp base; a_Array_Sub indices; uint32_t line; uint32_t where; a_Exp self; };
+// 1.5.1.7 added unchecked; index proven in range by the optimizer
+struct a_Exp_Array_ { a_Exp base; a_Array_Sub indices; int unchecked; uint32_t line; uint32_t where; a_Exp self; };
 struct a_Exp_Func_Call_ { a_Exp func; a_Exp args; t_CKTYPE ret_type;
                           t_CKFUNC ck_func; t_CKVMCODE ck_vm_code; uint32_t line; uint32_t where; a_Exp self; };
 struct a_Exp_Dot_Member_ { a_Exp base; t_CKTYPE t_base; S_Symbol xid; uint32_t line; uint32_t where; a_Exp self; };
@@ -411,6 +414,8 @@ struct a_Stmt_Code_
     a_Stmt_List stmt_list;
     // used to track control paths in non-void functions
     t_CKBOOL allControlPathsReturn; // 1.5.1.0 (ge) added
+    // emit in its own scope (e.g., a branch kept by the optimizer) | 1.5.1.7
+    t_CKBOOL scoped;
     // code position
     uint32_t line; uint32_t where; a_Stmt self;
 };
@@ -96,6 +96,8 @@ Chuck_Compiler::Chuck_Compiler()
     m_carrier = NULL;
     // initialize
     m_auto_depend = FALSE;
+    // AST optimizations | 1.5.1.7
+    m_optimize_level = CK_OPTIMIZE_NONE;
 
     // origin hint | 1.5.0.0 (ge) added
     m_originHint = te_originUnknown;
@@ -283,6 +285,22 @@ void Chuck_Compiler::set_auto_depend( t_CKBOOL v )
 
 
 
+//-----------------------------------------------------------------------------
+// name: set_optimize_level()
+// desc: AST optimization level, applied between type-check and emit
+//-----------------------------------------------------------------------------
+void Chuck_Compiler::set_optimize_level( t_CKUINT level )
+{
+    // clamp
+    if( level > CK_OPTIMIZE_FULL ) level = CK_OPTIMIZE_FULL;
+    // log
+    EM_log( CK_LOG_SYSTEM, "compiler optimization level: %lu", level );
+    m_optimize_level = level;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: go()
 // desc: parse, type-check, and emit a program
@@ -395,6 +413,10 @@ t_CKBOOL Chuck_Compiler::do_entire_file( Chuck_Context * context )
     if( !type_engine_check_context( env(), context, te_do_all ) )
         return FALSE;
 
+    // optimize (pass 3.5)
+    if( !do_optimize( te_do_all ) )
+        return FALSE;
+
     // emit (pass 4)
     if( !emit_engine_emit_prog( emitter, g_program ) )
         return FALSE;
@@ -430,6 +452,10 @@ t_CKBOOL Chuck_Compiler::do_only_classes( Chuck_Context * context )
     if( !type_engine_check_context( env(), context, te_do_classes_only ) )
         return FALSE;
 
+    // optimize (pass 3.5)
+    if( !do_optimize( te_do_classes_only ) )
+        return FALSE;
+
     // emit (pass 4)
     code = emit_engine_emit_prog( emitter, g_program , te_do_classes_only );
     if( !code ) return FALSE;
@@ -463,6 +489,10 @@ t_CKBOOL Chuck_Compiler::do_all_except_classes( Chuck_Context * context )
     if( !type_engine_check_context( env(), context, te_do_no_classes ) )
         return FALSE;
 
+    // optimize (pass 3.5)
+    if( !do_optimize( te_do_no_classes ) )
+        return FALSE;
+
     // emit (pass 4)
     code = emit_engine_emit_prog( emitter, g_program, te_do_no_classes );
     if( !code ) return FALSE;
@@ -476,6 +506,19 @@ t_CKBOOL Chuck_Compiler::do_all_except_classes( Chuck_Context * context )
 
 
 
+//-----------------------------------------------------------------------------
+// name: do_optimize()
+// desc: optimize the type-checked program before it is emitted | 1.5.1.7
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_Compiler::do_optimize( te_HowMuch how_much )
+{
+    // at the configured level (may be CK_OPTIMIZE_NONE)
+    return optimize_engine_optimize_prog( env(), g_program, m_optimize_level, how_much );
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: do_normal_depend()
 // desc: compile normally without auto-depend
@@ -525,6 +568,10 @@ t_CKBOOL Chuck_Compiler::do_normal_depend( const string & filename,
     if( !type_engine_check_context( env(), context, te_do_all ) )
     { ret = FALSE; goto cleanup; }
 
+    // optimize (pass 3.5)
+    if( !do_optimize( te_do_all ) )
+    { ret = FALSE; goto cleanup; }
+
     // emit (pass 4)
     code = emit_engine_emit_prog( emitter, g_program, te_do_all );
     if( !code ) { ret = FALSE; goto cleanup; }
@@ -37,6 +37,7 @@
 #include "chuck_scan.h"
 #include "chuck_type.h"
 #include "chuck_emit.h"
+#include "chuck_optimize.h"
 #include "chuck_vm.h"
 #include <list>
 
@@ -75,6 +76,8 @@ public: // data
 
     // auto-depend flag
     t_CKBOOL m_auto_depend;
+    // AST optimization level (see CK_OPTIMIZE_*) | 1.5.1.7
+    t_CKUINT m_optimize_level;
     // recent map
     std::map<std::string, Chuck_Context *> m_recent;
 
@@ -106,6 +109,8 @@ public: // additional binding
 public: // compile
     // set auto depend
     void set_auto_depend( t_CKBOOL v );
+    // set AST optimization level (see CK_OPTIMIZE_*) | 1.5.1.7
+    void set_optimize_level( t_CKUINT level );
     // parse, type-check, and emit a program
     t_CKBOOL go( const std::string & filename,
                  const std::string & full_path = "",
@@ -157,6 +162,8 @@ protected: // internal
     t_CKBOOL do_only_classes( Chuck_Context * context );
     // do all excect classes
     t_CKBOOL do_all_except_classes( Chuck_Context * context );
+    // optimize type-checked AST, as configured
+    t_CKBOOL do_optimize( te_HowMuch how_much );
     // do normal compile
     t_CKBOOL do_normal_depend( const std::string & path,
                                const std::string & codeLiteral = "",
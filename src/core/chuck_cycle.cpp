@@ -0,0 +1,380 @@
+/*----------------------------------------------------------------------------
+  ChucK Concurrent, On-the-fly Audio Programming Language
+    Compiler and Virtual Machine
+
+  Copyright (c) 2004 Ge Wang and Perry R. Cook.  All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+  U.S.A.
+-----------------------------------------------------------------------------*/
+
+
+
+//-----------------------------------------------------------------------------
+// file: chuck_cycle.cpp
+// desc: cycle collection of VM objects
+//-----------------------------------------------------------------------------
+#include "chuck_cycle.h"
+#include "chuck_oo.h"
+#include "chuck_type.h"
+#include <chrono>
+using namespace std;
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: Chuck_VM_Cycle_Collector()
+// desc: constructor
+//-----------------------------------------------------------------------------
+Chuck_VM_Cycle_Collector::Chuck_VM_Cycle_Collector( t_CKUINT budget )
+{
+    m_freeing = FALSE;
+    set_budget( budget );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ~Chuck_VM_Cycle_Collector()
+// desc: destructor
+//-----------------------------------------------------------------------------
+Chuck_VM_Cycle_Collector::~Chuck_VM_Cycle_Collector()
+{
+    #ifndef __DISABLE_THREADS__
+    m_lock.acquire();
+    #endif
+    // no longer candidates
+    for( unordered_set<Chuck_Object *>::iterator it = m_candidates.begin();
+         it != m_candidates.end(); it++ )
+        (*it)->m_cycle_candidate = FALSE;
+    m_candidates.clear();
+    #ifndef __DISABLE_THREADS__
+    m_lock.release();
+    #endif
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: scannable()
+// desc: whether an object's references are known to the collector: an
+//       array of objects, or an instance of a class with object members
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_VM_Cycle_Collector::scannable( Chuck_Object * obj )
+{
+    Chuck_Type * type = obj->type_ref;
+    if( !type ) return FALSE;
+    // array
+    if( type->xid == te_array ) return ((Chuck_Array *)obj)->contains_objects();
+    // object members, in this class or a parent
+    for( ; type != NULL; type = type->parent )
+        if( type->obj_mvars().size() ) return TRUE;
+
+    return FALSE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: children()
+// desc: get object references held by an object (appended to `out`)
+//-----------------------------------------------------------------------------
+void Chuck_VM_Cycle_Collector::children( Chuck_Object * obj, vector<Chuck_Object *> & out )
+{
+    Chuck_Type * type = obj->type_ref;
+
+    // array of objects (see scannable())
+    if( type->xid == te_array )
+    {
+        Chuck_ArrayInt * array = (Chuck_ArrayInt *)obj;
+        for( t_CKUINT i = 0; i < array->m_vector.size(); i++ )
+            if( array->m_vector[i] ) out.push_back( (Chuck_Object *)array->m_vector[i] );
+        for( Chuck_Map<t_CKUINT>::iterator it = array->m_map.begin(); it != array->m_map.end(); it++ )
+            if( it->second ) out.push_back( (Chuck_Object *)it->second );
+        return;
+    }
+
+    // object members
+    if( !obj->data ) return;
+    for( ; type != NULL; type = type->parent )
+    {
+        const vector<t_CKUINT> & offsets = type->obj_mvars();
+        for( t_CKUINT i = 0; i < offsets.size(); i++ )
+        {
+            Chuck_Object * child = *(Chuck_Object **)(obj->data + offsets[i]);
+            if( child ) out.push_back( child );
+        }
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: unlink()
+// desc: let go of object references held by an object
+//-----------------------------------------------------------------------------
+void Chuck_VM_Cycle_Collector::unlink( Chuck_Object * obj )
+{
+    Chuck_Type * type = obj->type_ref;
+
+    // array of objects: empty it
+    if( type->xid == te_array )
+    {
+        Chuck_ArrayInt * array = (Chuck_ArrayInt *)obj;
+        vector<t_CKUINT> values;
+        Chuck_Map<t_CKUINT> entries;
+        values.swap( array->m_vector );
+        entries.swap( array->m_map );
+        for( t_CKUINT i = 0; i < values.size(); i++ )
+            if( values[i] ) ((Chuck_Object *)values[i])->release();
+        for( Chuck_Map<t_CKUINT>::iterator it = entries.begin(); it != entries.end(); it++ )
+            if( it->second ) ((Chuck_Object *)it->second)->release();
+        return;
+    }
+
+    // object members: null out, then release
+    if( !obj->data ) return;
+    for( ; type != NULL; type = type->parent )
+    {
+        const vector<t_CKUINT> & offsets = type->obj_mvars();
+        for( t_CKUINT i = 0; i < offsets.size(); i++ )
+        {
+            Chuck_Object ** slot = (Chuck_Object **)(obj->data + offsets[i]);
+            Chuck_Object * child = *slot;
+            *slot = NULL;
+            if( child ) child->release();
+        }
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: candidate()
+// desc: note an object whose reference count is about to drop, but not to 0
+//-----------------------------------------------------------------------------
+void Chuck_VM_Cycle_Collector::candidate( Chuck_Object * obj )
+{
+    // already noted, or can't be part of a cycle we can see
+    if( obj->m_cycle_candidate || m_freeing || !scannable( obj ) ) return;
+
+    #ifndef __DISABLE_THREADS__
+    m_lock.acquire();
+    #endif
+    obj->m_cycle_candidate = TRUE;
+    m_candidates.insert( obj );
+    m_stats.candidates++;
+    #ifndef __DISABLE_THREADS__
+    m_lock.release();
+    #endif
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: forget()
+// desc: forget an object being deleted
+//-----------------------------------------------------------------------------
+void Chuck_VM_Cycle_Collector::forget( Chuck_Object * obj )
+{
+    #ifndef __DISABLE_THREADS__
+    m_lock.acquire();
+    #endif
+    obj->m_cycle_candidate = FALSE;
+    m_candidates.erase( obj );
+    #ifndef __DISABLE_THREADS__
+    m_lock.release();
+    #endif
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: take()
+// desc: take a candidate out of the buffer; FALSE if none
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_VM_Cycle_Collector::take( Chuck_Object * & obj )
+{
+    t_CKBOOL found = FALSE;
+
+    #ifndef __DISABLE_THREADS__
+    m_lock.acquire();
+    #endif
+    if( m_candidates.size() )
+    {
+        obj = *m_candidates.begin();
+        obj->m_cycle_candidate = FALSE;
+        m_candidates.erase( m_candidates.begin() );
+        found = TRUE;
+    }
+    #ifndef __DISABLE_THREADS__
+    m_lock.release();
+    #endif
+
+    return found;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: collect()
+// desc: look for cycles from candidates, until about `max` objects have
+//       been scanned (0: the budget)
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_VM_Cycle_Collector::collect( t_CKUINT max )
+{
+    // nothing to do
+    if( m_candidates.empty() ) return 0;
+    // how many this time
+    if( !max ) max = m_budget;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    t_CKUINT scanned = m_stats.scanned;
+    t_CKUINT freed = 0;
+    Chuck_Object * root = NULL;
+
+    // one candidate at a time
+    while( m_stats.scanned - scanned < max && take( root ) )
+        freed += collect_from( root );
+
+    // update
+    t_CKFLOAT elapsed = chrono::duration<t_CKFLOAT>( chrono::steady_clock::now() - start ).count();
+    m_stats.time_total += elapsed;
+    if( elapsed > m_stats.time_max ) m_stats.time_max = elapsed;
+    m_stats.slices++;
+
+    return freed;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: collect_all()
+// desc: look for cycles from all candidates, including those noted meanwhile
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_VM_Cycle_Collector::collect_all()
+{
+    t_CKUINT freed = 0;
+    while( !m_candidates.empty() ) freed += collect( (t_CKUINT)-1 );
+    return freed;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: visit()
+// desc: add object to the subgraph being scanned; returns its index
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_VM_Cycle_Collector::visit( Chuck_Object * obj )
+{
+    unordered_map<Chuck_Object *, t_CKUINT>::iterator it = m_index.find( obj );
+    if( it != m_index.end() ) return it->second;
+
+    Node node;
+    node.obj = obj;
+    node.trial = (t_CKINT)obj->m_ref_count;
+    node.edge_first = node.edge_count = 0;
+    node.live = FALSE;
+    m_index[obj] = m_nodes.size();
+    m_nodes.push_back( node );
+
+    return m_nodes.size() - 1;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: collect_from()
+// desc: look for garbage reachable from one candidate; returns number freed
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_VM_Cycle_Collector::collect_from( Chuck_Object * root )
+{
+    // deleted (or waiting to be), or no longer a possible cycle member
+    if( root->m_ref_count == 0 || !scannable( root ) ) return 0;
+
+    m_nodes.clear(); m_edges.clear(); m_index.clear();
+    visit( root );
+
+    // the subgraph reachable from root, through objects we can scan;
+    // subtract references from within it
+    for( t_CKUINT i = 0; i < m_nodes.size(); i++ )
+    {
+        m_children.clear();
+        children( m_nodes[i].obj, m_children );
+        m_nodes[i].edge_first = m_edges.size();
+        for( t_CKUINT j = 0; j < m_children.size(); j++ )
+        {
+            Chuck_Object * child = m_children[j];
+            // deleted soon, or holds references we can't see
+            if( child->m_ref_count == 0 || !scannable( child ) ) continue;
+            // too big; assume alive
+            if( m_nodes.size() >= CK_CYCLE_SCAN_MAX ) { m_stats.scanned += m_nodes.size(); return 0; }
+            t_CKUINT c = visit( child );
+            m_nodes[c].trial--;
+            m_edges.push_back( c );
+        }
+        m_nodes[i].edge_count = m_edges.size() - m_nodes[i].edge_first;
+    }
+    m_stats.scanned += m_nodes.size();
+
+    // objects referred to from outside, and everything they reach, are alive
+    m_stack.clear();
+    for( t_CKUINT i = 0; i < m_nodes.size(); i++ )
+        if( m_nodes[i].trial > 0 ) { m_nodes[i].live = TRUE; m_stack.push_back( i ); }
+    while( m_stack.size() )
+    {
+        Node & node = m_nodes[m_stack.back()];
+        m_stack.pop_back();
+        for( t_CKUINT e = node.edge_first; e < node.edge_first + node.edge_count; e++ )
+        {
+            Node & child = m_nodes[m_edges[e]];
+            if( !child.live ) { child.live = TRUE; m_stack.push_back( m_edges[e] ); }
+        }
+    }
+
+    // the rest only refer to each other
+    m_garbage.clear();
+    for( t_CKUINT i = 0; i < m_nodes.size(); i++ )
+        if( !m_nodes[i].live ) m_garbage.push_back( m_nodes[i].obj );
+    if( m_garbage.empty() ) return 0;
+
+    // hold on to them, while each lets go of what it refers to...
+    m_freeing = TRUE;
+    for( t_CKUINT i = 0; i < m_garbage.size(); i++ ) m_garbage[i]->add_ref();
+    for( t_CKUINT i = 0; i < m_garbage.size(); i++ ) unlink( m_garbage[i] );
+    m_freeing = FALSE;
+    // ...then let go of them
+    for( t_CKUINT i = 0; i < m_garbage.size(); i++ ) m_garbage[i]->release();
+
+    // update
+    m_stats.cycles++;
+    m_stats.freed += m_garbage.size();
+
+    return m_garbage.size();
+}
@@ -0,0 +1,184 @@
+/*----------------------------------------------------------------------------
+  ChucK Concurrent, On-the-fly Audio Programming Language
+    Compiler and Virtual Machine
+
+  Copyright (c) 2004 Ge Wang and Perry R. Cook.  All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+  U.S.A.
+-----------------------------------------------------------------------------*/
+
+
+
+//-----------------------------------------------------------------------------
+// file: chuck_cycle.h
+// desc: cycle collection of VM objects
+//
+//       reference counting never frees objects that refer to each other,
+//       e.g., a doubly-linked list of voices, or a child that points back
+//       to its parent; when enabled, every object released to a non-zero
+//       reference count that could be part of such a cycle (an instance of
+//       a class with object members, or an array of objects) is noted as a
+//       candidate by the VM it came from (Chuck_Object::originVM()), and
+//       that VM looks for garbage from a bounded number of them between
+//       blocks (trial deletion: for the objects reachable from a
+//       candidate, references from within that subgraph are subtracted;
+//       objects left with no references from outside it, and not reachable
+//       from one that has, can only be referred to by each other, and are
+//       freed); references the collector doesn't see (e.g., from native
+//       objects or shred stacks) only ever keep objects alive
+//-----------------------------------------------------------------------------
+#ifndef __CHUCK_CYCLE_H__
+#define __CHUCK_CYCLE_H__
+
+#include "chuck_def.h"
+#ifndef __DISABLE_THREADS__
+#include "util_thread.h"
+#endif
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+
+// default number of objects scanned per block
+#define CK_CYCLE_BUDGET              256
+// most objects scanned from one candidate; larger subgraphs are assumed
+// to be alive (until the candidate is released again)
+#define CK_CYCLE_SCAN_MAX            (0x1 << 16)
+
+
+// forward reference
+struct Chuck_Object;
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_VM_Cycle_Stats
+// desc: what the cycle collector has done so far
+//-----------------------------------------------------------------------------
+struct Chuck_VM_Cycle_Stats
+{
+    // objects noted as possible members of a cycle
+    t_CKUINT candidates;
+    // objects visited while looking for cycles
+    t_CKUINT scanned;
+    // unreachable groups of objects found, and objects in them
+    t_CKUINT cycles;
+    t_CKUINT freed;
+    // number of collect() calls that had work to do
+    t_CKUINT slices;
+    // time spent, in seconds: total and longest slice
+    t_CKFLOAT time_total;
+    t_CKFLOAT time_max;
+
+    // constructor
+    Chuck_VM_Cycle_Stats() : candidates(0), scanned(0), cycles(0), freed(0),
+        slices(0), time_total(0), time_max(0) { }
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_VM_Cycle_Collector
+// desc: candidate buffer and trial-deletion collector; any thread may note
+//       or forget candidates, but only one (the VM's) may collect()
+//-----------------------------------------------------------------------------
+struct Chuck_VM_Cycle_Collector
+{
+public:
+    // constructor
+    Chuck_VM_Cycle_Collector( t_CKUINT budget = CK_CYCLE_BUDGET );
+    // destructor; forgets remaining candidates (without collecting)
+    ~Chuck_VM_Cycle_Collector();
+
+public:
+    // note an object whose reference count is about to drop, but not to 0
+    void candidate( Chuck_Object * obj );
+    // forget an object being deleted
+    void forget( Chuck_Object * obj );
+    // look for cycles from candidates, until about `max` objects have been
+    // scanned (0: the budget); returns number of objects freed
+    t_CKUINT collect( t_CKUINT max = 0 );
+    // look for cycles from all candidates
+    t_CKUINT collect_all();
+
+public:
+    // whether an object's references are known to the collector
+    static t_CKBOOL scannable( Chuck_Object * obj );
+
+public:
+    // set/get the number of objects scanned per collect()
+    void set_budget( t_CKUINT budget ) { m_budget = budget ? budget : 1; }
+    t_CKUINT budget() const { return m_budget; }
+    // get stats
+    const Chuck_VM_Cycle_Stats & stats() const { return m_stats; }
+    // candidates waiting right now
+    t_CKUINT pending() const { return m_candidates.size(); }
+
+protected:
+    // look for garbage reachable from one candidate; returns number freed
+    t_CKUINT collect_from( Chuck_Object * root );
+    // add object to the subgraph being scanned; returns its index
+    t_CKUINT visit( Chuck_Object * obj );
+    // get object references held by an object
+    static void children( Chuck_Object * obj, std::vector<Chuck_Object *> & out );
+    // let go of object references held by an object
+    static void unlink( Chuck_Object * obj );
+    // take a candidate out of the buffer; FALSE if none
+    t_CKBOOL take( Chuck_Object * & obj );
+
+protected:
+    // an object in the subgraph being scanned
+    struct Node
+    {
+        Chuck_Object * obj;
+        // reference count, less references from within the subgraph
+        t_CKINT trial;
+        // references from this object to others in the subgraph
+        t_CKUINT edge_first;
+        t_CKUINT edge_count;
+        // reachable from outside the subgraph
+        t_CKBOOL live;
+    };
+    std::vector<Node> m_nodes;
+    std::vector<t_CKUINT> m_edges;
+    std::unordered_map<Chuck_Object *, t_CKUINT> m_index;
+    // scratch
+    std::vector<Chuck_Object *> m_children;
+    std::vector<t_CKUINT> m_stack;
+    std::vector<Chuck_Object *> m_garbage;
+
+    // possible members of a cycle
+    std::unordered_set<Chuck_Object *> m_candidates;
+    #ifndef __DISABLE_THREADS__
+    XMutex m_lock;
+    #endif
+    // TRUE while freeing garbage (candidates aren't noted)
+    t_CKBOOL m_freeing;
+
+    // objects scanned per collect()
+    t_CKUINT m_budget;
+    // stats
+    Chuck_VM_Cycle_Stats m_stats;
+};
+
+
+
+
+#endif
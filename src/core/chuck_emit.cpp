@@ -106,6 +106,8 @@ t_CKBOOL emit_engine_emit_symbol( Chuck_Emitter * emit, S_Symbol symbol,
                                   t_CKUINT line, t_CKUINT where );
 // disabled until further notice (added 1.3.0.0)
 // t_CKBOOL emit_engine_emit_spork( Chuck_Emitter * emit, a_Stmt stmt );
+// superinstruction fusion pass (added 1.5.1.7)
+t_CKUINT emit_engine_fuse( Chuck_Code * code );
 
 
 
@@ -314,13 +316,19 @@ Chuck_VM_Code * emit_to_code( Chuck_Code * in,
                               Chuck_VM_Code * out,
                               t_CKBOOL dump )
 {
+    // fuse common instruction sequences, until nothing more fuses,
+    // since fusing can expose new sequences | 1.5.1.7 (added)
+    t_CKUINT num_fused = 0, fused = 0;
+    while( (fused = emit_engine_fuse( in )) ) num_fused += fused;
     // log
-    EM_log( CK_LOG_FINER, "emitting: %d VM instructions...",
-            in->code.size() );
+    EM_log( CK_LOG_FINER, "emitting: %d VM instructions (%lu fused away)...",
+            in->code.size(), num_fused );
     // allocate the vm code
     Chuck_VM_Code * code = out ? out : new Chuck_VM_Code;
     // make sure
     assert( code->num_instr == 0 );
+    // number of instructions eliminated by fusion
+    code->num_fused = num_fused;
     // size
     code->num_instr = in->code.size();
     // allocate instruction pointers+
@@ -335,11 +343,22 @@ Chuck_VM_Code * emit_to_code( Chuck_Code * in,
     code->name = in->name;
     // set filename for me.sourceDir() (added 1.3.0.0)
     code->filename = in->filename;
+    // string literals, now the VM code's | 1.5.1.7
+    for( std::map<std::string, Chuck_String **>::iterator it = in->literals.begin(); it != in->literals.end(); it++ )
+        code->literals.push_back( it->second );
+    in->literals.clear();
 
     // copy
     for( t_CKUINT i = 0; i < code->num_instr; i++ )
         code->instr[i] = in->code[i];
 
+    // local variable high water mark | 1.5.1.7 (added)
+    code->mem_depth = in->frame ? in->frame->max_offset : 0;
+    // statically verify stack use; verified code skips per-instruction checks
+    if( code->verify() )
+        EM_log( CK_LOG_FINER, "stack verified (operand: %lu bytes, locals: %lu bytes)",
+                code->reg_depth, code->mem_depth );
+
     // dump
     if( dump )
     {
@@ -378,7 +397,14 @@ Chuck_VM_Code * emit_to_code( Chuck_Code * in,
                 }
             }
         }
-        EM_print2vanilla( "-------\n" );
+        EM_print2vanilla( "-------" );
+        // how many instructions fusion eliminated | 1.5.1.7 (added)
+        // stack use, if verified | 1.5.1.7 (added)
+        if( code->stack_verified )
+            EM_print2vanilla( "(stack verified: %lu bytes operand, %lu bytes locals)",
+                              code->reg_depth, code->mem_depth );
+        EM_print2vanilla( "(%lu instructions, %lu eliminated by fusion)\n",
+                          code->num_instr, code->num_fused );
     }
 
     return code;
@@ -387,6 +413,256 @@ Chuck_VM_Code * emit_to_code( Chuck_Code * in,
 
 
 
+//-----------------------------------------------------------------------------
+// name: emit_engine_fuse_get_jmp()
+// desc: if instr holds an absolute jump target, get it
+//-----------------------------------------------------------------------------
+static t_CKBOOL emit_engine_fuse_get_jmp( Chuck_Instr * instr, t_CKUINT & jmp )
+{
+    Chuck_Instr_Branch_Op * branch = NULL;
+    Chuck_Instr_Unary_Op * unary = NULL;
+
+    // branches and gotos
+    if( (branch = dynamic_cast<Chuck_Instr_Branch_Op *>(instr)) )
+    { jmp = branch->get(); return TRUE; }
+    // array pre-constructor loop keeps its target as operand
+    if( dynamic_cast<Chuck_Instr_Pre_Ctor_Array_Top *>(instr) ||
+        dynamic_cast<Chuck_Instr_Pre_Ctor_Array_Bottom *>(instr) )
+    { unary = (Chuck_Instr_Unary_Op *)instr; jmp = unary->get(); return TRUE; }
+
+    return FALSE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: emit_engine_fuse_set_jmp()
+// desc: set absolute jump target on an instr for which get_jmp() succeeded
+//-----------------------------------------------------------------------------
+static void emit_engine_fuse_set_jmp( Chuck_Instr * instr, t_CKUINT jmp )
+{
+    Chuck_Instr_Branch_Op * branch = NULL;
+
+    if( (branch = dynamic_cast<Chuck_Instr_Branch_Op *>(instr)) )
+        branch->set( jmp );
+    else
+        ((Chuck_Instr_Unary_Op *)instr)->set( jmp );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: emit_engine_fuse_compare()
+// desc: make a single branch from compare + push 0 + Branch_Eq/Neq_int;
+//       branch_if_true is TRUE for Branch_Neq_int (compare result != 0)
+//-----------------------------------------------------------------------------
+static Chuck_Instr * emit_engine_fuse_compare( Chuck_Instr * cmp, t_CKBOOL branch_if_true )
+{
+    // int: both senses are exact
+    if( dynamic_cast<Chuck_Instr_Lt_int *>(cmp) )
+        return branch_if_true ? (Chuck_Instr *)new Chuck_Instr_Branch_Lt_int(0) : new Chuck_Instr_Branch_Ge_int(0);
+    if( dynamic_cast<Chuck_Instr_Gt_int *>(cmp) )
+        return branch_if_true ? (Chuck_Instr *)new Chuck_Instr_Branch_Gt_int(0) : new Chuck_Instr_Branch_Le_int(0);
+    if( dynamic_cast<Chuck_Instr_Le_int *>(cmp) )
+        return branch_if_true ? (Chuck_Instr *)new Chuck_Instr_Branch_Le_int(0) : new Chuck_Instr_Branch_Gt_int(0);
+    if( dynamic_cast<Chuck_Instr_Ge_int *>(cmp) )
+        return branch_if_true ? (Chuck_Instr *)new Chuck_Instr_Branch_Ge_int(0) : new Chuck_Instr_Branch_Lt_int(0);
+    if( dynamic_cast<Chuck_Instr_Eq_int *>(cmp) )
+        return branch_if_true ? (Chuck_Instr *)new Chuck_Instr_Branch_Eq_int(0) : new Chuck_Instr_Branch_Neq_int(0);
+    if( dynamic_cast<Chuck_Instr_Neq_int *>(cmp) )
+        return branch_if_true ? (Chuck_Instr *)new Chuck_Instr_Branch_Neq_int(0) : new Chuck_Instr_Branch_Eq_int(0);
+
+    // float: only == and != can be negated (NaN compares false to everything)
+    if( dynamic_cast<Chuck_Instr_Eq_double *>(cmp) )
+        return branch_if_true ? (Chuck_Instr *)new Chuck_Instr_Branch_Eq_double(0) : new Chuck_Instr_Branch_Neq_double(0);
+    if( dynamic_cast<Chuck_Instr_Neq_double *>(cmp) )
+        return branch_if_true ? (Chuck_Instr *)new Chuck_Instr_Branch_Neq_double(0) : new Chuck_Instr_Branch_Eq_double(0);
+    // the rest only when branching on true
+    if( !branch_if_true ) return NULL;
+    if( dynamic_cast<Chuck_Instr_Lt_double *>(cmp) ) return new Chuck_Instr_Branch_Lt_double(0);
+    if( dynamic_cast<Chuck_Instr_Gt_double *>(cmp) ) return new Chuck_Instr_Branch_Gt_double(0);
+    if( dynamic_cast<Chuck_Instr_Le_double *>(cmp) ) return new Chuck_Instr_Branch_Le_double(0);
+    if( dynamic_cast<Chuck_Instr_Ge_double *>(cmp) ) return new Chuck_Instr_Branch_Ge_double(0);
+
+    return NULL;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: emit_engine_fuse_at()
+// desc: try to fuse the instructions starting at code[i] (the first `avail`
+//       of which may be fused); returns new instruction and sets len to
+//       the number of instructions it replaces, or NULL if no match
+//-----------------------------------------------------------------------------
+static Chuck_Instr * emit_engine_fuse_at( const vector<Chuck_Instr *> & code,
+                                          t_CKUINT i, t_CKUINT avail, t_CKUINT & len )
+{
+    Chuck_Instr * a = code[i];
+    Chuck_Instr * b = avail > 1 ? code[i+1] : NULL;
+    Chuck_Instr * c = avail > 2 ? code[i+2] : NULL;
+    Chuck_Instr * fused = NULL;
+
+    // triples
+    if( c )
+    {
+        Chuck_Instr_Reg_Push_Imm * imm = dynamic_cast<Chuck_Instr_Reg_Push_Imm *>(b);
+        Chuck_Instr_Reg_Push_Mem_Addr * addr = dynamic_cast<Chuck_Instr_Reg_Push_Mem_Addr *>(a);
+        Chuck_Instr_Branch_Op * branch = dynamic_cast<Chuck_Instr_Branch_Op *>(c);
+
+        // compare + push 0 + branch on (in)equality => branch on compare
+        if( imm && imm->get() == 0 && branch &&
+            ( dynamic_cast<Chuck_Instr_Branch_Eq_int *>(c) || dynamic_cast<Chuck_Instr_Branch_Neq_int *>(c) ) &&
+            ( fused = emit_engine_fuse_compare( a, dynamic_cast<Chuck_Instr_Branch_Neq_int *>(c) != NULL ) ) )
+        { ((Chuck_Instr_Branch_Op *)fused)->set( branch->get() ); len = 3; return fused; }
+
+        // push addr + assign + pop => store into mem stack
+        if( addr && dynamic_cast<Chuck_Instr_Assign_Primitive *>(b) && dynamic_cast<Chuck_Instr_Reg_Pop_Int *>(c) )
+        { len = 3; return new Chuck_Instr_Assign_Primitive_Mem( addr->get(), addr->use_base() ); }
+        if( addr && dynamic_cast<Chuck_Instr_Assign_Primitive2 *>(b) && dynamic_cast<Chuck_Instr_Reg_Pop_Float *>(c) )
+        { len = 3; return new Chuck_Instr_Assign_Primitive2_Mem( addr->get(), addr->use_base() ); }
+    }
+
+    // pairs
+    if( b )
+    {
+        Chuck_Instr_Reg_Push_Imm * imm = dynamic_cast<Chuck_Instr_Reg_Push_Imm *>(a);
+        Chuck_Instr_Reg_Push_Imm2 * imm2 = dynamic_cast<Chuck_Instr_Reg_Push_Imm2 *>(a);
+        Chuck_Instr_Reg_Push_Mem * mem = dynamic_cast<Chuck_Instr_Reg_Push_Mem *>(a);
+        Chuck_Instr_Reg_Push_Mem2 * mem2 = dynamic_cast<Chuck_Instr_Reg_Push_Mem2 *>(a);
+        Chuck_Instr_Branch_Op * branch = dynamic_cast<Chuck_Instr_Branch_Op *>(b);
+        len = 2;
+
+        if( imm )
+        {
+            // push 0 + branch on (in)equality => branch on zero
+            if( imm->get() == 0 && dynamic_cast<Chuck_Instr_Branch_Eq_int *>(b) )
+            { fused = new Chuck_Instr_Branch_Eq_int_Zero( branch->get() ); return fused; }
+            if( imm->get() == 0 && dynamic_cast<Chuck_Instr_Branch_Neq_int *>(b) )
+            { fused = new Chuck_Instr_Branch_Neq_int_Zero( branch->get() ); return fused; }
+            // push immediate + arithmetic => arithmetic with immediate
+            if( dynamic_cast<Chuck_Instr_Add_int *>(b) ) return new Chuck_Instr_Add_int_Imm( imm->get() );
+            if( dynamic_cast<Chuck_Instr_Minus_int *>(b) ) return new Chuck_Instr_Minus_int_Imm( imm->get() );
+            if( dynamic_cast<Chuck_Instr_Times_int *>(b) ) return new Chuck_Instr_Times_int_Imm( imm->get() );
+        }
+        else if( imm2 )
+        {
+            if( dynamic_cast<Chuck_Instr_Add_double *>(b) ) return new Chuck_Instr_Add_double_Imm( imm2->get() );
+            if( dynamic_cast<Chuck_Instr_Minus_double *>(b) ) return new Chuck_Instr_Minus_double_Imm( imm2->get() );
+            if( dynamic_cast<Chuck_Instr_Times_double *>(b) ) return new Chuck_Instr_Times_double_Imm( imm2->get() );
+        }
+        else if( mem )
+        {
+            // push variable + arithmetic => arithmetic with variable
+            if( dynamic_cast<Chuck_Instr_Add_int *>(b) ) return new Chuck_Instr_Add_int_Mem( mem->get(), mem->use_base() );
+            if( dynamic_cast<Chuck_Instr_Minus_int *>(b) ) return new Chuck_Instr_Minus_int_Mem( mem->get(), mem->use_base() );
+            if( dynamic_cast<Chuck_Instr_Times_int *>(b) ) return new Chuck_Instr_Times_int_Mem( mem->get(), mem->use_base() );
+        }
+        else if( mem2 )
+        {
+            if( dynamic_cast<Chuck_Instr_Add_double *>(b) ) return new Chuck_Instr_Add_double_Mem( mem2->get(), mem2->use_base() );
+            if( dynamic_cast<Chuck_Instr_Minus_double *>(b) ) return new Chuck_Instr_Minus_double_Mem( mem2->get(), mem2->use_base() );
+            if( dynamic_cast<Chuck_Instr_Times_double *>(b) ) return new Chuck_Instr_Times_double_Mem( mem2->get(), mem2->use_base() );
+        }
+
+        // unchecked array element address + assign => store
+        if( dynamic_cast<Chuck_Instr_ArrayInt_Addr_Unchecked *>(a) && dynamic_cast<Chuck_Instr_Assign_Primitive *>(b) )
+            return new Chuck_Instr_ArrayInt_Store_Unchecked;
+        if( dynamic_cast<Chuck_Instr_ArrayFloat_Addr_Unchecked *>(a) && dynamic_cast<Chuck_Instr_Assign_Primitive2 *>(b) )
+            return new Chuck_Instr_ArrayFloat_Store_Unchecked;
+
+        // member function lookup + func to code => lookup straight to code
+        Chuck_Instr_Dot_Member_Func * mfunc = dynamic_cast<Chuck_Instr_Dot_Member_Func *>(a);
+        if( mfunc && dynamic_cast<Chuck_Instr_Func_To_Code *>(b) )
+            return new Chuck_Instr_Dot_Member_Func( mfunc->get(), TRUE );
+    }
+
+    return NULL;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: emit_engine_fuse()
+// desc: peephole pass over emitted code, replacing common sequences of
+//       fine-grained instructions with superinstructions; returns the
+//       number of instructions eliminated | 1.5.1.7 (added)
+//-----------------------------------------------------------------------------
+t_CKUINT emit_engine_fuse( Chuck_Code * code )
+{
+#ifndef __CHUNREAL_ENGINE__ // needs run time type information
+    vector<Chuck_Instr *> & in = code->code;
+    vector<Chuck_Instr *> out;
+    t_CKUINT n = in.size();
+    t_CKUINT i, j, len, avail, jmp;
+
+    // mark jump targets; only the first instruction in a fused sequence
+    // may be the target of a jump
+    vector<t_CKBOOL> target( n + 1, FALSE );
+    for( i = 0; i < n; i++ )
+        if( emit_engine_fuse_get_jmp( in[i], jmp ) && jmp <= n )
+            target[jmp] = TRUE;
+
+    // map from old index to new index
+    vector<t_CKUINT> remap( n + 1, 0 );
+    out.reserve( n );
+
+    for( i = 0; i < n; i += len )
+    {
+        // how many instructions can be fused at i
+        for( avail = 1; avail < 3 && i + avail < n && !target[i+avail]; avail++ ) { }
+
+        remap[i] = out.size();
+        Chuck_Instr * fused = emit_engine_fuse_at( in, i, avail, len );
+        if( !fused ) { out.push_back( in[i] ); len = 1; continue; }
+
+        // carry over line position and code str to the new instruction
+        fused->set_linepos( in[i]->m_linepos );
+        for( j = i; j < i + len; j++ )
+        {
+            if( in[j]->m_codestr_pre )
+            {
+                if( !fused->m_codestr_pre ) fused->m_codestr_pre = new vector<string>();
+                fused->m_codestr_pre->insert( fused->m_codestr_pre->end(),
+                    in[j]->m_codestr_pre->begin(), in[j]->m_codestr_pre->end() );
+            }
+            if( in[j]->m_codestr_post )
+            {
+                if( !fused->m_codestr_post ) fused->m_codestr_post = new vector<string>();
+                fused->m_codestr_post->insert( fused->m_codestr_post->end(),
+                    in[j]->m_codestr_post->begin(), in[j]->m_codestr_post->end() );
+            }
+            // interior instructions are not jump targets; no need to remap
+            CK_SAFE_DELETE( in[j] );
+        }
+        out.push_back( fused );
+    }
+    remap[n] = out.size();
+
+    // nothing fused
+    if( out.size() == n ) return 0;
+
+    // retarget jumps
+    for( i = 0; i < out.size(); i++ )
+        if( emit_engine_fuse_get_jmp( out[i], jmp ) && jmp <= n )
+            emit_engine_fuse_set_jmp( out[i], remap[jmp] );
+
+    // swap in the fused code
+    in.swap( out );
+
+    return n - in.size();
+#else
+    return 0;
+#endif
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name:
 // desc: ...
@@ -3577,22 +3853,28 @@ t_CKBOOL emit_engine_emit_exp_primary( Chuck_Emitter * emit, a_Exp_Primary exp )
         break;
 
     case ae_primary_str:
-        // TODO: fix this
-        str = new Chuck_String();
-        if( !str || !initialize_object( str, emit->env->ckt_string, NULL, emit->env->vm() ) )
+        // one string per distinct literal in this code, pushed from a slot,
+        // so that changing it in place can swap in a copy | 1.5.1.7
+        if( !emit->code->literals.count( exp->str ) )
         {
-            // error (TODO: why is this a CK_SAFE_RELEASE and not CK_SAFE_DELETE?)
-            CK_SAFE_RELEASE( str );
-            // error out
-            CK_FPRINTF_STDERR(
-                "[chuck](emitter): OutOfMemory: while allocating string literal '%s'\n", exp->str );
-            return FALSE;
-        }
-        str->set( exp->str );
-        temp = (t_CKUINT)str;
-        emit->append( new Chuck_Instr_Reg_Push_Imm( temp ) );
-        // add reference for string literal (added 1.3.0.2)
-        str->add_ref();
+            str = new Chuck_String();
+            if( !str || !initialize_object( str, emit->env->ckt_string, NULL, emit->env->vm() ) )
+            {
+                // error (TODO: why is this a CK_SAFE_RELEASE and not CK_SAFE_DELETE?)
+                CK_SAFE_RELEASE( str );
+                // error out
+                CK_FPRINTF_STDERR(
+                    "[chuck](emitter): OutOfMemory: while allocating string literal '%s'\n", exp->str );
+                return FALSE;
+            }
+            str->set( exp->str );
+            // add reference for string literal (added 1.3.0.2)
+            // (held by the code, through its slot)
+            str->add_ref();
+            str->m_literal = new Chuck_String *( str );
+            emit->code->literals[exp->str] = str->m_literal;
+        }
+        emit->append( new Chuck_Instr_Reg_Push_Deref( (t_CKUINT)emit->code->literals[exp->str] ) );
         break;
 
     case ae_primary_char:
@@ -3998,6 +4280,13 @@ t_CKBOOL emit_engine_emit_exp_array( Chuck_Emitter * emit, a_Exp_Array array )
         // emit the array access (1.3.1.0: use getkindof instead of type->size)
         if( is_str )
             emit->append( instr = new Chuck_Instr_Array_Map_Access( getkindof(emit->env, type), is_var ) );
+        // index proven in range by the optimizer | 1.5.1.7
+        else if( array->unchecked && getkindof(emit->env, type) == kindof_INT )
+            emit->append( instr = is_var ? (Chuck_Instr *)new Chuck_Instr_ArrayInt_Addr_Unchecked
+                                         : new Chuck_Instr_ArrayInt_Load_Unchecked );
+        else if( array->unchecked && getkindof(emit->env, type) == kindof_FLOAT )
+            emit->append( instr = is_var ? (Chuck_Instr *)new Chuck_Instr_ArrayFloat_Addr_Unchecked
+                                         : new Chuck_Instr_ArrayFloat_Load_Unchecked );
         else
             emit->append( instr = new Chuck_Instr_Array_Access( getkindof(emit->env, type), is_var ) );
         instr->set_linepos( array->line );
@@ -4106,7 +4395,10 @@ t_CKBOOL emit_engine_emit_exp_func_call( Chuck_Emitter * emit,
     }
     else
     {
-        emit->append( instr = new Chuck_Instr_Func_Call );
+        Chuck_Instr_Func_Call * call = new Chuck_Instr_Func_Call;
+        // arguments and return value sizes, for stack verification | 1.5.1.7
+        call->set_sizes( func->def()->stack_depth, size );
+        emit->append( instr = call );
     }
     // set line position
     instr->set_linepos(line);
@@ -5174,6 +5466,10 @@ t_CKBOOL emit_engine_emit_code_segment( Chuck_Emitter * emit,
 {
     a_Stmt_List list = stmt->stmt_list;
 
+    // e.g., the body of an if() resolved by the optimizer keeps
+    // the scope it would have had as a branch | 1.5.1.7
+    if( stmt->scoped ) emit->push_scope();
+
     // loop through
     while( list )
     {
@@ -5186,6 +5482,7 @@ t_CKBOOL emit_engine_emit_code_segment( Chuck_Emitter * emit,
     }
 
     // TODO: push
+    if( stmt->scoped ) emit->pop_scope();
 
     return TRUE;
 }
@@ -77,6 +77,9 @@ public:
 
     // filename this code came from (added 1.3.0.0)
     std::string filename;
+    // string literals, one per distinct value, each in the slot its uses
+    // push it from; handed to the VM code | 1.5.1.7
+    std::map<std::string, Chuck_String **> literals;
 
     // constructor
     Chuck_Code( )
@@ -92,6 +95,9 @@ public:
     {
         // clean up frame
         CK_SAFE_DELETE( frame );
+        // literals, if not handed to VM code (e.g., on error) | 1.5.1.7
+        for( std::map<std::string, Chuck_String **>::iterator it = literals.begin(); it != literals.end(); it++ )
+            Chuck_String::release_literal( it->second );
         // TODO: what about contents of code?
         // TODO: what about contents of stack_*?
         // (these may also depend on success/error during emission)
@@ -45,6 +45,8 @@ Chuck_Frame::Chuck_Frame()
     name = "";
     // ofset
     curr_offset = 0;
+    // high water mark
+    max_offset = 0;
     // don't know
     num_access = 0;
 }
@@ -73,6 +75,8 @@ Chuck_Local * Chuck_Frame::alloc_local( t_CKUINT size, const string & theName,
     local->is_global = is_global;
     // the next offset
     this->curr_offset += local->size;
+    // update high water mark | 1.5.1.7
+    if( this->curr_offset > this->max_offset ) this->max_offset = this->curr_offset;
     // name
     local->name = theName;
     // push the local
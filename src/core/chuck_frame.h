@@ -76,6 +76,8 @@ struct Chuck_Frame
     std::string name;
     // the offset
     t_CKUINT curr_offset;
+    // the largest the offset has been | 1.5.1.7
+    t_CKUINT max_offset;
     // not sure
     t_CKUINT num_access;
     // offset stack
@@ -611,7 +611,7 @@ t_CKBOOL Chuck_Globals_Manager::add_request( Chuck_Global_Request request )
 //-----------------------------------------------------------------------------
 t_CKBOOL Chuck_Globals_Manager::more_requests()
 {
-    return m_global_request_queue.more();
+    return m_global_request_queue.more() || m_held_requests.size();
 }
 
 
@@ -698,7 +698,8 @@ t_CKBOOL Chuck_Globals_Manager::getGlobalInt( const char * name, t_CKINT id,
 // name: setGlobalInt()
 // desc: set a global int by name
 //-----------------------------------------------------------------------------
-t_CKBOOL Chuck_Globals_Manager::setGlobalInt( const char * name, t_CKINT val )
+t_CKBOOL Chuck_Globals_Manager::setGlobalInt( const char * name, t_CKINT val,
+                                              t_CKUINT offset )
 {
     Chuck_Set_Global_Int_Request * set_int_message =
         new Chuck_Set_Global_Int_Request;
@@ -708,6 +709,7 @@ t_CKBOOL Chuck_Globals_Manager::setGlobalInt( const char * name, t_CKINT val )
     Chuck_Global_Request r;
     r.type = set_global_int_request;
     r.setIntRequest = set_int_message;
+    r.offset = offset;
 
     m_global_request_queue.put( r );
 
@@ -842,7 +844,8 @@ t_CKBOOL Chuck_Globals_Manager::getGlobalFloat( const char * name, t_CKINT id,
 // desc: set a global float by name
 //-----------------------------------------------------------------------------
 t_CKBOOL Chuck_Globals_Manager::setGlobalFloat( const char * name,
-                                                t_CKFLOAT val )
+                                                t_CKFLOAT val,
+                                                t_CKUINT offset )
 {
     Chuck_Set_Global_Float_Request * set_float_message =
         new Chuck_Set_Global_Float_Request;
@@ -852,6 +855,7 @@ t_CKBOOL Chuck_Globals_Manager::setGlobalFloat( const char * name,
     Chuck_Global_Request r;
     r.type = set_global_float_request;
     r.setFloatRequest = set_float_message;
+    r.offset = offset;
 
     m_global_request_queue.put( r );
 
@@ -1061,7 +1065,8 @@ Chuck_String * * Chuck_Globals_Manager::get_ptr_to_global_string( const std::str
 // name: signalGlobalEvent()
 // desc: signal() an Event by name
 //-----------------------------------------------------------------------------
-t_CKBOOL Chuck_Globals_Manager::signalGlobalEvent( const char * name )
+t_CKBOOL Chuck_Globals_Manager::signalGlobalEvent( const char * name,
+                                                   t_CKUINT offset )
 {
     Chuck_Signal_Global_Event_Request * signal_event_message =
         new Chuck_Signal_Global_Event_Request;
@@ -1071,6 +1076,7 @@ t_CKBOOL Chuck_Globals_Manager::signalGlobalEvent( const char * name )
     Chuck_Global_Request r;
     r.type = signal_global_event_request;
     r.signalEventRequest = signal_event_message;
+    r.offset = offset;
 
     m_global_request_queue.put( r );
 
@@ -1084,7 +1090,8 @@ t_CKBOOL Chuck_Globals_Manager::signalGlobalEvent( const char * name )
 // name: broadcastGlobalEvent()
 // desc: broadcast() an Event by name
 //-----------------------------------------------------------------------------
-t_CKBOOL Chuck_Globals_Manager::broadcastGlobalEvent( const char * name )
+t_CKBOOL Chuck_Globals_Manager::broadcastGlobalEvent( const char * name,
+                                                      t_CKUINT offset )
 {
     Chuck_Signal_Global_Event_Request * signal_event_message =
         new Chuck_Signal_Global_Event_Request;
@@ -1094,6 +1101,7 @@ t_CKBOOL Chuck_Globals_Manager::broadcastGlobalEvent( const char * name )
     Chuck_Global_Request r;
     r.type = signal_global_event_request;
     r.signalEventRequest = signal_event_message;
+    r.offset = offset;
     // chuck object might not be constructed on time. retry only once
     r.retries = 1;
 
@@ -2633,6 +2641,41 @@ void Chuck_Globals_Manager::cleanup_global_variables()
 
 
 
+//-----------------------------------------------------------------------------
+// name: next_request() | 1.5.1.7
+// desc: get the next request to execute: first any held for a frame offset
+//       and now due, then new ones; new ones whose frame offset into the
+//       current block is still to come are held until then
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_Globals_Manager::next_request( Chuck_Global_Request & request,
+                                              t_CKTIME now )
+{
+    // held and now due
+    if( has_due( now ) )
+    {
+        request = m_held_requests.begin()->second;
+        m_held_requests.erase( m_held_requests.begin() );
+        return TRUE;
+    }
+
+    // new
+    while( m_global_request_queue.get( &request ) )
+    {
+        // no offset
+        if( !request.offset ) return TRUE;
+        // when it's due
+        t_CKTIME due = m_vm->block_start() + request.offset;
+        if( due <= now ) return TRUE;
+        // hold it (after any others due at the same time)
+        m_held_requests.insert( std::make_pair( due, request ) );
+    }
+
+    return FALSE;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: handle_global_queue_messages()
 // desc: update vm with set, get, listen, spork, etc. messages
@@ -2640,13 +2683,15 @@ void Chuck_Globals_Manager::cleanup_global_variables()
 void Chuck_Globals_Manager::handle_global_queue_messages()
 {
     bool should_retry_this_request = false;
+    // for requests with a frame offset | 1.5.1.7
+    t_CKTIME now = m_vm->now();
 
-    while( m_global_request_queue.more() )
+    while( has_due( now ) || m_global_request_queue.more() )
     {
         should_retry_this_request = false;
 
         Chuck_Global_Request message;
-        if( m_global_request_queue.get( & message ) )
+        if( next_request( message, now ) )
         {
             switch( message.type )
             {
@@ -140,6 +140,9 @@ struct Chuck_Global_Request
 {
     Chuck_Global_Request_Type type;
     t_CKUINT retries;
+    // frame offset into the block in which the VM takes this request in,
+    // for sample-accurate timing; 0: right away | 1.5.1.7
+    t_CKUINT offset;
     union {
         // primitives
         Chuck_Set_Global_Int_Request* setIntRequest;
@@ -177,6 +180,7 @@ struct Chuck_Global_Request
     {
         type = global_request_none;
         retries = 0;
+        offset = 0;
         executeChuckMsgRequest = NULL;
     }
 };
@@ -219,23 +223,25 @@ public:
 public:
     // REFACTOR-2017: externally accessible + global variables.
     // use these getters and setters from outside the audio thread
+    // 1.5.1.7: setters and event requests may take a frame `offset` into
+    // the block in which the VM takes them in (see Chuck_VM::set_poll())
     t_CKBOOL getGlobalInt( const char * name, void (*callback)(t_CKINT) );
     t_CKBOOL getGlobalInt( const char * name, void (*callback)(const char*, t_CKINT) );
     t_CKBOOL getGlobalInt( const char * name, t_CKINT callbackID, void (*callback)(t_CKINT, t_CKINT) );
-    t_CKBOOL setGlobalInt( const char * name, t_CKINT val );
+    t_CKBOOL setGlobalInt( const char * name, t_CKINT val, t_CKUINT offset = 0 );
 
     t_CKBOOL getGlobalFloat( const char * name, void (*callback)(t_CKFLOAT) );
     t_CKBOOL getGlobalFloat( const char * name, void (*callback)(const char*, t_CKFLOAT) );
     t_CKBOOL getGlobalFloat( const char * name, t_CKINT callbackID, void (*callback)(t_CKINT, t_CKFLOAT) );
-    t_CKBOOL setGlobalFloat( const char * name, t_CKFLOAT val );
+    t_CKBOOL setGlobalFloat( const char * name, t_CKFLOAT val, t_CKUINT offset = 0 );
 
     t_CKBOOL getGlobalString( const char * name, void (*callback)(const char*) );
     t_CKBOOL getGlobalString( const char * name, void (*callback)(const char*, const char*) );
     t_CKBOOL getGlobalString( const char * name, t_CKINT callbackID, void (*callback)(t_CKINT, const char*) );
     t_CKBOOL setGlobalString( const char * name, const char * val );
 
-    t_CKBOOL signalGlobalEvent( const char * name );
-    t_CKBOOL broadcastGlobalEvent( const char * name );
+    t_CKBOOL signalGlobalEvent( const char * name, t_CKUINT offset = 0 );
+    t_CKBOOL broadcastGlobalEvent( const char * name, t_CKUINT offset = 0 );
     t_CKBOOL listenForGlobalEvent( const char * name, void (*callback)(void), t_CKBOOL listen_forever );
     t_CKBOOL listenForGlobalEvent( const char * name, void (*callback)(const char*), t_CKBOOL listen_forever );
     t_CKBOOL listenForGlobalEvent( const char * name, t_CKINT callbackID, void (*callback)(t_CKINT), t_CKBOOL listen_forever );
@@ -334,6 +340,14 @@ public: // these should ever ONLY be called from within the VM
     t_CKBOOL more_requests();
     // REFACTOR-2017: execute the messages from the global queue
     void handle_global_queue_messages();
+    // is a request held for a frame offset due by `now`? | 1.5.1.7
+    t_CKBOOL has_due( t_CKTIME now ) const
+    { return m_held_requests.size() && m_held_requests.begin()->first <= now; }
+
+private:
+    // next request to execute: held ones now due, then new ones; new
+    // ones with a frame offset still to come are held | 1.5.1.7
+    t_CKBOOL next_request( Chuck_Global_Request & request, t_CKTIME now );
 
 private:
     // ptr to my vm
@@ -358,6 +372,9 @@ private:
     // this is ok because the external host has no guarantee of sample-level
     // determinism, like we have within the ChucK VM
     XCircleBuffer< Chuck_Global_Request > m_global_request_retry_queue;
+
+    // requests with a frame offset, held until due | 1.5.1.7
+    std::multimap< t_CKTIME, Chuck_Global_Request > m_held_requests;
 };
 
 
@@ -38,6 +38,8 @@
 #include "chuck_dl.h"
 #include "chuck_io.h"
 #include "chuck_errmsg.h"
+#include "chuck_jit.h" // 1.5.1.7
+#include "chuck_pool.h" // 1.5.1.7
 #include "chuck_globals.h" // added 1.4.1.0
 #include "util_math.h"
 #include "util_string.h"
@@ -1876,6 +1878,31 @@ void Chuck_Instr_vec4_Divide_float_Assign::execute( Chuck_VM * vm, Chuck_VM_Shre
 #pragma mark === String Arithmetic ===
 
 
+//-----------------------------------------------------------------------------
+// name: string_detach()
+// desc: if the string variable at 'ptr' holds a literal (shared by every
+//       use of that literal in its code), replace it with a copy the
+//       variable owns, before modifying it in place | 1.5.1.7
+//-----------------------------------------------------------------------------
+static Chuck_String * string_detach( Chuck_String ** ptr, Chuck_VM * vm, Chuck_VM_Shred * shred,
+                                     t_CKBOOL keep = TRUE )
+{
+    // not shared
+    if( !(*ptr)->m_literal ) return *ptr;
+
+    // copy, if the contents are to be kept
+    Chuck_String * copy = (Chuck_String *)instantiate_and_initialize_object( vm->env()->ckt_string, shred );
+    copy->add_ref();
+    if( keep ) copy->set( (*ptr)->str() );
+    // let go of the literal (still held by the code)
+    (*ptr)->release();
+    // the variable's own
+    return (*ptr = copy);
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: execute()
 // desc: string + string
@@ -1900,9 +1927,8 @@ void Chuck_Instr_Add_string::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
     // make new string
     result = (Chuck_String *)instantiate_and_initialize_object( vm->env()->ckt_string, shred );
 
-    // concat
-    // result->str = lhs->str + rhs->str;
-    result->set( lhs->str() + rhs->str() );
+    // concat, without a temporary | 1.5.1.7
+    result->concat( lhs->str().data(), lhs->str().length(), rhs->str().data(), rhs->str().length() );
 
     // push the reference value to reg stack
     push_( reg_sp, (t_CKUINT)(result) );
@@ -1945,9 +1971,8 @@ void Chuck_Instr_Add_string_Assign::execute( Chuck_VM * vm, Chuck_VM_Shred * shr
     // make sure no null
     if( !lhs || !(*rhs_ptr) ) goto null_pointer;
 
-    // concat
-    // (*rhs_ptr)->str += lhs->str;
-    (*rhs_ptr)->set( (*rhs_ptr)->str() + lhs->str() );
+    // concat in place; copy first if a literal | 1.5.1.7
+    string_detach( rhs_ptr, vm, shred )->append( lhs->str() );
 
     // push the reference value to reg stack
     push_( reg_sp, (t_CKUINT)(*rhs_ptr) );
@@ -1980,6 +2005,9 @@ void Chuck_Instr_Add_string_int::execute( Chuck_VM * vm, Chuck_VM_Shred * shred
     Chuck_String * lhs = NULL;
     t_CKINT rhs = 0;
     Chuck_String * result = NULL;
+    // number as text | 1.5.1.7
+    char buffer[128];
+    t_CKUINT len = 0;
 
     // pop word from reg stack
     pop_( reg_sp, 2 );
@@ -1994,9 +2022,9 @@ void Chuck_Instr_Add_string_int::execute( Chuck_VM * vm, Chuck_VM_Shred * shred
     // make new string
     result = (Chuck_String *)instantiate_and_initialize_object( vm->env()->ckt_string, shred );
 
-    // concat
-    // result->str = lhs->str + ::ck_itoa(rhs);
-    result->set( lhs->str() + ::ck_itoa( rhs ) );
+    // concat, without a temporary | 1.5.1.7
+    len = ::ck_itoa( rhs, buffer, sizeof(buffer) );
+    result->concat( lhs->str().data(), lhs->str().length(), buffer, len );
 
     // push the reference value to reg stack
     push_( reg_sp, (t_CKUINT)(result) );
@@ -2029,6 +2057,9 @@ void Chuck_Instr_Add_string_float::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
     Chuck_String * lhs = NULL;
     t_CKFLOAT rhs = 0;
     Chuck_String * result = NULL;
+    // number as text | 1.5.1.7
+    char buffer[128];
+    t_CKUINT len = 0;
 
     // pop word from reg stack (1.3.1.0: add size check)
     pop_( reg_sp, 1 + (sz_FLOAT / sz_UINT) ); // ISSUE: 64-bit (fixed 1.3.1.0)
@@ -2043,9 +2074,9 @@ void Chuck_Instr_Add_string_float::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
     // make new string
     result = (Chuck_String *)instantiate_and_initialize_object( vm->env()->ckt_string, shred );
 
-    // concat
-    // result->str = lhs->str + ::ck_ftoa(rhs, 4);
-    result->set( lhs->str() + ::ck_ftoa( rhs, 4 ) );
+    // concat, without a temporary | 1.5.1.7
+    len = ::ck_ftoa( rhs, 4, buffer, sizeof(buffer) );
+    result->concat( lhs->str().data(), lhs->str().length(), buffer, len );
 
     // push the reference value to reg stack
     push_( reg_sp, (t_CKUINT)(result) );
@@ -2078,6 +2109,9 @@ void Chuck_Instr_Add_int_string::execute( Chuck_VM * vm, Chuck_VM_Shred * shred
     t_CKINT lhs = 0;
     Chuck_String * rhs = NULL;
     Chuck_String * result = NULL;
+    // number as text | 1.5.1.7
+    char buffer[128];
+    t_CKUINT len = 0;
 
     // pop word from reg stack
     pop_( reg_sp, 2 );
@@ -2092,9 +2126,9 @@ void Chuck_Instr_Add_int_string::execute( Chuck_VM * vm, Chuck_VM_Shred * shred
     // make new string
     result = (Chuck_String *)instantiate_and_initialize_object( vm->env()->ckt_string, shred );
 
-    // concat
-    // result->str = ::ck_itoa(lhs) + rhs->str;
-    result->set( ::ck_itoa(lhs) + rhs->str() );
+    // concat, without a temporary | 1.5.1.7
+    len = ::ck_itoa( lhs, buffer, sizeof(buffer) );
+    result->concat( buffer, len, rhs->str().data(), rhs->str().length() );
 
     // push the reference value to reg stack
     push_( reg_sp, (t_CKUINT)(result) );
@@ -2127,6 +2161,9 @@ void Chuck_Instr_Add_float_string::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
     t_CKFLOAT lhs = 0;
     Chuck_String * rhs = NULL;
     Chuck_String * result = NULL;
+    // number as text | 1.5.1.7
+    char buffer[128];
+    t_CKUINT len = 0;
 
     // pop word from reg stack (1.3.1.0: added size check)
     pop_( reg_sp, 1 + (sz_FLOAT / sz_UINT) );  // ISSUE: 64-bit (fixed 1.3.1.0)
@@ -2141,9 +2178,9 @@ void Chuck_Instr_Add_float_string::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
     // make new string
     result = (Chuck_String *)instantiate_and_initialize_object( vm->env()->ckt_string, shred );
 
-    // concat
-    // result->str = ::ck_ftoa(lhs, 4) + rhs->str;
-    result->set( ::ck_ftoa( lhs, 4 ) + rhs->str() );
+    // concat, without a temporary | 1.5.1.7
+    len = ::ck_ftoa( lhs, 4, buffer, sizeof(buffer) );
+    result->concat( buffer, len, rhs->str().data(), rhs->str().length() );
 
     // push the reference value to reg stack
     push_( reg_sp, (t_CKUINT)(result) );
@@ -2175,6 +2212,9 @@ void Chuck_Instr_Add_int_string_Assign::execute( Chuck_VM * vm, Chuck_VM_Shred *
     t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
     t_CKINT lhs = 0;
     Chuck_String ** rhs_ptr = NULL;
+    // number as text | 1.5.1.7
+    char buffer[128];
+    t_CKUINT len = 0;
 
     // pop word from reg stack
     pop_( reg_sp, 2 );
@@ -2186,9 +2226,9 @@ void Chuck_Instr_Add_int_string_Assign::execute( Chuck_VM * vm, Chuck_VM_Shred *
     // make sure no null
     if( !(*rhs_ptr) ) goto null_pointer;
 
-    // concat
-    // (*rhs_ptr)->str += ::ck_itoa(lhs);
-    (*rhs_ptr)->set( (*rhs_ptr)->str() + ::ck_itoa(lhs) );
+    // concat in place; copy first if a literal | 1.5.1.7
+    len = ::ck_itoa( lhs, buffer, sizeof(buffer) );
+    string_detach( rhs_ptr, vm, shred )->append( buffer, len );
 
     // push the reference value to reg stack
     push_( reg_sp, (t_CKUINT)(*rhs_ptr) );
@@ -2220,6 +2260,9 @@ void Chuck_Instr_Add_float_string_Assign::execute( Chuck_VM * vm, Chuck_VM_Shred
     t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
     t_CKFLOAT lhs = 0;
     Chuck_String ** rhs_ptr = NULL;
+    // number as text | 1.5.1.7
+    char buffer[128];
+    t_CKUINT len = 0;
 
     // pop word from reg stack (1.3.1.0: added size check)
     pop_( reg_sp, 1 + (sz_FLOAT / sz_UINT) ); // ISSUE: 64-bit (fixed 1.3.1.0)
@@ -2231,9 +2274,9 @@ void Chuck_Instr_Add_float_string_Assign::execute( Chuck_VM * vm, Chuck_VM_Shred
     // make sure no null
     if( !(*rhs_ptr) ) goto null_pointer;
 
-    // concat
-    // (*rhs_ptr)->str += ::ck_ftoa(lhs, 4);
-    (*rhs_ptr)->set( (*rhs_ptr)->str() + ::ck_ftoa(lhs, 4) );
+    // concat in place; copy first if a literal | 1.5.1.7
+    len = ::ck_ftoa( lhs, 4, buffer, sizeof(buffer) );
+    string_detach( rhs_ptr, vm, shred )->append( buffer, len );
 
     // push the reference value to reg stack
     push_( reg_sp, (t_CKUINT)(*rhs_ptr) );
@@ -4268,8 +4311,10 @@ t_CKBOOL initialize_object( Chuck_Object * object, Chuck_Type * type, Chuck_VM_S
     // allocate memory
     if( object->data_size )
     {
-        // check to ensure enough memory
-        object->data = new t_CKBYTE[object->data_size];
+        // check to ensure enough memory; from the VM's pool if possible | 1.5.1.7
+        Chuck_VM_Pool * pool = vm ? vm->pool() : NULL;
+        object->data = (t_CKBYTE *)( pool ? pool->alloc( object->data_size )
+                                          : Chuck_VM_Pool::heap_alloc( object->data_size ) );
         if( !object->data ) goto out_of_memory;
         // zero it out
         memset( object->data, 0, object->data_size );
@@ -4287,6 +4332,8 @@ t_CKBOOL initialize_object( Chuck_Object * object, Chuck_Type * type, Chuck_VM_S
         if( type->ugen_info->tick ) ugen->tick = type->ugen_info->tick;
         // added 1.3.0.0 -- tickf for multi-channel tick
         if( type->ugen_info->tickf ) ugen->tickf = type->ugen_info->tickf;
+        // added 1.5.1.7 -- tickv for mono block tick
+        if( type->ugen_info->tickv ) ugen->tickv = type->ugen_info->tickv;
         if( type->ugen_info->pmsg ) ugen->pmsg = type->ugen_info->pmsg;
         // TODO: another hack!
         if( type->ugen_info->tock ) ((Chuck_UAna *)ugen)->tock = type->ugen_info->tock;
@@ -4382,8 +4429,8 @@ Chuck_Object * instantiate_and_initialize_object( Chuck_Type * type, Chuck_VM_Sh
         if( type->allocator )
             object = type->allocator( vm, shred, Chuck_DL_Api::instance() );
         else if( isa( type, vm->env()->ckt_fileio ) ) object = new Chuck_IO_File( vm );
-        else if( isa( type, vm->env()->ckt_event ) ) object = new Chuck_Event;
-        else if( isa( type, vm->env()->ckt_string ) ) object = new Chuck_String;
+        else if( isa( type, vm->env()->ckt_event ) ) object = new( vm->pool() ) Chuck_Event;
+        else if( isa( type, vm->env()->ckt_string ) ) object = new( vm->pool() ) Chuck_String;
         // TODO: is this ok?
         else if( isa( type, vm->env()->ckt_shred ) )
         {
@@ -4403,7 +4450,7 @@ Chuck_Object * instantiate_and_initialize_object( Chuck_Type * type, Chuck_VM_Sh
         // 1.5.0.0 (ge) added -- here my feeble brain starts leaking out of my eyeballs
         else if( isa( type, vm->env()->ckt_class ) ) object = new Chuck_Type( vm->env(), te_class, type->base_name, type, type->size );
         // TODO: is this ok?
-        else object = new Chuck_Object;
+        else object = new( vm->pool() ) Chuck_Object;
     }
     else
     {
@@ -4761,7 +4808,8 @@ void Chuck_Instr_Assign_String::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
     // release any previous reference
     if( *rhs_ptr )
     {
-        if( lhs ) (*rhs_ptr)->set( lhs->str() );
+        // copy into the variable's string (its own, if it held a literal) | 1.5.1.7
+        if( lhs ) string_detach( rhs_ptr, vm, shred, FALSE )->set( lhs->str() );
         else
         {
             // release reference
@@ -5131,11 +5179,28 @@ void Chuck_Instr_Func_Call::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
             *mem_sp2++ = *reg_sp2++;
     }
 
+    // verified code is not checked for overflow after each instruction;
+    // instead, check here that all it will need is available | 1.5.1.7
+    if( func->stack_verified )
+    {
+        // operand stack
+        if( would_overflow_( (t_CKBYTE *)reg_sp + func->reg_depth, shred->reg ) )
+            goto error_reg_overflow;
+        // local variables
+        if( would_overflow_( (t_CKBYTE *)mem_sp + func->mem_depth, shred->mem ) )
+            goto error_overflow;
+    }
+
     return;
 
 error_overflow:
 
     ck_handle_overflow( shred, vm, "too many nested/recursive function calls" );
+    return;
+
+error_reg_overflow:
+
+    ck_handle_overflow( shred, vm, "shred operand stack exceeded" );
 }
 
 
@@ -5838,7 +5903,7 @@ void Chuck_Instr_Array_Init_Literal::execute( Chuck_VM * vm, Chuck_VM_Shred * sh
         // pop the values
         pop_( reg_sp, m_length );
         // instantiate array
-        Chuck_ArrayInt * array = new Chuck_ArrayInt( m_is_obj, m_length );
+        Chuck_ArrayInt * array = new( vm->pool() ) Chuck_ArrayInt( m_is_obj, m_length );
         // problem
         if( !array ) goto out_of_memory;
         // initialize object
@@ -5857,7 +5922,7 @@ void Chuck_Instr_Array_Init_Literal::execute( Chuck_VM * vm, Chuck_VM_Shred * sh
         // pop the values
         pop_( reg_sp, m_length * (sz_FLOAT / sz_INT) ); // 1.3.1.0 added size division
         // instantiate array
-        Chuck_ArrayFloat * array = new Chuck_ArrayFloat( m_length );
+        Chuck_ArrayFloat * array = new( vm->pool() ) Chuck_ArrayFloat( m_length );
         // problem
         if( !array ) goto out_of_memory;
         // fill array
@@ -5877,7 +5942,7 @@ void Chuck_Instr_Array_Init_Literal::execute( Chuck_VM * vm, Chuck_VM_Shred * sh
         // pop the values
         pop_( reg_sp, m_length * (sz_VEC2 / sz_INT) ); // 1.3.1.0 added size division
         // instantiate array
-        Chuck_Array16 * array = new Chuck_Array16( m_length );
+        Chuck_Array16 * array = new( vm->pool() ) Chuck_Array16( m_length );
         // problem
         if( !array ) goto out_of_memory;
         // fill array
@@ -5886,6 +5951,8 @@ void Chuck_Instr_Array_Init_Literal::execute( Chuck_VM * vm, Chuck_VM_Shred * sh
         initialize_object( array, vm->env()->ckt_array, shred, vm );
         // differentiate between complex and polar | 1.5.1.0 (ge) added, used for sorting Array16s
         if( isa(m_type_ref, vm->env()->ckt_polar) ) array->m_isPolarType = TRUE;
+        // and complex from vec2, for bulk operations | 1.5.1.7
+        if( isa(m_type_ref, vm->env()->ckt_complex) ) array->m_isComplexType = TRUE;
         // set size
         array->set_size( m_length );
         // fill array
@@ -5899,7 +5966,7 @@ void Chuck_Instr_Array_Init_Literal::execute( Chuck_VM * vm, Chuck_VM_Shred * sh
         // pop the values
         pop_( reg_sp, m_length * (sz_VEC3 / sz_INT) );
         // instantiate array
-        Chuck_Array24 * array = new Chuck_Array24( m_length );
+        Chuck_Array24 * array = new( vm->pool() ) Chuck_Array24( m_length );
         // problem
         if( !array ) goto out_of_memory;
         // fill array
@@ -5919,7 +5986,7 @@ void Chuck_Instr_Array_Init_Literal::execute( Chuck_VM * vm, Chuck_VM_Shred * sh
         // pop the values
         pop_( reg_sp, m_length * (sz_VEC4 / sz_INT) );
         // instantiate array
-        Chuck_Array32 * array = new Chuck_Array32( m_length );
+        Chuck_Array32 * array = new( vm->pool() ) Chuck_Array32( m_length );
         // problem
         if( !array ) goto out_of_memory;
         // fill array
@@ -6048,7 +6115,7 @@ Chuck_Object * do_alloc_array( Chuck_VM * vm, // REFACTOR-2017: added
         // 1.3.1.0: look at type to use kind instead of size
         if( kind == kindof_INT ) // ISSUE: 64-bit (fixed 1.3.1.0)
         {
-            Chuck_ArrayInt * baseX = new Chuck_ArrayInt( is_obj, *capacity );
+            Chuck_ArrayInt * baseX = new( vm->pool() ) Chuck_ArrayInt( is_obj, *capacity );
             if( !baseX ) goto out_of_memory;
 
             // if object
@@ -6070,7 +6137,7 @@ Chuck_Object * do_alloc_array( Chuck_VM * vm, // REFACTOR-2017: added
         }
         else if( kind == kindof_FLOAT ) // ISSUE: 64-bit (fixed 1.3.1.0)
         {
-            Chuck_ArrayFloat * baseX = new Chuck_ArrayFloat( *capacity );
+            Chuck_ArrayFloat * baseX = new( vm->pool() ) Chuck_ArrayFloat( *capacity );
             if( !baseX ) goto out_of_memory;
 
             // initialize object | 1.5.0.0 (ge) use array type instead of base t_array
@@ -6081,13 +6148,15 @@ Chuck_Object * do_alloc_array( Chuck_VM * vm, // REFACTOR-2017: added
         }
         else if( kind == kindof_VEC2 ) // ISSUE: 64-bit (fixed 1.3.1.0) | 1.5.1.7 (ge) complex -> vec2
         {
-            Chuck_Array16 * baseX = new Chuck_Array16( *capacity );
+            Chuck_Array16 * baseX = new( vm->pool() ) Chuck_Array16( *capacity );
             if( !baseX ) goto out_of_memory;
 
             // check array type
             Chuck_Type * array_type = type->array_type;
             // differentiate between complex and polar | 1.5.1.0 (ge) added, used for sorting Array16s
             if( array_type && isa(array_type, vm->env()->ckt_polar) ) baseX->m_isPolarType = TRUE;
+            // and complex from vec2, for bulk operations | 1.5.1.7
+            if( array_type && isa(array_type, vm->env()->ckt_complex) ) baseX->m_isComplexType = TRUE;
 
             // initialize object | 1.5.0.0 (ge) use array type instead of base t_array
             // for the object->type_ref to contain more specific information
@@ -6097,7 +6166,7 @@ Chuck_Object * do_alloc_array( Chuck_VM * vm, // REFACTOR-2017: added
         }
         else if( kind == kindof_VEC3 ) // 1.3.5.3
         {
-            Chuck_Array24 * baseX = new Chuck_Array24( *capacity );
+            Chuck_Array24 * baseX = new( vm->pool() ) Chuck_Array24( *capacity );
             if( !baseX ) goto out_of_memory;
 
             // initialize object | 1.5.0.0 (ge) use array type instead of base t_array
@@ -6108,7 +6177,7 @@ Chuck_Object * do_alloc_array( Chuck_VM * vm, // REFACTOR-2017: added
         }
         else if( kind == kindof_VEC4 ) // 1.3.5.3
         {
-            Chuck_Array32 * baseX = new Chuck_Array32( *capacity );
+            Chuck_Array32 * baseX = new( vm->pool() ) Chuck_Array32( *capacity );
             if( !baseX ) goto out_of_memory;
 
             // initialize object | 1.5.0.0 (ge) use array type instead of base t_array
@@ -6123,7 +6192,7 @@ Chuck_Object * do_alloc_array( Chuck_VM * vm, // REFACTOR-2017: added
     }
 
     // not top level
-    theBase = new Chuck_ArrayInt( TRUE, *capacity );
+    theBase = new( vm->pool() ) Chuck_ArrayInt( TRUE, *capacity );
     if( !theBase) goto out_of_memory;
 
     // construct type for next array level | 1.5.0.0 (ge) added
@@ -6505,6 +6574,64 @@ done:
 
 
 
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: array element, index proven in range (see chuck_optimize.cpp);
+//       the array cannot be null, having had its size() taken | 1.5.1.7
+//-----------------------------------------------------------------------------
+void Chuck_Instr_ArrayInt_Load_Unchecked::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& sp = (t_CKUINT *&)shred->reg->sp;
+    // pop array and index
+    pop_( sp, 2 );
+    // push the element
+    push_( sp, ((Chuck_ArrayInt *)(*sp))->m_vector[*(t_CKINT *)(sp+1)] );
+}
+
+void Chuck_Instr_ArrayFloat_Load_Unchecked::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& sp = (t_CKUINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    t_CKFLOAT val = ((Chuck_ArrayFloat *)(*sp))->m_vector[*(t_CKINT *)(sp+1)];
+    push_( ((t_CKFLOAT *&)sp), val );
+}
+
+void Chuck_Instr_ArrayInt_Addr_Unchecked::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& sp = (t_CKUINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    // push the element's address
+    push_( sp, (t_CKUINT)&((Chuck_ArrayInt *)(*sp))->m_vector[*(t_CKINT *)(sp+1)] );
+}
+
+void Chuck_Instr_ArrayFloat_Addr_Unchecked::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& sp = (t_CKUINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    push_( sp, (t_CKUINT)&((Chuck_ArrayFloat *)(*sp))->m_vector[*(t_CKINT *)(sp+1)] );
+}
+
+void Chuck_Instr_ArrayInt_Store_Unchecked::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& sp = (t_CKUINT *&)shred->reg->sp;
+    // pop value, array, and index; leave the value
+    pop_( sp, 3 );
+    ((Chuck_ArrayInt *)(*(sp+1)))->m_vector[*(t_CKINT *)(sp+2)] = *sp;
+    sp++;
+}
+
+void Chuck_Instr_ArrayFloat_Store_Unchecked::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& sp = (t_CKUINT *&)shred->reg->sp;
+    pop_( sp, 2 + sz_FLOAT / sz_UINT );
+    t_CKUINT * arr = sp + sz_FLOAT / sz_UINT;
+    ((Chuck_ArrayFloat *)(*arr))->m_vector[*(t_CKINT *)(arr+1)] = *(t_CKFLOAT *)sp;
+    sp = arr;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: execute()
 // desc: ...
@@ -6537,14 +6664,14 @@ void Chuck_Instr_Array_Map_Access::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
         // check if writing
         if( m_emit_addr ) {
             // get the addr
-            val = arr->addr( key->str() );
+            val = arr->addr( key->str(), key->hash() );
             // exception
             if( !val ) goto error;
             // push the addr
             push_( sp, val );
         } else {
             // get the value
-            if( !arr->get( key->str(), &val ) )
+            if( !arr->get( key->str(), &val, key->hash() ) )
                 goto error;
             // push the value
             push_( sp, val );
@@ -6559,14 +6686,14 @@ void Chuck_Instr_Array_Map_Access::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
         // check if writing
         if( m_emit_addr ) {
             // get the addr
-            val = arr->addr( key->str() );
+            val = arr->addr( key->str(), key->hash() );
             // exception
             if( !val ) goto error;
             // push the addr
             push_( sp, val );
         } else {
             // get the value
-            if( !arr->get( key->str(), &fval ) )
+            if( !arr->get( key->str(), &fval, key->hash() ) )
                 goto error;
             // push the value
             push_( ((t_CKFLOAT *&)sp), fval );
@@ -6581,14 +6708,14 @@ void Chuck_Instr_Array_Map_Access::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
         // check if writing
         if( m_emit_addr ) {
             // get the addr
-            val = arr->addr( key->str() );
+            val = arr->addr( key->str(), key->hash() );
             // exception
             if( !val ) goto error;
             // push the addr
             push_( sp, val );
         } else {
             // get the value
-            if( !arr->get( key->str(), &v2 ) )
+            if( !arr->get( key->str(), &v2, key->hash() ) )
                 goto error;
             // push the value
             push_( ((t_CKVEC2 *&)sp), v2 );
@@ -6603,14 +6730,14 @@ void Chuck_Instr_Array_Map_Access::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
         // check if writing
         if( m_emit_addr ) {
             // get the addr
-            val = arr->addr( key->str() );
+            val = arr->addr( key->str(), key->hash() );
             // exception
             if( !val ) goto error;
             // push the addr
             push_( sp, val );
         } else {
             // get the value
-            if( !arr->get( key->str(), &v3 ) )
+            if( !arr->get( key->str(), &v3, key->hash() ) )
                 goto error;
             // push the value
             push_( ((t_CKVEC3 *&)sp), v3 );
@@ -6625,14 +6752,14 @@ void Chuck_Instr_Array_Map_Access::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
         // check if writing
         if( m_emit_addr ) {
             // get the addr
-            val = arr->addr( key->str() );
+            val = arr->addr( key->str(), key->hash() );
             // exception
             if( !val ) goto error;
             // push the addr
             push_( sp, val );
         } else {
             // get the value
-            if( !arr->get( key->str(), &v4 ) )
+            if( !arr->get( key->str(), &v4, key->hash() ) )
                 goto error;
             // push the value
             push_( ((t_CKVEC4 *&)sp), v4 );
@@ -6918,8 +7045,8 @@ void Chuck_Instr_Array_Append::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
         Chuck_ArrayInt * arr = (Chuck_ArrayInt *)(*sp);
         // get value
         val = (t_CKINT)(*(sp+1));
-        // append
-        arr->push_back( val );
+        // append (fails only if fixed and full | 1.5.1.7)
+        if( !arr->push_back( val ) ) goto capacity_exceeded;
     }
     else if( m_val == kindof_FLOAT ) // ISSUE: 64-bit (fixed 1.3.1.0)
     {
@@ -6927,8 +7054,8 @@ void Chuck_Instr_Array_Append::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
         Chuck_ArrayFloat * arr = (Chuck_ArrayFloat *)(*sp);
         // get value
         fval = (*(t_CKFLOAT *)(sp+1));
-        // append
-        arr->push_back( fval );
+        // append (fails only if fixed and full | 1.5.1.7)
+        if( !arr->push_back( fval ) ) goto capacity_exceeded;
     }
     else if( m_val == kindof_VEC2 ) // ISSUE: 64-bit (fixed 1.3.1.0)
     {
@@ -6936,8 +7063,8 @@ void Chuck_Instr_Array_Append::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
         Chuck_Array16 * arr = (Chuck_Array16 *)(*sp);
         // get value
         v2 = (*(t_CKVEC2 *)(sp+1));
-        // append
-        arr->push_back( v2 );
+        // append (fails only if fixed and full | 1.5.1.7)
+        if( !arr->push_back( v2 ) ) goto capacity_exceeded;
     }
     else if( m_val == kindof_VEC3 ) // 1.3.5.3
     {
@@ -6945,8 +7072,8 @@ void Chuck_Instr_Array_Append::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
         Chuck_Array24 * arr = (Chuck_Array24 *)(*sp);
         // get value
         v3 = (*(t_CKVEC3 *)(sp+1));
-        // append
-        arr->push_back( v3 );
+        // append (fails only if fixed and full | 1.5.1.7)
+        if( !arr->push_back( v3 ) ) goto capacity_exceeded;
     }
     else if( m_val == kindof_VEC4 ) // 1.3.5.3
     {
@@ -6954,8 +7081,8 @@ void Chuck_Instr_Array_Append::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
         Chuck_Array32 * arr = (Chuck_Array32 *)(*sp);
         // get value
         v4 = (*(t_CKVEC4 *)(sp+1));
-        // append
-        arr->push_back( v4 );
+        // append (fails only if fixed and full | 1.5.1.7)
+        if( !arr->push_back( v4 ) ) goto capacity_exceeded;
     }
     else
         assert( FALSE );
@@ -6972,6 +7099,13 @@ null_pointer:
         m_linepos, shred->xid, shred->name.c_str() );
     goto done;
 
+capacity_exceeded:
+    // fixed array is full | 1.5.1.7
+    EM_exception(
+        "ArrayCapacityExceeded: (array append) fixed capacity '%ld' on line[%lu] in shred[id=%lu:%s]",
+        ((Chuck_Array *)(*sp))->capacity(), m_linepos, shred->xid, shred->name.c_str() );
+    goto done;
+
 done:
     // do something!
     shred->is_running = FALSE;
@@ -7036,9 +7170,42 @@ error:
 
 
 
+//-----------------------------------------------------------------------------
+// name: Chuck_Instr_Dot_Member_Func()
+// desc: constructor
+//-----------------------------------------------------------------------------
+Chuck_Instr_Dot_Member_Func::Chuck_Instr_Dot_Member_Func( t_CKUINT offset, t_CKBOOL to_code )
+{
+    m_offset = offset;
+    m_to_code = to_code;
+    m_ic_size = 0;
+    m_ic_hits = 0;
+    m_ic_misses = 0;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ~Chuck_Instr_Dot_Member_Func()
+// desc: destructor
+//-----------------------------------------------------------------------------
+Chuck_Instr_Dot_Member_Func::~Chuck_Instr_Dot_Member_Func()
+{
+    // release the cached types
+    for( t_CKUINT i = 0; i < m_ic_size; i++ )
+        CK_SAFE_RELEASE( m_ic_type[i] );
+    m_ic_size = 0;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: execute()
-// desc: ...
+// desc: look up member function by receiver type; most call sites only ever
+//       see one or a few types, which the inline cache answers without going
+//       through the vtable (or, if m_to_code, the function) | 1.5.1.7
 //-----------------------------------------------------------------------------
 void Chuck_Instr_Dot_Member_Func::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
 {
@@ -7046,6 +7213,10 @@ void Chuck_Instr_Dot_Member_Func::execute( Chuck_VM * vm, Chuck_VM_Shred * shred
     t_CKUINT *& sp = (t_CKUINT *&)shred->reg->sp;
     // the pointer
     t_CKUINT data;
+    // the receiver's type
+    Chuck_Type * type = NULL;
+    // the function
+    Chuck_Func * func = NULL;
 
     // pop the object pointer
     pop_( sp, 1 );
@@ -7053,10 +7224,41 @@ void Chuck_Instr_Dot_Member_Func::execute( Chuck_VM * vm, Chuck_VM_Shred * shred
     Chuck_Object * obj = (Chuck_Object *)(*sp);
     // check
     if( !obj ) goto error;
+
+    // look in the inline cache
+    type = obj->type_ref;
+    for( t_CKUINT i = 0; i < m_ic_size; i++ )
+    {
+        if( m_ic_type[i] == type )
+        {
+            // hit
+            m_ic_hits++;
+            vm->count_ic_hit();
+            CK_TRACK( shred->stat->ic_hits++ );
+            push_( sp, m_ic_value[i] );
+            return;
+        }
+    }
+
+    // miss
+    m_ic_misses++;
+    vm->count_ic_miss();
+    CK_TRACK( shred->stat->ic_misses++ );
     // make sure we are in range
     assert( m_offset < obj->vtable->funcs.size() );
+    // get the function
+    func = obj->vtable->funcs[m_offset];
     // calculate the data pointer
-    data = (t_CKUINT)(obj->vtable->funcs[m_offset]);
+    data = m_to_code ? (t_CKUINT)func->code : (t_CKUINT)func;
+    // remember, while there is room; the reference keeps the type (and the
+    // function) from being freed and its address reused while cached
+    if( type && m_ic_size < CK_INLINE_CACHE_SIZE )
+    {
+        CK_SAFE_ADD_REF( type );
+        m_ic_type[m_ic_size] = type;
+        m_ic_value[m_ic_size] = data;
+        m_ic_size++;
+    }
 
     // push the address
     push_( sp, data );
@@ -8959,6 +9161,1671 @@ const char * Chuck_Instr_Gack::params() const
 }
 
 
+
+#pragma mark === Superinstructions ===
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: top of reg stack += immediate
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Add_int_Imm::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    // operate in place on the top of the reg stack
+    val_(sp-1) = val_(sp-1) + (t_CKINT)m_val;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: top of reg stack -= immediate
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Minus_int_Imm::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    // operate in place on the top of the reg stack
+    val_(sp-1) = val_(sp-1) - (t_CKINT)m_val;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: top of reg stack *= immediate
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Times_int_Imm::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    // operate in place on the top of the reg stack
+    val_(sp-1) = val_(sp-1) * (t_CKINT)m_val;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: top of reg stack += immediate
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Add_double_Imm::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    // operate in place on the top of the reg stack
+    val_(sp-1) = val_(sp-1) + m_val;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: top of reg stack -= immediate
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Minus_double_Imm::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    // operate in place on the top of the reg stack
+    val_(sp-1) = val_(sp-1) - m_val;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: top of reg stack *= immediate
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Times_double_Imm::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    // operate in place on the top of the reg stack
+    val_(sp-1) = val_(sp-1) * m_val;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: top of reg stack += mem stack variable
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Add_int_Mem::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKBYTE * mem_sp = base ? shred->base_ref->stack : shred->mem->sp;
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    // operate in place on the top of the reg stack
+    val_(sp-1) = val_(sp-1) + *((t_CKINT *)(mem_sp + m_val));
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: top of reg stack -= mem stack variable
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Minus_int_Mem::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKBYTE * mem_sp = base ? shred->base_ref->stack : shred->mem->sp;
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    // operate in place on the top of the reg stack
+    val_(sp-1) = val_(sp-1) - *((t_CKINT *)(mem_sp + m_val));
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: top of reg stack *= mem stack variable
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Times_int_Mem::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKBYTE * mem_sp = base ? shred->base_ref->stack : shred->mem->sp;
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    // operate in place on the top of the reg stack
+    val_(sp-1) = val_(sp-1) * *((t_CKINT *)(mem_sp + m_val));
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: top of reg stack += mem stack variable
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Add_double_Mem::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKBYTE * mem_sp = base ? shred->base_ref->stack : shred->mem->sp;
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    // operate in place on the top of the reg stack
+    val_(sp-1) = val_(sp-1) + *((t_CKFLOAT *)(mem_sp + m_val));
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: top of reg stack -= mem stack variable
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Minus_double_Mem::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKBYTE * mem_sp = base ? shred->base_ref->stack : shred->mem->sp;
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    // operate in place on the top of the reg stack
+    val_(sp-1) = val_(sp-1) - *((t_CKFLOAT *)(mem_sp + m_val));
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: top of reg stack *= mem stack variable
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Times_double_Mem::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKBYTE * mem_sp = base ? shred->base_ref->stack : shred->mem->sp;
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    // operate in place on the top of the reg stack
+    val_(sp-1) = val_(sp-1) * *((t_CKFLOAT *)(mem_sp + m_val));
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: ...
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Branch_Eq_int_Zero::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 1 );
+    if( val_(sp) == 0 )
+        shred->next_pc = m_jmp;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: ...
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Branch_Neq_int_Zero::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 1 );
+    if( val_(sp) != 0 )
+        shred->next_pc = m_jmp;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: pop word from reg stack into mem stack variable
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Assign_Primitive_Mem::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKBYTE * mem_sp = base ? shred->base_ref->stack : shred->mem->sp;
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+
+    // pop word from reg stack
+    pop_( reg_sp, 1 );
+    // copy popped value into mem stack
+    *((t_CKUINT *)(mem_sp + m_val)) = *reg_sp;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: pop t_CKFLOAT from reg stack into mem stack variable
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Assign_Primitive2_Mem::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKBYTE * mem_sp = base ? shred->base_ref->stack : shred->mem->sp;
+    t_CKFLOAT *& reg_sp = (t_CKFLOAT *&)shred->reg->sp;
+
+    // pop t_CKFLOAT from reg stack
+    pop_( reg_sp, 1 );
+    // copy popped value into mem stack
+    *((t_CKFLOAT *)(mem_sp + m_val)) = *reg_sp;
+}
+
+
+
+
+
+
+#pragma mark === Direct-Threaded Dispatch ===
+
+
+//-----------------------------------------------------------------------------
+// direct-threaded handlers | 1.5.1.7 (added)
+// each handler below must have exactly the same effect as the execute() of
+// the instruction it was lowered from; the only difference is the operand,
+// which is read from the op (inline) instead of from the instruction object
+//-----------------------------------------------------------------------------
+static void ckth_generic( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    // not specialized; go through the instruction
+    op->instr->execute( vm, shred );
+}
+
+static void ckth_nop( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    // no op
+}
+
+static void ckth_goto( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    shred->next_pc = op->uval;
+}
+
+static void ckth_add_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    push_( sp, val_(sp) + val_(sp+1) );
+}
+
+static void ckth_minus_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    push_( sp, val_(sp) - val_(sp+1) );
+}
+
+static void ckth_times_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    push_( sp, val_(sp) * val_(sp+1) );
+}
+
+static void ckth_add_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    push_( sp, val_(sp) + val_(sp+1) );
+}
+
+static void ckth_minus_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    push_( sp, val_(sp) - val_(sp+1) );
+}
+
+static void ckth_times_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    push_( sp, val_(sp) * val_(sp+1) );
+}
+
+static void ckth_divide_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    push_( sp, val_(sp) / val_(sp+1) );
+}
+
+static void ckth_lt_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    push_( sp, val_(sp) < val_(sp+1) );
+}
+
+static void ckth_gt_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    push_( sp, val_(sp) > val_(sp+1) );
+}
+
+static void ckth_le_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    push_( sp, val_(sp) <= val_(sp+1) );
+}
+
+static void ckth_ge_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    push_( sp, val_(sp) >= val_(sp+1) );
+}
+
+static void ckth_eq_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    push_( sp, val_(sp) == val_(sp+1) );
+}
+
+static void ckth_neq_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    push_( sp, val_(sp) != val_(sp+1) );
+}
+
+static void ckth_lt_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    t_CKUINT *& sp_uint = (t_CKUINT *&)sp;
+    pop_( sp, 2 );
+    push_( sp_uint, val_(sp) < val_(sp+1) );
+}
+
+static void ckth_gt_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    t_CKUINT *& sp_uint = (t_CKUINT *&)sp;
+    pop_( sp, 2 );
+    push_( sp_uint, val_(sp) > val_(sp+1) );
+}
+
+static void ckth_le_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    t_CKUINT *& sp_uint = (t_CKUINT *&)sp;
+    pop_( sp, 2 );
+    push_( sp_uint, val_(sp) <= val_(sp+1) );
+}
+
+static void ckth_ge_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    t_CKUINT *& sp_uint = (t_CKUINT *&)sp;
+    pop_( sp, 2 );
+    push_( sp_uint, val_(sp) >= val_(sp+1) );
+}
+
+static void ckth_eq_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    t_CKUINT *& sp_uint = (t_CKUINT *&)sp;
+    pop_( sp, 2 );
+    push_( sp_uint, val_(sp) == val_(sp+1) );
+}
+
+static void ckth_neq_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    t_CKUINT *& sp_uint = (t_CKUINT *&)sp;
+    pop_( sp, 2 );
+    push_( sp_uint, val_(sp) != val_(sp+1) );
+}
+
+static void ckth_branch_lt_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    if( val_(sp) < val_(sp+1) )
+        shred->next_pc = op->uval;
+}
+
+static void ckth_branch_gt_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    if( val_(sp) > val_(sp+1) )
+        shred->next_pc = op->uval;
+}
+
+static void ckth_branch_le_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    if( val_(sp) <= val_(sp+1) )
+        shred->next_pc = op->uval;
+}
+
+static void ckth_branch_ge_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    if( val_(sp) >= val_(sp+1) )
+        shred->next_pc = op->uval;
+}
+
+static void ckth_branch_eq_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    if( val_(sp) == val_(sp+1) )
+        shred->next_pc = op->uval;
+}
+
+static void ckth_branch_neq_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    if( val_(sp) != val_(sp+1) )
+        shred->next_pc = op->uval;
+}
+
+static void ckth_branch_lt_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    if( val_(sp) < val_(sp+1) )
+        shred->next_pc = op->uval;
+}
+
+static void ckth_branch_gt_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    if( val_(sp) > val_(sp+1) )
+        shred->next_pc = op->uval;
+}
+
+static void ckth_branch_le_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    if( val_(sp) <= val_(sp+1) )
+        shred->next_pc = op->uval;
+}
+
+static void ckth_branch_ge_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    if( val_(sp) >= val_(sp+1) )
+        shred->next_pc = op->uval;
+}
+
+static void ckth_branch_eq_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    if( val_(sp) == val_(sp+1) )
+        shred->next_pc = op->uval;
+}
+
+static void ckth_branch_neq_double( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    pop_( sp, 2 );
+    if( val_(sp) != val_(sp+1) )
+        shred->next_pc = op->uval;
+}
+
+static void ckth_reg_push_imm( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    push_( reg_sp, op->uval );
+}
+
+static void ckth_reg_push_imm2( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& reg_sp = (t_CKFLOAT *&)shred->reg->sp;
+    push_( reg_sp, op->fval );
+}
+
+static void ckth_reg_pop_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    pop_( reg_sp, 1 );
+}
+
+static void ckth_reg_pop_float( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& reg_sp = (t_CKFLOAT *&)shred->reg->sp;
+    pop_( reg_sp, 1 );
+}
+
+static void ckth_reg_dup_last( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    push_( reg_sp, *(reg_sp-1) );
+}
+
+static void ckth_reg_push_mem( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    push_( reg_sp, *((t_CKUINT *)(shred->mem->sp + op->uval)) );
+}
+
+static void ckth_reg_push_mem_base( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    push_( reg_sp, *((t_CKUINT *)(shred->base_ref->stack + op->uval)) );
+}
+
+static void ckth_reg_push_mem2( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& reg_sp = (t_CKFLOAT *&)shred->reg->sp;
+    push_( reg_sp, *((t_CKFLOAT *)(shred->mem->sp + op->uval)) );
+}
+
+static void ckth_reg_push_mem2_base( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& reg_sp = (t_CKFLOAT *&)shred->reg->sp;
+    push_( reg_sp, *((t_CKFLOAT *)(shred->base_ref->stack + op->uval)) );
+}
+
+static void ckth_reg_push_mem_addr( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    push_( reg_sp, (t_CKUINT)(shred->mem->sp + op->uval) );
+}
+
+static void ckth_reg_push_mem_addr_base( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    push_( reg_sp, (t_CKUINT)(shred->base_ref->stack + op->uval) );
+}
+
+static void ckth_assign_primitive( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    pop_( reg_sp, 2 );
+    *((t_CKUINT *)(*(reg_sp+1))) = *reg_sp;
+    push_( reg_sp, *reg_sp );
+}
+
+static void ckth_assign_primitive2( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    pop_( reg_sp, 1 + (sz_FLOAT / sz_UINT) );
+    *( (t_CKFLOAT *)(*(reg_sp+(sz_FLOAT/sz_UINT))) ) = *(t_CKFLOAT *)reg_sp;
+    t_CKFLOAT *& sp_double = (t_CKFLOAT *&)reg_sp;
+    push_( sp_double, *sp_double );
+}
+
+static void ckth_add_int_imm( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) + (t_CKINT)op->uval;
+}
+
+static void ckth_minus_int_imm( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) - (t_CKINT)op->uval;
+}
+
+static void ckth_times_int_imm( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) * (t_CKINT)op->uval;
+}
+
+static void ckth_add_double_imm( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) + op->fval;
+}
+
+static void ckth_minus_double_imm( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) - op->fval;
+}
+
+static void ckth_times_double_imm( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) * op->fval;
+}
+
+static void ckth_add_int_mem( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) + *((t_CKINT *)(shred->mem->sp + op->uval));
+}
+
+static void ckth_add_int_mem_base( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) + *((t_CKINT *)(shred->base_ref->stack + op->uval));
+}
+
+static void ckth_minus_int_mem( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) - *((t_CKINT *)(shred->mem->sp + op->uval));
+}
+
+static void ckth_minus_int_mem_base( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) - *((t_CKINT *)(shred->base_ref->stack + op->uval));
+}
+
+static void ckth_times_int_mem( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) * *((t_CKINT *)(shred->mem->sp + op->uval));
+}
+
+static void ckth_times_int_mem_base( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) * *((t_CKINT *)(shred->base_ref->stack + op->uval));
+}
+
+static void ckth_add_double_mem( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) + *((t_CKFLOAT *)(shred->mem->sp + op->uval));
+}
+
+static void ckth_add_double_mem_base( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) + *((t_CKFLOAT *)(shred->base_ref->stack + op->uval));
+}
+
+static void ckth_minus_double_mem( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) - *((t_CKFLOAT *)(shred->mem->sp + op->uval));
+}
+
+static void ckth_minus_double_mem_base( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) - *((t_CKFLOAT *)(shred->base_ref->stack + op->uval));
+}
+
+static void ckth_times_double_mem( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) * *((t_CKFLOAT *)(shred->mem->sp + op->uval));
+}
+
+static void ckth_times_double_mem_base( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& sp = (t_CKFLOAT *&)shred->reg->sp;
+    val_(sp-1) = val_(sp-1) * *((t_CKFLOAT *)(shred->base_ref->stack + op->uval));
+}
+
+static void ckth_branch_eq_int_zero( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 1 );
+    if( val_(sp) == 0 )
+        shred->next_pc = op->uval;
+}
+
+static void ckth_branch_neq_int_zero( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKINT *& sp = (t_CKINT *&)shred->reg->sp;
+    pop_( sp, 1 );
+    if( val_(sp) != 0 )
+        shred->next_pc = op->uval;
+}
+
+static void ckth_assign_primitive_mem( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    pop_( reg_sp, 1 );
+    *((t_CKUINT *)(shred->mem->sp + op->uval)) = *reg_sp;
+}
+
+static void ckth_assign_primitive_mem_base( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    pop_( reg_sp, 1 );
+    *((t_CKUINT *)(shred->base_ref->stack + op->uval)) = *reg_sp;
+}
+
+static void ckth_assign_primitive2_mem( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& reg_sp = (t_CKFLOAT *&)shred->reg->sp;
+    pop_( reg_sp, 1 );
+    *((t_CKFLOAT *)(shred->mem->sp + op->uval)) = *reg_sp;
+}
+
+static void ckth_assign_primitive2_mem_base( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKFLOAT *& reg_sp = (t_CKFLOAT *&)shred->reg->sp;
+    pop_( reg_sp, 1 );
+    *((t_CKFLOAT *)(shred->base_ref->stack + op->uval)) = *reg_sp;
+}
+
+
+
+static void ckth_dot_member_data_int( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    Chuck_Object * obj = (Chuck_Object *)(*(reg_sp-1));
+    // null: let the instruction report it
+    if( !obj ) { op->instr->execute( vm, shred ); return; }
+    *(reg_sp-1) = *((t_CKUINT *)(obj->data + op->uval));
+}
+
+static void ckth_dot_member_data_float( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    Chuck_Object * obj = (Chuck_Object *)(*(reg_sp-1));
+    if( !obj ) { op->instr->execute( vm, shred ); return; }
+    // pop the object, push the float (which may be wider)
+    pop_( reg_sp, 1 );
+    push_float( reg_sp, *((t_CKFLOAT *)(obj->data + op->uval)) );
+}
+
+static void ckth_dot_member_data_addr( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    Chuck_Object * obj = (Chuck_Object *)(*(reg_sp-1));
+    if( !obj ) { op->instr->execute( vm, shred ); return; }
+    *(reg_sp-1) = (t_CKUINT)(obj->data + op->uval);
+}
+
+
+
+static void ckth_array_int_load_unchecked( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    reg_sp--;
+    *(reg_sp-1) = ((Chuck_ArrayInt *)(*(reg_sp-1)))->m_vector[*(t_CKINT *)reg_sp];
+}
+
+static void ckth_array_float_load_unchecked( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    // pop array and index, push the float (which may be wider)
+    pop_( reg_sp, 2 );
+    t_CKFLOAT val = ((Chuck_ArrayFloat *)(*reg_sp))->m_vector[*(t_CKINT *)(reg_sp+1)];
+    push_float( reg_sp, val );
+}
+
+static void ckth_array_int_addr_unchecked( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    reg_sp--;
+    *(reg_sp-1) = (t_CKUINT)&((Chuck_ArrayInt *)(*(reg_sp-1)))->m_vector[*(t_CKINT *)reg_sp];
+}
+
+static void ckth_array_float_addr_unchecked( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    reg_sp--;
+    *(reg_sp-1) = (t_CKUINT)&((Chuck_ArrayFloat *)(*(reg_sp-1)))->m_vector[*(t_CKINT *)reg_sp];
+}
+
+// (value, array, index) => value
+static void ckth_array_int_store_unchecked( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    reg_sp -= 2;
+    ((Chuck_ArrayInt *)(*reg_sp))->m_vector[*(t_CKINT *)(reg_sp+1)] = *(reg_sp-1);
+}
+
+static void ckth_array_float_store_unchecked( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    // the value (which may be wider) is under the array and index
+    pop_( reg_sp, 2 + sz_FLOAT / sz_UINT );
+    t_CKUINT * arr = reg_sp + sz_FLOAT / sz_UINT;
+    ((Chuck_ArrayFloat *)(*arr))->m_vector[*(t_CKINT *)(arr+1)] = *(t_CKFLOAT *)reg_sp;
+    reg_sp = arr;
+}
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_lower_threaded()
+// desc: lower an instruction into a direct-threaded op
+//-----------------------------------------------------------------------------
+void ck_lower_threaded( Chuck_Instr * instr, Chuck_VM_Threaded_Op & op, t_CKBOOL specialize )
+{
+    // remember the instruction
+    op.instr = instr;
+    op.uval = 0;
+    // ask the instruction for a specialized handler
+    if( specialize && instr->lower( op ) ) return;
+    // otherwise go through the instruction
+    op.handler = ckth_generic;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_threaded_template() | 1.5.1.7 (added)
+// desc: the native template (see chuck_jit.h) equivalent to a direct-threaded
+//       op, by handler; int and float variants share a template wherever
+//       both are 8-byte moves
+//-----------------------------------------------------------------------------
+t_CKUINT ck_threaded_template( const Chuck_VM_Threaded_Op & op )
+{
+    static const struct { f_ckvm_threaded handler; t_CKUINT t; } table[] =
+    {
+        { ckth_nop, ckjit_nop }, { ckth_goto, ckjit_goto },
+        { ckth_add_int, ckjit_add_int }, { ckth_minus_int, ckjit_minus_int },
+        { ckth_times_int, ckjit_times_int },
+        { ckth_add_double, ckjit_add_double }, { ckth_minus_double, ckjit_minus_double },
+        { ckth_times_double, ckjit_times_double }, { ckth_divide_double, ckjit_divide_double },
+        { ckth_lt_int, ckjit_lt_int }, { ckth_gt_int, ckjit_gt_int }, { ckth_le_int, ckjit_le_int },
+        { ckth_ge_int, ckjit_ge_int }, { ckth_eq_int, ckjit_eq_int }, { ckth_neq_int, ckjit_neq_int },
+        { ckth_lt_double, ckjit_lt_double }, { ckth_gt_double, ckjit_gt_double },
+        { ckth_le_double, ckjit_le_double }, { ckth_ge_double, ckjit_ge_double },
+        { ckth_eq_double, ckjit_eq_double }, { ckth_neq_double, ckjit_neq_double },
+        { ckth_branch_lt_int, ckjit_branch_lt_int }, { ckth_branch_gt_int, ckjit_branch_gt_int },
+        { ckth_branch_le_int, ckjit_branch_le_int }, { ckth_branch_ge_int, ckjit_branch_ge_int },
+        { ckth_branch_eq_int, ckjit_branch_eq_int }, { ckth_branch_neq_int, ckjit_branch_neq_int },
+        { ckth_branch_lt_double, ckjit_branch_lt_double }, { ckth_branch_gt_double, ckjit_branch_gt_double },
+        { ckth_branch_le_double, ckjit_branch_le_double }, { ckth_branch_ge_double, ckjit_branch_ge_double },
+        { ckth_branch_eq_double, ckjit_branch_eq_double }, { ckth_branch_neq_double, ckjit_branch_neq_double },
+        { ckth_branch_eq_int_zero, ckjit_branch_eq_int_zero }, { ckth_branch_neq_int_zero, ckjit_branch_neq_int_zero },
+        { ckth_reg_push_imm, ckjit_reg_push_imm }, { ckth_reg_push_imm2, ckjit_reg_push_imm },
+        { ckth_reg_pop_int, ckjit_reg_pop }, { ckth_reg_pop_float, ckjit_reg_pop },
+        { ckth_reg_dup_last, ckjit_reg_dup_last },
+        { ckth_reg_push_mem, ckjit_reg_push_mem }, { ckth_reg_push_mem2, ckjit_reg_push_mem },
+        { ckth_reg_push_mem_base, ckjit_reg_push_mem_base }, { ckth_reg_push_mem2_base, ckjit_reg_push_mem_base },
+        { ckth_reg_push_mem_addr, ckjit_reg_push_mem_addr },
+        { ckth_reg_push_mem_addr_base, ckjit_reg_push_mem_addr_base },
+        { ckth_assign_primitive, ckjit_assign_primitive }, { ckth_assign_primitive2, ckjit_assign_primitive },
+        { ckth_assign_primitive_mem, ckjit_assign_primitive_mem },
+        { ckth_assign_primitive2_mem, ckjit_assign_primitive_mem },
+        { ckth_assign_primitive_mem_base, ckjit_assign_primitive_mem_base },
+        { ckth_assign_primitive2_mem_base, ckjit_assign_primitive_mem_base },
+        { ckth_add_int_imm, ckjit_add_int_imm }, { ckth_minus_int_imm, ckjit_minus_int_imm },
+        { ckth_times_int_imm, ckjit_times_int_imm },
+        { ckth_add_double_imm, ckjit_add_double_imm }, { ckth_minus_double_imm, ckjit_minus_double_imm },
+        { ckth_times_double_imm, ckjit_times_double_imm },
+        { ckth_add_int_mem, ckjit_add_int_mem }, { ckth_add_int_mem_base, ckjit_add_int_mem_base },
+        { ckth_minus_int_mem, ckjit_minus_int_mem }, { ckth_minus_int_mem_base, ckjit_minus_int_mem_base },
+        { ckth_times_int_mem, ckjit_times_int_mem }, { ckth_times_int_mem_base, ckjit_times_int_mem_base },
+        { ckth_add_double_mem, ckjit_add_double_mem }, { ckth_add_double_mem_base, ckjit_add_double_mem_base },
+        { ckth_minus_double_mem, ckjit_minus_double_mem }, { ckth_minus_double_mem_base, ckjit_minus_double_mem_base },
+        { ckth_times_double_mem, ckjit_times_double_mem }, { ckth_times_double_mem_base, ckjit_times_double_mem_base },
+    };
+
+    // look up
+    for( t_CKUINT i = 0; i < sizeof(table)/sizeof(table[0]); i++ )
+        if( table[i].handler == op.handler ) return table[i].t;
+
+    // everything else stays in the interpreter
+    return ckjit_none;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: lower()
+// desc: specialized direct-threaded handlers, with inline operands
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_Instr_Dot_Member_Data::lower( Chuck_VM_Threaded_Op & op )
+{
+    // address, or int/float value; (vectors go through execute())
+    if( m_emit_addr ) op.handler = ckth_dot_member_data_addr;
+    else if( m_kind == kindof_INT ) op.handler = ckth_dot_member_data_int;
+    else if( m_kind == kindof_FLOAT ) op.handler = ckth_dot_member_data_float;
+    else return FALSE;
+    op.uval = m_offset;
+    return TRUE;
+}
+t_CKBOOL Chuck_Instr_ArrayInt_Load_Unchecked::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_array_int_load_unchecked; return TRUE; }
+t_CKBOOL Chuck_Instr_ArrayFloat_Load_Unchecked::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_array_float_load_unchecked; return TRUE; }
+t_CKBOOL Chuck_Instr_ArrayInt_Addr_Unchecked::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_array_int_addr_unchecked; return TRUE; }
+t_CKBOOL Chuck_Instr_ArrayFloat_Addr_Unchecked::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_array_float_addr_unchecked; return TRUE; }
+t_CKBOOL Chuck_Instr_ArrayInt_Store_Unchecked::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_array_int_store_unchecked; return TRUE; }
+t_CKBOOL Chuck_Instr_ArrayFloat_Store_Unchecked::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_array_float_store_unchecked; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_add_int; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_minus_int; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_times_int; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_add_double; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_minus_double; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_times_double; return TRUE; }
+t_CKBOOL Chuck_Instr_Divide_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_divide_double; return TRUE; }
+t_CKBOOL Chuck_Instr_Lt_int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_lt_int; return TRUE; }
+t_CKBOOL Chuck_Instr_Gt_int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_gt_int; return TRUE; }
+t_CKBOOL Chuck_Instr_Le_int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_le_int; return TRUE; }
+t_CKBOOL Chuck_Instr_Ge_int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_ge_int; return TRUE; }
+t_CKBOOL Chuck_Instr_Eq_int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_eq_int; return TRUE; }
+t_CKBOOL Chuck_Instr_Neq_int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_neq_int; return TRUE; }
+t_CKBOOL Chuck_Instr_Lt_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_lt_double; return TRUE; }
+t_CKBOOL Chuck_Instr_Gt_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_gt_double; return TRUE; }
+t_CKBOOL Chuck_Instr_Le_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_le_double; return TRUE; }
+t_CKBOOL Chuck_Instr_Ge_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_ge_double; return TRUE; }
+t_CKBOOL Chuck_Instr_Eq_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_eq_double; return TRUE; }
+t_CKBOOL Chuck_Instr_Neq_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_neq_double; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Lt_int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_branch_lt_int; op.uval = m_jmp; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Gt_int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_branch_gt_int; op.uval = m_jmp; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Le_int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_branch_le_int; op.uval = m_jmp; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Ge_int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_branch_ge_int; op.uval = m_jmp; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Eq_int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_branch_eq_int; op.uval = m_jmp; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Neq_int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_branch_neq_int; op.uval = m_jmp; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Lt_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_branch_lt_double; op.uval = m_jmp; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Gt_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_branch_gt_double; op.uval = m_jmp; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Le_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_branch_le_double; op.uval = m_jmp; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Ge_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_branch_ge_double; op.uval = m_jmp; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Eq_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_branch_eq_double; op.uval = m_jmp; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Neq_double::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_branch_neq_double; op.uval = m_jmp; return TRUE; }
+t_CKBOOL Chuck_Instr_Goto::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_goto; op.uval = m_jmp; return TRUE; }
+t_CKBOOL Chuck_Instr_Nop::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_nop; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Imm::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_reg_push_imm; op.uval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Imm2::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_reg_push_imm2; op.fval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Pop_Int::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_reg_pop_int; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Pop_Float::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_reg_pop_float; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Dup_Last::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_reg_dup_last; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Mem::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = base ? ckth_reg_push_mem_base : ckth_reg_push_mem; op.uval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Mem2::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = base ? ckth_reg_push_mem2_base : ckth_reg_push_mem2; op.uval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Mem_Addr::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = base ? ckth_reg_push_mem_addr_base : ckth_reg_push_mem_addr; op.uval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Assign_Primitive::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_assign_primitive; return TRUE; }
+t_CKBOOL Chuck_Instr_Assign_Primitive2::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_assign_primitive2; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_int_Imm::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_add_int_imm; op.uval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_int_Imm::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_minus_int_imm; op.uval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_int_Imm::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_times_int_imm; op.uval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_double_Imm::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_add_double_imm; op.fval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_double_Imm::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_minus_double_imm; op.fval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_double_Imm::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_times_double_imm; op.fval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_int_Mem::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = base ? ckth_add_int_mem_base : ckth_add_int_mem; op.uval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_int_Mem::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = base ? ckth_minus_int_mem_base : ckth_minus_int_mem; op.uval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_int_Mem::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = base ? ckth_times_int_mem_base : ckth_times_int_mem; op.uval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_double_Mem::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = base ? ckth_add_double_mem_base : ckth_add_double_mem; op.uval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_double_Mem::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = base ? ckth_minus_double_mem_base : ckth_minus_double_mem; op.uval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_double_Mem::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = base ? ckth_times_double_mem_base : ckth_times_double_mem; op.uval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Eq_int_Zero::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_branch_eq_int_zero; op.uval = m_jmp; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Neq_int_Zero::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = ckth_branch_neq_int_zero; op.uval = m_jmp; return TRUE; }
+t_CKBOOL Chuck_Instr_Assign_Primitive_Mem::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = base ? ckth_assign_primitive_mem_base : ckth_assign_primitive_mem; op.uval = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Assign_Primitive2_Mem::lower( Chuck_VM_Threaded_Op & op )
+{ op.handler = base ? ckth_assign_primitive2_mem_base : ckth_assign_primitive2_mem; op.uval = m_val; return TRUE; }
+
+
+
+#pragma mark === Stack Effects ===
+
+
+//-----------------------------------------------------------------------------
+// name: ck_kindof_size()
+// desc: size in bytes of a value of the given kind on the operand stack
+//-----------------------------------------------------------------------------
+static t_CKUINT ck_kindof_size( t_CKUINT kind )
+{
+    switch( kind )
+    {
+        case kindof_INT: return sz_INT;
+        case kindof_FLOAT: return sz_FLOAT;
+        case kindof_VEC2: return sz_VEC2;
+        case kindof_VEC3: return sz_VEC3;
+        case kindof_VEC4: return sz_VEC4;
+        default: return 0;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_args_size()
+// desc: size in bytes of function arguments as popped by the func call
+//       instructions (which round up to whole ints)
+//-----------------------------------------------------------------------------
+static t_CKUINT ck_args_size( t_CKUINT stack_depth )
+{
+    return ( ( stack_depth / sz_INT ) + ( stack_depth & 0x3 ? 1 : 0 ) ) * sz_UINT;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: stack_effect()
+// desc: static operand stack effect of each instruction, in bytes; used by
+//       Chuck_VM_Code::verify() to compute the maximum stack depth of code
+//       (instructions without one make their code unverifiable) | 1.5.1.7
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_Instr_Add_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Mod_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Mod_int_Reverse::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_int_Reverse::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Divide_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Divide_int_Reverse::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_PreInc_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_PostInc_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_PreDec_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_PostDec_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Complement_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Not_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Negate_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Negate_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_double_Reverse::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Divide_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Divide_double_Reverse::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Mod_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Mod_double_Reverse::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_complex::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_COMPLEX; push = sz_COMPLEX; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_complex::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_COMPLEX; push = sz_COMPLEX; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_complex_Reverse::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_COMPLEX; push = sz_COMPLEX; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_complex::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_COMPLEX; push = sz_COMPLEX; return TRUE; }
+t_CKBOOL Chuck_Instr_Divide_complex::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_COMPLEX; push = sz_COMPLEX; return TRUE; }
+t_CKBOOL Chuck_Instr_Divide_complex_Reverse::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_COMPLEX; push = sz_COMPLEX; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_polar::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_POLAR; push = sz_POLAR; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_polar::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_POLAR; push = sz_POLAR; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_polar_Reverse::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_POLAR; push = sz_POLAR; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_polar::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_POLAR; push = sz_POLAR; return TRUE; }
+t_CKBOOL Chuck_Instr_Divide_polar::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_POLAR; push = sz_POLAR; return TRUE; }
+t_CKBOOL Chuck_Instr_Divide_polar_Reverse::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_POLAR; push = sz_POLAR; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_vec2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_VEC2; push = sz_VEC2; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_vec2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_VEC2; push = sz_VEC2; return TRUE; }
+t_CKBOOL Chuck_Instr_float_Times_vec2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_VEC2; push = sz_VEC2; return TRUE; }
+t_CKBOOL Chuck_Instr_vec2_Times_float::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC2 + sz_FLOAT; push = sz_VEC2; return TRUE; }
+t_CKBOOL Chuck_Instr_vec2_Divide_float::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC2 + sz_FLOAT; push = sz_VEC2; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_vec3::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_VEC3; push = sz_VEC3; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_vec3::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_VEC3; push = sz_VEC3; return TRUE; }
+t_CKBOOL Chuck_Instr_XProduct_vec3::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_VEC3; push = sz_VEC3; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_vec4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_VEC4; push = sz_VEC4; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_vec4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_VEC4; push = sz_VEC4; return TRUE; }
+t_CKBOOL Chuck_Instr_XProduct_vec4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_VEC4; push = sz_VEC4; return TRUE; }
+t_CKBOOL Chuck_Instr_float_Times_vec3::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_VEC3; push = sz_VEC3; return TRUE; }
+t_CKBOOL Chuck_Instr_vec3_Times_float::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC3 + sz_FLOAT; push = sz_VEC3; return TRUE; }
+t_CKBOOL Chuck_Instr_vec3_Divide_float::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC3 + sz_FLOAT; push = sz_VEC3; return TRUE; }
+t_CKBOOL Chuck_Instr_float_Times_vec4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_VEC4; push = sz_VEC4; return TRUE; }
+t_CKBOOL Chuck_Instr_vec4_Times_float::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC4 + sz_FLOAT; push = sz_VEC4; return TRUE; }
+t_CKBOOL Chuck_Instr_vec4_Divide_float::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC4 + sz_FLOAT; push = sz_VEC4; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_int_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Mod_int_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_int_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_int_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Divide_int_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_double_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_UINT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_double_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_UINT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_double_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_UINT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Divide_double_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_UINT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Mod_double_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_UINT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_complex_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_COMPLEX + sz_UINT; push = sz_COMPLEX; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_complex_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_COMPLEX + sz_UINT; push = sz_COMPLEX; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_complex_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_COMPLEX + sz_UINT; push = sz_COMPLEX; return TRUE; }
+t_CKBOOL Chuck_Instr_Divide_complex_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_COMPLEX + sz_UINT; push = sz_COMPLEX; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_polar_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_POLAR + sz_UINT; push = sz_POLAR; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_polar_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_POLAR + sz_UINT; push = sz_POLAR; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_polar_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_POLAR + sz_UINT; push = sz_POLAR; return TRUE; }
+t_CKBOOL Chuck_Instr_Divide_polar_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_POLAR + sz_UINT; push = sz_POLAR; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_vec2_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC2 + sz_UINT; push = sz_VEC2; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_vec2_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC2 + sz_UINT; push = sz_VEC2; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_vec3_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC3 + sz_UINT; push = sz_VEC3; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_vec3_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC3 + sz_UINT; push = sz_VEC3; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_vec4_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC4 + sz_UINT; push = sz_VEC4; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_vec4_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC4 + sz_UINT; push = sz_VEC4; return TRUE; }
+t_CKBOOL Chuck_Instr_float_Times_vec2_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_UINT; push = sz_VEC2; return TRUE; }
+t_CKBOOL Chuck_Instr_float_Times_vec3_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_UINT; push = sz_VEC3; return TRUE; }
+t_CKBOOL Chuck_Instr_float_Times_vec4_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_UINT; push = sz_VEC4; return TRUE; }
+t_CKBOOL Chuck_Instr_vec2_Divide_float_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_UINT; push = sz_VEC2; return TRUE; }
+t_CKBOOL Chuck_Instr_vec3_Divide_float_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_UINT; push = sz_VEC3; return TRUE; }
+t_CKBOOL Chuck_Instr_vec4_Divide_float_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_UINT; push = sz_VEC4; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_string::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_string_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_string_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT + sz_INT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_string_float::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT + sz_FLOAT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_int_string::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_INT + sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_float_string::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_int_string_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_INT + sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_float_string_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Lt_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Gt_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Le_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Ge_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Eq_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Neq_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Lt_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Gt_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Le_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Ge_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Eq_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Neq_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Eq_int_IO_good::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Neq_int_IO_good::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Lt_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Gt_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Le_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Ge_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Eq_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Neq_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Lt_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Gt_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Le_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Ge_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Eq_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Neq_double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_FLOAT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Eq_complex::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_COMPLEX; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Neq_complex::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_COMPLEX; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Eq_vec2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_VEC2; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Neq_vec2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_VEC2; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Eq_vec3::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_VEC3; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Neq_vec3::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_VEC3; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Eq_vec4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_VEC4; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Neq_vec4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_VEC4; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Binary_And::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Binary_Or::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Binary_Xor::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Binary_Shift_Right::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Binary_Shift_Right_Reverse::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Binary_Shift_Left::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Binary_Shift_Left_Reverse::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Binary_And_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Binary_Or_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Binary_Xor_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Binary_Shift_Right_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Binary_Shift_Left_Assign::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_And::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Or::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_INT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Goto::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Pop_Int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_INT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Pop_Float::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Pop_Vec2ComplexPolar::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC2; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Pop_Vec3::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC3; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Pop_Vec4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC4; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Pop_WordsMulti::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = m_val * sz_WORD; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Imm::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Imm2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Imm4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_COMPLEX; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Zero::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = m_val; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Dup_Last::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Dup_Last2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Dup_Last_As_Pointer::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Now::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_TIME; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Me::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_This::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Start::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_TIME; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Maybe::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Mem::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Mem2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Mem4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_COMPLEX; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Mem_Vec3::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_VEC3; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Mem_Vec4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_VEC4; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Mem_Addr::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Global::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = m_type == te_globalFloat ? sz_FLOAT : sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Global_Addr::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Deref::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Deref2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Mem_Set_Imm::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Mem_Set_Imm2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Nop::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_EOC::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Alloc_Word::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Alloc_Word2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Alloc_Word4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Alloc_Vec3::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Alloc_Vec4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Alloc_Member_Word::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Alloc_Member_Word2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Alloc_Member_Word4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Alloc_Member_Vec3::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Alloc_Member_Vec4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Alloc_Word_Global::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Instantiate_Object::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Pre_Constructor::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Assign_String::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Assign_Primitive::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Assign_Primitive2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT + sz_FLOAT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Assign_Primitive4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT + sz_VEC2; push = sz_VEC2; return TRUE; }
+t_CKBOOL Chuck_Instr_Assign_PrimitiveVec3::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT + sz_VEC3; push = sz_VEC3; return TRUE; }
+t_CKBOOL Chuck_Instr_Assign_PrimitiveVec4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT + sz_VEC4; push = sz_VEC4; return TRUE; }
+t_CKBOOL Chuck_Instr_Assign_Object::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_AddRef_Object::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_AddRef_Object2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_AddRef_Object3::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Release_Object::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Release_Object2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Release_Object3_Pop_Int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Release_Object4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Func_To_Code::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Func_Return::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Time_Advance::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_TIME; push = sz_TIME; return TRUE; }
+t_CKBOOL Chuck_Instr_Event_Wait::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT; push = sz_TIME; return TRUE; }
+t_CKBOOL Chuck_Instr_ADC::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_DAC::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Bunghole::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Chout::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Cherr::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_UGen_Link::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_UGen_Array_Link::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_UGen_UnLink::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Cast_double2int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_Cast_int2double::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_INT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Cast_int2complex::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_INT; push = sz_COMPLEX; return TRUE; }
+t_CKBOOL Chuck_Instr_Cast_int2polar::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_INT; push = sz_POLAR; return TRUE; }
+t_CKBOOL Chuck_Instr_Cast_double2complex::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT; push = sz_COMPLEX; return TRUE; }
+t_CKBOOL Chuck_Instr_Cast_double2polar::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT; push = sz_POLAR; return TRUE; }
+t_CKBOOL Chuck_Instr_Cast_complex2polar::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_COMPLEX; push = sz_POLAR; return TRUE; }
+t_CKBOOL Chuck_Instr_Cast_polar2complex::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_POLAR; push = sz_COMPLEX; return TRUE; }
+t_CKBOOL Chuck_Instr_Cast_vec2tovec3::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC2; push = sz_VEC3; return TRUE; }
+t_CKBOOL Chuck_Instr_Cast_vec2tovec4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC2; push = sz_VEC4; return TRUE; }
+t_CKBOOL Chuck_Instr_Cast_vec3tovec2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC3; push = sz_VEC2; return TRUE; }
+t_CKBOOL Chuck_Instr_Cast_vec4tovec2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC4; push = sz_VEC2; return TRUE; }
+t_CKBOOL Chuck_Instr_Cast_vec3tovec4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC3; push = sz_VEC4; return TRUE; }
+t_CKBOOL Chuck_Instr_Cast_vec4tovec3::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_VEC4; push = sz_VEC3; return TRUE; }
+t_CKBOOL Chuck_Instr_Cast_object2string::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Op_string::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_IO_in_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_IO_in_float::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_IO_in_string::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_IO_out_int::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT + sz_INT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_IO_out_float::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT + sz_FLOAT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_IO_out_complex::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT + sz_COMPLEX; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_IO_out_polar::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT + sz_POLAR; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_IO_out_vec2::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT + sz_VEC2; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_IO_out_vec3::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT + sz_VEC3; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_IO_out_vec4::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT + sz_VEC4; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_IO_out_string::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Hack::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Gack::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_int_Imm::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_int_Imm::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_int_Imm::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_double_Imm::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_double_Imm::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_double_Imm::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_int_Mem::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_int_Mem::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_int_Mem::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Add_double_Mem::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Minus_double_Mem::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Times_double_Mem::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Eq_int_Zero::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_INT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Branch_Neq_int_Zero::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_INT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Assign_Primitive_Mem::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Assign_Primitive2_Mem::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Init_Loop_Counter::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_INT; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Dec_Loop_Counter::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Reg_Push_Loop_Counter_Deref::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Pop_Loop_Counter::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = 0; return TRUE; }
+t_CKBOOL Chuck_Instr_Dot_Member_Data::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT; push = m_emit_addr ? sz_UINT : ck_kindof_size( m_kind ); return TRUE; }
+t_CKBOOL Chuck_Instr_Dot_Member_Func::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Dot_Primitive_Func::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Dot_Static_Data::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT; push = m_emit_addr ? sz_UINT : ck_kindof_size( m_kind ); return TRUE; }
+t_CKBOOL Chuck_Instr_Dot_Static_Import_Data::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = m_emit_addr ? sz_UINT : ck_kindof_size( m_kind ); return TRUE; }
+t_CKBOOL Chuck_Instr_Dot_Static_Func::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 0; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Dot_Cmp_First::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = m_is_mem ? sz_UINT : ck_kindof_size( m_kind ); push = m_emit_addr ? sz_UINT : sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Dot_Cmp_Second::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = m_is_mem ? sz_UINT : ck_kindof_size( m_kind ); push = m_emit_addr ? sz_UINT : sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Dot_Cmp_Third::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = m_is_mem ? sz_UINT : ck_kindof_size( m_kind ); push = m_emit_addr ? sz_UINT : sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Dot_Cmp_Fourth::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = m_is_mem ? sz_UINT : ck_kindof_size( m_kind ); push = m_emit_addr ? sz_UINT : sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Array_Access::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = m_emit_addr ? sz_UINT : ck_kindof_size( m_kind ); return TRUE; }
+t_CKBOOL Chuck_Instr_ArrayInt_Load_Unchecked::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_ArrayFloat_Load_Unchecked::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_ArrayInt_Addr_Unchecked::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_ArrayFloat_Addr_Unchecked::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_ArrayInt_Store_Unchecked::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_INT + 2 * sz_UINT; push = sz_INT; return TRUE; }
+t_CKBOOL Chuck_Instr_ArrayFloat_Store_Unchecked::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_FLOAT + 2 * sz_UINT; push = sz_FLOAT; return TRUE; }
+t_CKBOOL Chuck_Instr_Array_Map_Access::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT; push = m_emit_addr ? sz_UINT : ck_kindof_size( m_kind ); return TRUE; }
+t_CKBOOL Chuck_Instr_Array_Access_Multi::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = (m_depth + 1) * sz_UINT; push = m_emit_addr ? sz_UINT : ck_kindof_size( m_kind ); return TRUE; }
+t_CKBOOL Chuck_Instr_Array_Append::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = sz_UINT + ck_kindof_size( m_val ); push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Array_Init_Literal::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = m_length * m_type_ref->size; push = sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Array_Alloc::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = m_depth * sz_UINT; push = ( m_is_obj && !m_is_ref ? 4 : 1 ) * sz_UINT; return TRUE; }
+t_CKBOOL Chuck_Instr_Func_Call::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT + ck_args_size( m_arg_size ); push = m_ret_size; return m_known; }
+t_CKBOOL Chuck_Instr_Func_Call_Member::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT + ck_args_size( m_func_ref->code->stack_depth ); push = ck_kindof_size( m_val ); return TRUE; }
+t_CKBOOL Chuck_Instr_Func_Call_Static::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT + ck_args_size( m_func_ref->code->stack_depth ); push = ck_kindof_size( m_val ); return TRUE; }
+t_CKBOOL Chuck_Instr_Func_Call_Global::stack_effect( t_CKUINT & pop, t_CKUINT & push ) const
+{ pop = 2 * sz_UINT + ck_args_size( m_func_ref->code->stack_depth ); push = ck_kindof_size( m_val ); return TRUE; }
+
+
 // actions to throw exception
 void ck_throw_exception( Chuck_VM_Shred * shred, const char * name )
 {
@@ -43,6 +43,7 @@ struct Chuck_VM;
 struct Chuck_VM_Shred;
 struct Chuck_Type;
 struct Chuck_Func;
+struct Chuck_Instr;
 
 // 1.4.2.0 (ge) | added for switching from snprintf()
 #define CK_PRINT_BUF_LENGTH 256
@@ -50,6 +51,28 @@ struct Chuck_Func;
 
 
 
+//-----------------------------------------------------------------------------
+// name: struct Chuck_VM_Threaded_Op | 1.5.1.7 (added)
+// desc: one slot in the direct-threaded form of a Chuck_VM_Code; holds a
+//       handler and an inline copy of the instruction's operand, so that
+//       the interpreter loop can skip the virtual call on hot instructions
+//-----------------------------------------------------------------------------
+struct Chuck_VM_Threaded_Op;
+// handler function prototype
+typedef void (* f_ckvm_threaded)( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred );
+struct Chuck_VM_Threaded_Op
+{
+    // the handler to run for this slot
+    f_ckvm_threaded handler;
+    // the instruction this slot was lowered from
+    Chuck_Instr * instr;
+    // inline operand (immediate, memory offset, or jump target)
+    union { t_CKUINT uval; t_CKFLOAT fval; };
+};
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: struct Chuck_Instr
 // desc: ...
@@ -62,6 +85,19 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred ) = 0;
+    // fill in a direct-threaded op for this instruction; returning FALSE
+    // means no specialized handler exists (the generic handler is used)
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op ) { return FALSE; }
+
+public:
+    // static effect on the operand (reg) stack, in bytes popped and then
+    // pushed; returning FALSE means the effect is not known statically,
+    // which makes the containing code unverifiable | 1.5.1.7
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const { return FALSE; }
+    // control flow: whether this instruction may jump, and where
+    virtual t_CKBOOL branch_target( t_CKUINT & target ) const { return FALSE; }
+    // control flow: whether execution never falls through to the next
+    virtual t_CKBOOL is_terminal() const { return FALSE; }
 
 public:
     virtual const char * name() const;
@@ -97,8 +133,11 @@ struct Chuck_Instr_Branch_Op : public Chuck_Instr
 public:
     Chuck_Instr_Branch_Op() : m_jmp(0) { }
     inline void set( t_CKUINT jmp ) { m_jmp = jmp; }
+    inline t_CKUINT get() const { return m_jmp; }
 
 public:
+    virtual t_CKBOOL branch_target( t_CKUINT & target ) const
+    { target = m_jmp; return TRUE; }
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH]; snprintf( buffer, CK_PRINT_BUF_LENGTH, "%ld", (long)m_jmp ); return buffer; }
 
@@ -171,6 +210,8 @@ struct Chuck_Instr_Add_int : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -184,6 +225,7 @@ struct Chuck_Instr_PreInc_int : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -197,6 +239,7 @@ struct Chuck_Instr_PostInc_int : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -210,6 +253,7 @@ struct Chuck_Instr_PreDec_int : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -223,6 +267,7 @@ struct Chuck_Instr_PostDec_int : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -253,6 +298,7 @@ struct Chuck_Instr_Complement_int : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -266,6 +312,7 @@ struct Chuck_Instr_Mod_int : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -279,6 +326,7 @@ struct Chuck_Instr_Mod_int_Reverse : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -292,6 +340,8 @@ struct Chuck_Instr_Minus_int : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -305,6 +355,7 @@ struct Chuck_Instr_Minus_int_Reverse : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -318,6 +369,8 @@ struct Chuck_Instr_Times_int : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -331,6 +384,7 @@ struct Chuck_Instr_Divide_int : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -344,6 +398,7 @@ struct Chuck_Instr_Divide_int_Reverse : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -357,6 +412,8 @@ struct Chuck_Instr_Add_double : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -370,6 +427,8 @@ struct Chuck_Instr_Minus_double : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -383,6 +442,7 @@ struct Chuck_Instr_Minus_double_Reverse : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -396,6 +456,8 @@ struct Chuck_Instr_Times_double : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -409,6 +471,8 @@ struct Chuck_Instr_Divide_double : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -422,6 +486,7 @@ struct Chuck_Instr_Divide_double_Reverse : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -435,6 +500,7 @@ struct Chuck_Instr_Mod_double : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -448,6 +514,7 @@ struct Chuck_Instr_Mod_double_Reverse : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -461,6 +528,7 @@ struct Chuck_Instr_Add_complex : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -474,6 +542,7 @@ struct Chuck_Instr_Minus_complex : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -487,6 +556,7 @@ struct Chuck_Instr_Minus_complex_Reverse : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -500,6 +570,7 @@ struct Chuck_Instr_Times_complex : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -513,6 +584,7 @@ struct Chuck_Instr_Divide_complex : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -526,6 +598,7 @@ struct Chuck_Instr_Divide_complex_Reverse : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -539,6 +612,7 @@ struct Chuck_Instr_Add_polar : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -552,6 +626,7 @@ struct Chuck_Instr_Minus_polar : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -565,6 +640,7 @@ struct Chuck_Instr_Minus_polar_Reverse : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -578,6 +654,7 @@ struct Chuck_Instr_Times_polar : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -591,6 +668,7 @@ struct Chuck_Instr_Divide_polar : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -604,6 +682,7 @@ struct Chuck_Instr_Divide_polar_Reverse : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -617,6 +696,7 @@ struct Chuck_Instr_Add_vec2 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -630,6 +710,7 @@ struct Chuck_Instr_Minus_vec2 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -643,6 +724,7 @@ struct Chuck_Instr_float_Times_vec2 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -656,6 +738,7 @@ struct Chuck_Instr_vec2_Times_float : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -669,6 +752,7 @@ struct Chuck_Instr_vec2_Divide_float : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -682,6 +766,7 @@ struct Chuck_Instr_Add_vec3 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -695,6 +780,7 @@ struct Chuck_Instr_Minus_vec3 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -708,6 +794,7 @@ struct Chuck_Instr_XProduct_vec3 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -721,6 +808,7 @@ struct Chuck_Instr_Add_vec4 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -734,6 +822,7 @@ struct Chuck_Instr_Minus_vec4 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -747,6 +836,7 @@ struct Chuck_Instr_XProduct_vec4 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -760,6 +850,7 @@ struct Chuck_Instr_float_Times_vec3 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -773,6 +864,7 @@ struct Chuck_Instr_vec3_Times_float : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -786,6 +878,7 @@ struct Chuck_Instr_vec3_Divide_float : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -799,6 +892,7 @@ struct Chuck_Instr_float_Times_vec4 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -812,6 +906,7 @@ struct Chuck_Instr_vec4_Times_float : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -825,6 +920,7 @@ struct Chuck_Instr_vec4_Divide_float : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -838,6 +934,7 @@ struct Chuck_Instr_Add_int_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -851,6 +948,7 @@ struct Chuck_Instr_Mod_int_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -864,6 +962,7 @@ struct Chuck_Instr_Minus_int_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -877,6 +976,7 @@ struct Chuck_Instr_Times_int_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -890,6 +990,7 @@ struct Chuck_Instr_Divide_int_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -903,6 +1004,7 @@ struct Chuck_Instr_Add_double_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -916,6 +1018,7 @@ struct Chuck_Instr_Minus_double_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -929,6 +1032,7 @@ struct Chuck_Instr_Times_double_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -942,6 +1046,7 @@ struct Chuck_Instr_Divide_double_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -955,6 +1060,7 @@ struct Chuck_Instr_Mod_double_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -968,6 +1074,7 @@ struct Chuck_Instr_Add_complex_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -981,6 +1088,7 @@ struct Chuck_Instr_Minus_complex_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -994,6 +1102,7 @@ struct Chuck_Instr_Times_complex_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1007,6 +1116,7 @@ struct Chuck_Instr_Divide_complex_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1020,6 +1130,7 @@ struct Chuck_Instr_Add_polar_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1033,6 +1144,7 @@ struct Chuck_Instr_Minus_polar_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1046,6 +1158,7 @@ struct Chuck_Instr_Times_polar_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1059,6 +1172,7 @@ struct Chuck_Instr_Divide_polar_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1072,6 +1186,7 @@ struct Chuck_Instr_Add_vec2_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1085,6 +1200,7 @@ struct Chuck_Instr_Minus_vec2_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1098,6 +1214,7 @@ struct Chuck_Instr_Add_vec3_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1111,6 +1228,7 @@ struct Chuck_Instr_Minus_vec3_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1137,6 +1255,7 @@ struct Chuck_Instr_Add_vec4_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1150,6 +1269,7 @@ struct Chuck_Instr_Minus_vec4_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1176,6 +1296,7 @@ struct Chuck_Instr_float_Times_vec2_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1189,6 +1310,7 @@ struct Chuck_Instr_float_Times_vec3_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1202,6 +1324,7 @@ struct Chuck_Instr_float_Times_vec4_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1215,6 +1338,7 @@ struct Chuck_Instr_vec2_Divide_float_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1227,6 +1351,7 @@ struct Chuck_Instr_vec3_Divide_float_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1240,6 +1365,7 @@ struct Chuck_Instr_vec4_Divide_float_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1254,6 +1380,7 @@ struct Chuck_Instr_Add_string : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1267,6 +1394,7 @@ struct Chuck_Instr_Add_string_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1280,6 +1408,7 @@ struct Chuck_Instr_Add_string_int : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1293,6 +1422,7 @@ struct Chuck_Instr_Add_string_float : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1306,6 +1436,7 @@ struct Chuck_Instr_Add_int_string : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1319,6 +1450,7 @@ struct Chuck_Instr_Add_float_string : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1332,6 +1464,7 @@ struct Chuck_Instr_Add_int_string_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1345,6 +1478,7 @@ struct Chuck_Instr_Add_float_string_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1359,6 +1493,8 @@ struct Chuck_Instr_Branch_Lt_int : public Chuck_Instr_Branch_Op
 public:
     Chuck_Instr_Branch_Lt_int( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1373,6 +1509,8 @@ struct Chuck_Instr_Branch_Gt_int : public Chuck_Instr_Branch_Op
 public:
     Chuck_Instr_Branch_Gt_int( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1387,6 +1525,8 @@ struct Chuck_Instr_Branch_Le_int : public Chuck_Instr_Branch_Op
 public:
     Chuck_Instr_Branch_Le_int( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1401,6 +1541,8 @@ struct Chuck_Instr_Branch_Ge_int : public Chuck_Instr_Branch_Op
 public:
     Chuck_Instr_Branch_Ge_int( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1415,6 +1557,8 @@ struct Chuck_Instr_Branch_Eq_int : public Chuck_Instr_Branch_Op
 public:
     Chuck_Instr_Branch_Eq_int( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1429,6 +1573,8 @@ struct Chuck_Instr_Branch_Neq_int : public Chuck_Instr_Branch_Op
 public:
     Chuck_Instr_Branch_Neq_int( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1443,6 +1589,8 @@ struct Chuck_Instr_Branch_Lt_double : public Chuck_Instr_Branch_Op
 public:
     Chuck_Instr_Branch_Lt_double( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1457,6 +1605,8 @@ struct Chuck_Instr_Branch_Gt_double : public Chuck_Instr_Branch_Op
 public:
     Chuck_Instr_Branch_Gt_double( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1471,6 +1621,8 @@ struct Chuck_Instr_Branch_Le_double : public Chuck_Instr_Branch_Op
 public:
     Chuck_Instr_Branch_Le_double( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1485,6 +1637,8 @@ struct Chuck_Instr_Branch_Ge_double : public Chuck_Instr_Branch_Op
 public:
     Chuck_Instr_Branch_Ge_double( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1499,6 +1653,8 @@ struct Chuck_Instr_Branch_Eq_double : public Chuck_Instr_Branch_Op
 public:
     Chuck_Instr_Branch_Eq_double( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1513,6 +1669,8 @@ struct Chuck_Instr_Branch_Neq_double : public Chuck_Instr_Branch_Op
 public:
     Chuck_Instr_Branch_Neq_double( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1527,6 +1685,7 @@ struct Chuck_Instr_Branch_Eq_int_IO_good : public Chuck_Instr_Branch_Op
 public:
     Chuck_Instr_Branch_Eq_int_IO_good( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1541,6 +1700,7 @@ struct Chuck_Instr_Branch_Neq_int_IO_good : public Chuck_Instr_Branch_Op
 public:
     Chuck_Instr_Branch_Neq_int_IO_good( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1554,6 +1714,8 @@ struct Chuck_Instr_Lt_int : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1567,6 +1729,8 @@ struct Chuck_Instr_Gt_int : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1580,6 +1744,8 @@ struct Chuck_Instr_Le_int : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1593,6 +1759,8 @@ struct Chuck_Instr_Ge_int : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1606,6 +1774,8 @@ struct Chuck_Instr_Eq_int : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1619,6 +1789,8 @@ struct Chuck_Instr_Neq_int : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1632,6 +1804,7 @@ struct Chuck_Instr_Not_int : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1645,6 +1818,7 @@ struct Chuck_Instr_Negate_int : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1658,6 +1832,7 @@ struct Chuck_Instr_Negate_double : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1671,6 +1846,8 @@ struct Chuck_Instr_Lt_double : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1684,6 +1861,8 @@ struct Chuck_Instr_Gt_double : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1697,6 +1876,8 @@ struct Chuck_Instr_Le_double : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1710,6 +1891,8 @@ struct Chuck_Instr_Ge_double : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1723,6 +1906,8 @@ struct Chuck_Instr_Eq_double : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1736,6 +1921,8 @@ struct Chuck_Instr_Neq_double : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -1749,6 +1936,7 @@ struct Chuck_Instr_Eq_complex : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1762,6 +1950,7 @@ struct Chuck_Instr_Neq_complex : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1775,6 +1964,7 @@ struct Chuck_Instr_Eq_vec2 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1788,6 +1978,7 @@ struct Chuck_Instr_Neq_vec2 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1801,6 +1992,7 @@ struct Chuck_Instr_Eq_vec3 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1814,6 +2006,7 @@ struct Chuck_Instr_Neq_vec3 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1827,6 +2020,7 @@ struct Chuck_Instr_Eq_vec4 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1840,6 +2034,7 @@ struct Chuck_Instr_Neq_vec4 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1853,6 +2048,7 @@ struct Chuck_Instr_Binary_And : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1866,6 +2062,7 @@ struct Chuck_Instr_Binary_Or : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1879,6 +2076,7 @@ struct Chuck_Instr_Binary_Xor : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1892,6 +2090,7 @@ struct Chuck_Instr_Binary_Shift_Right : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1905,6 +2104,7 @@ struct Chuck_Instr_Binary_Shift_Right_Reverse : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1918,6 +2118,7 @@ struct Chuck_Instr_Binary_Shift_Left : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1931,6 +2132,7 @@ struct Chuck_Instr_Binary_Shift_Left_Reverse : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1944,6 +2146,7 @@ struct Chuck_Instr_Binary_And_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1957,6 +2160,7 @@ struct Chuck_Instr_Binary_Or_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1970,6 +2174,7 @@ struct Chuck_Instr_Binary_Xor_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1983,6 +2188,7 @@ struct Chuck_Instr_Binary_Shift_Right_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -1996,6 +2202,7 @@ struct Chuck_Instr_Binary_Shift_Left_Assign : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2009,6 +2216,7 @@ struct Chuck_Instr_And : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2022,6 +2230,7 @@ struct Chuck_Instr_Or : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2036,6 +2245,9 @@ struct Chuck_Instr_Goto : public Chuck_Instr_Branch_Op
 public:
     Chuck_Instr_Goto( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL is_terminal() const { return TRUE; }
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -2049,6 +2261,8 @@ struct Chuck_Instr_Reg_Pop_Int : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -2062,6 +2276,8 @@ struct Chuck_Instr_Reg_Pop_Float : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -2075,6 +2291,7 @@ struct Chuck_Instr_Reg_Pop_Vec2ComplexPolar : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2101,6 +2318,7 @@ struct Chuck_Instr_Reg_Pop_Vec3 : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2114,6 +2332,7 @@ struct Chuck_Instr_Reg_Pop_Vec4 : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2128,6 +2347,7 @@ struct Chuck_Instr_Reg_Pop_WordsMulti : public Chuck_Instr_Unary_Op
 public:
     Chuck_Instr_Reg_Pop_WordsMulti( t_CKUINT num ) { this->set( num ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2171,6 +2391,8 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -2188,6 +2410,8 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -2205,6 +2429,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 
 protected:
     t_CKFLOAT m_val2;
@@ -2225,6 +2450,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2238,6 +2464,8 @@ struct Chuck_Instr_Reg_Dup_Last : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -2251,6 +2479,7 @@ struct Chuck_Instr_Reg_Dup_Last2 : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2266,6 +2495,7 @@ public:
     Chuck_Instr_Reg_Dup_Last_As_Pointer( t_CKUINT sizeInWords )
     { this->set( sizeInWords ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2279,6 +2509,7 @@ struct Chuck_Instr_Reg_Push_Now : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2292,6 +2523,7 @@ struct Chuck_Instr_Reg_Push_Me : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2305,6 +2537,7 @@ struct Chuck_Instr_Reg_Push_This : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2318,6 +2551,7 @@ struct Chuck_Instr_Reg_Push_Start : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2331,6 +2565,7 @@ struct Chuck_Instr_Reg_Push_Maybe : public Chuck_Instr_Unary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2348,11 +2583,17 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "src=%ld, base=%ld", (long)m_val, (long)base );
       return buffer; }
 
+public:
+    // whether this uses the global stack base | 1.5.1.7 (added)
+    inline t_CKBOOL use_base() const { return base; }
+
 protected:
     // use global stack base
     t_CKBOOL base;
@@ -2373,11 +2614,17 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "src=%ld, base=%ld", (long)m_val, (long)base );
       return buffer; }
 
+public:
+    // whether this uses the global stack base | 1.5.1.7 (added)
+    inline t_CKBOOL use_base() const { return base; }
+
 protected:
     // use global stack base
     t_CKBOOL base;
@@ -2398,6 +2645,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "src=%ld, base=%ld", (long)m_val, (long)base );
@@ -2423,6 +2671,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
         snprintf( buffer, CK_PRINT_BUF_LENGTH, "src=%ld, base=%ld", (long)m_val, (long)base );
@@ -2448,6 +2697,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
         snprintf( buffer, CK_PRINT_BUF_LENGTH, "src=%ld, base=%ld", (long)m_val, (long)base );
@@ -2473,6 +2723,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "name='%s'", m_name.c_str() );
@@ -2498,11 +2749,17 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "src=%ld, base=%ld", (long)m_val, (long)base );
       return buffer; }
 
+public:
+    // whether this uses the global stack base | 1.5.1.7 (added)
+    inline t_CKBOOL use_base() const { return base; }
+
 protected:
     // use global stack base
     t_CKBOOL base;
@@ -2523,6 +2780,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "name='%s'", m_name.c_str() );
@@ -2549,6 +2807,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2566,6 +2825,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2583,6 +2843,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "offset=%ld, value=%ld", (long)m_offset, (long)m_val );
@@ -2608,6 +2869,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "offset=%ld, value=%f", (long)m_offset, m_val );
@@ -2701,6 +2963,8 @@ struct Chuck_Instr_Nop : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -2714,6 +2978,8 @@ struct Chuck_Instr_EOC : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL is_terminal() const { return TRUE; }
 };
 
 
@@ -2734,6 +3000,7 @@ public:
     t_CKBOOL m_is_object;
 
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2750,6 +3017,7 @@ public:
     { this->set( offset ); }
 
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2766,6 +3034,7 @@ public:
     { this->set( offset ); }
 
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2782,6 +3051,7 @@ public:
     { this->set( offset ); }
 
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2798,6 +3068,7 @@ public:
     { this->set( offset ); }
 
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2814,6 +3085,7 @@ public:
     { this->set( offset ); }
 
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2830,6 +3102,7 @@ public:
     { this->set( offset ); }
 
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2846,6 +3119,7 @@ public:
     { this->set( offset ); }
 
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2862,6 +3136,7 @@ public:
     { this->set( offset ); }
 
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2878,6 +3153,7 @@ public:
     { this->set( offset ); }
 
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2913,6 +3189,7 @@ public:
     Chuck_Type * m_chuck_type;
 
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -2929,6 +3206,7 @@ public:
     { this->type = t; }
 
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const;
 
 public:
@@ -2949,6 +3227,7 @@ public:
     { pre_ctor = pre; this->stack_offset = offset; }
 
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     // virtual const char * params() const;
 
 public:
@@ -3027,6 +3306,7 @@ struct Chuck_Instr_Array_Append : public Chuck_Instr_Unary_Op
 {
     Chuck_Instr_Array_Append( t_CKUINT size ) { set( size ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     // virtual const char * params() const;
 };
 
@@ -3041,6 +3321,7 @@ struct Chuck_Instr_Assign_String : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3054,6 +3335,8 @@ struct Chuck_Instr_Assign_Primitive : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -3067,6 +3350,8 @@ struct Chuck_Instr_Assign_Primitive2 : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
 };
 
 
@@ -3080,6 +3365,7 @@ struct Chuck_Instr_Assign_Primitive4 : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3093,6 +3379,7 @@ struct Chuck_Instr_Assign_PrimitiveVec3 : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3106,6 +3393,7 @@ struct Chuck_Instr_Assign_PrimitiveVec4 : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3119,6 +3407,7 @@ struct Chuck_Instr_Assign_Object : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3149,6 +3438,7 @@ struct Chuck_Instr_AddRef_Object : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3167,6 +3457,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3181,6 +3472,7 @@ struct Chuck_Instr_Reg_AddRef_Object3 : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3194,6 +3486,7 @@ struct Chuck_Instr_Release_Object : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3212,6 +3505,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3226,6 +3520,7 @@ struct Chuck_Instr_Release_Object3_Pop_Int : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3244,6 +3539,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3257,6 +3553,7 @@ struct Chuck_Instr_Func_To_Code : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3268,8 +3565,21 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Func_Call : public Chuck_Instr
 {
+public:
+    Chuck_Instr_Func_Call() : m_arg_size(0), m_ret_size(0), m_known(FALSE) { }
+    // set the size of the callee's arguments and return value, in bytes,
+    // as known to the emitter; makes the stack effect known | 1.5.1.7
+    inline void set_sizes( t_CKUINT arg_size, t_CKUINT ret_size )
+    { m_arg_size = arg_size; m_ret_size = ret_size; m_known = TRUE; }
+
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+
+protected:
+    t_CKUINT m_arg_size;
+    t_CKUINT m_ret_size;
+    t_CKBOOL m_known;
 };
 
 
@@ -3287,6 +3597,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 
 public:
     Chuck_Func * m_func_ref; // 1.5.0.0 (ge) | added for arg list cleanup
@@ -3307,6 +3618,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 
 public:
     Chuck_Func * m_func_ref; // 1.5.0.0 (ge) | added for arg list cleanup
@@ -3327,6 +3639,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 
 public:
     Chuck_Func * m_func_ref;
@@ -3343,6 +3656,8 @@ struct Chuck_Instr_Func_Return : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL is_terminal() const { return TRUE; }
 };
 
 
@@ -3386,6 +3701,7 @@ struct Chuck_Instr_Time_Advance : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3399,6 +3715,7 @@ struct Chuck_Instr_Event_Wait : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3416,6 +3733,7 @@ public: // REFACTOR-2017: added env
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const { return m_param_str; }
 
 protected:
@@ -3443,6 +3761,7 @@ public: // REFACTOR-2017: added env
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const { return m_param_str; }
 
 protected:
@@ -3471,6 +3790,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "kind=%ld, emit_addr=%p istr=%ld",
@@ -3486,6 +3806,99 @@ protected:
 
 
 
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_ArrayInt_Load_Unchecked
+// desc: int array element, index proven in range by the compiler; no
+//       bounds check, reads m_vector directly | 1.5.1.7
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_ArrayInt_Load_Unchecked : public Chuck_Instr
+{
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_ArrayFloat_Load_Unchecked
+// desc: float array element, index proven in range | 1.5.1.7
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_ArrayFloat_Load_Unchecked : public Chuck_Instr
+{
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_ArrayInt_Addr_Unchecked
+// desc: address of int array element, index proven in range | 1.5.1.7
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_ArrayInt_Addr_Unchecked : public Chuck_Instr
+{
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_ArrayFloat_Addr_Unchecked
+// desc: address of float array element, index proven in range | 1.5.1.7
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_ArrayFloat_Addr_Unchecked : public Chuck_Instr
+{
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_ArrayInt_Store_Unchecked
+// desc: store into int array element, index proven in range; fused from
+//       ArrayInt_Addr_Unchecked + Assign_Primitive | 1.5.1.7
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_ArrayInt_Store_Unchecked : public Chuck_Instr
+{
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_ArrayFloat_Store_Unchecked
+// desc: store into float array element, index proven in range; fused from
+//       ArrayFloat_Addr_Unchecked + Assign_Primitive2 | 1.5.1.7
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_ArrayFloat_Store_Unchecked : public Chuck_Instr
+{
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+};
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: struct Chuck_Instr_Array_Map_Access
 // desc: ...
@@ -3498,6 +3911,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "kind=%ld, emit_addr=%p", (long)m_kind, (void *)m_emit_addr );
@@ -3525,6 +3939,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "depth=%ld, kind=%ld, emit_addr=%p", (long)m_depth, (long)m_kind, (void *)m_emit_addr );
@@ -3554,6 +3969,8 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "offset=%ld, kind=%ld, emit_addr=%p", (long)m_offset, (long)m_kind, (void *)m_emit_addr );
@@ -3568,25 +3985,49 @@ protected:
 
 
 
+// number of receiver types remembered per call site | 1.5.1.7
+#define CK_INLINE_CACHE_SIZE 4
 //-----------------------------------------------------------------------------
 // name: struct Chuck_Instr_Dot_Member_Func
-// desc: access the member function of object by offset
+// desc: access the member function of object by offset; remembers the
+//       function each receiver type resolved to (inline cache) | 1.5.1.7
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Dot_Member_Func : public Chuck_Instr
 {
 public:
-    Chuck_Instr_Dot_Member_Func( t_CKUINT offset )
-    { m_offset = offset; }
+    // if to_code is TRUE, push the function's Chuck_VM_Code * instead of the
+    // Chuck_Func * (i.e., with Chuck_Instr_Func_To_Code folded in) | 1.5.1.7
+    Chuck_Instr_Dot_Member_Func( t_CKUINT offset, t_CKBOOL to_code = FALSE );
+    virtual ~Chuck_Instr_Dot_Member_Func();
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
-      snprintf( buffer, CK_PRINT_BUF_LENGTH, "offset=%ld", (long)m_offset );
+      snprintf( buffer, CK_PRINT_BUF_LENGTH, "offset=%ld%s ic=%lu/%lu", (long)m_offset,
+                m_to_code ? " (to code)" : "", m_ic_hits, m_ic_hits + m_ic_misses );
       return buffer; }
 
+public:
+    // vtable offset
+    t_CKUINT get() const { return m_offset; }
+    // number of lookups answered by the inline cache
+    t_CKUINT ic_hits() const { return m_ic_hits; }
+    // number of lookups that went through the vtable
+    t_CKUINT ic_misses() const { return m_ic_misses; }
+
 protected:
     t_CKUINT m_offset;
+    t_CKBOOL m_to_code;
+    // receiver types seen here (each holding a reference), and what they
+    // resolved to; once full, further types are looked up every time
+    Chuck_Type * m_ic_type[CK_INLINE_CACHE_SIZE];
+    t_CKUINT m_ic_value[CK_INLINE_CACHE_SIZE];
+    t_CKUINT m_ic_size;
+    // hit counters
+    t_CKUINT m_ic_hits;
+    t_CKUINT m_ic_misses;
 };
 
 
@@ -3604,6 +4045,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
         snprintf( buffer, CK_PRINT_BUF_LENGTH, "native_func=%p", (void *)m_native_func );
@@ -3628,6 +4070,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "offset=%ld, size=%ld, kind=%ld, emit_addr=%p",
@@ -3656,6 +4099,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "addr=%p, kind=%ld, emit_addr=%p",
@@ -3683,6 +4127,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "func=%p", (void *)m_func );
@@ -3707,6 +4152,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "is_mem=%ld, emit_addr=%p", (long)m_is_mem, (void *)m_emit_addr );
@@ -3733,6 +4179,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
       snprintf( buffer, CK_PRINT_BUF_LENGTH, "is_mem=%ld, emit_addr=%p", (long)m_is_mem, (void *)m_emit_addr );
@@ -3759,6 +4206,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
         snprintf( buffer, CK_PRINT_BUF_LENGTH, "is_mem=%ld, emit_addr=%p", (long)m_is_mem, (void *)m_emit_addr );
@@ -3785,6 +4233,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const
     { static char buffer[CK_PRINT_BUF_LENGTH];
         snprintf( buffer, CK_PRINT_BUF_LENGTH, "is_mem=%ld, emit_addr=%p", (long)m_is_mem, (void *)m_emit_addr );
@@ -3807,6 +4256,7 @@ struct Chuck_Instr_ADC : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3820,6 +4270,7 @@ struct Chuck_Instr_DAC : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3833,6 +4284,7 @@ struct Chuck_Instr_Bunghole : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3846,6 +4298,7 @@ struct Chuck_Instr_Chout : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3859,6 +4312,7 @@ struct Chuck_Instr_Cherr : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3875,6 +4329,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 
 protected:
     t_CKBOOL m_isUpChuck;
@@ -3895,6 +4350,7 @@ public:
     { }
 
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 
 protected:
     t_CKBOOL m_srcIsArray, m_dstIsArray;
@@ -3911,6 +4367,7 @@ struct Chuck_Instr_UGen_UnLink : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -3989,6 +4446,7 @@ struct Chuck_Instr_Cast_double2int : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4002,6 +4460,7 @@ struct Chuck_Instr_Cast_int2double : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4015,6 +4474,7 @@ struct Chuck_Instr_Cast_int2complex : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4028,6 +4488,7 @@ struct Chuck_Instr_Cast_int2polar : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4041,6 +4502,7 @@ struct Chuck_Instr_Cast_double2complex : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4054,6 +4516,7 @@ struct Chuck_Instr_Cast_double2polar : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4067,6 +4530,7 @@ struct Chuck_Instr_Cast_complex2polar : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4080,6 +4544,7 @@ struct Chuck_Instr_Cast_polar2complex : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4093,6 +4558,7 @@ struct Chuck_Instr_Cast_vec2tovec3 : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4106,6 +4572,7 @@ struct Chuck_Instr_Cast_vec2tovec4 : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4119,6 +4586,7 @@ struct Chuck_Instr_Cast_vec3tovec2 : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4132,6 +4600,7 @@ struct Chuck_Instr_Cast_vec4tovec2 : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4145,6 +4614,7 @@ struct Chuck_Instr_Cast_vec3tovec4 : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4158,6 +4628,7 @@ struct Chuck_Instr_Cast_vec4tovec3 : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4171,6 +4642,7 @@ struct Chuck_Instr_Cast_object2string : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4187,6 +4659,7 @@ public:
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4200,6 +4673,7 @@ struct Chuck_Instr_Init_Loop_Counter : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4213,6 +4687,7 @@ struct Chuck_Instr_Reg_Push_Loop_Counter_Deref : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4226,6 +4701,7 @@ struct Chuck_Instr_Dec_Loop_Counter : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4239,6 +4715,7 @@ struct Chuck_Instr_Pop_Loop_Counter : public Chuck_Instr
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4279,6 +4756,7 @@ struct Chuck_Instr_IO_in_int : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4292,6 +4770,7 @@ struct Chuck_Instr_IO_in_float : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4305,6 +4784,7 @@ struct Chuck_Instr_IO_in_string : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4318,6 +4798,7 @@ struct Chuck_Instr_IO_out_int : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4331,6 +4812,7 @@ struct Chuck_Instr_IO_out_float : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4344,6 +4826,7 @@ struct Chuck_Instr_IO_out_complex : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4357,6 +4840,7 @@ struct Chuck_Instr_IO_out_polar : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4370,6 +4854,7 @@ struct Chuck_Instr_IO_out_vec2 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4383,6 +4868,7 @@ struct Chuck_Instr_IO_out_vec3 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4396,6 +4882,7 @@ struct Chuck_Instr_IO_out_vec4 : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4409,6 +4896,7 @@ struct Chuck_Instr_IO_out_string : public Chuck_Instr_Binary_Op
 {
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
 };
 
 
@@ -4424,6 +4912,7 @@ public:
     Chuck_Instr_Hack( Chuck_Type * type );
     virtual ~Chuck_Instr_Hack();
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const;
 
 protected:
@@ -4443,6 +4932,7 @@ public:
     Chuck_Instr_Gack( const std::vector<Chuck_Type *> & types );
     virtual ~Chuck_Instr_Gack();
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
     virtual const char * params() const;
 
 protected:
@@ -4452,6 +4942,347 @@ protected:
 
 
 
+//-----------------------------------------------------------------------------
+// superinstructions | 1.5.1.7 (added)
+// the instructions below are never emitted directly; they are produced by
+// the emitter's fusion pass (see emit_engine_fuse() in chuck_emit.cpp) by
+// combining common sequences of simpler instructions into one
+//-----------------------------------------------------------------------------
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Add_int_Imm
+// desc: fused Reg_Push_Imm + Add_int
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Add_int_Imm : public Chuck_Instr_Unary_Op
+{
+public:
+    Chuck_Instr_Add_int_Imm( t_CKINT val ) { this->set( (t_CKUINT)val ); }
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+};
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Minus_int_Imm
+// desc: fused Reg_Push_Imm + Minus_int
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Minus_int_Imm : public Chuck_Instr_Unary_Op
+{
+public:
+    Chuck_Instr_Minus_int_Imm( t_CKINT val ) { this->set( (t_CKUINT)val ); }
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+};
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Times_int_Imm
+// desc: fused Reg_Push_Imm + Times_int
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Times_int_Imm : public Chuck_Instr_Unary_Op
+{
+public:
+    Chuck_Instr_Times_int_Imm( t_CKINT val ) { this->set( (t_CKUINT)val ); }
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+};
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Add_double_Imm
+// desc: fused Reg_Push_Imm2 + Add_double
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Add_double_Imm : public Chuck_Instr_Unary_Op2
+{
+public:
+    Chuck_Instr_Add_double_Imm( t_CKFLOAT val ) { this->set( val ); }
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+};
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Minus_double_Imm
+// desc: fused Reg_Push_Imm2 + Minus_double
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Minus_double_Imm : public Chuck_Instr_Unary_Op2
+{
+public:
+    Chuck_Instr_Minus_double_Imm( t_CKFLOAT val ) { this->set( val ); }
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+};
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Times_double_Imm
+// desc: fused Reg_Push_Imm2 + Times_double
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Times_double_Imm : public Chuck_Instr_Unary_Op2
+{
+public:
+    Chuck_Instr_Times_double_Imm( t_CKFLOAT val ) { this->set( val ); }
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+};
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Add_int_Mem
+// desc: fused Reg_Push_Mem + Add_int
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Add_int_Mem : public Chuck_Instr_Unary_Op
+{
+public:
+    Chuck_Instr_Add_int_Mem( t_CKUINT src, t_CKBOOL use_base )
+    { this->set( src ); base = use_base; }
+
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+    virtual const char * params() const
+    { static char buffer[CK_PRINT_BUF_LENGTH];
+      snprintf( buffer, CK_PRINT_BUF_LENGTH, "src=%ld, base=%ld", (long)m_val, (long)base );
+      return buffer; }
+
+protected:
+    // use global stack base
+    t_CKBOOL base;
+};
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Minus_int_Mem
+// desc: fused Reg_Push_Mem + Minus_int
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Minus_int_Mem : public Chuck_Instr_Unary_Op
+{
+public:
+    Chuck_Instr_Minus_int_Mem( t_CKUINT src, t_CKBOOL use_base )
+    { this->set( src ); base = use_base; }
+
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+    virtual const char * params() const
+    { static char buffer[CK_PRINT_BUF_LENGTH];
+      snprintf( buffer, CK_PRINT_BUF_LENGTH, "src=%ld, base=%ld", (long)m_val, (long)base );
+      return buffer; }
+
+protected:
+    // use global stack base
+    t_CKBOOL base;
+};
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Times_int_Mem
+// desc: fused Reg_Push_Mem + Times_int
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Times_int_Mem : public Chuck_Instr_Unary_Op
+{
+public:
+    Chuck_Instr_Times_int_Mem( t_CKUINT src, t_CKBOOL use_base )
+    { this->set( src ); base = use_base; }
+
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+    virtual const char * params() const
+    { static char buffer[CK_PRINT_BUF_LENGTH];
+      snprintf( buffer, CK_PRINT_BUF_LENGTH, "src=%ld, base=%ld", (long)m_val, (long)base );
+      return buffer; }
+
+protected:
+    // use global stack base
+    t_CKBOOL base;
+};
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Add_double_Mem
+// desc: fused Reg_Push_Mem2 + Add_double
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Add_double_Mem : public Chuck_Instr_Unary_Op
+{
+public:
+    Chuck_Instr_Add_double_Mem( t_CKUINT src, t_CKBOOL use_base )
+    { this->set( src ); base = use_base; }
+
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+    virtual const char * params() const
+    { static char buffer[CK_PRINT_BUF_LENGTH];
+      snprintf( buffer, CK_PRINT_BUF_LENGTH, "src=%ld, base=%ld", (long)m_val, (long)base );
+      return buffer; }
+
+protected:
+    // use global stack base
+    t_CKBOOL base;
+};
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Minus_double_Mem
+// desc: fused Reg_Push_Mem2 + Minus_double
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Minus_double_Mem : public Chuck_Instr_Unary_Op
+{
+public:
+    Chuck_Instr_Minus_double_Mem( t_CKUINT src, t_CKBOOL use_base )
+    { this->set( src ); base = use_base; }
+
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+    virtual const char * params() const
+    { static char buffer[CK_PRINT_BUF_LENGTH];
+      snprintf( buffer, CK_PRINT_BUF_LENGTH, "src=%ld, base=%ld", (long)m_val, (long)base );
+      return buffer; }
+
+protected:
+    // use global stack base
+    t_CKBOOL base;
+};
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Times_double_Mem
+// desc: fused Reg_Push_Mem2 + Times_double
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Times_double_Mem : public Chuck_Instr_Unary_Op
+{
+public:
+    Chuck_Instr_Times_double_Mem( t_CKUINT src, t_CKBOOL use_base )
+    { this->set( src ); base = use_base; }
+
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+    virtual const char * params() const
+    { static char buffer[CK_PRINT_BUF_LENGTH];
+      snprintf( buffer, CK_PRINT_BUF_LENGTH, "src=%ld, base=%ld", (long)m_val, (long)base );
+      return buffer; }
+
+protected:
+    // use global stack base
+    t_CKBOOL base;
+};
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Branch_Eq_int_Zero
+// desc: fused Reg_Push_Imm(0) + Branch_Eq_int; branch if popped int is zero
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Branch_Eq_int_Zero : public Chuck_Instr_Branch_Op
+{
+public:
+    Chuck_Instr_Branch_Eq_int_Zero( t_CKUINT jmp ) { this->set( jmp ); }
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+};
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Branch_Neq_int_Zero
+// desc: fused Reg_Push_Imm(0) + Branch_Neq_int; branch if popped int is non-zero
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Branch_Neq_int_Zero : public Chuck_Instr_Branch_Op
+{
+public:
+    Chuck_Instr_Branch_Neq_int_Zero( t_CKUINT jmp ) { this->set( jmp ); }
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+};
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Assign_Primitive_Mem
+// desc: fused Reg_Push_Mem_Addr + Assign_Primitive + Reg_Pop_Int;
+//       pop word from reg stack into a mem stack variable
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Assign_Primitive_Mem : public Chuck_Instr_Unary_Op
+{
+public:
+    Chuck_Instr_Assign_Primitive_Mem( t_CKUINT dest, t_CKBOOL use_base )
+    { this->set( dest ); base = use_base; }
+
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+    virtual const char * params() const
+    { static char buffer[CK_PRINT_BUF_LENGTH];
+      snprintf( buffer, CK_PRINT_BUF_LENGTH, "dest=%ld, base=%ld", (long)m_val, (long)base );
+      return buffer; }
+
+protected:
+    // use global stack base
+    t_CKBOOL base;
+};
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Assign_Primitive2_Mem
+// desc: fused Reg_Push_Mem_Addr + Assign_Primitive2 + Reg_Pop_Float;
+//       pop t_CKFLOAT from reg stack into a mem stack variable
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Assign_Primitive2_Mem : public Chuck_Instr_Unary_Op
+{
+public:
+    Chuck_Instr_Assign_Primitive2_Mem( t_CKUINT dest, t_CKBOOL use_base )
+    { this->set( dest ); base = use_base; }
+
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual t_CKBOOL stack_effect( t_CKUINT & pop, t_CKUINT & push ) const;
+    virtual t_CKBOOL lower( Chuck_VM_Threaded_Op & op );
+    virtual const char * params() const
+    { static char buffer[CK_PRINT_BUF_LENGTH];
+      snprintf( buffer, CK_PRINT_BUF_LENGTH, "dest=%ld, base=%ld", (long)m_val, (long)base );
+      return buffer; }
+
+protected:
+    // use global stack base
+    t_CKBOOL base;
+};
+
+
+
+
 // runtime functions (REFACTOR-2017: added overloads)
 Chuck_Object * instantiate_and_initialize_object( Chuck_Type * type, Chuck_VM_Shred * shred );
 Chuck_Object * instantiate_and_initialize_object( Chuck_Type * type, Chuck_VM * vm );
@@ -4466,6 +5297,13 @@ void ck_throw_exception(Chuck_VM_Shred * shred, const char * name, t_CKFLOAT des
 void ck_throw_exception(Chuck_VM_Shred * shred, const char * name, const char * desc);
 // handle overflow (halt current shred, print message + possible reason)
 void ck_handle_overflow( Chuck_VM_Shred * shred, Chuck_VM * vm, const std::string & reason = "" );
+// lower an instruction into a direct-threaded op | 1.5.1.7 (added)
+// if `specialize` is FALSE, always use the generic handler (e.g., for code
+// whose instruction operands are patched at runtime)
+void ck_lower_threaded( Chuck_Instr * instr, Chuck_VM_Threaded_Op & op, t_CKBOOL specialize = TRUE );
+// the native template equivalent to a direct-threaded op (a ckjit_Template,
+// see chuck_jit.h), or ckjit_none | 1.5.1.7 (added)
+t_CKUINT ck_threaded_template( const Chuck_VM_Threaded_Op & op );
 
 // define SP offset
 #define push_( sp, val )         *(sp) = (val); (sp)++
@@ -4520,8 +4520,8 @@ THREAD_RETURN( THREAD_TYPE Chuck_IO_File::writeStr_thread ) (void * data)
     args->fileio_obj->write( args->stringArg );
     Chuck_Event * e = args->fileio_obj->m_asyncEvent;
     delete args;
-    e->broadcast_local(); // wake up
-    e->broadcast_global();
+    // wake up, by way of the VM thread | 1.5.1.7
+    e->queue_broadcast();
 
     return (THREAD_RETURN)0;
 }
@@ -4530,8 +4530,8 @@ THREAD_RETURN( THREAD_TYPE Chuck_IO_File::writeInt_thread ) (void * data)
 {
     async_args * args = (async_args *)data;
     args->fileio_obj->write( args->intArg );
-    args->fileio_obj->m_asyncEvent->broadcast_local(); // wake up
-    args->fileio_obj->m_asyncEvent->broadcast_global();
+    // wake up, by way of the VM thread | 1.5.1.7
+    args->fileio_obj->m_asyncEvent->queue_broadcast();
     delete args;
 
     return (THREAD_RETURN)0;
@@ -4541,8 +4541,8 @@ THREAD_RETURN( THREAD_TYPE Chuck_IO_File::writeFloat_thread ) (void * data)
 {
     async_args * args = (async_args *)data;
     args->fileio_obj->write( args->floatArg, args->intArg );
-    args->fileio_obj->m_asyncEvent->broadcast_local(); // wake up
-    args->fileio_obj->m_asyncEvent->broadcast_global();
+    // wake up, by way of the VM thread | 1.5.1.7
+    args->fileio_obj->m_asyncEvent->queue_broadcast();
     delete args;
 
     return (THREAD_RETURN)0;
@@ -0,0 +1,512 @@
+/*----------------------------------------------------------------------------
+  ChucK Concurrent, On-the-fly Audio Programming Language
+    Compiler and Virtual Machine
+
+  Copyright (c) 2004 Ge Wang and Perry R. Cook.  All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+  U.S.A.
+-----------------------------------------------------------------------------*/
+
+//-----------------------------------------------------------------------------
+// file: chuck_jit.cpp
+// desc: chuck template JIT; tier-up for hot Chuck_VM_Code
+//
+//       each template below is the x86-64 machine code for one
+//       direct-threaded handler in chuck_instr.cpp, and must have exactly
+//       the same effect (same stack layout, same SSE2 double arithmetic,
+//       same NaN behavior on compares); holes in a template are patched
+//       with the op's inline operand (imm64 or disp32) or a jump (rel32)
+//
+//       register use inside compiled code:
+//         rdi = Chuck_JIT_Frame *   r8 = operand stack pointer
+//         r9  = memory stack ptr    r10 = memory stack base
+//         rax, rcx, rdx, xmm0, xmm1 = scratch
+//       (all caller-saved, so compiled code needs no stack frame)
+//-----------------------------------------------------------------------------
+#include "chuck_jit.h"
+#include "chuck_vm.h"
+#include "chuck_instr.h"
+#include "chuck_errmsg.h"
+
+#ifdef __CHUCK_JIT__
+#include <sys/mman.h>
+#include <unistd.h>
+#include <string.h>
+#include <stddef.h>
+#include <vector>
+#include <map>
+#endif
+
+
+
+
+#ifdef __CHUCK_JIT__
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_JIT_Template
+// desc: a native code template and where to patch it (-1: no such hole)
+//-----------------------------------------------------------------------------
+struct Chuck_JIT_Template
+{
+    // the machine code
+    const t_CKBYTE * code;
+    // size in bytes
+    t_CKUINT size;
+    // offset of 64-bit immediate (the op's uval / fval)
+    t_CKINT imm;
+    // offset of 32-bit displacement (the op's uval, as a memory offset)
+    t_CKINT disp;
+    // offsets of 32-bit relative jumps to the op's branch target
+    t_CKINT jmp1;
+    t_CKINT jmp2;
+    // can control fall through to the next instruction?
+    t_CKBOOL falls;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// templates | operand stack slots are 8 bytes (t_CKINT, t_CKFLOAT, pointers)
+//-----------------------------------------------------------------------------
+// sub r8, 8
+#define CKJIT_POP1            0x49,0x83,0xe8,0x08
+// sub r8, 16
+#define CKJIT_POP2            0x49,0x83,0xe8,0x10
+// mov [r8], rax ; add r8, 8
+#define CKJIT_PUSH_RAX        0x49,0x89,0x00, 0x49,0x83,0xc0,0x08
+// mov rax, [r8-16] | mov [r8-16], rax
+#define CKJIT_LOAD_A          0x49,0x8b,0x40,0xf0
+#define CKJIT_STORE_A         0x49,0x89,0x40,0xf0
+// movsd xmm0, [r8-16] | movsd xmm0, [r8-8] | movsd [r8-16], xmm0
+#define CKJIT_LOADSD_A        0xf2,0x41,0x0f,0x10,0x40,0xf0
+#define CKJIT_LOADSD_B        0xf2,0x41,0x0f,0x10,0x40,0xf8
+#define CKJIT_STORESD_A       0xf2,0x41,0x0f,0x11,0x40,0xf0
+// ucomisd xmm0, [r8-16] | ucomisd xmm0, [r8-8]
+#define CKJIT_UCOMI_A         0x66,0x41,0x0f,0x2e,0x40,0xf0
+#define CKJIT_UCOMI_B         0x66,0x41,0x0f,0x2e,0x40,0xf8
+// movzx eax, al ; (result replaces lhs) ; pop
+#define CKJIT_CMP_TAIL        0x0f,0xb6,0xc0, CKJIT_STORE_A, CKJIT_POP1
+// (after pop 2) movsd xmm0, [r8] | movsd xmm0, [r8+8]
+#define CKJIT_BLOADSD_A       0xf2,0x41,0x0f,0x10,0x00
+#define CKJIT_BLOADSD_B       0xf2,0x41,0x0f,0x10,0x40,0x08
+// (after pop 2) ucomisd xmm0, [r8] | ucomisd xmm0, [r8+8]
+#define CKJIT_BUCOMI_A        0x66,0x41,0x0f,0x2e,0x00
+#define CKJIT_BUCOMI_B        0x66,0x41,0x0f,0x2e,0x40,0x08
+// jcc rel32
+#define CKJIT_JCC(cc)         0x0f,cc,0,0,0,0
+// mov rax, imm64 | mov rdx, imm64
+#define CKJIT_MOV_RAX_IMM     0x48,0xb8,0,0,0,0,0,0,0,0
+#define CKJIT_MOV_RDX_IMM     0x48,0xba,0,0,0,0,0,0,0,0
+// ModRM for [r9+disp32] (mem) and [r10+disp32] (base), with reg = rax/xmm0
+#define CKJIT_MEM             0x81
+#define CKJIT_BASE            0x82
+
+// a (a op b) for int: lhs in rax, op with [r8-8], store
+#define CKJIT_BINARY_INT(opc)  CKJIT_LOAD_A, 0x49,opc,0x40,0xf8, CKJIT_STORE_A, CKJIT_POP1
+// same, double (addsd 58 subsd 5c mulsd 59 divsd 5e)
+#define CKJIT_BINARY_DBL(opc)  CKJIT_LOADSD_A, 0xf2,0x41,0x0f,opc,0x40,0xf8, CKJIT_STORESD_A, CKJIT_POP1
+// int compare: setcc al
+#define CKJIT_CMP_INT(cc)      CKJIT_LOAD_A, 0x49,0x3b,0x40,0xf8, 0x0f,cc,0xc0, CKJIT_CMP_TAIL
+// int branch: pop 2; mov rax, [r8]; cmp rax, [r8+8]; jcc
+#define CKJIT_BRANCH_INT(cc)   CKJIT_POP2, 0x49,0x8b,0x00, 0x49,0x3b,0x40,0x08, CKJIT_JCC(cc)
+// push [mem+disp] | push lea [mem+disp]
+#define CKJIT_PUSH_MEM(m)      0x49,0x8b,m,0,0,0,0, CKJIT_PUSH_RAX
+#define CKJIT_PUSH_ADDR(m)     0x49,0x8d,m,0,0,0,0, CKJIT_PUSH_RAX
+// pop; mov rax, [r8]; mov [mem+disp], rax
+#define CKJIT_ASSIGN_MEM(m)    CKJIT_POP1, 0x49,0x8b,0x00, 0x49,0x89,m,0,0,0,0
+// top += imm | top -= imm
+#define CKJIT_INT_IMM(opc)     CKJIT_MOV_RAX_IMM, 0x49,opc,0x40,0xf8
+// movq xmm1, rax; top (op)= xmm1
+#define CKJIT_DBL_IMM(opc)     CKJIT_MOV_RAX_IMM, 0x66,0x48,0x0f,0x6e,0xc8, CKJIT_LOADSD_B, \
+                               0xf2,0x0f,opc,0xc1, 0xf2,0x41,0x0f,0x11,0x40,0xf8
+// mov rax, [mem+disp]; top (op)= rax
+#define CKJIT_INT_MEM(opc,m)   0x49,0x8b,m,0,0,0,0, 0x49,opc,0x40,0xf8
+// mov rax, top; imul rax, [mem+disp]; top = rax
+#define CKJIT_TIMES_INT_MEM(m) 0x49,0x8b,0x40,0xf8, 0x49,0x0f,0xaf,m,0,0,0,0, 0x49,0x89,0x40,0xf8
+// xmm0 = top; xmm0 (op)= [mem+disp]; top = xmm0
+#define CKJIT_DBL_MEM(opc,m)   CKJIT_LOADSD_B, 0xf2,0x41,0x0f,opc,m,0,0,0,0, 0xf2,0x41,0x0f,0x11,0x40,0xf8
+
+// the byte arrays
+static const t_CKBYTE ckjit_goto_[] = { 0xe9,0,0,0,0 };
+static const t_CKBYTE ckjit_add_int_[] = { CKJIT_BINARY_INT(0x03) };
+static const t_CKBYTE ckjit_minus_int_[] = { CKJIT_BINARY_INT(0x2b) };
+static const t_CKBYTE ckjit_times_int_[] = { CKJIT_LOAD_A, 0x49,0x0f,0xaf,0x40,0xf8, CKJIT_STORE_A, CKJIT_POP1 };
+static const t_CKBYTE ckjit_add_double_[] = { CKJIT_BINARY_DBL(0x58) };
+static const t_CKBYTE ckjit_minus_double_[] = { CKJIT_BINARY_DBL(0x5c) };
+static const t_CKBYTE ckjit_times_double_[] = { CKJIT_BINARY_DBL(0x59) };
+static const t_CKBYTE ckjit_divide_double_[] = { CKJIT_BINARY_DBL(0x5e) };
+static const t_CKBYTE ckjit_lt_int_[] = { CKJIT_CMP_INT(0x9c) };
+static const t_CKBYTE ckjit_gt_int_[] = { CKJIT_CMP_INT(0x9f) };
+static const t_CKBYTE ckjit_le_int_[] = { CKJIT_CMP_INT(0x9e) };
+static const t_CKBYTE ckjit_ge_int_[] = { CKJIT_CMP_INT(0x9d) };
+static const t_CKBYTE ckjit_eq_int_[] = { CKJIT_CMP_INT(0x94) };
+static const t_CKBYTE ckjit_neq_int_[] = { CKJIT_CMP_INT(0x95) };
+// double compares follow C: false on NaN, except !=
+// a < b is b > a (seta); a <= b is b >= a (setae)
+static const t_CKBYTE ckjit_lt_double_[] = { CKJIT_LOADSD_B, CKJIT_UCOMI_A, 0x0f,0x97,0xc0, CKJIT_CMP_TAIL };
+static const t_CKBYTE ckjit_gt_double_[] = { CKJIT_LOADSD_A, CKJIT_UCOMI_B, 0x0f,0x97,0xc0, CKJIT_CMP_TAIL };
+static const t_CKBYTE ckjit_le_double_[] = { CKJIT_LOADSD_B, CKJIT_UCOMI_A, 0x0f,0x93,0xc0, CKJIT_CMP_TAIL };
+static const t_CKBYTE ckjit_ge_double_[] = { CKJIT_LOADSD_A, CKJIT_UCOMI_B, 0x0f,0x93,0xc0, CKJIT_CMP_TAIL };
+// sete al; setnp cl; and al, cl | setne al; setp cl; or al, cl
+static const t_CKBYTE ckjit_eq_double_[] = { CKJIT_LOADSD_A, CKJIT_UCOMI_B, 0x0f,0x94,0xc0, 0x0f,0x9b,0xc1, 0x20,0xc8, CKJIT_CMP_TAIL };
+static const t_CKBYTE ckjit_neq_double_[] = { CKJIT_LOADSD_A, CKJIT_UCOMI_B, 0x0f,0x95,0xc0, 0x0f,0x9a,0xc1, 0x08,0xc8, CKJIT_CMP_TAIL };
+static const t_CKBYTE ckjit_branch_lt_int_[] = { CKJIT_BRANCH_INT(0x8c) };
+static const t_CKBYTE ckjit_branch_gt_int_[] = { CKJIT_BRANCH_INT(0x8f) };
+static const t_CKBYTE ckjit_branch_le_int_[] = { CKJIT_BRANCH_INT(0x8e) };
+static const t_CKBYTE ckjit_branch_ge_int_[] = { CKJIT_BRANCH_INT(0x8d) };
+static const t_CKBYTE ckjit_branch_eq_int_[] = { CKJIT_BRANCH_INT(0x84) };
+static const t_CKBYTE ckjit_branch_neq_int_[] = { CKJIT_BRANCH_INT(0x85) };
+// ja / jae, as for compares above
+static const t_CKBYTE ckjit_branch_lt_double_[] = { CKJIT_POP2, CKJIT_BLOADSD_B, CKJIT_BUCOMI_A, CKJIT_JCC(0x87) };
+static const t_CKBYTE ckjit_branch_gt_double_[] = { CKJIT_POP2, CKJIT_BLOADSD_A, CKJIT_BUCOMI_B, CKJIT_JCC(0x87) };
+static const t_CKBYTE ckjit_branch_le_double_[] = { CKJIT_POP2, CKJIT_BLOADSD_B, CKJIT_BUCOMI_A, CKJIT_JCC(0x83) };
+static const t_CKBYTE ckjit_branch_ge_double_[] = { CKJIT_POP2, CKJIT_BLOADSD_A, CKJIT_BUCOMI_B, CKJIT_JCC(0x83) };
+// jp +6 (unordered: not equal); je | jp; jne
+static const t_CKBYTE ckjit_branch_eq_double_[] = { CKJIT_POP2, CKJIT_BLOADSD_A, CKJIT_BUCOMI_B, 0x7a,0x06, CKJIT_JCC(0x84) };
+static const t_CKBYTE ckjit_branch_neq_double_[] = { CKJIT_POP2, CKJIT_BLOADSD_A, CKJIT_BUCOMI_B, CKJIT_JCC(0x8a), CKJIT_JCC(0x85) };
+// pop; cmp qword [r8], 0; je | jne
+static const t_CKBYTE ckjit_branch_eq_int_zero_[] = { CKJIT_POP1, 0x49,0x83,0x38,0x00, CKJIT_JCC(0x84) };
+static const t_CKBYTE ckjit_branch_neq_int_zero_[] = { CKJIT_POP1, 0x49,0x83,0x38,0x00, CKJIT_JCC(0x85) };
+static const t_CKBYTE ckjit_reg_push_imm_[] = { CKJIT_MOV_RAX_IMM, CKJIT_PUSH_RAX };
+static const t_CKBYTE ckjit_reg_pop_[] = { CKJIT_POP1 };
+static const t_CKBYTE ckjit_reg_dup_last_[] = { 0x49,0x8b,0x40,0xf8, CKJIT_PUSH_RAX };
+static const t_CKBYTE ckjit_reg_push_mem_[] = { CKJIT_PUSH_MEM(CKJIT_MEM) };
+static const t_CKBYTE ckjit_reg_push_mem_base_[] = { CKJIT_PUSH_MEM(CKJIT_BASE) };
+static const t_CKBYTE ckjit_reg_push_mem_addr_[] = { CKJIT_PUSH_ADDR(CKJIT_MEM) };
+static const t_CKBYTE ckjit_reg_push_mem_addr_base_[] = { CKJIT_PUSH_ADDR(CKJIT_BASE) };
+// value in rax, address in rdx; store; value stays (replacing the address)
+static const t_CKBYTE ckjit_assign_primitive_[] = { CKJIT_LOAD_A, 0x49,0x8b,0x50,0xf8, 0x48,0x89,0x02, CKJIT_POP1 };
+static const t_CKBYTE ckjit_assign_primitive_mem_[] = { CKJIT_ASSIGN_MEM(CKJIT_MEM) };
+static const t_CKBYTE ckjit_assign_primitive_mem_base_[] = { CKJIT_ASSIGN_MEM(CKJIT_BASE) };
+static const t_CKBYTE ckjit_add_int_imm_[] = { CKJIT_INT_IMM(0x01) };
+static const t_CKBYTE ckjit_minus_int_imm_[] = { CKJIT_INT_IMM(0x29) };
+static const t_CKBYTE ckjit_times_int_imm_[] = { CKJIT_MOV_RDX_IMM, 0x49,0x8b,0x40,0xf8, 0x48,0x0f,0xaf,0xc2, 0x49,0x89,0x40,0xf8 };
+static const t_CKBYTE ckjit_add_double_imm_[] = { CKJIT_DBL_IMM(0x58) };
+static const t_CKBYTE ckjit_minus_double_imm_[] = { CKJIT_DBL_IMM(0x5c) };
+static const t_CKBYTE ckjit_times_double_imm_[] = { CKJIT_DBL_IMM(0x59) };
+static const t_CKBYTE ckjit_add_int_mem_[] = { CKJIT_INT_MEM(0x01,CKJIT_MEM) };
+static const t_CKBYTE ckjit_add_int_mem_base_[] = { CKJIT_INT_MEM(0x01,CKJIT_BASE) };
+static const t_CKBYTE ckjit_minus_int_mem_[] = { CKJIT_INT_MEM(0x29,CKJIT_MEM) };
+static const t_CKBYTE ckjit_minus_int_mem_base_[] = { CKJIT_INT_MEM(0x29,CKJIT_BASE) };
+static const t_CKBYTE ckjit_times_int_mem_[] = { CKJIT_TIMES_INT_MEM(CKJIT_MEM) };
+static const t_CKBYTE ckjit_times_int_mem_base_[] = { CKJIT_TIMES_INT_MEM(CKJIT_BASE) };
+static const t_CKBYTE ckjit_add_double_mem_[] = { CKJIT_DBL_MEM(0x58,CKJIT_MEM) };
+static const t_CKBYTE ckjit_add_double_mem_base_[] = { CKJIT_DBL_MEM(0x58,CKJIT_BASE) };
+static const t_CKBYTE ckjit_minus_double_mem_[] = { CKJIT_DBL_MEM(0x5c,CKJIT_MEM) };
+static const t_CKBYTE ckjit_minus_double_mem_base_[] = { CKJIT_DBL_MEM(0x5c,CKJIT_BASE) };
+static const t_CKBYTE ckjit_times_double_mem_[] = { CKJIT_DBL_MEM(0x59,CKJIT_MEM) };
+static const t_CKBYTE ckjit_times_double_mem_base_[] = { CKJIT_DBL_MEM(0x59,CKJIT_BASE) };
+
+// entry: mov r8, [rdi]; mov r9, [rdi+8]; mov r10, [rdi+16]; jmp rel32
+static const t_CKBYTE ckjit_entry[] = { 0x4c,0x8b,0x07, 0x4c,0x8b,0x4f,0x08, 0x4c,0x8b,0x57,0x10, 0xe9,0,0,0,0 };
+#define CKJIT_ENTRY_JMP 12
+// exit: mov [rdi], r8; mov eax, imm32 (pc); ret
+static const t_CKBYTE ckjit_exit[] = { 0x4c,0x89,0x07, 0xb8,0,0,0,0, 0xc3 };
+#define CKJIT_EXIT_PC 4
+// backward jump: leave if the VM stopped or the shred was aborted
+// mov rax, [rdi+24]; cmp qword [rax], 0; je exit
+// mov rax, [rdi+32]; cmp qword [rax], 0; jne exit; jmp rel32 (the target)
+static const t_CKBYTE ckjit_check[] = { 0x48,0x8b,0x47,0x18, 0x48,0x83,0x38,0x00, 0x74,0x0f,
+                                        0x48,0x8b,0x47,0x20, 0x48,0x83,0x38,0x00, 0x75,0x05,
+                                        0xe9,0,0,0,0 };
+#define CKJIT_CHECK_JMP 21
+
+// template table entry
+#define CKJIT_T(a,imm,disp,j1,j2,falls) { a, sizeof(a), imm, disp, j1, j2, falls }
+#define CKJIT_T_OP(a) CKJIT_T(a,-1,-1,-1,-1,TRUE)
+
+// indexed by ckjit_Template
+static const Chuck_JIT_Template g_ckjit_templates[ckjit_NUM_TEMPLATES] =
+{
+    { NULL, 0, -1, -1, -1, -1, FALSE }, // ckjit_none
+    { NULL, 0, -1, -1, -1, -1, TRUE }, // ckjit_nop
+    CKJIT_T( ckjit_goto_, -1, -1, 1, -1, FALSE ),
+    CKJIT_T_OP( ckjit_add_int_ ), CKJIT_T_OP( ckjit_minus_int_ ), CKJIT_T_OP( ckjit_times_int_ ),
+    CKJIT_T_OP( ckjit_add_double_ ), CKJIT_T_OP( ckjit_minus_double_ ),
+    CKJIT_T_OP( ckjit_times_double_ ), CKJIT_T_OP( ckjit_divide_double_ ),
+    CKJIT_T_OP( ckjit_lt_int_ ), CKJIT_T_OP( ckjit_gt_int_ ), CKJIT_T_OP( ckjit_le_int_ ),
+    CKJIT_T_OP( ckjit_ge_int_ ), CKJIT_T_OP( ckjit_eq_int_ ), CKJIT_T_OP( ckjit_neq_int_ ),
+    CKJIT_T_OP( ckjit_lt_double_ ), CKJIT_T_OP( ckjit_gt_double_ ), CKJIT_T_OP( ckjit_le_double_ ),
+    CKJIT_T_OP( ckjit_ge_double_ ), CKJIT_T_OP( ckjit_eq_double_ ), CKJIT_T_OP( ckjit_neq_double_ ),
+    CKJIT_T( ckjit_branch_lt_int_, -1, -1, 13, -1, TRUE ),
+    CKJIT_T( ckjit_branch_gt_int_, -1, -1, 13, -1, TRUE ),
+    CKJIT_T( ckjit_branch_le_int_, -1, -1, 13, -1, TRUE ),
+    CKJIT_T( ckjit_branch_ge_int_, -1, -1, 13, -1, TRUE ),
+    CKJIT_T( ckjit_branch_eq_int_, -1, -1, 13, -1, TRUE ),
+    CKJIT_T( ckjit_branch_neq_int_, -1, -1, 13, -1, TRUE ),
+    CKJIT_T( ckjit_branch_lt_double_, -1, -1, 17, -1, TRUE ),
+    CKJIT_T( ckjit_branch_gt_double_, -1, -1, 17, -1, TRUE ),
+    CKJIT_T( ckjit_branch_le_double_, -1, -1, 17, -1, TRUE ),
+    CKJIT_T( ckjit_branch_ge_double_, -1, -1, 17, -1, TRUE ),
+    CKJIT_T( ckjit_branch_eq_double_, -1, -1, 19, -1, TRUE ),
+    CKJIT_T( ckjit_branch_neq_double_, -1, -1, 17, 23, TRUE ),
+    CKJIT_T( ckjit_branch_eq_int_zero_, -1, -1, 10, -1, TRUE ),
+    CKJIT_T( ckjit_branch_neq_int_zero_, -1, -1, 10, -1, TRUE ),
+    CKJIT_T( ckjit_reg_push_imm_, 2, -1, -1, -1, TRUE ),
+    CKJIT_T_OP( ckjit_reg_pop_ ), CKJIT_T_OP( ckjit_reg_dup_last_ ),
+    CKJIT_T( ckjit_reg_push_mem_, -1, 3, -1, -1, TRUE ),
+    CKJIT_T( ckjit_reg_push_mem_base_, -1, 3, -1, -1, TRUE ),
+    CKJIT_T( ckjit_reg_push_mem_addr_, -1, 3, -1, -1, TRUE ),
+    CKJIT_T( ckjit_reg_push_mem_addr_base_, -1, 3, -1, -1, TRUE ),
+    CKJIT_T_OP( ckjit_assign_primitive_ ),
+    CKJIT_T( ckjit_assign_primitive_mem_, -1, 10, -1, -1, TRUE ),
+    CKJIT_T( ckjit_assign_primitive_mem_base_, -1, 10, -1, -1, TRUE ),
+    CKJIT_T( ckjit_add_int_imm_, 2, -1, -1, -1, TRUE ),
+    CKJIT_T( ckjit_minus_int_imm_, 2, -1, -1, -1, TRUE ),
+    CKJIT_T( ckjit_times_int_imm_, 2, -1, -1, -1, TRUE ),
+    CKJIT_T( ckjit_add_double_imm_, 2, -1, -1, -1, TRUE ),
+    CKJIT_T( ckjit_minus_double_imm_, 2, -1, -1, -1, TRUE ),
+    CKJIT_T( ckjit_times_double_imm_, 2, -1, -1, -1, TRUE ),
+    CKJIT_T( ckjit_add_int_mem_, -1, 3, -1, -1, TRUE ),
+    CKJIT_T( ckjit_add_int_mem_base_, -1, 3, -1, -1, TRUE ),
+    CKJIT_T( ckjit_minus_int_mem_, -1, 3, -1, -1, TRUE ),
+    CKJIT_T( ckjit_minus_int_mem_base_, -1, 3, -1, -1, TRUE ),
+    CKJIT_T( ckjit_times_int_mem_, -1, 8, -1, -1, TRUE ),
+    CKJIT_T( ckjit_times_int_mem_base_, -1, 8, -1, -1, TRUE ),
+    CKJIT_T( ckjit_add_double_mem_, -1, 11, -1, -1, TRUE ),
+    CKJIT_T( ckjit_add_double_mem_base_, -1, 11, -1, -1, TRUE ),
+    CKJIT_T( ckjit_minus_double_mem_, -1, 11, -1, -1, TRUE ),
+    CKJIT_T( ckjit_minus_double_mem_base_, -1, 11, -1, -1, TRUE ),
+    CKJIT_T( ckjit_times_double_mem_, -1, 11, -1, -1, TRUE ),
+    CKJIT_T( ckjit_times_double_mem_base_, -1, 11, -1, -1, TRUE ),
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_JIT_Assembler
+// desc: lays out templates and stubs for one Chuck_VM_Code
+//-----------------------------------------------------------------------------
+struct Chuck_JIT_Assembler
+{
+    // the code so far
+    std::vector<t_CKBYTE> buf;
+    // rel32 holes to fill in, each with the byte offset it should reach
+    std::vector< std::pair<t_CKUINT, t_CKUINT> > jumps;
+    // exit and backward-jump stubs, by target pc
+    std::map<t_CKUINT, t_CKUINT> exits;
+    std::map<t_CKUINT, t_CKUINT> checks;
+
+    // append bytes; returns offset
+    t_CKUINT emit( const t_CKBYTE * code, t_CKUINT size )
+    {
+        t_CKUINT at = buf.size();
+        buf.insert( buf.end(), code, code + size );
+        return at;
+    }
+    // patch little-endian value
+    void patch( t_CKUINT at, t_CKUINT value, t_CKUINT bytes )
+    {
+        for( t_CKUINT i = 0; i < bytes; i++ ) buf[at+i] = (t_CKBYTE)( value >> (8*i) );
+    }
+    // a rel32 at `at` should reach `dest` (fixed up in resolve())
+    void jump( t_CKUINT at, t_CKUINT dest ) { jumps.push_back( std::make_pair( at, dest ) ); }
+
+    // stub that leaves compiled code at pc
+    t_CKUINT exit( t_CKUINT pc )
+    {
+        if( exits.count( pc ) ) return exits[pc];
+        t_CKUINT at = emit( ckjit_exit, sizeof(ckjit_exit) );
+        patch( at + CKJIT_EXIT_PC, pc, 4 );
+        return exits[pc] = at;
+    }
+    // stub that checks VM/shred state before jumping back to label
+    t_CKUINT check( t_CKUINT pc, t_CKUINT label )
+    {
+        if( checks.count( pc ) ) return checks[pc];
+        t_CKUINT at = emit( ckjit_check, sizeof(ckjit_check) );
+        // the exit must follow immediately (the check's short jumps land there)
+        t_CKUINT out = emit( ckjit_exit, sizeof(ckjit_exit) );
+        patch( out + CKJIT_EXIT_PC, pc, 4 );
+        jump( at + CKJIT_CHECK_JMP, label );
+        return checks[pc] = at;
+    }
+
+    // fill in all jumps
+    void resolve()
+    {
+        for( t_CKUINT i = 0; i < jumps.size(); i++ )
+        {
+            t_CKUINT at = jumps[i].first, dest = jumps[i].second;
+            patch( at, (t_CKUINT)( (t_CKINT)dest - (t_CKINT)(at + 4) ), 4 );
+        }
+    }
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ckth_native()
+// desc: direct-threaded handler that runs compiled code, starting at the
+//       op's entry point, until the next op without a template
+//-----------------------------------------------------------------------------
+static void ckth_native( const Chuck_VM_Threaded_Op * op, Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    Chuck_JIT_Frame frame;
+    frame.reg_sp = shred->reg->sp;
+    frame.mem_sp = shred->mem->sp;
+    frame.base = shred->base_ref ? shred->base_ref->stack : NULL;
+    frame.running = &vm->runningState();
+    frame.abort = &shred->is_abort;
+
+    // run; continue interpreting at the returned pc
+    shred->next_pc = ((f_ckjit_native)op->uval)( &frame );
+    // write back
+    shred->reg->sp = frame.reg_sp;
+}
+
+#endif // __CHUCK_JIT__
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_jit_compile()
+// desc: compile code into native entry points for its ops
+//-----------------------------------------------------------------------------
+t_CKBOOL ck_jit_compile( Chuck_VM_Code * code )
+{
+#ifdef __CHUCK_JIT__
+    // the ops
+    Chuck_VM_Threaded_Op * ops = code->threaded;
+    t_CKUINT n = code->num_instr;
+    t_CKUINT i, target, count = 0;
+
+    // only once; compiled code relies on the verifier (no overflow checks)
+    // and on inline operands that are not patched at runtime
+    if( code->jit_native || !ops || !code->stack_verified || !code->threaded_inline )
+        return FALSE;
+    // frame layout is baked into the templates
+    if( offsetof(Chuck_JIT_Frame, mem_sp) != 8 || offsetof(Chuck_JIT_Frame, base) != 16 ||
+        offsetof(Chuck_JIT_Frame, running) != 24 || offsetof(Chuck_JIT_Frame, abort) != 32 )
+        return FALSE;
+
+    // template for each op, and which ops the interpreter can enter at
+    std::vector<t_CKUINT> kind( n, ckjit_none );
+    std::vector<t_CKBOOL> entry( n, FALSE );
+    for( i = 0; i < n; i++ )
+    {
+        kind[i] = ck_threaded_template( ops[i] );
+        // displacements must fit in 32 bits
+        if( g_ckjit_templates[kind[i]].disp >= 0 && ops[i].uval > 0x7fffffff ) kind[i] = ckjit_none;
+        if( kind[i] != ckjit_none ) count++;
+        // any jump target
+        if( ops[i].instr->branch_target( target ) && target < n ) entry[target] = TRUE;
+    }
+    // nothing to do
+    if( !count ) return FALSE;
+
+    // lay out
+    Chuck_JIT_Assembler a;
+    std::vector<t_CKUINT> label( n, 0 );
+    for( i = 0; i < n; i++ )
+    {
+        if( kind[i] == ckjit_none ) continue;
+        const Chuck_JIT_Template & t = g_ckjit_templates[kind[i]];
+        // after an interpreted op
+        if( i == 0 || kind[i-1] == ckjit_none ) entry[i] = TRUE;
+
+        // copy
+        label[i] = a.buf.size();
+        if( t.size ) a.emit( t.code, t.size );
+        // patch operand
+        if( t.imm >= 0 ) a.patch( label[i] + t.imm, ops[i].uval, 8 );
+        if( t.disp >= 0 ) a.patch( label[i] + t.disp, ops[i].uval, 4 );
+        // continue with the interpreter?
+        if( t.falls && ( i+1 >= n || kind[i+1] == ckjit_none ) )
+            a.patch( a.emit( ckjit_exit, sizeof(ckjit_exit) ) + CKJIT_EXIT_PC, i+1, 4 );
+    }
+
+    // jumps, now that all labels are known
+    for( i = 0; i < n; i++ )
+    {
+        const Chuck_JIT_Template & t = g_ckjit_templates[kind[i]];
+        if( t.jmp1 < 0 ) continue;
+        target = ops[i].uval;
+        t_CKUINT dest = 0;
+        // not compiled: leave
+        if( target >= n || kind[target] == ckjit_none ) dest = a.exit( target );
+        // forward
+        else if( target > i ) dest = label[target];
+        // backward: give the VM a chance to stop us
+        else dest = a.check( target, label[target] );
+        a.jump( label[i] + t.jmp1, dest );
+        if( t.jmp2 >= 0 ) a.jump( label[i] + t.jmp2, dest );
+    }
+
+    // entry points
+    std::vector<t_CKUINT> entries( n, 0 );
+    for( i = 0; i < n; i++ )
+    {
+        if( kind[i] == ckjit_none || !entry[i] ) continue;
+        entries[i] = a.emit( ckjit_entry, sizeof(ckjit_entry) );
+        a.jump( entries[i] + CKJIT_ENTRY_JMP, label[i] );
+    }
+    a.resolve();
+
+    // executable memory
+    t_CKUINT page = (t_CKUINT)sysconf( _SC_PAGESIZE );
+    t_CKUINT size = ( a.buf.size() + page - 1 ) / page * page;
+    void * mem = mmap( NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if( mem == MAP_FAILED ) return FALSE;
+    memcpy( mem, &a.buf[0], a.buf.size() );
+    if( mprotect( mem, size, PROT_READ | PROT_EXEC ) != 0 )
+    {
+        munmap( mem, size );
+        return FALSE;
+    }
+    code->jit_native = mem;
+    code->jit_size = size;
+
+    // patch the ops; the rest keep their interpreter handlers
+    for( i = 0; i < n; i++ )
+    {
+        if( kind[i] == ckjit_none || !entry[i] ) continue;
+        ops[i].handler = ckth_native;
+        ops[i].uval = (t_CKUINT)mem + entries[i];
+    }
+
+    // log
+    EM_log( CK_LOG_FINE, "JIT compiled '%s': %lu/%lu instructions, %lu bytes",
+            code->name.c_str(), count, n, a.buf.size() );
+
+    return TRUE;
+#else
+    // not available
+    return FALSE;
+#endif
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_jit_release()
+// desc: free any native code belonging to code
+//-----------------------------------------------------------------------------
+void ck_jit_release( Chuck_VM_Code * code )
+{
+#ifdef __CHUCK_JIT__
+    if( code->jit_native ) munmap( code->jit_native, code->jit_size );
+#endif
+    code->jit_native = NULL;
+    code->jit_size = 0;
+}
@@ -0,0 +1,139 @@
+/*----------------------------------------------------------------------------
+  ChucK Concurrent, On-the-fly Audio Programming Language
+    Compiler and Virtual Machine
+
+  Copyright (c) 2004 Ge Wang and Perry R. Cook.  All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+  U.S.A.
+-----------------------------------------------------------------------------*/
+
+//-----------------------------------------------------------------------------
+// file: chuck_jit.h
+// desc: chuck template JIT; tier-up for hot Chuck_VM_Code
+//
+//       code that runs often enough (see CKVM_JIT_THRESHOLD) is compiled by
+//       copying a native template for each of its direct-threaded ops into
+//       executable memory and patching in the inline operands and jump
+//       targets; ops without a template stay in the interpreter, which is
+//       entered and left at instruction boundaries
+//
+//       currently x86-64 Linux only; elsewhere compilation always fails
+//       and the direct-threaded interpreter is used as is
+//-----------------------------------------------------------------------------
+#ifndef __CHUCK_JIT_H__
+#define __CHUCK_JIT_H__
+
+#include "chuck_def.h"
+
+
+// native code generation available on this platform?
+#if defined(__x86_64__) && defined(__PLATFORM_LINUX__) && !defined(__DISABLE_JIT__)
+#define __CHUCK_JIT__
+#endif
+
+// number of entries into (or backward jumps within) a Chuck_VM_Code
+// before it is compiled
+#define CKVM_JIT_THRESHOLD           1000
+
+
+// forward references
+struct Chuck_VM_Code;
+struct Chuck_VM_Threaded_Op;
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: enum ckjit_Template
+// desc: native templates, one per specialized direct-threaded handler
+//       (see ck_threaded_template() in chuck_instr.cpp)
+//-----------------------------------------------------------------------------
+enum ckjit_Template
+{
+    ckjit_none = 0, // no template; stays in the interpreter
+    ckjit_nop, ckjit_goto,
+    // int / float arithmetic
+    ckjit_add_int, ckjit_minus_int, ckjit_times_int,
+    ckjit_add_double, ckjit_minus_double, ckjit_times_double, ckjit_divide_double,
+    // comparison
+    ckjit_lt_int, ckjit_gt_int, ckjit_le_int, ckjit_ge_int, ckjit_eq_int, ckjit_neq_int,
+    ckjit_lt_double, ckjit_gt_double, ckjit_le_double, ckjit_ge_double, ckjit_eq_double, ckjit_neq_double,
+    // branch
+    ckjit_branch_lt_int, ckjit_branch_gt_int, ckjit_branch_le_int,
+    ckjit_branch_ge_int, ckjit_branch_eq_int, ckjit_branch_neq_int,
+    ckjit_branch_lt_double, ckjit_branch_gt_double, ckjit_branch_le_double,
+    ckjit_branch_ge_double, ckjit_branch_eq_double, ckjit_branch_neq_double,
+    ckjit_branch_eq_int_zero, ckjit_branch_neq_int_zero,
+    // operand stack
+    ckjit_reg_push_imm, ckjit_reg_pop, ckjit_reg_dup_last,
+    ckjit_reg_push_mem, ckjit_reg_push_mem_base,
+    ckjit_reg_push_mem_addr, ckjit_reg_push_mem_addr_base,
+    // assignment
+    ckjit_assign_primitive,
+    ckjit_assign_primitive_mem, ckjit_assign_primitive_mem_base,
+    // superinstructions: immediate and variable operands
+    ckjit_add_int_imm, ckjit_minus_int_imm, ckjit_times_int_imm,
+    ckjit_add_double_imm, ckjit_minus_double_imm, ckjit_times_double_imm,
+    ckjit_add_int_mem, ckjit_add_int_mem_base,
+    ckjit_minus_int_mem, ckjit_minus_int_mem_base,
+    ckjit_times_int_mem, ckjit_times_int_mem_base,
+    ckjit_add_double_mem, ckjit_add_double_mem_base,
+    ckjit_minus_double_mem, ckjit_minus_double_mem_base,
+    ckjit_times_double_mem, ckjit_times_double_mem_base,
+    // (end)
+    ckjit_NUM_TEMPLATES
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_JIT_Frame
+// desc: what compiled code sees of the shred; filled in on each entry
+//       NOTE: field offsets are baked into the templates
+//-----------------------------------------------------------------------------
+struct Chuck_JIT_Frame
+{
+    // operand stack pointer (updated on exit)
+    t_CKBYTE * reg_sp;
+    // memory stack pointer (locals)
+    t_CKBYTE * mem_sp;
+    // base of the memory stack (file-level variables)
+    t_CKBYTE * base;
+    // VM running state, checked on backward jumps
+    const t_CKBOOL * running;
+    // shred abort flag, checked on backward jumps
+    const t_CKBOOL * abort;
+};
+
+// compiled code entry point; returns the pc to continue at
+typedef t_CKUINT (* f_ckjit_native)( Chuck_JIT_Frame * frame );
+
+
+
+
+// compile code (which must already be lowered to direct-threaded ops);
+// patches the ops that have native entry points; FALSE if nothing compiled
+t_CKBOOL ck_jit_compile( Chuck_VM_Code * code );
+// free any native code belonging to code
+void ck_jit_release( Chuck_VM_Code * code );
+
+
+
+
+#endif
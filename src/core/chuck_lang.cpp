@@ -39,8 +39,10 @@
 #include "chuck_errmsg.h"
 #include "chuck_ugen.h"
 #include "util_string.h"
+#include "util_simd.h"
 
 #include <math.h>
+#include <string.h>
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -48,6 +50,8 @@ using namespace std;
 
 // dac tick
 CK_DLL_TICK(__ugen_tick) { *out = in; return TRUE; }
+// dac block tick | 1.5.1.7
+CK_DLL_TICKV(__ugen_tickv) { memcpy( out, in, nframes * sizeof(SAMPLE) ); return TRUE; }
 // object string offset
 static t_CKUINT Object_offset_string = 0;
 
@@ -133,6 +137,8 @@ t_CKBOOL init_class_ugen( Chuck_Env * env, Chuck_Type * type )
     type->ugen_info = new Chuck_UGen_Info;
     type->ugen_info->add_ref();
     type->ugen_info->tick = __ugen_tick;
+    type->ugen_info->tickv = __ugen_tickv; // 1.5.1.7
+    type->ugen_info->concurrent = TRUE; // 1.5.1.7
     type->ugen_info->num_ins = 1;
     type->ugen_info->num_outs = 1;
     // documentation text
@@ -235,6 +241,7 @@ t_CKBOOL init_class_uana( Chuck_Env * env, Chuck_Type * type )
     type->ugen_info = new Chuck_UGen_Info;
     type->ugen_info->add_ref();
     type->ugen_info->tick = __ugen_tick;
+    type->ugen_info->tickv = __ugen_tickv; // 1.5.1.7
     type->ugen_info->num_ins = 1;
     type->ugen_info->num_outs = 1;
 
@@ -1048,6 +1055,97 @@ error:
 
 
 
+//-----------------------------------------------------------------------------
+// name: init_class_array_bulk()
+// desc: add the bulk operations taking another array of type 'atype';
+//       'linear': add, scale, interp hold for its elements (not for polar);
+//       'real': so do mul, dot, abs, clamp (not for complex or polar)
+//       1.5.1.7 added
+//-----------------------------------------------------------------------------
+static const struct { const char * atype; t_CKBOOL linear; t_CKBOOL real; } array_bulk_types[] =
+{
+    { "float[]", TRUE, TRUE }, { "complex[]", TRUE, FALSE }, { "polar[]", FALSE, FALSE },
+    { "vec2[]", TRUE, TRUE }, { "vec3[]", TRUE, TRUE }, { "vec4[]", TRUE, TRUE }
+};
+static t_CKBOOL init_class_array_bulk( Chuck_Env * env, const char * atype,
+                                       t_CKBOOL linear, t_CKBOOL real )
+{
+    Chuck_DL_Func * func = NULL;
+
+    // copying holds for any element type
+    func = make_new_mfun( "void", "copyRange", array_bulk_copy_range_from );
+    func->add_arg( atype, "src" );
+    func->add_arg( "int", "from" );
+    func->add_arg( "int", "to" );
+    func->add_arg( "int", "length" );
+    func->doc = "(float-based arrays) copy 'length' elements of 'src', starting at 'from', into this array at position 'to'.";
+    if( !type_engine_import_mfun( env, func ) ) return FALSE;
+
+    if( !linear ) return TRUE;
+
+    func = make_new_mfun( "void", "add", array_bulk_add );
+    func->add_arg( atype, "other" );
+    func->doc = "(float-based arrays, not polar) add 'other' to this array, element-wise, in place; sizes must match.";
+    if( !type_engine_import_mfun( env, func ) ) return FALSE;
+    func = make_new_mfun( "void", "add", array_bulk_add_out );
+    func->add_arg( atype, "other" );
+    func->add_arg( atype, "out" );
+    func->doc = "(float-based arrays, not polar) store this array plus 'other', element-wise, in 'out' (resized to match).";
+    if( !type_engine_import_mfun( env, func ) ) return FALSE;
+
+    func = make_new_mfun( "void", "interp", array_bulk_interp );
+    func->add_arg( atype, "other" );
+    func->add_arg( "float", "t" );
+    func->doc = "(float-based arrays, not polar) move this array toward 'other' by 't' (0: unchanged, 1: same as 'other'), in place.";
+    if( !type_engine_import_mfun( env, func ) ) return FALSE;
+    func = make_new_mfun( "void", "interp", array_bulk_interp_out );
+    func->add_arg( atype, "other" );
+    func->add_arg( "float", "t" );
+    func->add_arg( atype, "out" );
+    func->doc = "(float-based arrays, not polar) store the interpolation from this array toward 'other' by 't' in 'out' (resized to match).";
+    if( !type_engine_import_mfun( env, func ) ) return FALSE;
+
+    func = make_new_mfun( "void", "scale", array_bulk_scale_out );
+    func->add_arg( "float", "s" );
+    func->add_arg( atype, "out" );
+    func->doc = "(float-based arrays, not polar) store this array times 's' in 'out' (resized to match).";
+    if( !type_engine_import_mfun( env, func ) ) return FALSE;
+
+    if( !real ) return TRUE;
+
+    func = make_new_mfun( "void", "mul", array_bulk_mul );
+    func->add_arg( atype, "other" );
+    func->doc = "(float and vec arrays) multiply this array by 'other', per component, in place; sizes must match.";
+    if( !type_engine_import_mfun( env, func ) ) return FALSE;
+    func = make_new_mfun( "void", "mul", array_bulk_mul_out );
+    func->add_arg( atype, "other" );
+    func->add_arg( atype, "out" );
+    func->doc = "(float and vec arrays) store this array times 'other', per component, in 'out' (resized to match).";
+    if( !type_engine_import_mfun( env, func ) ) return FALSE;
+
+    func = make_new_mfun( "float", "dot", array_bulk_dot );
+    func->add_arg( atype, "other" );
+    func->doc = "(float and vec arrays) return the dot product of this array and 'other', over all components.";
+    if( !type_engine_import_mfun( env, func ) ) return FALSE;
+
+    func = make_new_mfun( "void", "abs", array_bulk_abs_out );
+    func->add_arg( atype, "out" );
+    func->doc = "(float and vec arrays) store the absolute values of this array, per component, in 'out' (resized to match).";
+    if( !type_engine_import_mfun( env, func ) ) return FALSE;
+
+    func = make_new_mfun( "void", "clamp", array_bulk_clamp_out );
+    func->add_arg( "float", "lo" );
+    func->add_arg( "float", "hi" );
+    func->add_arg( atype, "out" );
+    func->doc = "(float and vec arrays) store this array limited to [lo,hi], per component, in 'out' (resized to match).";
+    if( !type_engine_import_mfun( env, func ) ) return FALSE;
+
+    return TRUE;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: init_class_array()
 // desc: ...
@@ -1142,7 +1240,14 @@ t_CKBOOL init_class_array( Chuck_Env * env, Chuck_Type * type )
     // add getKeys() | (1.4.1.1) nshaheed
     func = make_new_mfun( "void", "getKeys", array_get_keys );
     func->add_arg( "string[]", "keys" );
-    func->doc = "return all keys found in associative array in keys";
+    func->doc = "return all keys found in associative array in keys (in no particular order).";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add getKeys() with sort flag | 1.5.1.7
+    func = make_new_mfun( "void", "getKeys", array_get_keys_sorted );
+    func->add_arg( "string[]", "keys" );
+    func->add_arg( "int", "sorted" );
+    func->doc = "return all keys found in associative array in keys; if 'sorted' is true, in ascending order.";
     if( !type_engine_import_mfun( env, func ) ) goto error;
 
     // note 1.4.1.0: in the future, should deprecate and encourage programmer
@@ -1162,6 +1267,21 @@ t_CKBOOL init_class_array( Chuck_Env * env, Chuck_Type * type )
     func->doc = "get current capacity of the array (number of addressable elements).";
     if( !type_engine_import_mfun( env, func ) ) goto error;
 
+    // add reserve() | 1.5.1.7
+    func = make_new_mfun( "int", "reserve", array_reserve );
+    func->add_arg( "int", "n" );
+    func->doc = "make room for 'n' elements without changing the size, so that growing up to 'n' (e.g., with <<) does not reallocate; returns the capacity.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add fixed() | 1.5.1.7
+    func = make_new_mfun( "int", "fixed", array_set_fixed );
+    func->add_arg( "int", "fixed" );
+    func->doc = "set whether the capacity is fixed; if true, the array's storage is never reallocated, and growing past capacity() (e.g., with << or size()) throws ArrayCapacityExceeded instead; returns the setting. For real-time code: reserve() first, then fix.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "int", "fixed", array_get_fixed );
+    func->doc = "get whether the capacity is fixed.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
     // add isInMap() | 1.5.0.8 previously was find()
     func = make_new_mfun( "int", "isInMap", array_map_find );
     func->add_arg( "string", "key" );
@@ -1189,11 +1309,48 @@ t_CKBOOL init_class_array( Chuck_Env * env, Chuck_Type * type )
     func->doc = "sort the contents of the array in ascending order.";
     if( !type_engine_import_mfun( env, func ) ) goto error;
 
+    // bulk operations over float-based arrays | 1.5.1.7
+    // (float[], complex[], polar[], vec2[], vec3[], vec4[]); vec elements are
+    // processed per component; complex[] has only the linear ones (scale,
+    // add, interp) and copyRange, polar[] only copyRange -- the rest throw
+    func = make_new_mfun( "void", "scale", array_bulk_scale );
+    func->add_arg( "float", "s" );
+    func->doc = "(float-based arrays, not polar) multiply each element by 's', in place.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "void", "abs", array_bulk_abs );
+    func->doc = "(float and vec arrays) replace each element by its absolute value, per component, in place.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "void", "clamp", array_bulk_clamp );
+    func->add_arg( "float", "lo" );
+    func->add_arg( "float", "hi" );
+    func->doc = "(float and vec arrays) limit each element to [lo,hi], per component, in place.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "float", "sum", array_bulk_sum );
+    func->doc = "(float and vec arrays) return the sum of all elements (all components).";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "float", "min", array_bulk_min );
+    func->doc = "(float and vec arrays) return the smallest element (over all components); 0 if empty.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "float", "max", array_bulk_max );
+    func->doc = "(float and vec arrays) return the largest element (over all components); 0 if empty.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "void", "copyRange", array_bulk_copy_range );
+    func->add_arg( "int", "from" );
+    func->add_arg( "int", "to" );
+    func->add_arg( "int", "length" );
+    func->doc = "(float-based arrays) copy 'length' elements starting at 'from' to position 'to' in the same array; the ranges may overlap.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    // overloads taking another array, one for each float-based array type
+    for( t_CKUINT i = 0; i < sizeof(array_bulk_types)/sizeof(array_bulk_types[0]); i++ )
+        if( !init_class_array_bulk( env, array_bulk_types[i].atype, array_bulk_types[i].linear,
+                                    array_bulk_types[i].real ) ) goto error;
+
     // add examples
     if( !type_engine_import_add_ex( env, "array/array_append.ck" ) ) goto error;
     if( !type_engine_import_add_ex( env, "array/array_argument.ck" ) ) goto error;
     if( !type_engine_import_add_ex( env, "array/array_assign.ck" ) ) goto error;
     if( !type_engine_import_add_ex( env, "array/array_associative.ck" ) ) goto error;
+    if( !type_engine_import_add_ex( env, "array/array_bulk.ck" ) ) goto error;
     if( !type_engine_import_add_ex( env, "array/array_capacity.ck" ) ) goto error;
     if( !type_engine_import_add_ex( env, "array/array_dynamic.ck" ) ) goto error;
     if( !type_engine_import_add_ex( env, "array/array_erase.ck" ) ) goto error;
@@ -1226,6 +1383,282 @@ error:
 
 
 
+// offset of the native Chuck_Deque in Deque and its subclasses
+static t_CKUINT deque_offset_data = 0;
+//-----------------------------------------------------------------------------
+// name: init_class_deque_of()
+// desc: add one typed deque class, 'name', holding 'elem' elements
+//       1.5.1.7 added
+//-----------------------------------------------------------------------------
+static t_CKBOOL init_class_deque_of( Chuck_Env * env, const char * name, const char * elem,
+                                     const char * doc, f_ctor ctor, f_mfun push_back,
+                                     f_mfun push_front, f_mfun pop_back, f_mfun pop_front,
+                                     f_mfun back, f_mfun front, f_mfun get, f_mfun set )
+{
+    Chuck_DL_Func * func = NULL;
+
+    // log
+    EM_log( CK_LOG_SEVERE, "class '%s'", name );
+
+    // begin class, the native deque is made by ctor and freed by Deque's dtor
+    if( !type_engine_import_class_begin( env, name, "Deque", env->global(), ctor, NULL, doc ) )
+        return FALSE;
+
+    // add pushBack()
+    func = make_new_mfun( "void", "pushBack", push_back );
+    func->add_arg( elem, "value" );
+    func->doc = "append value at the back.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add pushFront()
+    func = make_new_mfun( "void", "pushFront", push_front );
+    func->add_arg( elem, "value" );
+    func->doc = "prepend value at the front.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add popBack()
+    func = make_new_mfun( elem, "popBack", pop_back );
+    func->doc = "remove and return the value at the back.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add popFront()
+    func = make_new_mfun( elem, "popFront", pop_front );
+    func->doc = "remove and return the value at the front.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add back()
+    func = make_new_mfun( elem, "back", back );
+    func->doc = "return the value at the back.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add front()
+    func = make_new_mfun( elem, "front", front );
+    func->doc = "return the value at the front.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add get()
+    func = make_new_mfun( elem, "get", get );
+    func->add_arg( "int", "index" );
+    func->doc = "return the value at 'index', counting from the front (0); negative indices count from the back (-1).";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add set()
+    func = make_new_mfun( elem, "set", set );
+    func->add_arg( "int", "index" );
+    func->add_arg( elem, "value" );
+    func->doc = "replace the value at 'index', counting from the front (0); negative indices count from the back (-1).";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add examples
+    if( !type_engine_import_add_ex( env, "array/deque.ck" ) ) goto error;
+
+    // end the class import
+    type_engine_import_class_end( env );
+
+    return TRUE;
+
+error:
+
+    // end the class import
+    type_engine_import_class_end( env );
+
+    return FALSE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: init_class_deque()
+// desc: initialize Deque and its typed subclasses | 1.5.1.7 added
+//-----------------------------------------------------------------------------
+t_CKBOOL init_class_deque( Chuck_Env * env )
+{
+    Chuck_DL_Func * func = NULL;
+
+    // log
+    EM_log( CK_LOG_SEVERE, "class 'Deque'" );
+
+    const char * doc = "base class of IntDeque, FloatDeque, and ObjectDeque: double-ended queues with O(1) push and pop at both ends. Capacity can be set ahead of time; a deque grows (doubling) only when full, and never if set to be fixed (default capacity: 8). Growing allocates memory while the shred runs, and is counted by Machine.reallocs() (as for arrays); for time-critical code, set the capacity ahead of time, or set it to be fixed.";
+
+    // begin class
+    if( !type_engine_import_class_begin( env, "Deque", "Object", env->global(), NULL, deque_dtor, doc ) )
+        return FALSE;
+
+    // add member variable
+    deque_offset_data = type_engine_import_mvar( env, "int", "@Deque_data", FALSE );
+    if( deque_offset_data == CK_INVALID_OFFSET ) goto error;
+
+    // add size()
+    func = make_new_mfun( "int", "size", deque_size );
+    func->doc = "get the number of elements.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add capacity()
+    func = make_new_mfun( "int", "capacity", deque_get_capacity );
+    func->doc = "get the number of elements that fit without growing.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add capacity()
+    func = make_new_mfun( "int", "capacity", deque_set_capacity );
+    func->add_arg( "int", "n" );
+    func->doc = "set the number of elements that fit without growing (but not below the current size), e.g., ahead of time-critical code; returns the capacity.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add fixed()
+    func = make_new_mfun( "int", "fixed", deque_get_fixed );
+    func->doc = "get whether the capacity is fixed.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add fixed()
+    func = make_new_mfun( "int", "fixed", deque_set_fixed );
+    func->add_arg( "int", "fixed" );
+    func->doc = "set whether the capacity is fixed; if true, the deque never grows, and pushing onto a full deque drops the element at the other end (like a ring buffer); returns the setting.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add clear()
+    func = make_new_mfun( "void", "clear", deque_clear );
+    func->doc = "remove all elements; capacity is unchanged.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // end the class import
+    type_engine_import_class_end( env );
+
+    // the typed deques
+    if( !init_class_deque_of( env, "IntDeque", "int",
+            "double-ended queue of int; O(1) push and pop at both ends.", intdeque_ctor,
+            intdeque_push_back, intdeque_push_front, intdeque_pop_back, intdeque_pop_front,
+            intdeque_back, intdeque_front, intdeque_get, intdeque_set ) )
+        return FALSE;
+    if( !init_class_deque_of( env, "FloatDeque", "float",
+            "double-ended queue of float; O(1) push and pop at both ends.", floatdeque_ctor,
+            floatdeque_push_back, floatdeque_push_front, floatdeque_pop_back, floatdeque_pop_front,
+            floatdeque_back, floatdeque_front, floatdeque_get, floatdeque_set ) )
+        return FALSE;
+    if( !init_class_deque_of( env, "ObjectDeque", "Object",
+            "double-ended queue of Object references; O(1) push and pop at both ends.", objdeque_ctor,
+            objdeque_push_back, objdeque_push_front, objdeque_pop_back, objdeque_pop_front,
+            objdeque_back, objdeque_front, objdeque_get, objdeque_set ) )
+        return FALSE;
+
+    return TRUE;
+
+error:
+
+    // end the class import
+    type_engine_import_class_end( env );
+
+    return FALSE;
+}
+
+
+
+
+// offset of the native string of a StringBuilder
+static t_CKUINT stringbuilder_offset_data = 0;
+//-----------------------------------------------------------------------------
+// name: init_class_stringbuilder()
+// desc: initialize StringBuilder | 1.5.1.7 added
+//-----------------------------------------------------------------------------
+t_CKBOOL init_class_stringbuilder( Chuck_Env * env )
+{
+    Chuck_DL_Func * func = NULL;
+
+    // log
+    EM_log( CK_LOG_SEVERE, "class 'StringBuilder'" );
+
+    const char * doc = "a mutable string that appends in place, without making an intermediate string for each piece (as + does); useful for building messages and addresses at control rate. Storage grows only as needed, and is kept across clear().";
+
+    // begin class
+    if( !type_engine_import_class_begin( env, "StringBuilder", "Object", env->global(), stringbuilder_ctor, stringbuilder_dtor, doc ) )
+        return FALSE;
+
+    // add member variable
+    stringbuilder_offset_data = type_engine_import_mvar( env, "int", "@StringBuilder_data", FALSE );
+    if( stringbuilder_offset_data == CK_INVALID_OFFSET ) goto error;
+
+    // add append()
+    func = make_new_mfun( "StringBuilder", "append", stringbuilder_append );
+    func->add_arg( "string", "str" );
+    func->doc = "append a string; returns this builder.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add append()
+    func = make_new_mfun( "StringBuilder", "append", stringbuilder_append_int );
+    func->add_arg( "int", "value" );
+    func->doc = "append an int, as text; returns this builder.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add append()
+    func = make_new_mfun( "StringBuilder", "append", stringbuilder_append_float );
+    func->add_arg( "float", "value" );
+    func->doc = "append a float, as text with 4 decimal places (like string + float); returns this builder.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add append()
+    func = make_new_mfun( "StringBuilder", "append", stringbuilder_append_float_precision );
+    func->add_arg( "float", "value" );
+    func->add_arg( "int", "precision" );
+    func->doc = "append a float, as text with 'precision' decimal places; returns this builder.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add appendChar()
+    func = make_new_mfun( "StringBuilder", "appendChar", stringbuilder_append_char );
+    func->add_arg( "int", "ch" );
+    func->doc = "append a character, by its ASCII value; returns this builder.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add length()
+    func = make_new_mfun( "int", "length", stringbuilder_length );
+    func->doc = "get the number of characters.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add capacity()
+    func = make_new_mfun( "int", "capacity", stringbuilder_capacity );
+    func->doc = "get the number of characters that fit without growing.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add reserve()
+    func = make_new_mfun( "int", "reserve", stringbuilder_reserve );
+    func->add_arg( "int", "n" );
+    func->doc = "make room for at least 'n' characters ahead of time; returns the capacity.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add clear()
+    func = make_new_mfun( "void", "clear", stringbuilder_clear );
+    func->doc = "remove all characters; capacity is unchanged.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add toString()
+    func = make_new_mfun( "string", "toString", stringbuilder_to_string );
+    func->doc = "get the contents as a new string.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add copyTo()
+    func = make_new_mfun( "string", "copyTo", stringbuilder_copy_to );
+    func->add_arg( "string", "str" );
+    func->doc = "replace the contents of 'str' with this builder's, reusing its storage (no new string is made); returns 'str'. 'str' cannot be a string literal.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add examples
+    if( !type_engine_import_add_ex( env, "string/stringbuilder.ck" ) ) goto error;
+
+    // end the class import
+    type_engine_import_class_end( env );
+
+    return TRUE;
+
+error:
+
+    // end the class import
+    type_engine_import_class_end( env );
+
+    return FALSE;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: init_class_function()
 // desc: initialize the @fuction class | 1.5.0.0 (ge) added
@@ -2017,6 +2450,7 @@ CK_DLL_CTOR( uanablob_ctor )
     // cvals
     Chuck_Array16 * arr16 = new Chuck_Array16( 8 );
     initialize_object( arr16, SHRED->vm_ref->env()->ckt_array, SHRED, VM );
+    arr16->m_isComplexType = TRUE;
     arr16->add_ref();
     OBJ_MEMBER_INT(SELF, uanablob_offset_cvals) = (t_CKINT)arr16;
 }
@@ -2614,8 +3048,9 @@ CK_DLL_MFUN(string_setCharAt)
     // str->str.at(index) = the_char;
     std::string s = str->str();
     s.at(index) = the_char;
-    str->set( s );
-    RETURN->v_int = str->str().at(index);
+    RETURN->v_int = s.at(index);
+    // copy-on-write, if a literal | 1.5.1.7
+    str->modify( s );
 }
 
 CK_DLL_MFUN(string_substring)
@@ -2682,7 +3117,8 @@ CK_DLL_MFUN(string_insert)
     // str->str.insert(position, str2->str);
     std::string s = str->str();
     s.insert( position, str2->str() );
-    str->set( s );
+    // copy-on-write, if a literal | 1.5.1.7
+    str->modify( s );
 }
 
 CK_DLL_MFUN(string_replace)
@@ -2711,7 +3147,8 @@ CK_DLL_MFUN(string_replace)
     // str->str.replace(position, length, str2->str);
     std::string s = str->str();
     s.replace( position, length, str2->str() );
-    str->set( s );
+    // copy-on-write, if a literal | 1.5.1.7
+    str->modify( s );
 }
 
 CK_DLL_MFUN(string_replaceN)
@@ -2742,7 +3179,8 @@ CK_DLL_MFUN(string_replaceN)
     // str->str.replace(position, length, str2->str);
     std::string s = str->str();
     s.replace( position, length, str2->str() );
-    str->set( s );
+    // copy-on-write, if a literal | 1.5.1.7
+    str->modify( s );
 }
 
 // string.replace(old, new) | 1.5.1.3 (nshaheed) added
@@ -2765,7 +3203,8 @@ CK_DLL_MFUN(string_replace_str)
         start_pos += to.length(); // In case 'to' contains 'from', like replacing 'x' with 'yx'
     }
 
-    str->set(s);
+    // copy-on-write, if a literal | 1.5.1.7
+    str->modify( s );
 }
 
 CK_DLL_MFUN(string_find)
@@ -2925,7 +3364,8 @@ CK_DLL_MFUN(string_erase)
     // str->str.erase(start, length);
     std::string s = str->str();
     s.erase( start, length );
-    str->set( s );
+    // copy-on-write, if a literal | 1.5.1.7
+    str->modify( s );
 }
 
 CK_DLL_MFUN( string_toInt )
@@ -2993,6 +3433,14 @@ CK_DLL_MFUN( array_get_size )
     RETURN->v_int = array->size();
 }
 
+// check that an array, if fixed, can hold n elements | 1.5.1.7
+static t_CKBOOL array_check_fixed( Chuck_Array * array, t_CKINT n, Chuck_VM_Shred * SHRED )
+{
+    if( !array->m_fixed || n <= array->capacity() ) return TRUE;
+    ck_throw_exception( SHRED, "ArrayCapacityExceeded", array->capacity() );
+    return FALSE;
+}
+
 // array.size()
 CK_DLL_MFUN( array_set_size )
 {
@@ -3006,7 +3454,8 @@ CK_DLL_MFUN( array_set_size )
     }
     else
     {
-        array->set_size( size );
+        if( array_check_fixed( array, size, SHRED ) )
+            array->set_size( size );
         RETURN->v_int = array->size();
     }
     RETURN->v_int = array->size();
@@ -3049,11 +3498,37 @@ CK_DLL_MFUN( array_set_capacity )
     }
     else
     {
-        array->set_capacity( capacity );
+        if( array_check_fixed( array, capacity, SHRED ) )
+            array->set_capacity( capacity );
         RETURN->v_int = array->capacity();
     }
 }
 
+// array.reserve() | 1.5.1.7 added
+CK_DLL_MFUN( array_reserve )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    t_CKINT n = GET_NEXT_INT(ARGS);
+    if( n > 0 && array_check_fixed( array, n, SHRED ) )
+        array->reserve( n );
+    RETURN->v_int = array->capacity();
+}
+
+// array.fixed() | 1.5.1.7 added
+CK_DLL_MFUN( array_get_fixed )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    RETURN->v_int = array->m_fixed;
+}
+
+// array.fixed( int ) | 1.5.1.7 added
+CK_DLL_MFUN( array_set_fixed )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    array->m_fixed = GET_NEXT_INT(ARGS) != 0;
+    RETURN->v_int = array->m_fixed;
+}
+
 // array.cap()
 CK_DLL_MFUN( array_get_capacity_hack )
 {
@@ -3190,18 +3665,16 @@ CK_DLL_MFUN( array_erase2 )
     RETURN->v_int = array->erase( begin, end );
 }
 
-// 1.4.1.1 nshaheed (added) array.getKeys()
-CK_DLL_MFUN( array_get_keys )
+// copy an array's keys into a string array | 1.5.1.7 (factored out)
+static void array_copy_keys( Chuck_Array * array, Chuck_ArrayInt * returned_keys,
+                             t_CKBOOL sorted, Chuck_VM_Shred * SHRED )
 {
-    Chuck_Array * array = (Chuck_Array *)SELF;
-    Chuck_ArrayInt * returned_keys = (Chuck_ArrayInt *) GET_NEXT_OBJECT(ARGS);
-
     // clear return array
     returned_keys->set_size(0);
     // local keys array
     std::vector<std::string> array_keys;
     // get the keys
-    array->get_keys( array_keys );
+    array->get_keys( array_keys, sorted );
 
     // copy array keys into the provided string array
     for (t_CKUINT i = 0; i < array_keys.size(); i++ ) {
@@ -3211,6 +3684,23 @@ CK_DLL_MFUN( array_get_keys )
     }
 }
 
+// 1.4.1.1 nshaheed (added) array.getKeys()
+CK_DLL_MFUN( array_get_keys )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    Chuck_ArrayInt * returned_keys = (Chuck_ArrayInt *) GET_NEXT_OBJECT(ARGS);
+    array_copy_keys( array, returned_keys, FALSE, SHRED );
+}
+
+// 1.5.1.7 (added) array.getKeys( keys, sorted )
+CK_DLL_MFUN( array_get_keys_sorted )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    Chuck_ArrayInt * returned_keys = (Chuck_ArrayInt *) GET_NEXT_OBJECT(ARGS);
+    t_CKINT sorted = GET_NEXT_INT(ARGS);
+    array_copy_keys( array, returned_keys, sorted != 0, SHRED );
+}
+
 // 1.5.0.0 azaday (added) array.reverse()
 CK_DLL_MFUN( array_reverse )
 {
@@ -3220,6 +3710,705 @@ CK_DLL_MFUN( array_reverse )
 
 
 
+
+//-----------------------------------------------------------------------------
+// bulk operations over float-based arrays | 1.5.1.7
+// kernels in util_simd; arrays are treated as flat runs of floats
+//-----------------------------------------------------------------------------
+// what the elements of a float-based array hold: complex and polar values
+// are not plain runs of reals -- only operations that are linear in the
+// components (add, scale, interp) hold for complex, and none for polar
+enum { ARRAY_BULK_REAL = 0, ARRAY_BULK_COMPLEX, ARRAY_BULK_POLAR };
+static t_CKINT array_bulk_kind( Chuck_Array * array )
+{
+    if( array->data_type_kind() != CHUCK_ARRAY16_DATAKIND ) return ARRAY_BULK_REAL;
+    Chuck_Array16 * a16 = (Chuck_Array16 *)array;
+    if( a16->m_isPolarType ) return ARRAY_BULK_POLAR;
+    return a16->m_isComplexType ? ARRAY_BULK_COMPLEX : ARRAY_BULK_REAL;
+}
+
+// check that 'array' is float-based, and that the operation is defined for
+// its elements ('linear': add, scale, interp)
+static t_CKBOOL array_bulk_check( Chuck_Array * array, t_CKBOOL linear,
+                                  Chuck_VM_Shred * SHRED )
+{
+    if( !array->float_width() )
+    {
+        ck_throw_exception( SHRED, "ArrayTypeMismatch", "bulk operations need float-based arrays" );
+        return FALSE;
+    }
+    t_CKINT kind = array_bulk_kind( array );
+    if( kind == ARRAY_BULK_POLAR || (kind == ARRAY_BULK_COMPLEX && !linear) )
+    {
+        ck_throw_exception( SHRED, "ArrayTypeMismatch", kind == ARRAY_BULK_POLAR
+            ? "bulk operation not defined for polar[]" : "bulk operation not defined for complex[]" );
+        return FALSE;
+    }
+    return TRUE;
+}
+
+// check that 'other' can be combined element-wise with 'array'
+static t_CKBOOL array_bulk_check( Chuck_Array * array, Chuck_Array * other,
+                                  t_CKBOOL linear, Chuck_VM_Shred * SHRED )
+{
+    if( !other )
+    {
+        ck_throw_exception( SHRED, "NullPointer" );
+        return FALSE;
+    }
+    if( !array_bulk_check( array, linear, SHRED ) ) return FALSE;
+    if( array->data_type_kind() != other->data_type_kind() || array_bulk_kind( array ) != array_bulk_kind( other ) )
+    {
+        ck_throw_exception( SHRED, "ArrayTypeMismatch", "bulk operations need float-based arrays of the same type" );
+        return FALSE;
+    }
+    if( array->size() != other->size() )
+    {
+        ck_throw_exception( SHRED, "ArraySizeMismatch", other->size() );
+        return FALSE;
+    }
+    return TRUE;
+}
+
+// ready 'out' to receive the result of an operation on 'array'
+static t_CKFLOAT * array_bulk_out( Chuck_Array * array, Chuck_Array * out,
+                                   Chuck_VM_Shred * SHRED )
+{
+    if( !out )
+    {
+        ck_throw_exception( SHRED, "NullPointer" );
+        return NULL;
+    }
+    if( array->data_type_kind() != out->data_type_kind() || array_bulk_kind( array ) != array_bulk_kind( out ) )
+    {
+        ck_throw_exception( SHRED, "ArrayTypeMismatch", "bulk operations need float-based arrays of the same type" );
+        return NULL;
+    }
+    // size to match
+    if( !array_check_fixed( out, array->size(), SHRED ) ) return NULL;
+    out->set_size( array->size() );
+    return out->floats();
+}
+
+// number of floats in 'array'
+static inline t_CKUINT array_bulk_count( Chuck_Array * array )
+{ return array->size() * array->float_width(); }
+
+// array.add( other )
+CK_DLL_MFUN( array_bulk_add )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    Chuck_Array * other = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    if( !array_bulk_check( array, other, TRUE, SHRED ) ) return;
+    ck_vec_add( array->floats(), array->floats(), other->floats(), array_bulk_count(array) );
+}
+
+// array.add( other, out )
+CK_DLL_MFUN( array_bulk_add_out )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    Chuck_Array * other = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    Chuck_Array * out = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    if( !array_bulk_check( array, other, TRUE, SHRED ) ) return;
+    t_CKFLOAT * dst = array_bulk_out( array, out, SHRED );
+    if( !dst ) return;
+    ck_vec_add( dst, array->floats(), other->floats(), array_bulk_count(array) );
+}
+
+// array.mul( other )
+CK_DLL_MFUN( array_bulk_mul )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    Chuck_Array * other = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    if( !array_bulk_check( array, other, FALSE, SHRED ) ) return;
+    ck_vec_mul( array->floats(), array->floats(), other->floats(), array_bulk_count(array) );
+}
+
+// array.mul( other, out )
+CK_DLL_MFUN( array_bulk_mul_out )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    Chuck_Array * other = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    Chuck_Array * out = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    if( !array_bulk_check( array, other, FALSE, SHRED ) ) return;
+    t_CKFLOAT * dst = array_bulk_out( array, out, SHRED );
+    if( !dst ) return;
+    ck_vec_mul( dst, array->floats(), other->floats(), array_bulk_count(array) );
+}
+
+// array.scale( s )
+CK_DLL_MFUN( array_bulk_scale )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    t_CKFLOAT s = GET_NEXT_FLOAT(ARGS);
+    if( !array_bulk_check( array, TRUE, SHRED ) ) return;
+    ck_vec_scale( array->floats(), array->floats(), s, array_bulk_count(array) );
+}
+
+// array.scale( s, out )
+CK_DLL_MFUN( array_bulk_scale_out )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    t_CKFLOAT s = GET_NEXT_FLOAT(ARGS);
+    Chuck_Array * out = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    if( !array_bulk_check( array, TRUE, SHRED ) ) return;
+    t_CKFLOAT * dst = array_bulk_out( array, out, SHRED );
+    if( !dst ) return;
+    ck_vec_scale( dst, array->floats(), s, array_bulk_count(array) );
+}
+
+// array.abs()
+CK_DLL_MFUN( array_bulk_abs )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    if( !array_bulk_check( array, FALSE, SHRED ) ) return;
+    ck_vec_abs( array->floats(), array->floats(), array_bulk_count(array) );
+}
+
+// array.abs( out )
+CK_DLL_MFUN( array_bulk_abs_out )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    Chuck_Array * out = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    if( !array_bulk_check( array, FALSE, SHRED ) ) return;
+    t_CKFLOAT * dst = array_bulk_out( array, out, SHRED );
+    if( !dst ) return;
+    ck_vec_abs( dst, array->floats(), array_bulk_count(array) );
+}
+
+// array.clamp( lo, hi )
+CK_DLL_MFUN( array_bulk_clamp )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    t_CKFLOAT lo = GET_NEXT_FLOAT(ARGS);
+    t_CKFLOAT hi = GET_NEXT_FLOAT(ARGS);
+    if( !array_bulk_check( array, FALSE, SHRED ) ) return;
+    ck_vec_clamp( array->floats(), array->floats(), lo, hi, array_bulk_count(array) );
+}
+
+// array.clamp( lo, hi, out )
+CK_DLL_MFUN( array_bulk_clamp_out )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    t_CKFLOAT lo = GET_NEXT_FLOAT(ARGS);
+    t_CKFLOAT hi = GET_NEXT_FLOAT(ARGS);
+    Chuck_Array * out = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    if( !array_bulk_check( array, FALSE, SHRED ) ) return;
+    t_CKFLOAT * dst = array_bulk_out( array, out, SHRED );
+    if( !dst ) return;
+    ck_vec_clamp( dst, array->floats(), lo, hi, array_bulk_count(array) );
+}
+
+// array.interp( other, t )
+CK_DLL_MFUN( array_bulk_interp )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    Chuck_Array * other = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    t_CKFLOAT t = GET_NEXT_FLOAT(ARGS);
+    if( !array_bulk_check( array, other, TRUE, SHRED ) ) return;
+    ck_vec_interp( array->floats(), array->floats(), other->floats(), t, array_bulk_count(array) );
+}
+
+// array.interp( other, t, out )
+CK_DLL_MFUN( array_bulk_interp_out )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    Chuck_Array * other = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    t_CKFLOAT t = GET_NEXT_FLOAT(ARGS);
+    Chuck_Array * out = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    if( !array_bulk_check( array, other, TRUE, SHRED ) ) return;
+    t_CKFLOAT * dst = array_bulk_out( array, out, SHRED );
+    if( !dst ) return;
+    ck_vec_interp( dst, array->floats(), other->floats(), t, array_bulk_count(array) );
+}
+
+// array.dot( other )
+CK_DLL_MFUN( array_bulk_dot )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    Chuck_Array * other = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    RETURN->v_float = 0;
+    if( !array_bulk_check( array, other, FALSE, SHRED ) ) return;
+    RETURN->v_float = ck_vec_dot( array->floats(), other->floats(), array_bulk_count(array) );
+}
+
+// array.sum()
+CK_DLL_MFUN( array_bulk_sum )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    RETURN->v_float = 0;
+    if( !array_bulk_check( array, FALSE, SHRED ) ) return;
+    RETURN->v_float = ck_vec_sum( array->floats(), array_bulk_count(array) );
+}
+
+// array.min()
+CK_DLL_MFUN( array_bulk_min )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    RETURN->v_float = 0;
+    if( !array_bulk_check( array, FALSE, SHRED ) ) return;
+    RETURN->v_float = ck_vec_min( array->floats(), array_bulk_count(array) );
+}
+
+// array.max()
+CK_DLL_MFUN( array_bulk_max )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    RETURN->v_float = 0;
+    if( !array_bulk_check( array, FALSE, SHRED ) ) return;
+    RETURN->v_float = ck_vec_max( array->floats(), array_bulk_count(array) );
+}
+
+// copy 'length' elements of 'src' from 'from' to 'to' in 'dst'
+static void array_bulk_copy( Chuck_Array * dst, Chuck_Array * src, t_CKINT from,
+                             t_CKINT to, t_CKINT length, Chuck_VM_Shred * SHRED )
+{
+    if( length < 0 ) { ck_throw_exception( SHRED, "IndexOutOfBounds", length ); return; }
+    if( from < 0 || from + length > src->size() ) { ck_throw_exception( SHRED, "IndexOutOfBounds", from ); return; }
+    if( to < 0 || to + length > dst->size() ) { ck_throw_exception( SHRED, "IndexOutOfBounds", to ); return; }
+    t_CKINT w = dst->float_width();
+    // ranges may overlap when src is dst
+    memmove( dst->floats() + to*w, src->floats() + from*w, length * w * sizeof(t_CKFLOAT) );
+}
+
+// array.copyRange( from, to, length )
+CK_DLL_MFUN( array_bulk_copy_range )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    t_CKINT from = GET_NEXT_INT(ARGS);
+    t_CKINT to = GET_NEXT_INT(ARGS);
+    t_CKINT length = GET_NEXT_INT(ARGS);
+    // copying holds for any element type
+    if( !array->float_width() )
+    {
+        ck_throw_exception( SHRED, "ArrayTypeMismatch", "bulk operations need float-based arrays" );
+        return;
+    }
+    array_bulk_copy( array, array, from, to, length, SHRED );
+}
+
+// array.copyRange( src, from, to, length )
+CK_DLL_MFUN( array_bulk_copy_range_from )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    Chuck_Array * src = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    t_CKINT from = GET_NEXT_INT(ARGS);
+    t_CKINT to = GET_NEXT_INT(ARGS);
+    t_CKINT length = GET_NEXT_INT(ARGS);
+    if( !src ) { ck_throw_exception( SHRED, "NullPointer" ); return; }
+    if( !array->float_width() || array->data_type_kind() != src->data_type_kind()
+        || array_bulk_kind( array ) != array_bulk_kind( src ) )
+    {
+        ck_throw_exception( SHRED, "ArrayTypeMismatch", "bulk operations need float-based arrays of the same type" );
+        return;
+    }
+    array_bulk_copy( array, src, from, to, length, SHRED );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Deque implementation | 1.5.1.7
+//-----------------------------------------------------------------------------
+// the native deque of a Deque (NULL for a plain Deque)
+static inline Chuck_Deque * deque_data( Chuck_Object * SELF )
+{ return (Chuck_Deque *)OBJ_MEMBER_UINT(SELF, deque_offset_data); }
+static inline Chuck_DequeOf<t_CKINT> * intdeque_data( Chuck_Object * SELF )
+{ return (Chuck_DequeOf<t_CKINT> *)OBJ_MEMBER_UINT(SELF, deque_offset_data); }
+static inline Chuck_DequeOf<t_CKFLOAT> * floatdeque_data( Chuck_Object * SELF )
+{ return (Chuck_DequeOf<t_CKFLOAT> *)OBJ_MEMBER_UINT(SELF, deque_offset_data); }
+static inline Chuck_ObjectDeque * objdeque_data( Chuck_Object * SELF )
+{ return (Chuck_ObjectDeque *)OBJ_MEMBER_UINT(SELF, deque_offset_data); }
+
+// check that there is an element to pop or peek
+static t_CKBOOL deque_check_empty( Chuck_Deque * d, Chuck_VM_Shred * SHRED )
+{
+    if( d->size() ) return TRUE;
+    ck_throw_exception( SHRED, "EmptyDeque" );
+    return FALSE;
+}
+
+// count (and report, if asked) growth of a full deque before a push, as
+// array growth is counted (see Chuck_Array::grow_check())
+static void deque_grow_check( Chuck_Deque * d, Chuck_VM * VM )
+{
+    if( d->m_fixed || d->size() < d->capacity() ) return;
+    VM->count_realloc();
+    if( VM->realloc_report() )
+        CK_FPRINTF_STDERR( "[chuck]: (realloc) deque storage grown past capacity %lu\n",
+                           (unsigned long)d->capacity() );
+}
+
+// resolve index (negative counts from the back); -1 if out of bounds
+static t_CKINT deque_index( Chuck_Deque * d, t_CKINT index, Chuck_VM_Shred * SHRED )
+{
+    t_CKINT i = index < 0 ? index + d->size() : index;
+    if( i >= 0 && i < d->size() ) return i;
+    ck_throw_exception( SHRED, "IndexOutOfBounds", index );
+    return -1;
+}
+
+CK_DLL_DTOR( deque_dtor )
+{
+    Chuck_Deque * d = deque_data( SELF );
+    CK_SAFE_DELETE( d );
+    OBJ_MEMBER_UINT(SELF, deque_offset_data) = 0;
+}
+
+CK_DLL_MFUN( deque_size )
+{
+    Chuck_Deque * d = deque_data( SELF );
+    RETURN->v_int = d ? d->size() : 0;
+}
+
+CK_DLL_MFUN( deque_get_capacity )
+{
+    Chuck_Deque * d = deque_data( SELF );
+    RETURN->v_int = d ? d->capacity() : 0;
+}
+
+CK_DLL_MFUN( deque_set_capacity )
+{
+    Chuck_Deque * d = deque_data( SELF );
+    t_CKINT n = GET_NEXT_INT(ARGS);
+    if( d ) d->set_capacity( n );
+    RETURN->v_int = d ? d->capacity() : 0;
+}
+
+CK_DLL_MFUN( deque_get_fixed )
+{
+    Chuck_Deque * d = deque_data( SELF );
+    RETURN->v_int = d ? d->m_fixed : 0;
+}
+
+CK_DLL_MFUN( deque_set_fixed )
+{
+    Chuck_Deque * d = deque_data( SELF );
+    t_CKINT fixed = GET_NEXT_INT(ARGS);
+    if( d ) d->m_fixed = fixed != 0;
+    RETURN->v_int = d ? d->m_fixed : 0;
+}
+
+CK_DLL_MFUN( deque_clear )
+{
+    Chuck_Deque * d = deque_data( SELF );
+    if( d ) d->clear();
+}
+
+// IntDeque
+CK_DLL_CTOR( intdeque_ctor )
+{
+    OBJ_MEMBER_UINT(SELF, deque_offset_data) = (t_CKUINT)new Chuck_DequeOf<t_CKINT>();
+}
+
+CK_DLL_MFUN( intdeque_push_back )
+{
+    Chuck_DequeOf<t_CKINT> * d = intdeque_data( SELF );
+    t_CKINT dropped;
+    deque_grow_check( d, VM );
+    d->push_back( GET_NEXT_INT(ARGS), dropped );
+}
+
+CK_DLL_MFUN( intdeque_push_front )
+{
+    Chuck_DequeOf<t_CKINT> * d = intdeque_data( SELF );
+    t_CKINT dropped;
+    deque_grow_check( d, VM );
+    d->push_front( GET_NEXT_INT(ARGS), dropped );
+}
+
+CK_DLL_MFUN( intdeque_pop_back )
+{
+    Chuck_DequeOf<t_CKINT> * d = intdeque_data( SELF );
+    RETURN->v_int = deque_check_empty( d, SHRED ) ? d->pop_back() : 0;
+}
+
+CK_DLL_MFUN( intdeque_pop_front )
+{
+    Chuck_DequeOf<t_CKINT> * d = intdeque_data( SELF );
+    RETURN->v_int = deque_check_empty( d, SHRED ) ? d->pop_front() : 0;
+}
+
+CK_DLL_MFUN( intdeque_back )
+{
+    Chuck_DequeOf<t_CKINT> * d = intdeque_data( SELF );
+    RETURN->v_int = deque_check_empty( d, SHRED ) ? d->at( d->size()-1 ) : 0;
+}
+
+CK_DLL_MFUN( intdeque_front )
+{
+    Chuck_DequeOf<t_CKINT> * d = intdeque_data( SELF );
+    RETURN->v_int = deque_check_empty( d, SHRED ) ? d->at( 0 ) : 0;
+}
+
+CK_DLL_MFUN( intdeque_get )
+{
+    Chuck_DequeOf<t_CKINT> * d = intdeque_data( SELF );
+    t_CKINT i = deque_index( d, GET_NEXT_INT(ARGS), SHRED );
+    RETURN->v_int = i >= 0 ? d->at( i ) : 0;
+}
+
+CK_DLL_MFUN( intdeque_set )
+{
+    Chuck_DequeOf<t_CKINT> * d = intdeque_data( SELF );
+    t_CKINT i = deque_index( d, GET_NEXT_INT(ARGS), SHRED );
+    t_CKINT value = GET_NEXT_INT(ARGS);
+    if( i >= 0 ) d->at( i ) = value;
+    RETURN->v_int = value;
+}
+
+// FloatDeque
+CK_DLL_CTOR( floatdeque_ctor )
+{
+    OBJ_MEMBER_UINT(SELF, deque_offset_data) = (t_CKUINT)new Chuck_DequeOf<t_CKFLOAT>();
+}
+
+CK_DLL_MFUN( floatdeque_push_back )
+{
+    Chuck_DequeOf<t_CKFLOAT> * d = floatdeque_data( SELF );
+    t_CKFLOAT dropped;
+    deque_grow_check( d, VM );
+    d->push_back( GET_NEXT_FLOAT(ARGS), dropped );
+}
+
+CK_DLL_MFUN( floatdeque_push_front )
+{
+    Chuck_DequeOf<t_CKFLOAT> * d = floatdeque_data( SELF );
+    t_CKFLOAT dropped;
+    deque_grow_check( d, VM );
+    d->push_front( GET_NEXT_FLOAT(ARGS), dropped );
+}
+
+CK_DLL_MFUN( floatdeque_pop_back )
+{
+    Chuck_DequeOf<t_CKFLOAT> * d = floatdeque_data( SELF );
+    RETURN->v_float = deque_check_empty( d, SHRED ) ? d->pop_back() : 0;
+}
+
+CK_DLL_MFUN( floatdeque_pop_front )
+{
+    Chuck_DequeOf<t_CKFLOAT> * d = floatdeque_data( SELF );
+    RETURN->v_float = deque_check_empty( d, SHRED ) ? d->pop_front() : 0;
+}
+
+CK_DLL_MFUN( floatdeque_back )
+{
+    Chuck_DequeOf<t_CKFLOAT> * d = floatdeque_data( SELF );
+    RETURN->v_float = deque_check_empty( d, SHRED ) ? d->at( d->size()-1 ) : 0;
+}
+
+CK_DLL_MFUN( floatdeque_front )
+{
+    Chuck_DequeOf<t_CKFLOAT> * d = floatdeque_data( SELF );
+    RETURN->v_float = deque_check_empty( d, SHRED ) ? d->at( 0 ) : 0;
+}
+
+CK_DLL_MFUN( floatdeque_get )
+{
+    Chuck_DequeOf<t_CKFLOAT> * d = floatdeque_data( SELF );
+    t_CKINT i = deque_index( d, GET_NEXT_INT(ARGS), SHRED );
+    RETURN->v_float = i >= 0 ? d->at( i ) : 0;
+}
+
+CK_DLL_MFUN( floatdeque_set )
+{
+    Chuck_DequeOf<t_CKFLOAT> * d = floatdeque_data( SELF );
+    t_CKINT i = deque_index( d, GET_NEXT_INT(ARGS), SHRED );
+    t_CKFLOAT value = GET_NEXT_FLOAT(ARGS);
+    if( i >= 0 ) d->at( i ) = value;
+    RETURN->v_float = value;
+}
+
+// ObjectDeque; holds a reference to each element, until popped
+CK_DLL_CTOR( objdeque_ctor )
+{
+    OBJ_MEMBER_UINT(SELF, deque_offset_data) = (t_CKUINT)new Chuck_ObjectDeque();
+}
+
+CK_DLL_MFUN( objdeque_push_back )
+{
+    Chuck_ObjectDeque * d = objdeque_data( SELF );
+    Chuck_Object * obj = GET_NEXT_OBJECT(ARGS);
+    Chuck_Object * dropped = NULL;
+    CK_SAFE_ADD_REF( obj );
+    deque_grow_check( d, VM );
+    if( d->push_back( obj, dropped ) ) CK_SAFE_RELEASE( dropped );
+}
+
+CK_DLL_MFUN( objdeque_push_front )
+{
+    Chuck_ObjectDeque * d = objdeque_data( SELF );
+    Chuck_Object * obj = GET_NEXT_OBJECT(ARGS);
+    Chuck_Object * dropped = NULL;
+    CK_SAFE_ADD_REF( obj );
+    deque_grow_check( d, VM );
+    if( d->push_front( obj, dropped ) ) CK_SAFE_RELEASE( dropped );
+}
+
+CK_DLL_MFUN( objdeque_pop_back )
+{
+    Chuck_ObjectDeque * d = objdeque_data( SELF );
+    Chuck_Object * obj = deque_check_empty( d, SHRED ) ? d->pop_back() : NULL;
+    // hand the deque's reference over to the VM, which adds its own
+    if( obj ) obj->release_to_caller();
+    RETURN->v_object = obj;
+}
+
+CK_DLL_MFUN( objdeque_pop_front )
+{
+    Chuck_ObjectDeque * d = objdeque_data( SELF );
+    Chuck_Object * obj = deque_check_empty( d, SHRED ) ? d->pop_front() : NULL;
+    // hand the deque's reference over to the VM, which adds its own
+    if( obj ) obj->release_to_caller();
+    RETURN->v_object = obj;
+}
+
+CK_DLL_MFUN( objdeque_back )
+{
+    Chuck_ObjectDeque * d = objdeque_data( SELF );
+    RETURN->v_object = deque_check_empty( d, SHRED ) ? d->at( d->size()-1 ) : NULL;
+}
+
+CK_DLL_MFUN( objdeque_front )
+{
+    Chuck_ObjectDeque * d = objdeque_data( SELF );
+    RETURN->v_object = deque_check_empty( d, SHRED ) ? d->at( 0 ) : NULL;
+}
+
+CK_DLL_MFUN( objdeque_get )
+{
+    Chuck_ObjectDeque * d = objdeque_data( SELF );
+    t_CKINT i = deque_index( d, GET_NEXT_INT(ARGS), SHRED );
+    RETURN->v_object = i >= 0 ? d->at( i ) : NULL;
+}
+
+CK_DLL_MFUN( objdeque_set )
+{
+    Chuck_ObjectDeque * d = objdeque_data( SELF );
+    t_CKINT i = deque_index( d, GET_NEXT_INT(ARGS), SHRED );
+    Chuck_Object * obj = GET_NEXT_OBJECT(ARGS);
+    if( i >= 0 )
+    {
+        // reference the new before releasing the old, in case they are the same
+        CK_SAFE_ADD_REF( obj );
+        CK_SAFE_RELEASE( d->at( i ) );
+        d->at( i ) = obj;
+    }
+    RETURN->v_object = obj;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// StringBuilder implementation | 1.5.1.7
+//-----------------------------------------------------------------------------
+// the native string of a StringBuilder
+static inline std::string * stringbuilder_data( Chuck_Object * SELF )
+{ return (std::string *)OBJ_MEMBER_UINT(SELF, stringbuilder_offset_data); }
+
+CK_DLL_CTOR( stringbuilder_ctor )
+{
+    OBJ_MEMBER_UINT(SELF, stringbuilder_offset_data) = (t_CKUINT)new std::string();
+}
+
+CK_DLL_DTOR( stringbuilder_dtor )
+{
+    std::string * str = stringbuilder_data( SELF );
+    CK_SAFE_DELETE( str );
+    OBJ_MEMBER_UINT(SELF, stringbuilder_offset_data) = 0;
+}
+
+CK_DLL_MFUN( stringbuilder_append )
+{
+    Chuck_String * str = GET_NEXT_STRING(ARGS);
+    if( !str ) { ck_throw_exception( SHRED, "NullPointer" ); return; }
+    stringbuilder_data( SELF )->append( str->str() );
+    RETURN->v_object = SELF;
+}
+
+CK_DLL_MFUN( stringbuilder_append_int )
+{
+    char buffer[128];
+    t_CKUINT len = ck_itoa( GET_NEXT_INT(ARGS), buffer, sizeof(buffer) );
+    stringbuilder_data( SELF )->append( buffer, len );
+    RETURN->v_object = SELF;
+}
+
+CK_DLL_MFUN( stringbuilder_append_float )
+{
+    char buffer[128];
+    t_CKUINT len = ck_ftoa( GET_NEXT_FLOAT(ARGS), 4, buffer, sizeof(buffer) );
+    stringbuilder_data( SELF )->append( buffer, len );
+    RETURN->v_object = SELF;
+}
+
+CK_DLL_MFUN( stringbuilder_append_float_precision )
+{
+    t_CKFLOAT value = GET_NEXT_FLOAT(ARGS);
+    t_CKINT precision = GET_NEXT_INT(ARGS);
+    char buffer[128];
+    t_CKUINT len = ck_ftoa( value, precision < 0 ? 0 : precision, buffer, sizeof(buffer) );
+    stringbuilder_data( SELF )->append( buffer, len );
+    RETURN->v_object = SELF;
+}
+
+CK_DLL_MFUN( stringbuilder_append_char )
+{
+    stringbuilder_data( SELF )->push_back( (char)GET_NEXT_INT(ARGS) );
+    RETURN->v_object = SELF;
+}
+
+CK_DLL_MFUN( stringbuilder_length )
+{
+    RETURN->v_int = stringbuilder_data( SELF )->length();
+}
+
+CK_DLL_MFUN( stringbuilder_capacity )
+{
+    RETURN->v_int = stringbuilder_data( SELF )->capacity();
+}
+
+CK_DLL_MFUN( stringbuilder_reserve )
+{
+    std::string * str = stringbuilder_data( SELF );
+    t_CKINT n = GET_NEXT_INT(ARGS);
+    if( n > 0 ) str->reserve( n );
+    RETURN->v_int = str->capacity();
+}
+
+CK_DLL_MFUN( stringbuilder_clear )
+{
+    stringbuilder_data( SELF )->clear();
+}
+
+CK_DLL_MFUN( stringbuilder_to_string )
+{
+    std::string * data = stringbuilder_data( SELF );
+    Chuck_String * str = (Chuck_String *)instantiate_and_initialize_object( SHRED->vm_ref->env()->ckt_string, SHRED );
+    str->set( data->data(), data->length() );
+    RETURN->v_string = str;
+}
+
+CK_DLL_MFUN( stringbuilder_copy_to )
+{
+    std::string * data = stringbuilder_data( SELF );
+    Chuck_String * str = GET_NEXT_STRING(ARGS);
+    RETURN->v_string = str;
+    if( !str ) { ck_throw_exception( SHRED, "NullPointer" ); return; }
+    // a literal is shared by every use of it in its code, so must not change
+    if( str->m_literal )
+    {
+        ck_throw_exception( SHRED, "StringLiteral", "cannot copy into a string literal; copy into a string variable" );
+        return;
+    }
+    str->set( data->data(), data->length() );
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // Type implementation
 // 1.5.0.0 (ge) added
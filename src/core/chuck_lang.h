@@ -61,6 +61,8 @@ t_CKBOOL init_class_vec3( Chuck_Env * env, Chuck_Type * type ); // 1.3.5.3
 t_CKBOOL init_class_vec4( Chuck_Env * env, Chuck_Type * type ); // 1.3.5.3
 t_CKBOOL init_class_type( Chuck_Env * env, Chuck_Type * type ); // 1.5.0.0
 t_CKBOOL init_class_function( Chuck_Env * env, Chuck_Type * type ); // 1.5.0.0
+t_CKBOOL init_class_deque( Chuck_Env * env ); // 1.5.1.7
+t_CKBOOL init_class_stringbuilder( Chuck_Env * env ); // 1.5.1.7
 t_CKBOOL init_primitive_types( Chuck_Env * env ); // 1.5.0.0
 
 
@@ -183,6 +185,9 @@ CK_DLL_DTOR( array_dtor );
 CK_DLL_MFUN( array_set_capacity );
 CK_DLL_MFUN( array_get_capacity );
 CK_DLL_MFUN( array_get_capacity_hack );
+CK_DLL_MFUN( array_reserve );
+CK_DLL_MFUN( array_get_fixed );
+CK_DLL_MFUN( array_set_fixed );
 CK_DLL_MFUN( array_set_size );
 CK_DLL_MFUN( array_get_size );
 CK_DLL_MFUN( array_insert );
@@ -196,11 +201,223 @@ CK_DLL_MFUN( array_clear );
 CK_DLL_MFUN( array_reset );
 CK_DLL_MFUN( array_zero );
 CK_DLL_MFUN( array_get_keys );
+CK_DLL_MFUN( array_get_keys_sorted );
 CK_DLL_MFUN( array_reverse );
 CK_DLL_MFUN( array_shuffle );
 CK_DLL_MFUN( array_sort );
 CK_DLL_MFUN( array_map_find );
 CK_DLL_MFUN( array_map_erase );
+// bulk operations over float-based arrays | 1.5.1.7
+CK_DLL_MFUN( array_bulk_add );
+CK_DLL_MFUN( array_bulk_add_out );
+CK_DLL_MFUN( array_bulk_mul );
+CK_DLL_MFUN( array_bulk_mul_out );
+CK_DLL_MFUN( array_bulk_scale );
+CK_DLL_MFUN( array_bulk_scale_out );
+CK_DLL_MFUN( array_bulk_abs );
+CK_DLL_MFUN( array_bulk_abs_out );
+CK_DLL_MFUN( array_bulk_clamp );
+CK_DLL_MFUN( array_bulk_clamp_out );
+CK_DLL_MFUN( array_bulk_interp );
+CK_DLL_MFUN( array_bulk_interp_out );
+CK_DLL_MFUN( array_bulk_dot );
+CK_DLL_MFUN( array_bulk_sum );
+CK_DLL_MFUN( array_bulk_min );
+CK_DLL_MFUN( array_bulk_max );
+CK_DLL_MFUN( array_bulk_copy_range );
+CK_DLL_MFUN( array_bulk_copy_range_from );
+
+
+
+//-----------------------------------------------------------------------------
+// Deque API | 1.5.1.7
+//-----------------------------------------------------------------------------
+CK_DLL_DTOR( deque_dtor );
+CK_DLL_MFUN( deque_size );
+CK_DLL_MFUN( deque_get_capacity );
+CK_DLL_MFUN( deque_set_capacity );
+CK_DLL_MFUN( deque_get_fixed );
+CK_DLL_MFUN( deque_set_fixed );
+CK_DLL_MFUN( deque_clear );
+CK_DLL_CTOR( intdeque_ctor );
+CK_DLL_MFUN( intdeque_push_back );
+CK_DLL_MFUN( intdeque_push_front );
+CK_DLL_MFUN( intdeque_pop_back );
+CK_DLL_MFUN( intdeque_pop_front );
+CK_DLL_MFUN( intdeque_back );
+CK_DLL_MFUN( intdeque_front );
+CK_DLL_MFUN( intdeque_get );
+CK_DLL_MFUN( intdeque_set );
+CK_DLL_CTOR( floatdeque_ctor );
+CK_DLL_MFUN( floatdeque_push_back );
+CK_DLL_MFUN( floatdeque_push_front );
+CK_DLL_MFUN( floatdeque_pop_back );
+CK_DLL_MFUN( floatdeque_pop_front );
+CK_DLL_MFUN( floatdeque_back );
+CK_DLL_MFUN( floatdeque_front );
+CK_DLL_MFUN( floatdeque_get );
+CK_DLL_MFUN( floatdeque_set );
+CK_DLL_CTOR( objdeque_ctor );
+CK_DLL_MFUN( objdeque_push_back );
+CK_DLL_MFUN( objdeque_push_front );
+CK_DLL_MFUN( objdeque_pop_back );
+CK_DLL_MFUN( objdeque_pop_front );
+CK_DLL_MFUN( objdeque_back );
+CK_DLL_MFUN( objdeque_front );
+CK_DLL_MFUN( objdeque_get );
+CK_DLL_MFUN( objdeque_set );
+
+
+//-----------------------------------------------------------------------------
+// StringBuilder API | 1.5.1.7
+//-----------------------------------------------------------------------------
+CK_DLL_CTOR( stringbuilder_ctor );
+CK_DLL_DTOR( stringbuilder_dtor );
+CK_DLL_MFUN( stringbuilder_append );
+CK_DLL_MFUN( stringbuilder_append_int );
+CK_DLL_MFUN( stringbuilder_append_float );
+CK_DLL_MFUN( stringbuilder_append_float_precision );
+CK_DLL_MFUN( stringbuilder_append_char );
+CK_DLL_MFUN( stringbuilder_length );
+CK_DLL_MFUN( stringbuilder_capacity );
+CK_DLL_MFUN( stringbuilder_reserve );
+CK_DLL_MFUN( stringbuilder_clear );
+CK_DLL_MFUN( stringbuilder_to_string );
+CK_DLL_MFUN( stringbuilder_copy_to );
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Deque
+// desc: native state of Deque (base of IntDeque, FloatDeque, ObjectDeque)
+//       a ring buffer; pushing and popping at either end is O(1) and moves
+//       no other elements; the buffer only grows (doubling) when full, and
+//       never if 'fixed', in which case a push onto a full deque drops the
+//       element at the other end; growing allocates, in the shred pushing
+//       (i.e., on the audio thread), so it is counted like array growth
+//       (see deque_grow_check() in chuck_lang.cpp) | 1.5.1.7
+//-----------------------------------------------------------------------------
+struct Chuck_Deque
+{
+public:
+    Chuck_Deque() : m_head( 0 ), m_count( 0 ), m_fixed( FALSE ) { }
+    virtual ~Chuck_Deque() { }
+
+public:
+    // number of elements
+    t_CKINT size() const { return (t_CKINT)m_count; }
+    // number of elements that fit without growing
+    virtual t_CKINT capacity() const = 0;
+    // set the capacity to n (but not below size() or 1)
+    virtual void set_capacity( t_CKINT n ) = 0;
+    // remove all elements
+    virtual void clear() = 0;
+
+public:
+    // buffer index of the front element
+    t_CKUINT m_head;
+    // number of elements
+    t_CKUINT m_count;
+    // if true, never grow
+    t_CKBOOL m_fixed;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_DequeOf
+// desc: Chuck_Deque holding elements of type T | 1.5.1.7
+//-----------------------------------------------------------------------------
+template <typename T>
+struct Chuck_DequeOf : public Chuck_Deque
+{
+public:
+    Chuck_DequeOf( t_CKINT capacity = 8 ) : m_slots( capacity > 0 ? capacity : 1 ) { }
+
+public:
+    virtual t_CKINT capacity() const { return (t_CKINT)m_slots.size(); }
+    virtual void set_capacity( t_CKINT n )
+    {
+        if( n < (t_CKINT)m_count ) n = m_count;
+        if( n < 1 ) n = 1;
+        if( n == capacity() ) return;
+        // lay the elements out from the start of the new buffer
+        std::vector<T> slots( n );
+        for( t_CKUINT i = 0; i < m_count; i++ ) slots[i] = at( i );
+        m_slots.swap( slots );
+        m_head = 0;
+    }
+    virtual void clear() { m_head = 0; m_count = 0; }
+
+public:
+    // the i-th element from the front (i < size())
+    T & at( t_CKUINT i )
+    {
+        t_CKUINT index = m_head + i;
+        return m_slots[index < m_slots.size() ? index : index - m_slots.size()];
+    }
+    // append; if full and fixed, the front element is dropped into
+    // 'dropped' and TRUE is returned
+    t_CKBOOL push_back( const T & v, T & dropped )
+    {
+        t_CKBOOL drop = make_room( dropped, TRUE );
+        m_count++; at( m_count-1 ) = v;
+        return drop;
+    }
+    // prepend; if full and fixed, the back element is dropped
+    t_CKBOOL push_front( const T & v, T & dropped )
+    {
+        t_CKBOOL drop = make_room( dropped, FALSE );
+        m_head = m_head ? m_head - 1 : m_slots.size() - 1;
+        m_slots[m_head] = v; m_count++;
+        return drop;
+    }
+    // remove and return the back element (size() > 0)
+    T pop_back() { m_count--; return at( m_count ); }
+    // remove and return the front element (size() > 0)
+    T pop_front()
+    {
+        T v = m_slots[m_head];
+        if( ++m_head == m_slots.size() ) m_head = 0;
+        m_count--;
+        return v;
+    }
+
+protected:
+    // make room for one more element: grow, or if fixed, drop the front
+    // (or back) element
+    t_CKBOOL make_room( T & dropped, t_CKBOOL front )
+    {
+        if( m_count < m_slots.size() ) return FALSE;
+        if( !m_fixed ) { set_capacity( m_slots.size() * 2 ); return FALSE; }
+        dropped = front ? pop_front() : pop_back();
+        return TRUE;
+    }
+
+protected:
+    std::vector<T> m_slots;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_ObjectDeque
+// desc: Chuck_Deque of object references; holds a reference to each
+//       element, which a pop hands to the caller | 1.5.1.7
+//-----------------------------------------------------------------------------
+struct Chuck_ObjectDeque : public Chuck_DequeOf<Chuck_Object *>
+{
+public:
+    virtual ~Chuck_ObjectDeque() { clear(); }
+
+public:
+    virtual void clear()
+    {
+        while( m_count ) { Chuck_Object * obj = pop_back(); CK_SAFE_RELEASE( obj ); }
+        m_head = 0;
+    }
+};
 
 
 //-----------------------------------------------------------------------------
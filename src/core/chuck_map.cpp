@@ -0,0 +1,54 @@
+/*----------------------------------------------------------------------------
+  ChucK Concurrent, On-the-fly Audio Programming Language
+    Compiler and Virtual Machine
+
+  Copyright (c) 2004 Ge Wang and Perry R. Cook.  All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+  U.S.A.
+-----------------------------------------------------------------------------*/
+
+
+
+//-----------------------------------------------------------------------------
+// file: chuck_map.cpp
+// desc: hash map for the associative part of ChucK arrays
+//-----------------------------------------------------------------------------
+#include "chuck_map.h"
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_map_hash()
+// desc: hash a key (FNV-1a; never 0)
+//-----------------------------------------------------------------------------
+t_CKUINT ck_map_hash( const std::string & key )
+{
+    // offset basis and prime, for the width of t_CKUINT
+    t_CKUINT h = sizeof(t_CKUINT) == 8 ? (t_CKUINT)14695981039346656037ULL : (t_CKUINT)2166136261UL;
+    const t_CKUINT prime = sizeof(t_CKUINT) == 8 ? (t_CKUINT)1099511628211ULL : (t_CKUINT)16777619UL;
+
+    for( t_CKUINT i = 0; i < key.size(); i++ )
+    {
+        h ^= (unsigned char)key[i];
+        h *= prime;
+    }
+
+    // 0 means not yet hashed
+    return h ? h : 1;
+}
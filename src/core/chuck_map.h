@@ -0,0 +1,233 @@
+/*----------------------------------------------------------------------------
+  ChucK Concurrent, On-the-fly Audio Programming Language
+    Compiler and Virtual Machine
+
+  Copyright (c) 2004 Ge Wang and Perry R. Cook.  All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+  U.S.A.
+-----------------------------------------------------------------------------*/
+
+
+
+//-----------------------------------------------------------------------------
+// file: chuck_map.h
+// desc: hash map for the associative part of ChucK arrays
+//
+//       open addressing (linear probing) over string keys, each stored
+//       with its hash; lookups that already know the hash of their key
+//       (e.g., Chuck_String::hash(), computed once per string) compare
+//       hashes before strings; entries live in a deque and are never
+//       moved, so the address of a value stays valid until its key is
+//       erased (the VM writes to map elements through their addresses);
+//       the interface follows the parts of std::map the arrays use
+//-----------------------------------------------------------------------------
+#ifndef __CHUCK_MAP_H__
+#define __CHUCK_MAP_H__
+
+#include "chuck_def.h"
+#include <string>
+#include <vector>
+#include <deque>
+#include <algorithm>
+
+
+// initial number of slots (power of 2)
+#define CK_MAP_INIT_SLOTS            8
+
+
+//-----------------------------------------------------------------------------
+// name: ck_map_hash()
+// desc: hash a key (never 0, which means "not yet hashed")
+//-----------------------------------------------------------------------------
+t_CKUINT ck_map_hash( const std::string & key );
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Map
+// desc: hash map from string to T
+//-----------------------------------------------------------------------------
+template <typename T>
+struct Chuck_Map
+{
+public:
+    // an entry; first/second as in std::map
+    struct Entry
+    {
+        std::string first;
+        T second;
+        t_CKUINT hash;
+        t_CKBOOL used;
+    };
+
+    // iterator over entries in use (in no particular order)
+    struct iterator
+    {
+        std::deque<Entry> * entries;
+        t_CKUINT i;
+
+        iterator( std::deque<Entry> * e = NULL, t_CKUINT at = 0 ) : entries(e), i(at) { skip(); }
+        Entry & operator *() const { return (*entries)[i]; }
+        Entry * operator ->() const { return &(*entries)[i]; }
+        iterator & operator ++() { i++; skip(); return *this; }
+        iterator operator ++( int ) { iterator it = *this; ++(*this); return it; }
+        bool operator ==( const iterator & rhs ) const { return i == rhs.i; }
+        bool operator !=( const iterator & rhs ) const { return i != rhs.i; }
+        // move past unused entries
+        void skip() { while( entries && i < entries->size() && !(*entries)[i].used ) i++; }
+    };
+
+public:
+    Chuck_Map() : m_count(0), m_tombs(0) { }
+
+    // number of keys
+    t_CKUINT size() const { return m_count; }
+    t_CKBOOL empty() const { return m_count == 0; }
+    // iterate
+    iterator begin() { return iterator( &m_entries, 0 ); }
+    iterator end() { return iterator( &m_entries, m_entries.size() ); }
+
+    // find key; end() if not there
+    iterator find( const std::string & key, t_CKUINT hash = 0 )
+    {
+        t_CKUINT e = lookup( key, hash ? hash : ck_map_hash( key ) );
+        return e ? iterator( &m_entries, e - 1 ) : end();
+    }
+
+    // value at key, added (zeroed) if not there
+    T & operator []( const std::string & key ) { return get( key, 0 ); }
+    T & get( const std::string & key, t_CKUINT hash )
+    {
+        if( !hash ) hash = ck_map_hash( key );
+        t_CKUINT e = lookup( key, hash );
+        return e ? m_entries[e-1].second : add( key, hash );
+    }
+
+    // erase key; returns number erased (0 or 1)
+    t_CKUINT erase( const std::string & key, t_CKUINT hash = 0 )
+    {
+        if( !hash ) hash = ck_map_hash( key );
+        if( m_slots.empty() ) return 0;
+        t_CKUINT mask = m_slots.size() - 1;
+        for( t_CKUINT s = hash & mask; m_slots[s]; s = (s + 1) & mask )
+        {
+            t_CKUINT e = m_slots[s];
+            if( e == TOMB ) continue;
+            Entry & entry = m_entries[e-1];
+            if( entry.hash != hash || entry.first != key ) continue;
+            // free the entry for reuse, leave a tombstone in the slot
+            entry.used = FALSE; entry.first.clear(); entry.second = T();
+            m_free.push_back( e - 1 );
+            m_slots[s] = TOMB;
+            m_count--; m_tombs++;
+            return 1;
+        }
+        return 0;
+    }
+
+    // erase everything
+    void clear()
+    {
+        m_entries.clear(); m_free.clear(); m_slots.clear();
+        m_count = m_tombs = 0;
+    }
+
+    // exchange contents
+    void swap( Chuck_Map & rhs )
+    {
+        m_entries.swap( rhs.m_entries ); m_free.swap( rhs.m_free );
+        m_slots.swap( rhs.m_slots );
+        std::swap( m_count, rhs.m_count ); std::swap( m_tombs, rhs.m_tombs );
+    }
+
+protected:
+    // slot marker for an erased entry
+    static const t_CKUINT TOMB = (t_CKUINT)-1;
+
+    // entry index + 1 for key; 0 if not there
+    t_CKUINT lookup( const std::string & key, t_CKUINT hash ) const
+    {
+        if( m_slots.empty() ) return 0;
+        t_CKUINT mask = m_slots.size() - 1;
+        for( t_CKUINT s = hash & mask; m_slots[s]; s = (s + 1) & mask )
+        {
+            t_CKUINT e = m_slots[s];
+            if( e == TOMB ) continue;
+            const Entry & entry = m_entries[e-1];
+            if( entry.hash == hash && entry.first == key ) return e;
+        }
+        return 0;
+    }
+
+    // add a key known not to be there
+    T & add( const std::string & key, t_CKUINT hash )
+    {
+        // keep slots (including tombstones) at most half full
+        if( (m_count + m_tombs + 1) * 2 > m_slots.size() ) rehash();
+
+        // an entry: reuse a free one, or append (entries never move)
+        t_CKUINT e = 0;
+        if( m_free.size() ) { e = m_free.back(); m_free.pop_back(); }
+        else { e = m_entries.size(); m_entries.push_back( Entry() ); }
+        Entry & entry = m_entries[e];
+        entry.first = key; entry.second = T(); entry.hash = hash; entry.used = TRUE;
+
+        // the first empty slot
+        place( e + 1, hash );
+        m_count++;
+
+        return entry.second;
+    }
+
+    // put entry (index + 1) in the first empty slot for hash
+    void place( t_CKUINT e, t_CKUINT hash )
+    {
+        t_CKUINT mask = m_slots.size() - 1;
+        t_CKUINT s = hash & mask;
+        while( m_slots[s] ) s = (s + 1) & mask;
+        m_slots[s] = e;
+    }
+
+    // resize slots for the keys there are (dropping tombstones)
+    void rehash()
+    {
+        t_CKUINT n = CK_MAP_INIT_SLOTS;
+        while( n < (m_count + 1) * 4 ) n <<= 1;
+        m_slots.assign( n, 0 );
+        m_tombs = 0;
+        for( t_CKUINT i = 0; i < m_entries.size(); i++ )
+            if( m_entries[i].used ) place( i + 1, m_entries[i].hash );
+    }
+
+protected:
+    // the entries
+    std::deque<Entry> m_entries;
+    // entries free for reuse
+    std::vector<t_CKUINT> m_free;
+    // hash table of entry index + 1 (0: empty, TOMB: erased)
+    std::vector<t_CKUINT> m_slots;
+    // keys, and erased slots
+    t_CKUINT m_count;
+    t_CKUINT m_tombs;
+};
+
+
+
+
+#endif
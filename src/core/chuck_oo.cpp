@@ -37,15 +37,21 @@
 #include "chuck_instr.h"
 #include "chuck_errmsg.h"
 #include "chuck_dl.h"
+#include "chuck_reclaim.h"
+#include "chuck_pool.h"
+#include "chuck_cycle.h"
 #include "util_math.h"
 
 #include <algorithm>
+#include <string.h>
 #include <iostream>
+#include <new>
 using namespace std;
 
 
 // initialize
 t_CKBOOL Chuck_VM_Object::our_locks_in_effect = TRUE;
+// deferred reclamation; NULL to delete right away | 1.5.1.7
 
 
 
@@ -163,6 +169,16 @@ void Chuck_VM_Object::release()
         // track | 1.5.0.5 (ge)
         CK_VM_DEBUGGER( destruct( this ) );
 
+        // hand off to the origin VM's reclaimer (if on), which deletes it
+        // a few at a time per block, keeping large releases off this call
+        // (reclaimable objects are Chuck_Objects; see reclaimable()) | 1.5.1.7
+        if( reclaimable() )
+        {
+            Chuck_VM * vm = ((Chuck_Object *)this)->originVM();
+            Chuck_VM_Reclaimer * reclaimer = vm ? vm->reclaimer() : NULL;
+            if( reclaimer && reclaimer->defer( this ) ) return;
+        }
+
         // trigger this object's deletion / destructors
         // should be valid as long as no members are used beyond this point
         delete this; // REFACTOR-2017
@@ -172,6 +188,24 @@ void Chuck_VM_Object::release()
 
 
 
+//-----------------------------------------------------------------------------
+// name: release_to_caller() | 1.5.1.7
+// desc: decrement reference, without deleting at 0; for native functions
+//       returning an object they held a reference to (e.g., a popped
+//       element): the VM adds its own reference to the returned object
+//-----------------------------------------------------------------------------
+void Chuck_VM_Object::release_to_caller()
+{
+    // decrement
+    if( m_ref_count > 0 ) m_ref_count--;
+
+    // counts as a release
+    CK_VM_DEBUGGER( release( this ) );
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: lock()
 // desc: lock to keep from deleted
@@ -255,6 +289,8 @@ Chuck_Object::Chuck_Object()
     data = NULL;
     // zero size
     data_size = 0;
+    // not a cycle candidate
+    m_cycle_candidate = FALSE;
     // zero origin shred
     origin_shred = NULL;
     // zero origin vm
@@ -288,6 +324,27 @@ Chuck_Object::~Chuck_Object()
         type = type->parent;
     }
 
+    // no longer a cycle candidate | 1.5.1.7
+    Chuck_VM_Cycle_Collector * collector = origin_vm ? origin_vm->collector() : NULL;
+    if( m_cycle_candidate && collector ) collector->forget( this );
+
+    // release object references held in members declared in ChucK code;
+    // previously these were never released | 1.5.1.7
+    if( data )
+    {
+        for( type = this->type_ref; type != NULL; type = type->parent )
+        {
+            const vector<t_CKUINT> & offsets = type->obj_mvars();
+            for( t_CKUINT i = 0; i < offsets.size(); i++ )
+            {
+                Chuck_VM_Object ** slot = (Chuck_VM_Object **)(data + offsets[i]);
+                Chuck_VM_Object * obj = *slot;
+                *slot = NULL;
+                if( obj ) obj->release();
+            }
+        }
+    }
+
     // release
     CK_SAFE_RELEASE( origin_shred );
     CK_SAFE_RELEASE( origin_vm );
@@ -295,7 +352,76 @@ Chuck_Object::~Chuck_Object()
     // free
     CK_SAFE_DELETE( vtable );
     CK_SAFE_RELEASE( type_ref );
-    CK_SAFE_DELETE_ARRAY( data );
+    Chuck_VM_Pool::free( data ); data = NULL; // 1.5.1.7
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: release() | 1.5.1.7
+// desc: decrement reference; if other references remain, this may now be
+//       held only by a cycle, so let the cycle collector know
+//-----------------------------------------------------------------------------
+void Chuck_Object::release()
+{
+    // note
+    Chuck_VM_Cycle_Collector * collector = origin_vm ? origin_vm->collector() : NULL;
+    if( collector && m_ref_count > 1 ) collector->candidate( this );
+    // decrement, delete if 0
+    Chuck_VM_Object::release();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: operator new() | 1.5.1.7
+// desc: allocate from the heap (in a block Chuck_VM_Pool::free() accepts)
+//-----------------------------------------------------------------------------
+void * Chuck_Object::operator new( size_t size )
+{
+    void * ptr = Chuck_VM_Pool::heap_alloc( size );
+    if( !ptr ) throw std::bad_alloc();
+    return ptr;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: operator new() | 1.5.1.7
+// desc: allocate from a VM's pool; NULL pool allocates from the heap
+//-----------------------------------------------------------------------------
+void * Chuck_Object::operator new( size_t size, Chuck_VM_Pool * pool )
+{
+    void * ptr = pool ? pool->alloc( size ) : Chuck_VM_Pool::heap_alloc( size );
+    if( !ptr ) throw std::bad_alloc();
+    return ptr;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: operator delete() | 1.5.1.7
+// desc: free from wherever it was allocated
+//-----------------------------------------------------------------------------
+void Chuck_Object::operator delete( void * ptr )
+{
+    Chuck_VM_Pool::free( ptr );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: operator delete() | 1.5.1.7
+// desc: matches the pool operator new (if a constructor throws)
+//-----------------------------------------------------------------------------
+void Chuck_Object::operator delete( void * ptr, Chuck_VM_Pool * pool )
+{
+    Chuck_VM_Pool::free( ptr );
 }
 
 
@@ -363,7 +489,34 @@ void Chuck_Object::setOriginVM( Chuck_VM * vm )
 // name: Chuck_Array()
 // desc: constructor
 //-----------------------------------------------------------------------------
-Chuck_Array::Chuck_Array() { }
+Chuck_Array::Chuck_Array() : m_fixed( FALSE ) { }
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: grow_check() | 1.5.1.7 added
+// desc: whether storage of 'capacity' elements may grow to hold n; growth
+//       reallocates, so it is counted (and reported, if asked to) by the
+//       array's origin VM; fixed arrays never grow
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_Array::grow_check( t_CKUINT n, t_CKUINT capacity )
+{
+    // never reallocate
+    if( m_fixed ) return FALSE;
+
+    // not from a VM (e.g., made by the compiler)
+    if( !origin_vm ) return TRUE;
+
+    // count
+    origin_vm->count_realloc();
+    // report
+    if( origin_vm->realloc_report() )
+        CK_FPRINTF_STDERR( "[chuck]: (realloc) array storage grown past capacity %lu to hold %lu elements\n",
+                           (unsigned long)capacity, (unsigned long)n );
+
+    return TRUE;
+}
 
 
 
@@ -431,10 +584,10 @@ t_CKUINT Chuck_ArrayInt::addr( t_CKINT i )
 // name: addr()
 // desc: return address of element at key, as an int
 //-----------------------------------------------------------------------------
-t_CKUINT Chuck_ArrayInt::addr( const string & key )
+t_CKUINT Chuck_ArrayInt::addr( const string & key, t_CKUINT hash )
 {
     // get the addr
-    return (t_CKUINT)(&m_map[key]);
+    return (t_CKUINT)(&m_map.get( key, hash ));
 }
 
 
@@ -464,12 +617,12 @@ t_CKINT Chuck_ArrayInt::get( t_CKINT i, t_CKUINT * val )
 // name: get()
 // desc: get value of element at key
 //-----------------------------------------------------------------------------
-t_CKINT Chuck_ArrayInt::get( const string & key, t_CKUINT * val )
+t_CKINT Chuck_ArrayInt::get( const string & key, t_CKUINT * val, t_CKUINT hash )
 {
     // set to zero
     *val = 0;
     // find
-    map<string, t_CKUINT>::iterator iter = m_map.find( key );
+    Chuck_Map<t_CKUINT>::iterator iter = m_map.find( key, hash );
     // check
     if( iter != m_map.end() ) *val = (*iter).second;
 
@@ -515,7 +668,7 @@ t_CKINT Chuck_ArrayInt::set( t_CKINT i, t_CKUINT val )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayInt::set( const string & key, t_CKUINT val )
 {
-    map<string, t_CKUINT>::iterator iter = m_map.find( key );
+    Chuck_Map<t_CKUINT>::iterator iter = m_map.find( key );
 
     // if obj
     if( m_is_obj && iter != m_map.end() )
@@ -544,6 +697,9 @@ t_CKINT Chuck_ArrayInt::insert( t_CKINT i, t_CKUINT val )
     if( i < 0 || i >= m_vector.capacity() )
         return 0;
 
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( m_vector.size()+1, m_vector.capacity() ) ) return 0;
+
     // insert the value
     m_vector.insert( m_vector.begin()+i, val );
 
@@ -575,7 +731,7 @@ t_CKINT Chuck_ArrayInt::map_find( const string & key )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayInt::map_erase( const string & key )
 {
-    map<string, t_CKUINT>::iterator iter = m_map.find( key );
+    Chuck_Map<t_CKUINT>::iterator iter = m_map.find( key );
     t_CKINT v = iter != m_map.end();
 
     // if obj
@@ -597,6 +753,8 @@ t_CKINT Chuck_ArrayInt::map_erase( const string & key )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayInt::push_back( t_CKUINT val )
 {
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( m_vector.size()+1, m_vector.capacity() ) ) return 0;
     // if obj, reference count it (added 1.3.0.0)
     if( m_is_obj && val ) ((Chuck_Object *)val)->add_ref();
 
@@ -645,6 +803,8 @@ t_CKINT Chuck_ArrayInt::pop_back()
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayInt::push_front( t_CKUINT val )
 {
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( m_vector.size()+1, m_vector.capacity() ) ) return 0;
     // if obj, reference count it (added 1.3.0.0)
     if( m_is_obj && val ) ((Chuck_Object *)val)->add_ref();
 
@@ -755,16 +915,18 @@ t_CKINT Chuck_ArrayInt::erase( t_CKINT begin, t_CKINT end )
 // name: get_keys() | 1.4.1.1 nshaheed (added)
 // desc: return vector of keys from associative array
 //-----------------------------------------------------------------------------
-void Chuck_ArrayInt::get_keys( std::vector<std::string> & keys )
+void Chuck_ArrayInt::get_keys( std::vector<std::string> & keys, t_CKBOOL sorted )
 {
     // clear the return array
     keys.clear();
     // iterator
-    for( std::map<std::string, t_CKUINT>::iterator iter = m_map.begin(); iter !=m_map.end(); iter++ )
+    for( Chuck_Map<t_CKUINT>::iterator iter = m_map.begin(); iter != m_map.end(); iter++ )
     {
         // add to list
         keys.push_back((*iter).first);
     }
+    // in key order (as with std::map, before 1.5.1.7)
+    if( sorted ) std::sort( keys.begin(), keys.end() );
 }
 
 
@@ -879,6 +1041,9 @@ t_CKINT Chuck_ArrayInt::set_capacity( t_CKINT capacity )
     // sanity check
     assert( capacity >= 0 );
 
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( capacity, m_vector.capacity() ) ) return m_vector.capacity();
+
     // ensure size (removed 1.4.1.0 in favor of actually setting capacity)
     // set_size( capacity );
 
@@ -907,6 +1072,27 @@ t_CKINT Chuck_ArrayInt::set_capacity( t_CKINT capacity )
 
 
 
+//-----------------------------------------------------------------------------
+// name: reserve() | 1.5.1.7 added
+// desc: make room for n elements, without changing size
+//-----------------------------------------------------------------------------
+t_CKINT Chuck_ArrayInt::reserve( t_CKINT n )
+{
+    t_CKUINT capacity = m_vector.capacity();
+    // grow, unless fixed
+    if( n > (t_CKINT)capacity && can_grow( n, capacity ) )
+    {
+        m_vector.reserve( n );
+        // keep storage past the end zeroed, like the rest of the array
+        memset( m_vector.data() + m_vector.size(), 0, (m_vector.capacity() - m_vector.size()) * sizeof(t_CKUINT) );
+    }
+
+    return m_vector.capacity();
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: set_size()
 // desc: ...
@@ -916,6 +1102,9 @@ t_CKINT Chuck_ArrayInt::set_size( t_CKINT size )
     // sanity check
     assert( size >= 0 );
 
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( size, m_vector.capacity() ) ) return m_vector.size();
+
     // if clearing size
     if( size < m_vector.size() )
     {
@@ -1030,10 +1219,10 @@ t_CKUINT Chuck_ArrayFloat::addr( t_CKINT i )
 // name: addr()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKUINT Chuck_ArrayFloat::addr( const string & key )
+t_CKUINT Chuck_ArrayFloat::addr( const string & key, t_CKUINT hash )
 {
     // get the addr
-    return (t_CKUINT)(&m_map[key]);
+    return (t_CKUINT)(&m_map.get( key, hash ));
 }
 
 
@@ -1063,13 +1252,13 @@ t_CKINT Chuck_ArrayFloat::get( t_CKINT i, t_CKFLOAT * val )
 // name: get()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKINT Chuck_ArrayFloat::get( const string & key, t_CKFLOAT * val )
+t_CKINT Chuck_ArrayFloat::get( const string & key, t_CKFLOAT * val, t_CKUINT hash )
 {
     // set to zero
     *val = 0.0;
 
     // iterator
-    map<string, t_CKFLOAT>::iterator iter = m_map.find( key );
+    Chuck_Map<t_CKFLOAT>::iterator iter = m_map.find( key, hash );
 
     // check
     if( iter != m_map.end() )
@@ -1137,6 +1326,9 @@ t_CKINT Chuck_ArrayFloat::insert( t_CKINT i, t_CKFLOAT val )
     if( i < 0 || i >= m_vector.capacity() )
         return 0;
 
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( m_vector.size()+1, m_vector.capacity() ) ) return 0;
+
     // insert the value
     m_vector.insert( m_vector.begin()+i, val );
 
@@ -1176,6 +1368,8 @@ t_CKINT Chuck_ArrayFloat::map_erase( const string & key )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayFloat::push_back( t_CKFLOAT val )
 {
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( m_vector.size()+1, m_vector.capacity() ) ) return 0;
     // add to vector
     m_vector.push_back( val );
 
@@ -1212,6 +1406,8 @@ t_CKINT Chuck_ArrayFloat::pop_back( )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayFloat::push_front( t_CKFLOAT val )
 {
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( m_vector.size()+1, m_vector.capacity() ) ) return 0;
     // add to vector
     m_vector.insert( m_vector.begin(), val );
 
@@ -1288,16 +1484,18 @@ t_CKINT Chuck_ArrayFloat::erase( t_CKINT begin, t_CKINT end )
 // name: get_keys() | 1.4.1.1 nshaheed (added)
 // desc: return vector of keys from associative array
 //-----------------------------------------------------------------------------
-void Chuck_ArrayFloat::get_keys( std::vector<std::string> & keys )
+void Chuck_ArrayFloat::get_keys( std::vector<std::string> & keys, t_CKBOOL sorted )
 {
     // clear the return array
     keys.clear();
     // iterator
-    for( std::map<std::string,t_CKFLOAT>::iterator iter = m_map.begin(); iter !=m_map.end(); iter++ )
+    for( Chuck_Map<t_CKFLOAT>::iterator iter = m_map.begin(); iter != m_map.end(); iter++ )
     {
         // add to list
         keys.push_back((*iter).first);
     }
+    // in key order (as with std::map, before 1.5.1.7)
+    if( sorted ) std::sort( keys.begin(), keys.end() );
 }
 
 
@@ -1391,6 +1589,27 @@ t_CKINT Chuck_ArrayFloat::set_capacity( t_CKINT capacity )
 
 
 
+//-----------------------------------------------------------------------------
+// name: reserve() | 1.5.1.7 added
+// desc: make room for n elements, without changing size
+//-----------------------------------------------------------------------------
+t_CKINT Chuck_ArrayFloat::reserve( t_CKINT n )
+{
+    t_CKUINT capacity = m_vector.capacity();
+    // grow, unless fixed
+    if( n > (t_CKINT)capacity && can_grow( n, capacity ) )
+    {
+        m_vector.reserve( n );
+        // keep storage past the end zeroed, like the rest of the array
+        memset( m_vector.data() + m_vector.size(), 0, (m_vector.capacity() - m_vector.size()) * sizeof(t_CKFLOAT) );
+    }
+
+    return m_vector.capacity();
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: set_size()
 // desc: ...
@@ -1400,6 +1619,9 @@ t_CKINT Chuck_ArrayFloat::set_size( t_CKINT size )
     // sanity check
     assert( size >= 0 );
 
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( size, m_vector.capacity() ) ) return m_vector.size();
+
     // if clearing size
     if( size < m_vector.size() )
     {
@@ -1458,6 +1680,7 @@ Chuck_Array16::Chuck_Array16( t_CKINT capacity )
     this->zero( 0, m_vector.capacity() );
     // clear
     m_isPolarType = FALSE;
+    m_isComplexType = FALSE;
 }
 
 
@@ -1496,10 +1719,10 @@ t_CKUINT Chuck_Array16::addr( t_CKINT i )
 // name: addr()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKUINT Chuck_Array16::addr( const string & key )
+t_CKUINT Chuck_Array16::addr( const string & key, t_CKUINT hash )
 {
     // get the addr
-    return (t_CKUINT)(&m_map[key]);
+    return (t_CKUINT)(&m_map.get( key, hash ));
 }
 
 
@@ -1532,14 +1755,14 @@ t_CKINT Chuck_Array16::get( t_CKINT i, t_CKCOMPLEX * val )
 // name: get()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKINT Chuck_Array16::get( const string & key, t_CKVEC2 * val )
+t_CKINT Chuck_Array16::get( const string & key, t_CKVEC2 * val, t_CKUINT hash )
 {
     // set to zero
     val->x = 0;
     val->y = 0;
 
     // iterator
-    map<string, t_CKVEC2>::iterator iter = m_map.find( key );
+    Chuck_Map<t_CKVEC2>::iterator iter = m_map.find( key, hash );
 
     // check
     if( iter != m_map.end() )
@@ -1552,8 +1775,8 @@ t_CKINT Chuck_Array16::get( const string & key, t_CKVEC2 * val )
     return 1;
 }
 // redirect as vec2
-t_CKINT Chuck_Array16::get( const string & key, t_CKCOMPLEX * val )
-{ return this->get( key, (t_CKVEC2 *)val ); }
+t_CKINT Chuck_Array16::get( const string & key, t_CKCOMPLEX * val, t_CKUINT hash )
+{ return this->get( key, (t_CKVEC2 *)val, hash ); }
 
 
 
@@ -1614,6 +1837,9 @@ t_CKINT Chuck_Array16::insert( t_CKINT i, const t_CKVEC2 & val )
     if( i < 0 || i >= m_vector.capacity() )
         return 0;
 
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( m_vector.size()+1, m_vector.capacity() ) ) return 0;
+
     // insert the value
     m_vector.insert( m_vector.begin()+i, val );
 
@@ -1653,6 +1879,8 @@ t_CKINT Chuck_Array16::map_erase( const string & key )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_Array16::push_back( const t_CKVEC2 & val )
 {
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( m_vector.size()+1, m_vector.capacity() ) ) return 0;
     // add to vector
     m_vector.push_back( val );
 
@@ -1690,6 +1918,8 @@ t_CKINT Chuck_Array16::pop_back( )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_Array16::push_front( const t_CKVEC2 & val )
 {
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( m_vector.size()+1, m_vector.capacity() ) ) return 0;
     // add to vector
     m_vector.insert( m_vector.begin(), val );
 
@@ -1766,16 +1996,18 @@ t_CKINT Chuck_Array16::erase( t_CKINT begin, t_CKINT end )
 // name: get_keys() | 1.4.1.1 nshaheed (added)
 // desc: return vector of keys from associative array
 //-----------------------------------------------------------------------------
-void Chuck_Array16::get_keys( std::vector<std::string> & keys )
+void Chuck_Array16::get_keys( std::vector<std::string> & keys, t_CKBOOL sorted )
 {
     // clear the return array
     keys.clear();
     // iterator
-    for( std::map<std::string,t_CKVEC2>::iterator iter = m_map.begin(); iter !=m_map.end(); iter++ )
+    for( Chuck_Map<t_CKVEC2>::iterator iter = m_map.begin(); iter != m_map.end(); iter++ )
     {
         // add to list
         keys.push_back((*iter).first);
     }
+    // in key order (as with std::map, before 1.5.1.7)
+    if( sorted ) std::sort( keys.begin(), keys.end() );
 }
 
 
@@ -1949,6 +2181,27 @@ t_CKINT Chuck_Array16::set_capacity( t_CKINT capacity )
 
 
 
+//-----------------------------------------------------------------------------
+// name: reserve() | 1.5.1.7 added
+// desc: make room for n elements, without changing size
+//-----------------------------------------------------------------------------
+t_CKINT Chuck_Array16::reserve( t_CKINT n )
+{
+    t_CKUINT capacity = m_vector.capacity();
+    // grow, unless fixed
+    if( n > (t_CKINT)capacity && can_grow( n, capacity ) )
+    {
+        m_vector.reserve( n );
+        // keep storage past the end zeroed, like the rest of the array
+        memset( m_vector.data() + m_vector.size(), 0, (m_vector.capacity() - m_vector.size()) * sizeof(t_CKVEC2) );
+    }
+
+    return m_vector.capacity();
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: set_size()
 // desc: ...
@@ -1958,6 +2211,9 @@ t_CKINT Chuck_Array16::set_size( t_CKINT size )
     // sanity check
     assert( size >= 0 );
 
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( size, m_vector.capacity() ) ) return m_vector.size();
+
     // if clearing size
     if( size < m_vector.size() )
     {
@@ -2053,10 +2309,10 @@ t_CKUINT Chuck_Array24::addr( t_CKINT i )
 // name: addr()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKUINT Chuck_Array24::addr( const string & key )
+t_CKUINT Chuck_Array24::addr( const string & key, t_CKUINT hash )
 {
     // get the addr
-    return (t_CKUINT)(&m_map[key]);
+    return (t_CKUINT)(&m_map.get( key, hash ));
 }
 
 
@@ -2086,13 +2342,13 @@ t_CKINT Chuck_Array24::get( t_CKINT i, t_CKVEC3 * val )
 // name: get()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKINT Chuck_Array24::get( const string & key, t_CKVEC3 * val )
+t_CKINT Chuck_Array24::get( const string & key, t_CKVEC3 * val, t_CKUINT hash )
 {
     // set to zero
     val->x = val->y = val->z = 0;
 
     // iterator
-    map<string, t_CKVEC3>::iterator iter = m_map.find( key );
+    Chuck_Map<t_CKVEC3>::iterator iter = m_map.find( key, hash );
 
     // check
     if( iter != m_map.end() )
@@ -2157,6 +2413,9 @@ t_CKINT Chuck_Array24::insert( t_CKINT i, const t_CKVEC3 & val )
     if( i < 0 || i >= m_vector.capacity() )
         return 0;
 
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( m_vector.size()+1, m_vector.capacity() ) ) return 0;
+
     // insert the value
     m_vector.insert( m_vector.begin()+i, val );
 
@@ -2196,6 +2455,8 @@ t_CKINT Chuck_Array24::map_erase( const string & key )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_Array24::push_back( const t_CKVEC3 & val )
 {
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( m_vector.size()+1, m_vector.capacity() ) ) return 0;
     // add to vector
     m_vector.push_back( val );
 
@@ -2253,6 +2514,8 @@ t_CKINT Chuck_Array24::back( t_CKVEC3 * val ) const
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_Array24::push_front( const t_CKVEC3 & val )
 {
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( m_vector.size()+1, m_vector.capacity() ) ) return 0;
     // add to vector
     m_vector.insert( m_vector.begin(), val );
 
@@ -2359,6 +2622,27 @@ t_CKINT Chuck_Array24::set_capacity( t_CKINT capacity )
 
 
 
+//-----------------------------------------------------------------------------
+// name: reserve() | 1.5.1.7 added
+// desc: make room for n elements, without changing size
+//-----------------------------------------------------------------------------
+t_CKINT Chuck_Array24::reserve( t_CKINT n )
+{
+    t_CKUINT capacity = m_vector.capacity();
+    // grow, unless fixed
+    if( n > (t_CKINT)capacity && can_grow( n, capacity ) )
+    {
+        m_vector.reserve( n );
+        // keep storage past the end zeroed, like the rest of the array
+        memset( m_vector.data() + m_vector.size(), 0, (m_vector.capacity() - m_vector.size()) * sizeof(t_CKVEC3) );
+    }
+
+    return m_vector.capacity();
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: set_size()
 // desc: ...
@@ -2368,6 +2652,9 @@ t_CKINT Chuck_Array24::set_size( t_CKINT size )
     // sanity check
     assert( size >= 0 );
 
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( size, m_vector.capacity() ) ) return m_vector.size();
+
     // if clearing size
     if( size < m_vector.size() )
     {
@@ -2418,16 +2705,18 @@ void Chuck_Array24::zero( t_CKUINT start, t_CKUINT end )
 // name: get_keys() | 1.4.1.1 nshaheed (added)
 // desc: return vector of keys from associative array
 //-----------------------------------------------------------------------------
-void Chuck_Array24::get_keys( std::vector<std::string> & keys )
+void Chuck_Array24::get_keys( std::vector<std::string> & keys, t_CKBOOL sorted )
 {
     // clear the return array
     keys.clear();
     // iterator
-    for( std::map<std::string, t_CKVEC3>::iterator iter = m_map.begin(); iter !=m_map.end(); iter++ )
+    for( Chuck_Map<t_CKVEC3>::iterator iter = m_map.begin(); iter != m_map.end(); iter++ )
     {
         // add to list
         keys.push_back((*iter).first);
     }
+    // in key order (as with std::map, before 1.5.1.7)
+    if( sorted ) std::sort( keys.begin(), keys.end() );
 }
 
 
@@ -2543,10 +2832,10 @@ t_CKUINT Chuck_Array32::addr( t_CKINT i )
 // name: addr()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKUINT Chuck_Array32::addr( const string & key )
+t_CKUINT Chuck_Array32::addr( const string & key, t_CKUINT hash )
 {
     // get the addr
-    return (t_CKUINT)(&m_map[key]);
+    return (t_CKUINT)(&m_map.get( key, hash ));
 }
 
 
@@ -2576,13 +2865,13 @@ t_CKINT Chuck_Array32::get( t_CKINT i, t_CKVEC4 * val )
 // name: get()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKINT Chuck_Array32::get( const string & key, t_CKVEC4 * val )
+t_CKINT Chuck_Array32::get( const string & key, t_CKVEC4 * val, t_CKUINT hash )
 {
     // set to zero
     val->x = val->y = val->z = val->w;
 
     // iterator
-    map<string, t_CKVEC4>::iterator iter = m_map.find( key );
+    Chuck_Map<t_CKVEC4>::iterator iter = m_map.find( key, hash );
 
     // check
     if( iter != m_map.end() )
@@ -2650,6 +2939,9 @@ t_CKINT Chuck_Array32::insert( t_CKINT i, const t_CKVEC4 & val )
     if( i < 0 || i >= m_vector.capacity() )
         return 0;
 
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( m_vector.size()+1, m_vector.capacity() ) ) return 0;
+
     // insert the value
     m_vector.insert( m_vector.begin()+i, val );
 
@@ -2689,6 +2981,8 @@ t_CKINT Chuck_Array32::map_erase( const string & key )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_Array32::push_back( const t_CKVEC4 & val )
 {
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( m_vector.size()+1, m_vector.capacity() ) ) return 0;
     // add to vector
     m_vector.push_back( val );
 
@@ -2747,6 +3041,8 @@ t_CKINT Chuck_Array32::back( t_CKVEC4 * val ) const
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_Array32::push_front( const t_CKVEC4 & val )
 {
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( m_vector.size()+1, m_vector.capacity() ) ) return 0;
     // add to vector
     m_vector.insert( m_vector.begin(), val );
 
@@ -2853,6 +3149,27 @@ t_CKINT Chuck_Array32::set_capacity( t_CKINT capacity )
 
 
 
+//-----------------------------------------------------------------------------
+// name: reserve() | 1.5.1.7 added
+// desc: make room for n elements, without changing size
+//-----------------------------------------------------------------------------
+t_CKINT Chuck_Array32::reserve( t_CKINT n )
+{
+    t_CKUINT capacity = m_vector.capacity();
+    // grow, unless fixed
+    if( n > (t_CKINT)capacity && can_grow( n, capacity ) )
+    {
+        m_vector.reserve( n );
+        // keep storage past the end zeroed, like the rest of the array
+        memset( m_vector.data() + m_vector.size(), 0, (m_vector.capacity() - m_vector.size()) * sizeof(t_CKVEC4) );
+    }
+
+    return m_vector.capacity();
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: set_size()
 // desc: ...
@@ -2862,6 +3179,9 @@ t_CKINT Chuck_Array32::set_size( t_CKINT size )
     // sanity check
     assert( size >= 0 );
 
+    // growing past capacity reallocates, unless fixed | 1.5.1.7
+    if( !can_grow( size, m_vector.capacity() ) ) return m_vector.size();
+
     // if clearing size
     if( size < m_vector.size() )
     {
@@ -2913,16 +3233,18 @@ void Chuck_Array32::zero( t_CKUINT start, t_CKUINT end )
 // name: get_keys() | 1.4.1.1 nshaheed (added)
 // desc: return vector of keys from associative array
 //-----------------------------------------------------------------------------
-void Chuck_Array32::get_keys( std::vector<std::string> & keys )
+void Chuck_Array32::get_keys( std::vector<std::string> & keys, t_CKBOOL sorted )
 {
     // clear the return array
     keys.clear();
     // iterator
-    for( std::map<std::string, t_CKVEC4>::iterator iter = m_map.begin(); iter !=m_map.end(); iter++ )
+    for( Chuck_Map<t_CKVEC4>::iterator iter = m_map.begin(); iter != m_map.end(); iter++ )
     {
         // add to list
         keys.push_back((*iter).first);
     }
+    // in key order (as with std::map, before 1.5.1.7)
+    if( sorted ) std::sort( keys.begin(), keys.end() );
 }
 
 
@@ -2992,6 +3314,36 @@ void Chuck_Array32::sort()
 t_CKUINT Chuck_Event::our_can_wait = 0;
 t_CKUINT Chuck_Event::our_waiting_on = 0;
 
+//-----------------------------------------------------------------------------
+// name: Chuck_Event()
+// desc: constructor | 1.5.1.7
+//-----------------------------------------------------------------------------
+Chuck_Event::Chuck_Event()
+    : m_wait_head( NULL ), m_wait_tail( NULL ), m_num_waiting( 0 )
+{
+    // our place in the VM's broadcast request queue
+    m_link = new Chuck_Event_Link( this );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ~Chuck_Event()
+// desc: destructor | 1.5.1.7
+//-----------------------------------------------------------------------------
+Chuck_Event::~Chuck_Event()
+{
+    // let go of the link...
+    m_link->event.store( NULL );
+    // ...which the VM deletes if it's queued; no one else can queue it now
+    if( m_link->pending.load() == 0 ) delete m_link;
+    m_link = NULL;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: signal_local()
 // desc: signal a event/condition variable, shreduling the next waiting shred
@@ -2999,38 +3351,26 @@ t_CKUINT Chuck_Event::our_waiting_on = 0;
 //-----------------------------------------------------------------------------
 void Chuck_Event::signal_local()
 {
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.acquire();
-    #endif
-    if( !m_queue.empty() )
-    {
-        // get the shred on top of the queue
-        Chuck_VM_Shred * shred = m_queue.front();
-        // pop the top
-        m_queue.pop();
-        // release it!
-        #ifndef __DISABLE_THREADS__
-        m_queue_lock.release();
-        #endif
-        // REFACTOR-2017: BUG-FIX
-        // release the extra ref we added when we started waiting for this event
-        CK_SAFE_RELEASE( shred->event );
-        // get shreduler
-        Chuck_VM_Shreduler * shreduler = shred->vm_ref->shreduler();
-        // remove the blocked shred from the list
-        shreduler->remove_blocked( shred );
-        // shredule the signaled shred
-        shreduler->shredule( shred );
-        // push the current time
-        t_CKTIME *& sp = (t_CKTIME *&)shred->reg->sp;
-        push_( sp, shreduler->now_system );
-    }
-    else
-    {
-        #ifndef __DISABLE_THREADS__
-        m_queue_lock.release();
-        #endif
-    }
+    // the shred waiting longest
+    Chuck_VM_Shred * shred = m_wait_head;
+    // none
+    if( !shred ) return;
+
+    // take it off the list
+    remove( shred );
+    // REFACTOR-2017: BUG-FIX
+    // release the extra ref we added when we started waiting for this event
+    // (remove() zeroed shred->event, so release ourself)
+    this->release();
+    // get shreduler
+    Chuck_VM_Shreduler * shreduler = shred->vm_ref->shreduler();
+    // remove the blocked shred from the list
+    shreduler->remove_blocked( shred );
+    // shredule the signaled shred
+    shreduler->shredule( shred );
+    // push the current time
+    t_CKTIME *& sp = (t_CKTIME *&)shred->reg->sp;
+    push_( sp, shreduler->now_system );
 }
 
 
@@ -3042,47 +3382,26 @@ void Chuck_Event::signal_local()
 //-----------------------------------------------------------------------------
 t_CKBOOL Chuck_Event::remove( Chuck_VM_Shred * shred )
 {
-    queue<Chuck_VM_Shred *> temp;
-    t_CKBOOL removed = FALSE;
+    // not waiting on us
+    if( shred->event != this ) return FALSE;
 
-    // lock
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.acquire();
-    #endif
-    // while something in queue
-    while( !m_queue.empty() )
-    {
-        // check if the shred we are looking for
-        if( m_queue.front() != shred )
-        {
-            // if not, enqueue it into temp
-            temp.push( m_queue.front() );
-        }
-        else
-        {
-            // TARPIT: this might seem like the right place for
-            // CK_SAFE_RELEASE(shred->event), however this might cause
-            // the deletion of the object while we are still using it.
-            // so, put it in the caller: Chuck_VM_Shreduler::remove_blocked()
-
-            // zero out
-            shred->event = NULL;
-            // flag
-            removed = TRUE;
-        }
+    // TARPIT: this might seem like the right place for
+    // CK_SAFE_RELEASE(shred->event), however this might cause
+    // the deletion of the object while we are still using it.
+    // so, put it in the caller: Chuck_VM_Shreduler::remove_blocked()
 
-        // pop the top
-        m_queue.pop();
-    }
+    // unlink, in O(1) | 1.5.1.7 (was: rebuilt the queue without it)
+    if( shred->event_prev ) shred->event_prev->event_next = shred->event_next;
+    else m_wait_head = shred->event_next;
+    if( shred->event_next ) shred->event_next->event_prev = shred->event_prev;
+    else m_wait_tail = shred->event_prev;
+    shred->event_prev = shred->event_next = NULL;
+    m_num_waiting.fetch_sub( 1, std::memory_order_relaxed );
 
-    // copy temp back to queue
-    m_queue = temp;
-    // release lock
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.release();
-    #endif
+    // zero out
+    shred->event = NULL;
 
-    return removed;
+    return TRUE;
 }
 
 
@@ -3165,10 +3484,6 @@ t_CKBOOL Chuck_Event::remove_listen( void (* cb)(void) )
     std::queue<Chuck_Global_Event_Listener> temp;
     t_CKBOOL removed = FALSE;
 
-    // lock
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.acquire();
-    #endif
     // while something in queue
     while( !m_global_queue.empty() )
     {
@@ -3190,10 +3505,6 @@ t_CKBOOL Chuck_Event::remove_listen( void (* cb)(void) )
 
     // copy temp back to queue
     m_global_queue = temp;
-    // release lock
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.release();
-    #endif
 
     return removed;
 }
@@ -3210,10 +3521,6 @@ t_CKBOOL Chuck_Event::remove_listen( std::string name, void (* cb)(const char *)
     std::queue<Chuck_Global_Event_Listener> temp;
     t_CKBOOL removed = FALSE;
 
-    // lock
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.acquire();
-    #endif
     // while something in queue
     while( !m_global_queue.empty() )
     {
@@ -3235,10 +3542,6 @@ t_CKBOOL Chuck_Event::remove_listen( std::string name, void (* cb)(const char *)
 
     // copy temp back to queue
     m_global_queue = temp;
-    // release lock
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.release();
-    #endif
 
     return removed;
 }
@@ -3255,10 +3558,6 @@ t_CKBOOL Chuck_Event::remove_listen( t_CKINT id, void (* cb)(t_CKINT)  )
     std::queue<Chuck_Global_Event_Listener> temp;
     t_CKBOOL removed = FALSE;
 
-    // lock
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.acquire();
-    #endif
     // while something in queue
     while( !m_global_queue.empty() )
     {
@@ -3280,10 +3579,6 @@ t_CKBOOL Chuck_Event::remove_listen( t_CKINT id, void (* cb)(t_CKINT)  )
 
     // copy temp back to queue
     m_global_queue = temp;
-    // release lock
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.release();
-    #endif
 
     return removed;
 }
@@ -3297,10 +3592,6 @@ t_CKBOOL Chuck_Event::remove_listen( t_CKINT id, void (* cb)(t_CKINT)  )
 //-----------------------------------------------------------------------------
 void Chuck_Event::signal_global()
 {
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.acquire();
-    #endif
-
     if( !m_global_queue.empty() )
     {
         // get the listener on top of the queue
@@ -3335,10 +3626,6 @@ void Chuck_Event::signal_global()
             m_global_queue.push( listener );
         }
     }
-
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.release();
-    #endif
 }
 
 
@@ -3350,9 +3637,6 @@ void Chuck_Event::signal_global()
 //-----------------------------------------------------------------------------
 void Chuck_Event::broadcast_global()
 {
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.acquire();
-    #endif
     std::queue< Chuck_Global_Event_Listener > call_again;
 
     while( !m_global_queue.empty() )
@@ -3392,10 +3676,6 @@ void Chuck_Event::broadcast_global()
 
     // for those that should be called again, store them again
     m_global_queue = call_again;
-
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.release();
-    #endif
 }
 
 
@@ -3406,30 +3686,15 @@ void Chuck_Event::broadcast_global()
 // desc: queue the event to broadcast a event/condition variable,
 //       by the owner of the queue
 //       added 1.3.0.0: event_buffer to fix big-ass bug
+//       1.5.1.7: wait-free from any thread; event_buffer is not needed
 //-----------------------------------------------------------------------------
 void Chuck_Event::queue_broadcast( CBufferSimple * event_buffer )
 {
-    // TODO: handle multiple VM
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.acquire();
-    #endif
-    if( !m_queue.empty() )
-    {
-        // get shred (only to get the VM ref)
-        Chuck_VM_Shred * shred = m_queue.front();
-        // release lock
-        #ifndef __DISABLE_THREADS__
-        m_queue_lock.release();
-        #endif
-        // queue the event on the vm (added 1.3.0.0: event_buffer)
-        shred->vm_ref->queue_event( this, 1, event_buffer );
-    }
-    else
-    {
-        #ifndef __DISABLE_THREADS__
-        m_queue_lock.release();
-        #endif
-    }
+    // no one to wake (a shred that starts waiting after this check would
+    // have missed the broadcast either way)
+    if( !num_waiting() || !originVM() ) return;
+    // queue the event on the vm (added 1.3.0.0: event_buffer)
+    originVM()->queue_event( this, 1, event_buffer );
 }
 
 
@@ -3442,28 +3707,12 @@ void Chuck_Event::queue_broadcast( CBufferSimple * event_buffer )
 //-----------------------------------------------------------------------------
 void Chuck_Event::broadcast_local()
 {
-    // lock queue
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.acquire();
-    #endif
-    // while not empty
-    while( !m_queue.empty() )
-    {
-        // release first
-        #ifndef __DISABLE_THREADS__
-        m_queue_lock.release();
-        #endif
-        // signal the next shred
-        this->signal_local();
-        // lock again
-        #ifndef __DISABLE_THREADS__
-        m_queue_lock.acquire();
-        #endif
-    }
-    // release
-    #ifndef __DISABLE_THREADS__
-    m_queue_lock.release();
-    #endif
+    // hold on, in case the last shred's reference is the last one
+    this->add_ref();
+    // signal each shred, in order
+    while( m_wait_head ) this->signal_local();
+    // let go
+    this->release();
 }
 
 
@@ -3488,18 +3737,17 @@ void Chuck_Event::wait( Chuck_VM_Shred * shred, Chuck_VM * vm )
         // suspend
         shred->is_running = FALSE;
 
-        // add to waiting list
-        #ifndef __DISABLE_THREADS__
-        m_queue_lock.acquire();
-        #endif
-        m_queue.push( shred );
-        #ifndef __DISABLE_THREADS__
-        m_queue_lock.release();
-        #endif
-
         // add event to shred
         assert( shred->event == NULL );
         shred->event = this;
+
+        // add to the end of the waiting list | 1.5.1.7
+        shred->event_prev = m_wait_tail;
+        shred->event_next = NULL;
+        if( m_wait_tail ) m_wait_tail->event_next = shred;
+        else m_wait_head = shred;
+        m_wait_tail = shred;
+        m_num_waiting.fetch_add( 1, std::memory_order_relaxed );
         // the shred might need the event pointer after it's been released by the
         // vm instruction Chuck_Instr_Release_Object2, in order to tell the event
         // to forget the shred. So, add another reference so it won't be freed
@@ -3522,3 +3770,61 @@ void Chuck_Event::wait( Chuck_VM_Shred * shred, Chuck_VM * vm )
         push_( sp, shred->now );
     }
 }
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: modify()
+// desc: set, from a method changing this string in place (copy-on-write for
+//       literals) | 1.5.1.7
+//-----------------------------------------------------------------------------
+void Chuck_String::modify( const std::string & s )
+{
+    Chuck_String ** slot = m_literal;
+
+    // not a literal
+    if( !slot ) { set( s ); return; }
+
+    // the code's own copy, to push from now on
+    Chuck_String * copy = new Chuck_String( m_str );
+    initialize_object( copy, type_ref, NULL, origin_vm );
+    copy->add_ref();
+    copy->m_literal = slot;
+    *slot = copy;
+
+    // this one is no longer a literal
+    m_literal = NULL;
+    set( s );
+    // the code's reference (last: this may be deleted)
+    release();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: release_literal()
+// desc: let go of the literal in 'slot', and the slot | 1.5.1.7
+//-----------------------------------------------------------------------------
+void Chuck_String::release_literal( Chuck_String ** slot )
+{
+    // no longer a literal, to whoever else holds it
+    (*slot)->m_literal = NULL;
+    (*slot)->release();
+    delete slot;
+}
+
+
+
+
+#ifdef __CHUCK_DEBUG__
+//-----------------------------------------------------------------------------
+// name: debug_storage()
+// desc: report string storage (re)allocation to the VM debugger | 1.5.1.7
+//-----------------------------------------------------------------------------
+void Chuck_String::debug_storage()
+{
+    CK_VM_DEBUGGER( string_storage( this ) );
+}
+#endif
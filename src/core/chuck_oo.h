@@ -44,6 +44,8 @@
 #include <vector>
 #include <map>
 #include <queue>
+#include <atomic>
+#include "chuck_map.h"
 
 
 
@@ -59,6 +61,10 @@ struct Chuck_VM_Code;
 struct Chuck_VM_Shred;
 struct Chuck_VM;
 struct Chuck_IO_File;
+struct Chuck_VM_Reclaimer;
+struct Chuck_VM_Pool;
+struct Chuck_VM_Cycle_Collector;
+struct Chuck_Event;
 class  CBufferSimple;
 
 
@@ -79,6 +85,10 @@ public:
     virtual void add_ref();
     // decrement reference; deletes objects when refcount reaches 0
     virtual void release();
+    // decrement reference, but don't delete at 0: hands the reference to
+    // whoever adds the next one, e.g., the VM, which adds a reference to
+    // objects returned from native functions | 1.5.1.7
+    void release_to_caller();
     // lock
     virtual void lock();
     // unlock | 1.5.0.0 (ge) added
@@ -87,6 +97,12 @@ public:
     // NOTE: be careful when overriding these, should always
     // explicitly call up to ChucK_VM_Object (ge: 2013)
 
+    // whether deletion may be deferred to the reclaimer of the object's
+    // origin VM (see Chuck_VM::reclaimer()); FALSE for objects whose
+    // destructors the compiler/VM count on running right away; only
+    // Chuck_Objects (which know their VM) may return TRUE | 1.5.1.7
+    virtual t_CKBOOL reclaimable() const { return FALSE; }
+
 public:
     // get reference count
     t_CKUINT refcount() const;
@@ -137,16 +153,31 @@ public:
     virtual void help();
     // output current state (can be overridden)
     virtual void dump();
+    // runtime objects may be deleted later | 1.5.1.7
+    virtual t_CKBOOL reclaimable() const { return TRUE; }
+    // decrement reference; may note this as a possible cycle member with
+    // the origin VM's cycle collector (see Chuck_VM::collector()) | 1.5.1.7
+    virtual void release();
+
+public:
+    // allocate from the heap, or from a VM's pool (see chuck_pool.h),
+    // e.g., `new(vm->pool()) Chuck_String`; delete works for both | 1.5.1.7
+    static void * operator new( size_t size );
+    static void * operator new( size_t size, Chuck_VM_Pool * pool );
+    static void operator delete( void * ptr );
+    static void operator delete( void * ptr, Chuck_VM_Pool * pool );
 
 public:
     // virtual table
     Chuck_VTable * vtable;
     // reference to type
     Chuck_Type * type_ref;
-    // data for the object
+    // data for the object (allocated through Chuck_VM_Pool)
     t_CKBYTE * data;
     // the size of the data region
     t_CKUINT data_size;
+    // waiting to be checked by the cycle collector | 1.5.1.7
+    t_CKBOOL m_cycle_candidate;
 
 public:
     // set VM on which this object was instantiated | 1.5.1.5
@@ -240,9 +271,32 @@ public: // interface common to all Chuck_Arary*
     // typed as Object array? | 1.5.0.8 (ge) moved to common
     virtual t_CKBOOL contains_objects() { return FALSE; }
 
+public: // capacity control | 1.5.1.7
+    // make room for n elements without changing size; returns capacity
+    virtual t_CKINT reserve( t_CKINT n ) = 0;
+    // whether storage of 'capacity' elements may hold n (growing if needed)
+    t_CKBOOL can_grow( t_CKUINT n, t_CKUINT capacity )
+    { return n <= capacity || grow_check( n, capacity ); }
+
+public:
+    // if true, storage is never reallocated: operations that would grow
+    // the array past its capacity fail instead | 1.5.1.7
+    t_CKBOOL m_fixed;
+
+protected:
+    // out-of-line part of can_grow()
+    t_CKBOOL grow_check( t_CKUINT n, t_CKUINT capacity );
+
+public: // bulk float operations | 1.5.1.7
+    // contiguous float storage of the elements, or NULL if not float-based
+    virtual t_CKFLOAT * floats() { return NULL; }
+    // number of floats per element (0 if not float-based)
+    virtual t_CKINT float_width() { return 0; }
+
 public: // map-only operations
     // get all keys in map | added (1.4.2.0) nshaheed
-    virtual void get_keys( std::vector<std::string> & keys ) = 0;
+    // in no particular order, unless sorted | 1.5.1.7
+    virtual void get_keys( std::vector<std::string> & keys, t_CKBOOL sorted = FALSE ) = 0;
     // (map only) test is key is in map | 1.5.0.8 (ge) was find()
     virtual t_CKINT map_find( const std::string & key ) = 0;
     // (map only) erase entry by key | 1.5.0.8 (ge) was erase()
@@ -268,12 +322,13 @@ public:
     virtual ~Chuck_ArrayInt();
 
 public: // specific to this class
-    // get address
+    // get address; (map) `hash` is ck_map_hash(key) if known, e.g., from
+    // Chuck_String::hash(), or 0 to compute it | 1.5.1.7
     t_CKUINT addr( t_CKINT i );
-    t_CKUINT addr( const std::string & key );
+    t_CKUINT addr( const std::string & key, t_CKUINT hash = 0 );
     // get value
     t_CKINT get( t_CKINT i, t_CKUINT * val );
-    t_CKINT get( const std::string & key, t_CKUINT * val );
+    t_CKINT get( const std::string & key, t_CKUINT * val, t_CKUINT hash = 0 );
     // set value
     t_CKINT set( t_CKINT i, t_CKUINT val );
     t_CKINT set( const std::string & key, t_CKUINT val );
@@ -300,6 +355,8 @@ public: // array interface implementation
     virtual t_CKINT set_size( t_CKINT size );
     // set array capacity
     virtual t_CKINT set_capacity( t_CKINT capacity );
+    // make room for n elements without changing size | 1.5.1.7
+    virtual t_CKINT reserve( t_CKINT n );
     // size of stored type (from type_ref)
     virtual t_CKINT data_type_size() { return CHUCK_ARRAYINT_DATASIZE; }
     // kind of stored type (from kindof)
@@ -332,7 +389,7 @@ public: // array interface implementation
 
 public: // map only
     // get all keys in map
-    virtual void get_keys( std::vector<std::string> & keys );
+    virtual void get_keys( std::vector<std::string> & keys, t_CKBOOL sorted = FALSE );
     // (map only) test is key is in map
     virtual t_CKINT map_find( const std::string & key );
     // (map only) erase entry by key
@@ -340,7 +397,7 @@ public: // map only
 
 public:
     std::vector<t_CKUINT> m_vector;
-    std::map<std::string, t_CKUINT> m_map;
+    Chuck_Map<t_CKUINT> m_map;
     t_CKBOOL m_is_obj;
 
     // TODO: may need additional information here for set_size, if this is part of a multi-dim array
@@ -366,10 +423,10 @@ public:
 public: // specific to this class
     // get address
     t_CKUINT addr( t_CKINT i );
-    t_CKUINT addr( const std::string & key );
+    t_CKUINT addr( const std::string & key, t_CKUINT hash = 0 );
     // get value
     t_CKINT get( t_CKINT i, t_CKFLOAT * val );
-    t_CKINT get( const std::string & key, t_CKFLOAT * val );
+    t_CKINT get( const std::string & key, t_CKFLOAT * val, t_CKUINT hash = 0 );
     // set value
     t_CKINT set( t_CKINT i, t_CKFLOAT val );
     t_CKINT set( const std::string & key, t_CKFLOAT val );
@@ -396,10 +453,16 @@ public: // array interface implementation
     virtual t_CKINT set_size( t_CKINT size );
     // set array capacity
     virtual t_CKINT set_capacity( t_CKINT capacity );
+    // make room for n elements without changing size | 1.5.1.7
+    virtual t_CKINT reserve( t_CKINT n );
     // size of stored type (from type_ref)
     virtual t_CKINT data_type_size() { return CHUCK_ARRAYFLOAT_DATASIZE; }
     // kind of stored type (from kindof)
     virtual t_CKINT data_type_kind() { return CHUCK_ARRAYFLOAT_DATAKIND; }
+    // contiguous float storage | 1.5.1.7
+    virtual t_CKFLOAT * floats() { return m_vector.data(); }
+    // floats per element | 1.5.1.7
+    virtual t_CKINT float_width() { return 1; }
     // clear
     virtual void clear();
     // zero out the array by range [start,end)
@@ -425,7 +488,7 @@ public: // array interface implementation
 
 public: // map only
     // get all keys in map
-    virtual void get_keys( std::vector<std::string> & keys );
+    virtual void get_keys( std::vector<std::string> & keys, t_CKBOOL sorted = FALSE );
     // (map only) test is key is in map
     virtual t_CKINT map_find( const std::string & key );
     // (map only) erase entry by key
@@ -433,7 +496,7 @@ public: // map only
 
 public:
     std::vector<t_CKFLOAT> m_vector;
-    std::map<std::string, t_CKFLOAT> m_map;
+    Chuck_Map<t_CKFLOAT> m_map;
     // t_CKINT m_size;
     // t_CKINT m_capacity;
 };
@@ -454,12 +517,12 @@ public:
 public: // specific to this class
     // get address
     t_CKUINT addr( t_CKINT i );
-    t_CKUINT addr( const std::string & key );
+    t_CKUINT addr( const std::string & key, t_CKUINT hash = 0 );
     // get value
     t_CKINT get( t_CKINT i, t_CKVEC2 * val );
     t_CKINT get( t_CKINT i, t_CKCOMPLEX * val );
-    t_CKINT get( const std::string & key, t_CKVEC2 * val );
-    t_CKINT get( const std::string & key, t_CKCOMPLEX * val );
+    t_CKINT get( const std::string & key, t_CKVEC2 * val, t_CKUINT hash = 0 );
+    t_CKINT get( const std::string & key, t_CKCOMPLEX * val, t_CKUINT hash = 0 );
     // set value
     t_CKINT set( t_CKINT i, const t_CKVEC2 & val );
     t_CKINT set( t_CKINT i, const t_CKCOMPLEX & val );
@@ -488,10 +551,16 @@ public: // array interface implementation
     virtual t_CKINT set_size( t_CKINT size );
     // set array capacity
     virtual t_CKINT set_capacity( t_CKINT capacity );
+    // make room for n elements without changing size | 1.5.1.7
+    virtual t_CKINT reserve( t_CKINT n );
     // size of stored type (from type_ref)
     virtual t_CKINT data_type_size() { return CHUCK_ARRAY16_DATASIZE; }
     // kind of stored type (from kindof)
     virtual t_CKINT data_type_kind() { return CHUCK_ARRAY16_DATAKIND; }
+    // contiguous float storage | 1.5.1.7
+    virtual t_CKFLOAT * floats() { return (t_CKFLOAT *)m_vector.data(); }
+    // floats per element | 1.5.1.7
+    virtual t_CKINT float_width() { return 2; }
     // clear
     virtual void clear();
     // zero out the array by range [start,end)
@@ -517,7 +586,7 @@ public: // array interface implementation
 
 public: // map only
     // get all keys in map
-    virtual void get_keys( std::vector<std::string> & keys );
+    virtual void get_keys( std::vector<std::string> & keys, t_CKBOOL sorted = FALSE );
     // (map only) test is key is in map
     virtual t_CKINT map_find( const std::string & key );
     // (map only) erase entry by key
@@ -525,10 +594,12 @@ public: // map only
 
 public:
     std::vector<t_CKVEC2> m_vector;
-    std::map<std::string, t_CKVEC2> m_map;
+    Chuck_Map<t_CKVEC2> m_map;
     // semantic hint; in certain situations (like sorting)
     // need to distinguish between complex and polar | 1.5.1.0
     t_CKBOOL m_isPolarType;
+    // and complex from vec2 (bulk operations) | 1.5.1.7
+    t_CKBOOL m_isComplexType;
 };
 
 
@@ -547,10 +618,10 @@ public:
 public: // specific to this class
     // get address
     t_CKUINT addr( t_CKINT i );
-    t_CKUINT addr( const std::string & key );
+    t_CKUINT addr( const std::string & key, t_CKUINT hash = 0 );
     // get value
     t_CKINT get( t_CKINT i, t_CKVEC3 * val );
-    t_CKINT get( const std::string & key, t_CKVEC3 * val );
+    t_CKINT get( const std::string & key, t_CKVEC3 * val, t_CKUINT hash = 0 );
     // set value
     t_CKINT set( t_CKINT i, const t_CKVEC3 & val );
     t_CKINT set( const std::string & key, const t_CKVEC3 & val );
@@ -577,10 +648,16 @@ public: // array interface implementation
     virtual t_CKINT set_size( t_CKINT size );
     // set array capacity
     virtual t_CKINT set_capacity( t_CKINT capacity );
+    // make room for n elements without changing size | 1.5.1.7
+    virtual t_CKINT reserve( t_CKINT n );
     // size of stored type (from type_ref)
     virtual t_CKINT data_type_size() { return CHUCK_ARRAY24_DATASIZE; }
     // kind of stored type (from kindof)
     virtual t_CKINT data_type_kind() { return CHUCK_ARRAY24_DATAKIND; }
+    // contiguous float storage | 1.5.1.7
+    virtual t_CKFLOAT * floats() { return (t_CKFLOAT *)m_vector.data(); }
+    // floats per element | 1.5.1.7
+    virtual t_CKINT float_width() { return 3; }
     // clear
     virtual void clear();
     // zero out the array by range [start,end)
@@ -606,7 +683,7 @@ public: // array interface implementation
 
 public: // map only
     // get all keys in map
-    virtual void get_keys( std::vector<std::string> & keys );
+    virtual void get_keys( std::vector<std::string> & keys, t_CKBOOL sorted = FALSE );
     // (map only) test is key is in map
     virtual t_CKINT map_find( const std::string & key );
     // (map only) erase entry by key
@@ -614,7 +691,7 @@ public: // map only
 
 public:
     std::vector<t_CKVEC3> m_vector;
-    std::map<std::string, t_CKVEC3> m_map;
+    Chuck_Map<t_CKVEC3> m_map;
 };
 
 
@@ -633,10 +710,10 @@ public:
 public: // specific to this class
     // get address
     t_CKUINT addr( t_CKINT i );
-    t_CKUINT addr( const std::string & key );
+    t_CKUINT addr( const std::string & key, t_CKUINT hash = 0 );
     // get value
     t_CKINT get( t_CKINT i, t_CKVEC4 * val );
-    t_CKINT get( const std::string & key, t_CKVEC4 * val );
+    t_CKINT get( const std::string & key, t_CKVEC4 * val, t_CKUINT hash = 0 );
     // set value
     t_CKINT set( t_CKINT i, const t_CKVEC4 & val );
     t_CKINT set( const std::string & key, const t_CKVEC4 & val );
@@ -663,10 +740,16 @@ public: // array interface implementation
     virtual t_CKINT set_size( t_CKINT size );
     // set array capacity
     virtual t_CKINT set_capacity( t_CKINT capacity );
+    // make room for n elements without changing size | 1.5.1.7
+    virtual t_CKINT reserve( t_CKINT n );
     // size of stored type (from type_ref)
     virtual t_CKINT data_type_size() { return CHUCK_ARRAY32_DATASIZE; }
     // kind of stored type (from kindof)
     virtual t_CKINT data_type_kind() { return CHUCK_ARRAY32_DATAKIND; }
+    // contiguous float storage | 1.5.1.7
+    virtual t_CKFLOAT * floats() { return (t_CKFLOAT *)m_vector.data(); }
+    // floats per element | 1.5.1.7
+    virtual t_CKINT float_width() { return 4; }
     // clear
     virtual void clear();
     // zero out the array by range [start,end)
@@ -692,7 +775,7 @@ public: // array interface implementation
 
 public: // map only
     // get all keys in map
-    virtual void get_keys( std::vector<std::string> & keys );
+    virtual void get_keys( std::vector<std::string> & keys, t_CKBOOL sorted = FALSE );
     // (map only) test is key is in map
     virtual t_CKINT map_find( const std::string & key );
     // (map only) erase entry by key
@@ -700,7 +783,7 @@ public: // map only
 
 public:
     std::vector<t_CKVEC4> m_vector;
-    std::map<std::string, t_CKVEC4> m_map;
+    Chuck_Map<t_CKVEC4> m_map;
 };
 
 
@@ -742,12 +825,41 @@ struct Chuck_Global_Event_Listener
 
 
 
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Event_Link
+// desc: an event's place in its VM's queue of broadcast requests from other
+//       threads (see Chuck_VM::queue_event()); made with the event, and left
+//       for the VM to delete if the event goes away with a request pending
+//       1.5.1.7 added
+//-----------------------------------------------------------------------------
+struct Chuck_Event_Link
+{
+    // next in the queue
+    std::atomic<Chuck_Event_Link *> next;
+    // the event; NULL once it is deleted
+    std::atomic<Chuck_Event *> event;
+    // broadcasts requested since the VM last took this off the queue
+    std::atomic<t_CKUINT> pending;
+
+    // constructor
+    Chuck_Event_Link( Chuck_Event * e = NULL ) : next( NULL ), event( e ), pending( 0 ) { }
+};
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: Chuck_Event
 // desc: base Chuck Event class
 //-----------------------------------------------------------------------------
 struct Chuck_Event : public Chuck_Object
 {
+public:
+    // constructor | 1.5.1.7
+    Chuck_Event();
+    // destructor | 1.5.1.7
+    virtual ~Chuck_Event();
+
 public:
     // signal/broadcast "local" -- signal ChucK Events
     void signal_local();
@@ -771,8 +883,15 @@ public:
     t_CKBOOL remove_listen( t_CKINT id, void (* cb)(t_CKINT) );
 
 public: // internal
+    // broadcast from any thread: queues the request, without waiting, for
+    // the VM to carry out at its next chance; event_buffer is no longer
+    // needed, and kept for compatibility | 1.5.1.7 (was: locked)
     // added 1.3.0.0: queue_broadcast now takes event_buffer
     void queue_broadcast( CBufferSimple * event_buffer = NULL );
+    // number of shreds waiting; may be read from any thread | 1.5.1.7
+    t_CKUINT num_waiting() const { return m_num_waiting.load( std::memory_order_relaxed ); }
+    // place in the VM's broadcast request queue | 1.5.1.7
+    Chuck_Event_Link * link() const { return m_link; }
 
 public:
     // virtual table offset for can_wait()
@@ -781,14 +900,16 @@ public:
     static t_CKUINT our_waiting_on;
 
 protected:
-    std::queue<Chuck_VM_Shred *> m_queue;
+    // shreds waiting, in order, linked through Chuck_VM_Shred::event_prev
+    // and event_next; only the VM thread touches these | 1.5.1.7
+    // (was: std::queue guarded by a mutex)
+    Chuck_VM_Shred * m_wait_head;
+    Chuck_VM_Shred * m_wait_tail;
+    std::atomic<t_CKUINT> m_num_waiting;
+    // global listeners (VM thread only)
     std::queue<Chuck_Global_Event_Listener> m_global_queue;
-
-    #ifndef __DISABLE_THREADS__
-    // 1.4.1.0 (ge/jack) TODO: rewrite queue_broadcast to use a lock-free queue
-    // and avoid the use of a lock in events
-    XMutex m_queue_lock;
-    #endif
+    // place in the VM's broadcast request queue | 1.5.1.7
+    Chuck_Event_Link * m_link;
 };
 
 
@@ -802,22 +923,65 @@ struct Chuck_String : public Chuck_Object
 {
 public:
     // constructor
-    Chuck_String( const std::string & s = "" ) { set( s ); }
+    Chuck_String( const std::string & s = "" ) : m_literal( NULL ) { set( s ); }
     // destructor | 1.5.0.1 (ge) made destructor virtual
     virtual ~Chuck_String() { }
 
-    // set string (makes copy)
-    void set( const std::string & s ) { m_str = s; m_charptr = m_str.c_str(); }
+    // set string (makes copy; reuses storage if large enough)
+    void set( const std::string & s ) { size_t c = m_str.capacity(); m_str = s; changed( c ); }
+    // set string from characters | 1.5.1.7
+    void set( const char * s, size_t len ) { size_t c = m_str.capacity(); m_str.assign( s, len ); changed( c ); }
+    // append in place, without a temporary string | 1.5.1.7
+    void append( const std::string & s ) { size_t c = m_str.capacity(); m_str.append( s ); changed( c ); }
+    // append characters in place | 1.5.1.7
+    void append( const char * s, size_t len ) { size_t c = m_str.capacity(); m_str.append( s, len ); changed( c ); }
+    // set to a + b, allocating storage (if any) once | 1.5.1.7
+    void concat( const char * a, size_t alen, const char * b, size_t blen )
+    { size_t c = m_str.capacity(); m_str.reserve( alen + blen ); m_str.assign( a, alen ); m_str.append( b, blen ); changed( c ); }
+    // reserve storage for n characters | 1.5.1.7
+    void reserve( size_t n ) { size_t c = m_str.capacity(); m_str.reserve( n ); changed( c ); }
     // get as standard c++ string
     const std::string & str() { return m_str; }
     // get as C string (NOTE: use this in dynamical modules like chugins!)
     const char * c_str() { return m_charptr; }
+    // get hash, as an associative array key; computed once | 1.5.1.7
+    t_CKUINT hash() { if( !m_hash ) m_hash = ck_map_hash( m_str ); return m_hash; }
+    // set, from a method changing this string in place; a literal is first
+    // swapped, in its code, for a copy of itself (copy-on-write), and this
+    // one is left to whoever holds it -- deleted, if no one | 1.5.1.7
+    void modify( const std::string & s );
+    // let go of the literal in 'slot', and the slot, when the code that
+    // pushes it goes away | 1.5.1.7
+    static void release_literal( Chuck_String ** slot );
 
 private:
+    // after m_str changes; 'capacity' is what it was before
+    void changed( size_t capacity )
+    {
+        m_charptr = m_str.c_str(); m_hash = 0;
+#ifdef __CHUCK_DEBUG__
+        // report storage (re)allocation to the VM debugger
+        if( m_str.capacity() > capacity ) debug_storage();
+#endif
+    }
+#ifdef __CHUCK_DEBUG__
+    // report storage (re)allocation (see Chuck_VM_Debug::string_storage)
+    void debug_storage();
+#endif
+
+private:
+    // hash of m_str; 0 if not computed yet | 1.5.1.7
+    t_CKUINT m_hash;
     // c pointer | HACK: needed for ensure string passing in dynamic modules
     const char * m_charptr; // REFACTOR-2017
     // c++ string
     std::string m_str;
+
+public:
+    // if a string literal: the slot its code pushes it from (one string per
+    // distinct literal in a piece of code); NULL otherwise; a variable
+    // holding one is given a copy before it is assigned to | 1.5.1.7
+    Chuck_String ** m_literal;
 };
 
 
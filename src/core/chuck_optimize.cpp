@@ -0,0 +1,1282 @@
+/*----------------------------------------------------------------------------
+  ChucK Concurrent, On-the-fly Audio Programming Language
+    Compiler and Virtual Machine
+
+  Copyright (c) 2004 Ge Wang and Perry R. Cook.  All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+  U.S.A.
+-----------------------------------------------------------------------------*/
+
+//-----------------------------------------------------------------------------
+// file: chuck_optimize.cpp
+// desc: chuck AST optimizer; runs over the type-checked abstract syntax
+//       tree, between type-checking (pass 3) and emission (pass 4)
+//
+//       every transformation here must produce exactly what the emitted
+//       code would have computed at runtime (same instructions, same
+//       rounding); anything that could trap at runtime (e.g., integer
+//       division by zero) is left alone
+//-----------------------------------------------------------------------------
+#include "chuck_optimize.h"
+#include "chuck_errmsg.h"
+#include "chuck_symbol.h"
+#include "chuck_vm.h"
+
+#include <math.h>
+#include <limits.h>
+#include <vector>
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Opt_Const
+// desc: a compile-time constant, in the VM's representation
+//-----------------------------------------------------------------------------
+struct Chuck_Opt_Const
+{
+    // te_int or te_float (dur and time are float-kind)
+    te_Type kind;
+    // value, if int
+    t_CKINT i;
+    // value, if float
+    t_CKFLOAT f;
+
+    // constructor
+    Chuck_Opt_Const() : kind(te_int), i(0), f(0) { }
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Optimizer
+// desc: optimizer state for one program
+//-----------------------------------------------------------------------------
+struct Chuck_Optimizer
+{
+    // the type environment
+    Chuck_Env * env;
+    // optimization level
+    t_CKUINT level;
+    // what we did
+    Chuck_Optimizer_Stats stats;
+
+    // constructor
+    Chuck_Optimizer( Chuck_Env * e, t_CKUINT l ) : env(e), level(l) { }
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// internal
+//-----------------------------------------------------------------------------
+static void opt_class_def( Chuck_Optimizer * opt, a_Class_Def class_def );
+static void opt_func_def( Chuck_Optimizer * opt, a_Func_Def func_def );
+static void opt_stmt_list( Chuck_Optimizer * opt, a_Stmt_List list );
+static void opt_stmt( Chuck_Optimizer * opt, a_Stmt stmt );
+static void opt_exp( Chuck_Optimizer * opt, a_Exp exp );
+static void opt_exp_one( Chuck_Optimizer * opt, a_Exp exp );
+static void opt_array_sub( Chuck_Optimizer * opt, a_Array_Sub sub );
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: optimize_engine_optimize_prog()
+// desc: optimize a type-checked program in place
+//-----------------------------------------------------------------------------
+t_CKBOOL optimize_engine_optimize_prog( Chuck_Env * env, a_Program prog,
+                                        t_CKUINT level, te_HowMuch how_much,
+                                        Chuck_Optimizer_Stats * stats )
+{
+    // nothing to do
+    if( level == CK_OPTIMIZE_NONE ) return TRUE;
+
+    // log
+    EM_log( CK_LOG_FINER, "(pass 3.5) optimizing abstract syntax tree (level %lu)...", level );
+    // push indent
+    EM_pushlog();
+
+    // the optimizer
+    Chuck_Optimizer opt( env, level );
+
+    // loop over the program sections
+    while( prog )
+    {
+        switch( prog->section->s_type )
+        {
+        case ae_section_stmt: // code section
+            if( how_much != te_do_classes_only )
+                opt_stmt_list( &opt, prog->section->stmt_list );
+            break;
+
+        case ae_section_func: // function definition
+            if( how_much != te_do_classes_only )
+                opt_func_def( &opt, prog->section->func_def );
+            break;
+
+        case ae_section_class: // class definition
+            if( how_much != te_do_no_classes )
+                opt_class_def( &opt, prog->section->class_def );
+            break;
+        }
+
+        // the next
+        prog = prog->next;
+    }
+
+    // log
+    EM_log( CK_LOG_FINER, "folded: %lu | members: %lu | branches: %lu | reduced: %lu | unchecked: %lu",
+            opt.stats.folded, opt.stats.members, opt.stats.branches, opt.stats.reduced, opt.stats.unchecked );
+    // pop indent
+    EM_poplog();
+
+    // copy out
+    if( stats ) *stats = opt.stats;
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_class_def()
+// desc: optimize class body (pre-constructor code and member functions)
+//-----------------------------------------------------------------------------
+static void opt_class_def( Chuck_Optimizer * opt, a_Class_Def class_def )
+{
+    a_Class_Body body = class_def->body;
+    while( body )
+    {
+        switch( body->section->s_type )
+        {
+        case ae_section_stmt:
+            opt_stmt_list( opt, body->section->stmt_list );
+            break;
+        case ae_section_func:
+            opt_func_def( opt, body->section->func_def );
+            break;
+        case ae_section_class:
+            opt_class_def( opt, body->section->class_def );
+            break;
+        }
+        body = body->next;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_func_def()
+// desc: optimize function body
+//-----------------------------------------------------------------------------
+static void opt_func_def( Chuck_Optimizer * opt, a_Func_Def func_def )
+{
+    // builtin functions have no body
+    if( func_def->s_type != ae_func_user ) return;
+    // the body
+    opt_stmt( opt, func_def->code );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_stmt_list()
+// desc: ...
+//-----------------------------------------------------------------------------
+static void opt_stmt_list( Chuck_Optimizer * opt, a_Stmt_List list )
+{
+    while( list )
+    {
+        opt_stmt( opt, list->stmt );
+        list = list->next;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_get_const()
+// desc: get the value of a constant expression, as the enclosing
+//       expression will see it (i.e., after any implicit cast)
+//-----------------------------------------------------------------------------
+static t_CKBOOL opt_get_const( Chuck_Optimizer * opt, a_Exp e, Chuck_Opt_Const & c )
+{
+    // only literals (folding leaves its results as literals)
+    if( !e || e->s_type != ae_exp_primary || e->emit_var ) return FALSE;
+    if( e->primary.s_type == ae_primary_num ) { c.kind = te_int; c.i = e->primary.num; }
+    else if( e->primary.s_type == ae_primary_float ) { c.kind = te_float; c.f = e->primary.fnum; }
+    else return FALSE;
+
+    // implicit cast
+    if( e->cast_to && !equals( e->cast_to, e->type ) )
+    {
+        // only int to float (Cast_int2double)
+        if( c.kind != te_int || !equals( e->cast_to, opt->env->ckt_float ) ) return FALSE;
+        c.kind = te_float; c.f = (t_CKFLOAT)c.i;
+    }
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_kind()
+// desc: int, float, dur, time are foldable; dur and time are float-kind
+//-----------------------------------------------------------------------------
+static t_CKBOOL opt_kind( Chuck_Type * type, te_Type & kind )
+{
+    if( !type ) return FALSE;
+    switch( type->xid )
+    {
+    case te_int: kind = te_int; return TRUE;
+    case te_float: case te_dur: case te_time: kind = te_float; return TRUE;
+    default: return FALSE;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_set_const()
+// desc: turn an expression (in place) into a literal of its own type
+//-----------------------------------------------------------------------------
+static t_CKBOOL opt_set_const( Chuck_Optimizer * opt, a_Exp e, const Chuck_Opt_Const & c )
+{
+    te_Type kind;
+    // must be representable in the expression's own type
+    if( !opt_kind( e->type, kind ) || kind != c.kind ) return FALSE;
+
+    // free what it used to be
+    delete_exp_contents( e );
+
+    // the literal; type, cast_to, and next are untouched
+    e->s_type = ae_exp_primary;
+    e->s_meta = ae_meta_value;
+    e->primary.value = NULL;
+    if( kind == te_int ) { e->primary.s_type = ae_primary_num; e->primary.num = c.i; }
+    else { e->primary.s_type = ae_primary_float; e->primary.fnum = c.f; }
+    e->primary.line = e->line; e->primary.where = e->where;
+    e->primary.self = e;
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_is_pow2()
+// desc: is x a (signed) power of two whose reciprocal is exact?
+//-----------------------------------------------------------------------------
+static t_CKBOOL opt_is_pow2( t_CKFLOAT x )
+{
+    int e = 0;
+    if( x == 0 || x != x || x - x != 0 ) return FALSE;
+    if( ::fabs( ::frexp( x, &e ) ) != 0.5 ) return FALSE;
+    // reciprocal must be exact, too
+    t_CKFLOAT r = 1.0 / x;
+    return r - r == 0 && r * x == 1.0 && ::fabs( ::frexp( r, &e ) ) == 0.5;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_fold_primary()
+// desc: builtin constants (true, false, pi, samp...eon)
+//       NOTE: mirrors the emitter, which already pushes these as immediates
+//-----------------------------------------------------------------------------
+static void opt_fold_primary( Chuck_Optimizer * opt, a_Exp e )
+{
+    Chuck_Opt_Const c;
+    a_Exp_Primary p = &e->primary;
+
+    // recurse
+    switch( p->s_type )
+    {
+    case ae_primary_array: opt_array_sub( opt, p->array ); return;
+    case ae_primary_exp: case ae_primary_hack: opt_exp( opt, p->exp ); return;
+    case ae_primary_complex: opt_exp( opt, p->complex->re ); return;
+    case ae_primary_polar: opt_exp( opt, p->polar->mod ); return;
+    case ae_primary_vec: opt_exp( opt, p->vec->args ); return;
+    case ae_primary_var: break;
+    default: return;
+    }
+
+    // not as an lvalue
+    if( e->emit_var ) return;
+
+    // the name
+    S_Symbol var = p->var;
+    if( var == insert_symbol( "true" ) ) { c.kind = te_int; c.i = 1; }
+    else if( var == insert_symbol( "false" ) ) { c.kind = te_int; c.i = 0; }
+    else if( var == insert_symbol( "pi" ) ) { c.kind = te_float; c.f = CK_ONE_PI; }
+    else if( e->type && e->type->xid == te_dur )
+    {
+        // same lookup as Chuck_Emitter::find_dur()
+        Chuck_Value * value = opt->env->global()->lookup_value( S_name(var), FALSE );
+        if( !value || !value->is_const || !value->addr || !equals( value->type, opt->env->ckt_dur ) ) return;
+        c.kind = te_float; c.f = *(t_CKDUR *)value->addr;
+    }
+    else return;
+
+    if( opt_set_const( opt, e, c ) ) opt->stats.members++;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_fold_dot_member()
+// desc: read-only static data of builtin classes (e.g., Math.PI, Math.INT_MAX)
+//       this also takes such lookups out of loops altogether
+//-----------------------------------------------------------------------------
+static void opt_fold_dot_member( Chuck_Optimizer * opt, a_Exp e )
+{
+    a_Exp_Dot_Member member = &e->dot_member;
+    // the base (e.g., a call that returns an object)
+    opt_exp( opt, member->base );
+
+    // lvalue? function?
+    if( e->emit_var || !member->t_base || isfunc( opt->env, e->type ) ) return;
+    // result must be a foldable primitive
+    te_Type kind;
+    if( !opt_kind( e->type, kind ) ) return;
+    // special primitives (e.g., complex.re) are not objects
+    switch( member->t_base->xid )
+    {
+    case te_complex: case te_polar: case te_vec2: case te_vec3: case te_vec4: return;
+    default: break;
+    }
+
+    // actual type - if base is class name its type is 'class'
+    t_CKBOOL base_static = type_engine_is_base_static( opt->env, member->t_base );
+    Chuck_Type * t_base = base_static ? member->t_base->actual_type : member->t_base;
+    if( !t_base || !t_base->info ) return;
+
+    // find the value; only constant builtin statics (the emitter would
+    // have used Dot_Static_Import_Data and not evaluated the base)
+    Chuck_Value * value = type_engine_find_value( t_base, member->xid );
+    if( !value || value->is_member || !value->is_const || !value->addr ) return;
+
+    Chuck_Opt_Const c; c.kind = kind;
+    if( kind == te_int ) c.i = *(t_CKINT *)value->addr;
+    else c.f = *(t_CKFLOAT *)value->addr;
+
+    if( opt_set_const( opt, e, c ) ) opt->stats.members++;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_fold_binary_op()
+// desc: evaluate lhs OP rhs as the VM would; FALSE if not foldable
+//-----------------------------------------------------------------------------
+static t_CKBOOL opt_fold_binary_op( ae_Operator op, const Chuck_Opt_Const & l,
+                                    const Chuck_Opt_Const & r, Chuck_Opt_Const & out )
+{
+    if( l.kind != r.kind ) return FALSE;
+
+    if( l.kind == te_int )
+    {
+        t_CKINT a = l.i, b = r.i;
+        // two's complement wrap, like the VM
+        t_CKUINT ua = (t_CKUINT)a, ub = (t_CKUINT)b;
+        out.kind = te_int;
+        switch( op )
+        {
+        case ae_op_plus: out.i = (t_CKINT)(ua + ub); return TRUE;
+        case ae_op_minus: out.i = (t_CKINT)(ua - ub); return TRUE;
+        case ae_op_times: out.i = (t_CKINT)(ua * ub); return TRUE;
+        // leave runtime errors (and INT_MIN/-1) to runtime
+        case ae_op_divide: if( b == 0 || (b == -1 && a == -CK_INT_MAX-1) ) return FALSE; out.i = a / b; return TRUE;
+        case ae_op_percent: if( b == 0 || (b == -1 && a == -CK_INT_MAX-1) ) return FALSE; out.i = a % b; return TRUE;
+        case ae_op_s_and: out.i = a & b; return TRUE;
+        case ae_op_s_or: out.i = a | b; return TRUE;
+        case ae_op_s_xor: out.i = a ^ b; return TRUE;
+        // VM shifts are unsigned
+        case ae_op_shift_left: if( ub >= sizeof(t_CKUINT)*8 ) return FALSE; out.i = (t_CKINT)(ua << ub); return TRUE;
+        case ae_op_shift_right: if( ub >= sizeof(t_CKUINT)*8 ) return FALSE; out.i = (t_CKINT)(ua >> ub); return TRUE;
+        case ae_op_lt: out.i = a < b; return TRUE;
+        case ae_op_le: out.i = a <= b; return TRUE;
+        case ae_op_gt: out.i = a > b; return TRUE;
+        case ae_op_ge: out.i = a >= b; return TRUE;
+        case ae_op_eq: out.i = a == b; return TRUE;
+        case ae_op_neq: out.i = a != b; return TRUE;
+        // as emitted: && yields rhs, || yields 1 or rhs
+        case ae_op_and: out.i = a ? b : 0; return TRUE;
+        case ae_op_or: out.i = a ? 1 : b; return TRUE;
+        default: return FALSE;
+        }
+    }
+    else
+    {
+        t_CKFLOAT a = l.f, b = r.f;
+        switch( op )
+        {
+        case ae_op_plus: out.kind = te_float; out.f = a + b; return TRUE;
+        case ae_op_minus: out.kind = te_float; out.f = a - b; return TRUE;
+        case ae_op_times: out.kind = te_float; out.f = a * b; return TRUE;
+        case ae_op_divide: out.kind = te_float; out.f = a / b; return TRUE;
+        case ae_op_percent: out.kind = te_float; out.f = ::fmod( a, b ); return TRUE;
+        case ae_op_lt: out.kind = te_int; out.i = a < b; return TRUE;
+        case ae_op_le: out.kind = te_int; out.i = a <= b; return TRUE;
+        case ae_op_gt: out.kind = te_int; out.i = a > b; return TRUE;
+        case ae_op_ge: out.kind = te_int; out.i = a >= b; return TRUE;
+        case ae_op_eq: out.kind = te_int; out.i = a == b; return TRUE;
+        case ae_op_neq: out.kind = te_int; out.i = a != b; return TRUE;
+        default: return FALSE;
+        }
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_take_operand()
+// desc: replace binary expression e by one of its operands (a variable);
+//       the other operand is discarded
+//-----------------------------------------------------------------------------
+static t_CKBOOL opt_take_operand( Chuck_Optimizer * opt, a_Exp e, a_Exp keep )
+{
+    // only plain variables, of exactly the result type, not cast
+    if( keep->s_type != ae_exp_primary || keep->primary.s_type != ae_primary_var ) return FALSE;
+    if( keep->emit_var || keep->cast_to || !equals( keep->type, e->type ) ) return FALSE;
+    // not special names (now, me, dac...) that the emitter treats differently
+    if( !keep->primary.value ) return FALSE;
+
+    // keep the variable
+    struct a_Exp_Primary_ p = keep->primary;
+    // detach, then free the other operand and the kept shell
+    a_Exp drop = (keep == e->binary.lhs) ? e->binary.rhs : e->binary.lhs;
+    delete_exp( drop );
+    CK_SAFE_FREE( keep );
+
+    // becomes the variable; type, cast_to, next are untouched
+    e->s_type = ae_exp_primary;
+    e->s_meta = ae_meta_value;
+    e->primary = p;
+    e->primary.self = e;
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_reduce_binary()
+// desc: strength reduction on binary expressions with one constant operand
+//       NOTE: only exact identities; the result is bit-identical
+//-----------------------------------------------------------------------------
+static void opt_reduce_binary( Chuck_Optimizer * opt, a_Exp e )
+{
+    a_Exp_Binary binary = &e->binary;
+    Chuck_Opt_Const l, r;
+    t_CKBOOL lc = opt_get_const( opt, binary->lhs, l );
+    t_CKBOOL rc = opt_get_const( opt, binary->rhs, r );
+    if( lc == rc ) return;
+
+    // the constant and the other
+    const Chuck_Opt_Const & c = lc ? l : r;
+    a_Exp other = lc ? binary->rhs : binary->lhs;
+    t_CKBOOL isInt = (c.kind == te_int);
+    t_CKBOOL zero = isInt ? c.i == 0 : c.f == 0;
+    t_CKBOOL one = isInt ? c.i == 1 : c.f == 1;
+
+    // x*1, 1*x, x/1
+    if( (binary->op == ae_op_times && one) || (binary->op == ae_op_divide && rc && one) )
+    {
+        if( opt_take_operand( opt, e, other ) ) { opt->stats.reduced++; return; }
+    }
+    // x-0 (float too: -0.0 - 0.0 is -0.0), and for int only x+0, 0+x, x|0, x^0, x<<0, x>>0
+    else if( zero && ( (binary->op == ae_op_minus && rc) ||
+             ( isInt && ( binary->op == ae_op_plus || binary->op == ae_op_s_or || binary->op == ae_op_s_xor ||
+               ((binary->op == ae_op_shift_left || binary->op == ae_op_shift_right) && rc) ) ) ) )
+    {
+        if( opt_take_operand( opt, e, other ) ) { opt->stats.reduced++; return; }
+    }
+    // x / 2^k => x * 2^-k (the reciprocal is exact, so is the product)
+    else if( binary->op == ae_op_divide && rc && !isInt && opt_is_pow2( r.f ) )
+    {
+        // float or dur divided by a float
+        Chuck_Type * t_left = binary->lhs->cast_to ? binary->lhs->cast_to : binary->lhs->type;
+        Chuck_Type * t_right = binary->rhs->cast_to ? binary->rhs->cast_to : binary->rhs->type;
+        if( !equals( t_right, opt->env->ckt_float ) ) return;
+        if( !equals( t_left, opt->env->ckt_float ) && !equals( t_left, opt->env->ckt_dur ) ) return;
+        // the rhs is now exactly float
+        Chuck_Opt_Const rr; rr.kind = te_float; rr.f = 1.0 / r.f;
+        binary->rhs->type = opt->env->ckt_float; binary->rhs->cast_to = NULL;
+        if( !opt_set_const( opt, binary->rhs, rr ) ) return;
+        binary->op = ae_op_times;
+        opt->stats.reduced++;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_fold_binary()
+// desc: ...
+//-----------------------------------------------------------------------------
+static void opt_fold_binary( Chuck_Optimizer * opt, a_Exp e )
+{
+    a_Exp_Binary binary = &e->binary;
+    Chuck_Opt_Const l, r, out;
+
+    // operands first
+    opt_exp( opt, binary->lhs );
+    opt_exp( opt, binary->rhs );
+
+    // user-defined operators are function calls
+    if( binary->ck_overload_func || e->emit_var ) return;
+
+    // lhs known?
+    if( !opt_get_const( opt, binary->lhs, l ) ) return;
+
+    // short circuit: ( 0 && f() ) and ( 1 || f() ) never evaluate f()
+    if( l.kind == te_int && ( (binary->op == ae_op_and && l.i == 0) ||
+                              (binary->op == ae_op_or && l.i != 0) ) )
+    {
+        Chuck_Opt_Const v; v.kind = te_int; v.i = (binary->op == ae_op_or);
+        if( opt_set_const( opt, e, v ) ) opt->stats.folded++;
+        return;
+    }
+
+    // both
+    if( opt_get_const( opt, binary->rhs, r ) && opt_fold_binary_op( binary->op, l, r, out ) )
+    {
+        if( opt_set_const( opt, e, out ) ) opt->stats.folded++;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_fold_unary()
+// desc: -x, !x, ~x
+//-----------------------------------------------------------------------------
+static void opt_fold_unary( Chuck_Optimizer * opt, a_Exp e )
+{
+    a_Exp_Unary unary = &e->unary;
+    Chuck_Opt_Const c, out;
+
+    // operands
+    opt_exp( opt, unary->exp );
+    opt_array_sub( opt, unary->array );
+    if( unary->code ) opt_stmt( opt, unary->code );
+
+    // user-defined operators are function calls
+    if( unary->ck_overload_func || e->emit_var ) return;
+    // emitter picks the instruction from the operand's own type
+    if( !opt_get_const( opt, unary->exp, c ) || unary->exp->cast_to ) return;
+
+    t_CKBOOL isInt = equals( unary->exp->type, opt->env->ckt_int );
+    t_CKBOOL isFloat = equals( unary->exp->type, opt->env->ckt_float );
+    switch( unary->op )
+    {
+    case ae_op_minus:
+        if( isInt ) { out.kind = te_int; out.i = (t_CKINT)( 0 - (t_CKUINT)c.i ); }
+        else if( isFloat ) { out.kind = te_float; out.f = -c.f; }
+        else return;
+        break;
+    case ae_op_exclamation:
+        if( !isInt ) return;
+        out.kind = te_int; out.i = !c.i;
+        break;
+    case ae_op_tilda:
+        if( !isInt ) return;
+        out.kind = te_int; out.i = ~c.i;
+        break;
+    default:
+        return;
+    }
+
+    if( opt_set_const( opt, e, out ) ) opt->stats.folded++;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_fold_cast()
+// desc: ( x $ T ) for int/float-kind x and T
+//-----------------------------------------------------------------------------
+static void opt_fold_cast( Chuck_Optimizer * opt, a_Exp e )
+{
+    Chuck_Opt_Const c;
+    te_Type kind;
+
+    // operand
+    opt_exp( opt, e->cast.exp );
+
+    if( e->emit_var || !opt_get_const( opt, e->cast.exp, c ) ) return;
+    if( !opt_kind( e->type, kind ) ) return;
+    // Cast_int2double, Cast_double2int, or no-op (e.g., float to dur)
+    if( kind == te_float && c.kind == te_int ) { c.kind = te_float; c.f = (t_CKFLOAT)c.i; }
+    else if( kind == te_int && c.kind == te_float ) { c.kind = te_int; c.i = (t_CKINT)c.f; }
+
+    if( opt_set_const( opt, e, c ) ) opt->stats.folded++;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_fold_dur()
+// desc: base::unit, e.g., 1::second
+//-----------------------------------------------------------------------------
+static void opt_fold_dur( Chuck_Optimizer * opt, a_Exp e )
+{
+    Chuck_Opt_Const b, u, out;
+
+    // operands
+    opt_exp( opt, e->dur.base );
+    opt_exp( opt, e->dur.unit );
+
+    if( !opt_get_const( opt, e->dur.base, b ) || !opt_get_const( opt, e->dur.unit, u ) ) return;
+    if( u.kind != te_float ) return;
+    // base cast to float (as emitted), times the unit
+    out.kind = te_float;
+    out.f = ( b.kind == te_int ? (t_CKFLOAT)b.i : b.f ) * u.f;
+
+    if( opt_set_const( opt, e, out ) ) opt->stats.folded++;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_fold_exp_if()
+// desc: cond ? a : b with constant cond and constant chosen value
+//-----------------------------------------------------------------------------
+static void opt_fold_exp_if( Chuck_Optimizer * opt, a_Exp e )
+{
+    Chuck_Opt_Const c, v;
+
+    // operands
+    opt_exp( opt, e->exp_if.cond );
+    opt_exp( opt, e->exp_if.if_exp );
+    opt_exp( opt, e->exp_if.else_exp );
+
+    if( e->emit_var || !opt_get_const( opt, e->exp_if.cond, c ) || c.kind != te_int ) return;
+    // the chosen one
+    if( !opt_get_const( opt, c.i ? e->exp_if.if_exp : e->exp_if.else_exp, v ) ) return;
+
+    if( opt_set_const( opt, e, v ) ) opt->stats.folded++;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_array_sub()
+// desc: array subscripts, and array literal elements
+//-----------------------------------------------------------------------------
+static void opt_array_sub( Chuck_Optimizer * opt, a_Array_Sub sub )
+{
+    if( sub ) opt_exp( opt, sub->exp_list );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_exp()
+// desc: optimize every expression in a list
+//-----------------------------------------------------------------------------
+static void opt_exp( Chuck_Optimizer * opt, a_Exp exp )
+{
+    while( exp )
+    {
+        opt_exp_one( opt, exp );
+        exp = exp->next;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_exp_one()
+// desc: optimize one expression (bottom-up) in place
+//-----------------------------------------------------------------------------
+static void opt_exp_one( Chuck_Optimizer * opt, a_Exp exp )
+{
+    switch( exp->s_type )
+    {
+    case ae_exp_binary:
+        opt_fold_binary( opt, exp );
+        if( exp->s_type == ae_exp_binary && opt->level >= CK_OPTIMIZE_FULL
+            && !exp->binary.ck_overload_func )
+            opt_reduce_binary( opt, exp );
+        break;
+    case ae_exp_unary:
+        opt_fold_unary( opt, exp );
+        break;
+    case ae_exp_cast:
+        opt_fold_cast( opt, exp );
+        break;
+    case ae_exp_postfix:
+        opt_exp( opt, exp->postfix.exp );
+        break;
+    case ae_exp_dur:
+        opt_fold_dur( opt, exp );
+        break;
+    case ae_exp_primary:
+        opt_fold_primary( opt, exp );
+        break;
+    case ae_exp_array:
+        opt_exp( opt, exp->array.base );
+        opt_array_sub( opt, exp->array.indices );
+        break;
+    case ae_exp_func_call:
+        opt_exp( opt, exp->func_call.func );
+        opt_exp( opt, exp->func_call.args );
+        break;
+    case ae_exp_dot_member:
+        opt_fold_dot_member( opt, exp );
+        break;
+    case ae_exp_if:
+        opt_fold_exp_if( opt, exp );
+        break;
+    case ae_exp_decl:
+    {
+        a_Var_Decl_List list = exp->decl.var_decl_list;
+        for( ; list; list = list->next )
+            opt_array_sub( opt, list->var_decl->array );
+        break;
+    }
+    }
+
+    // a constant int headed for float: do the implicit cast now
+    if( exp->s_type == ae_exp_primary && exp->primary.s_type == ae_primary_num
+        && !exp->emit_var && exp->cast_to && equals( exp->cast_to, opt->env->ckt_float )
+        && equals( exp->type, opt->env->ckt_int ) )
+    {
+        t_CKFLOAT f = (t_CKFLOAT)exp->primary.num;
+        exp->type = opt->env->ckt_float;
+        exp->cast_to = NULL;
+        exp->primary.s_type = ae_primary_float;
+        exp->primary.fnum = f;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_cond()
+// desc: value of a constant condition, as the emitter would test it
+//-----------------------------------------------------------------------------
+static t_CKBOOL opt_cond( Chuck_Optimizer * opt, a_Exp cond, t_CKBOOL & truth )
+{
+    Chuck_Opt_Const c;
+    // single expression only
+    if( !cond || cond->next || !opt_get_const( opt, cond, c ) ) return FALSE;
+    truth = c.kind == te_int ? c.i != 0 : c.f != 0;
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_has_jump()
+// desc: does stmt contain a break/continue that targets the enclosing loop?
+//-----------------------------------------------------------------------------
+static t_CKBOOL opt_has_jump( a_Stmt stmt )
+{
+    if( !stmt ) return FALSE;
+    switch( stmt->s_type )
+    {
+    case ae_stmt_break: case ae_stmt_continue: return TRUE;
+    case ae_stmt_if: return opt_has_jump( stmt->stmt_if.if_body ) || opt_has_jump( stmt->stmt_if.else_body );
+    case ae_stmt_code:
+    {
+        for( a_Stmt_List list = stmt->stmt_code.stmt_list; list; list = list->next )
+            if( opt_has_jump( list->stmt ) ) return TRUE;
+        return FALSE;
+    }
+    // nested loops have their own targets
+    default: return FALSE;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_stmt_to_code()
+// desc: turn stmt (in place) into a scoped block { body }
+//-----------------------------------------------------------------------------
+static void opt_stmt_to_code( a_Stmt stmt, a_Stmt body )
+{
+    stmt->s_type = ae_stmt_code;
+    stmt->stmt_code.stmt_list = body ? new_stmt_list( body, stmt->line, stmt->where ) : NULL;
+    stmt->stmt_code.allControlPathsReturn = stmt->allControlPathsReturn;
+    stmt->stmt_code.scoped = TRUE;
+    stmt->stmt_code.line = stmt->line; stmt->stmt_code.where = stmt->where;
+    stmt->stmt_code.self = stmt;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_stmt_to_forever()
+// desc: turn a loop (in place) into for( ; ; ) body
+//-----------------------------------------------------------------------------
+static void opt_stmt_to_forever( a_Stmt stmt, a_Stmt body )
+{
+    stmt->s_type = ae_stmt_for;
+    stmt->stmt_for.c1 = NULL;
+    stmt->stmt_for.c2 = NULL;
+    stmt->stmt_for.c3 = NULL;
+    stmt->stmt_for.body = body;
+    stmt->stmt_for.line = stmt->line; stmt->stmt_for.where = stmt->where;
+    stmt->stmt_for.self = stmt;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Opt_Bounds
+// desc: state for proving array indices in range within a counting loop,
+//       for( <n >= 0> => int i; i < a.size(); i++ ) { ... a[i] ... }
+//
+//       inside the body, i is in [0, a.size()) as long as neither i nor a
+//       are assigned (by name, or as a member, e.g., this.a), and a cannot
+//       be resized; variables are compared by value, so a local that
+//       shadows either is a different variable; since only calls and time
+//       can run other code (or other shreds) that might resize a, the
+//       body may only call native non-member functions on primitives and
+//       a.size(), and may not advance time, spork, or instantiate objects
+//-----------------------------------------------------------------------------
+struct Chuck_Opt_Bounds
+{
+    // the index variable
+    Chuck_Value * index;
+    // the array variable
+    Chuck_Value * array;
+    // array accesses a[i] found so far
+    std::vector<a_Exp> found;
+
+    // constructor
+    Chuck_Opt_Bounds() : index(NULL), array(NULL) { }
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_bounds_is_size()
+// desc: is e a call to array.size() (or .cap()) on an array variable?
+//-----------------------------------------------------------------------------
+static t_CKBOOL opt_bounds_is_size( a_Exp e, Chuck_Value ** array )
+{
+    if( e->s_type != ae_exp_func_call || e->func_call.args || !e->func_call.ck_func ) return FALSE;
+    a_Exp f = e->func_call.func;
+    if( f->s_type != ae_exp_dot_member || !f->dot_member.t_base || !f->dot_member.t_base->array_depth ) return FALSE;
+    // (by base name; the member symbol is the mangled name)
+    const std::string & name = e->func_call.ck_func->base_name;
+    if( name != "size" && name != "cap" ) return FALSE;
+    // a variable, if asked for
+    if( array && ( f->dot_member.base->s_type != ae_exp_primary ||
+                   f->dot_member.base->primary.s_type != ae_primary_var ||
+                   !f->dot_member.base->primary.value ) ) return FALSE;
+    if( array ) *array = f->dot_member.base->primary.value;
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_bounds_is_var()
+// desc: is e the (int) variable var, read as a value?
+//-----------------------------------------------------------------------------
+static t_CKBOOL opt_bounds_is_var( Chuck_Optimizer * opt, a_Exp e, Chuck_Value * var )
+{
+    return e->s_type == ae_exp_primary && e->primary.s_type == ae_primary_var &&
+           e->primary.value == var && !e->emit_var && !e->cast_to && !e->next &&
+           equals( e->type, opt->env->ckt_int );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_bounds_type_ok()
+// desc: can a declaration of this type run user code (constructors)?
+//-----------------------------------------------------------------------------
+static t_CKBOOL opt_bounds_type_ok( Chuck_Optimizer * opt, Chuck_Type * type, t_CKBOOL ref )
+{
+    if( !type ) return FALSE;
+    // references don't instantiate
+    if( ref ) return TRUE;
+    // arrays instantiate their elements
+    if( type->array_depth ) type = type->array_type;
+    return type && isprim( opt->env, type );
+}
+
+
+
+
+// forward reference
+static t_CKBOOL opt_bounds_stmt( Chuck_Optimizer * opt, Chuck_Opt_Bounds & b, a_Stmt stmt );
+//-----------------------------------------------------------------------------
+// name: opt_bounds_exp()
+// desc: check an expression list in a loop body; records a[i] accesses
+//-----------------------------------------------------------------------------
+static t_CKBOOL opt_bounds_exp( Chuck_Optimizer * opt, Chuck_Opt_Bounds & b, a_Exp exp )
+{
+    for( ; exp; exp = exp->next )
+    {
+        switch( exp->s_type )
+        {
+        case ae_exp_binary:
+            // operator overloads and chucking to functions run code
+            if( exp->binary.ck_func || exp->binary.ck_overload_func ) return FALSE;
+            // appending resizes (any array; it might be an alias)
+            if( exp->binary.op == ae_op_arrow_left && exp->binary.lhs->type && exp->binary.lhs->type->array_depth ) return FALSE;
+            if( !opt_bounds_exp( opt, b, exp->binary.lhs ) || !opt_bounds_exp( opt, b, exp->binary.rhs ) ) return FALSE;
+            break;
+        case ae_exp_unary:
+            if( exp->unary.ck_overload_func || exp->unary.code ) return FALSE;
+            if( exp->unary.op == ae_op_spork || exp->unary.op == ae_op_new ) return FALSE;
+            if( !opt_bounds_exp( opt, b, exp->unary.exp ) ) return FALSE;
+            break;
+        case ae_exp_postfix:
+            if( exp->postfix.ck_overload_func ) return FALSE;
+            if( !opt_bounds_exp( opt, b, exp->postfix.exp ) ) return FALSE;
+            break;
+        case ae_exp_cast:
+            if( !opt_bounds_exp( opt, b, exp->cast.exp ) ) return FALSE;
+            break;
+        case ae_exp_dur:
+            if( !opt_bounds_exp( opt, b, exp->dur.base ) || !opt_bounds_exp( opt, b, exp->dur.unit ) ) return FALSE;
+            break;
+        case ae_exp_if:
+            if( !opt_bounds_exp( opt, b, exp->exp_if.cond ) || !opt_bounds_exp( opt, b, exp->exp_if.if_exp ) ||
+                !opt_bounds_exp( opt, b, exp->exp_if.else_exp ) ) return FALSE;
+            break;
+        case ae_exp_dot_member:
+            // assigned through a member (e.g., [1.0] @=> this.a): might be i or a
+            if( exp->emit_var ) return FALSE;
+            if( !opt_bounds_exp( opt, b, exp->dot_member.base ) ) return FALSE;
+            break;
+        case ae_exp_array:
+            if( !opt_bounds_exp( opt, b, exp->array.base ) || !opt_bounds_exp( opt, b, exp->array.indices->exp_list ) )
+                return FALSE;
+            // a[i]
+            if( exp->array.base->s_type == ae_exp_primary && exp->array.base->primary.s_type == ae_primary_var &&
+                exp->array.base->primary.value == b.array && exp->array.indices->depth == 1 &&
+                opt_bounds_is_var( opt, exp->array.indices->exp_list, b.index ) )
+                b.found.push_back( exp );
+            break;
+        case ae_exp_func_call:
+        {
+            Chuck_Func * func = exp->func_call.ck_func;
+            // size() on any array
+            if( opt_bounds_is_size( exp, NULL ) )
+            {
+                if( !opt_bounds_exp( opt, b, exp->func_call.func->dot_member.base ) ) return FALSE;
+                break;
+            }
+            // native non-member functions, on primitives only
+            if( !func || func->is_member || !func->code || !func->code->native_func ) return FALSE;
+            for( a_Exp arg = exp->func_call.args; arg; arg = arg->next )
+                if( !arg->type || !isprim( opt->env, arg->type ) ) return FALSE;
+            if( !opt_bounds_exp( opt, b, exp->func_call.args ) ) return FALSE;
+            break;
+        }
+        case ae_exp_decl:
+        {
+            a_Var_Decl_List list = exp->decl.var_decl_list;
+            for( ; list; list = list->next )
+            {
+                a_Var_Decl decl = list->var_decl;
+                if( !opt_bounds_type_ok( opt, decl->ck_type ? decl->ck_type : exp->decl.ck_type,
+                                         decl->ref || exp->decl.type->ref ) ) return FALSE;
+                if( decl->array && !opt_bounds_exp( opt, b, decl->array->exp_list ) ) return FALSE;
+            }
+            break;
+        }
+        case ae_exp_primary:
+            switch( exp->primary.s_type )
+            {
+            case ae_primary_var:
+                // assigned (or time advanced)
+                if( exp->emit_var && ( exp->primary.value == b.index || exp->primary.value == b.array ||
+                                       exp->primary.var == insert_symbol( "now" ) ) ) return FALSE;
+                break;
+            case ae_primary_exp:
+                if( !opt_bounds_exp( opt, b, exp->primary.exp ) ) return FALSE;
+                break;
+            case ae_primary_array:
+                if( exp->primary.array && !opt_bounds_exp( opt, b, exp->primary.array->exp_list ) ) return FALSE;
+                break;
+            case ae_primary_hack:
+                if( !opt_bounds_exp( opt, b, exp->primary.exp ) ) return FALSE;
+                break;
+            case ae_primary_complex:
+                if( !opt_bounds_exp( opt, b, exp->primary.complex->re ) ||
+                    !opt_bounds_exp( opt, b, exp->primary.complex->im ) ) return FALSE;
+                break;
+            case ae_primary_polar:
+                if( !opt_bounds_exp( opt, b, exp->primary.polar->mod ) ||
+                    !opt_bounds_exp( opt, b, exp->primary.polar->phase ) ) return FALSE;
+                break;
+            case ae_primary_vec:
+                if( !opt_bounds_exp( opt, b, exp->primary.vec->args ) ) return FALSE;
+                break;
+            default:
+                break;
+            }
+            break;
+        default:
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_bounds_stmt()
+// desc: check a statement in a loop body
+//-----------------------------------------------------------------------------
+static t_CKBOOL opt_bounds_stmt( Chuck_Optimizer * opt, Chuck_Opt_Bounds & b, a_Stmt stmt )
+{
+    if( !stmt ) return TRUE;
+    switch( stmt->s_type )
+    {
+    case ae_stmt_exp: return opt_bounds_exp( opt, b, stmt->stmt_exp );
+    case ae_stmt_while: return opt_bounds_exp( opt, b, stmt->stmt_while.cond ) && opt_bounds_stmt( opt, b, stmt->stmt_while.body );
+    case ae_stmt_until: return opt_bounds_exp( opt, b, stmt->stmt_until.cond ) && opt_bounds_stmt( opt, b, stmt->stmt_until.body );
+    case ae_stmt_loop: return opt_bounds_exp( opt, b, stmt->stmt_loop.cond ) && opt_bounds_stmt( opt, b, stmt->stmt_loop.body );
+    case ae_stmt_for:
+        return opt_bounds_stmt( opt, b, stmt->stmt_for.c1 ) && opt_bounds_stmt( opt, b, stmt->stmt_for.c2 ) &&
+               opt_bounds_exp( opt, b, stmt->stmt_for.c3 ) && opt_bounds_stmt( opt, b, stmt->stmt_for.body );
+    case ae_stmt_foreach:
+        return opt_bounds_exp( opt, b, stmt->stmt_foreach.theIter ) && opt_bounds_exp( opt, b, stmt->stmt_foreach.theArray ) &&
+               opt_bounds_stmt( opt, b, stmt->stmt_foreach.body );
+    case ae_stmt_if:
+        return opt_bounds_exp( opt, b, stmt->stmt_if.cond ) && opt_bounds_stmt( opt, b, stmt->stmt_if.if_body ) &&
+               opt_bounds_stmt( opt, b, stmt->stmt_if.else_body );
+    case ae_stmt_code:
+        for( a_Stmt_List list = stmt->stmt_code.stmt_list; list; list = list->next )
+            if( !opt_bounds_stmt( opt, b, list->stmt ) ) return FALSE;
+        return TRUE;
+    case ae_stmt_return: return opt_bounds_exp( opt, b, stmt->stmt_return.val );
+    case ae_stmt_break: case ae_stmt_continue: return TRUE;
+    default: return FALSE;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_bounds_for()
+// desc: mark a[i] accesses in a counting for loop as unchecked, if in range
+//-----------------------------------------------------------------------------
+static void opt_bounds_for( Chuck_Optimizer * opt, a_Stmt stmt )
+{
+    a_Stmt c1 = stmt->stmt_for.c1, c2 = stmt->stmt_for.c2;
+    a_Exp c3 = stmt->stmt_for.c3, e = NULL;
+    Chuck_Opt_Const start;
+    Chuck_Opt_Bounds b;
+
+    // c1: n => int i (or n => i), for a constant n >= 0
+    if( !c1 || c1->s_type != ae_stmt_exp || !(e = c1->stmt_exp) || e->next ) return;
+    if( e->s_type != ae_exp_binary || e->binary.op != ae_op_chuck || e->binary.ck_overload_func ) return;
+    if( !opt_get_const( opt, e->binary.lhs, start ) || start.kind != te_int || start.i < 0 ) return;
+    a_Exp rhs = e->binary.rhs;
+    if( !equals( rhs->type, opt->env->ckt_int ) || rhs->next ) return;
+    if( rhs->s_type == ae_exp_decl && rhs->decl.num_var_decls == 1 && !rhs->decl.var_decl_list->var_decl->array )
+        b.index = rhs->decl.var_decl_list->var_decl->value;
+    else if( rhs->s_type == ae_exp_primary && rhs->primary.s_type == ae_primary_var )
+        b.index = rhs->primary.value;
+    else return;
+    if( !b.index ) return;
+
+    // c2: i < a.size()
+    if( !c2 || c2->s_type != ae_stmt_exp || !(e = c2->stmt_exp) || e->next ) return;
+    if( e->s_type != ae_exp_binary || e->binary.op != ae_op_lt || e->binary.ck_overload_func ) return;
+    if( !opt_bounds_is_var( opt, e->binary.lhs, b.index ) ) return;
+    if( !opt_bounds_is_size( e->binary.rhs, &b.array ) ) return;
+    // (cap() is not an upper bound on the index)
+    if( e->binary.rhs->func_call.ck_func->base_name != "size" ) return;
+
+    // c3: i++ or ++i
+    if( !c3 || c3->next ) return;
+    if( c3->s_type == ae_exp_postfix && c3->postfix.op == ae_op_plusplus && !c3->postfix.ck_overload_func ) e = c3->postfix.exp;
+    else if( c3->s_type == ae_exp_unary && c3->unary.op == ae_op_plusplus && !c3->unary.ck_overload_func ) e = c3->unary.exp;
+    else return;
+    if( e->s_type != ae_exp_primary || e->primary.s_type != ae_primary_var || e->primary.value != b.index ) return;
+
+    // the body
+    if( !opt_bounds_stmt( opt, b, stmt->stmt_for.body ) ) return;
+
+    // mark (int/float elements only; see emit_engine_emit_exp_array())
+    for( t_CKUINT k = 0; k < b.found.size(); k++ )
+    {
+        te_Type kind;
+        if( !opt_kind( b.found[k]->type, kind ) ) continue;
+        b.found[k]->array.unchecked = TRUE;
+        opt->stats.unchecked++;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: opt_stmt()
+// desc: optimize a statement; resolves if/while/until/for on constants
+//-----------------------------------------------------------------------------
+static void opt_stmt( Chuck_Optimizer * opt, a_Stmt stmt )
+{
+    t_CKBOOL truth = FALSE;
+    if( !stmt ) return;
+
+    switch( stmt->s_type )
+    {
+    case ae_stmt_exp:
+        opt_exp( opt, stmt->stmt_exp );
+        break;
+
+    case ae_stmt_code:
+        opt_stmt_list( opt, stmt->stmt_code.stmt_list );
+        break;
+
+    case ae_stmt_if:
+    {
+        opt_exp( opt, stmt->stmt_if.cond );
+        opt_stmt( opt, stmt->stmt_if.if_body );
+        opt_stmt( opt, stmt->stmt_if.else_body );
+        if( !opt_cond( opt, stmt->stmt_if.cond, truth ) ) break;
+        // keep one branch
+        a_Stmt keep = truth ? stmt->stmt_if.if_body : stmt->stmt_if.else_body;
+        a_Stmt drop = truth ? stmt->stmt_if.else_body : stmt->stmt_if.if_body;
+        delete_exp( stmt->stmt_if.cond );
+        delete_stmt( drop );
+        opt_stmt_to_code( stmt, keep );
+        opt->stats.branches++;
+        break;
+    }
+
+    case ae_stmt_while:
+    {
+        opt_exp( opt, stmt->stmt_while.cond );
+        opt_stmt( opt, stmt->stmt_while.body );
+        if( !opt_cond( opt, stmt->stmt_while.cond, truth ) ) break;
+        a_Stmt body = stmt->stmt_while.body;
+        // do { body } while( false ) runs once, if it doesn't jump
+        if( !truth && stmt->stmt_while.is_do && opt_has_jump( body ) ) break;
+        delete_exp( stmt->stmt_while.cond );
+        if( truth ) opt_stmt_to_forever( stmt, body );
+        else if( stmt->stmt_while.is_do ) opt_stmt_to_code( stmt, body );
+        else { delete_stmt( body ); opt_stmt_to_code( stmt, NULL ); }
+        opt->stats.branches++;
+        break;
+    }
+
+    case ae_stmt_until:
+    {
+        opt_exp( opt, stmt->stmt_until.cond );
+        opt_stmt( opt, stmt->stmt_until.body );
+        if( !opt_cond( opt, stmt->stmt_until.cond, truth ) ) break;
+        a_Stmt body = stmt->stmt_until.body;
+        // do { body } until( true ) runs once, if it doesn't jump
+        if( truth && stmt->stmt_until.is_do && opt_has_jump( body ) ) break;
+        delete_exp( stmt->stmt_until.cond );
+        if( !truth ) opt_stmt_to_forever( stmt, body );
+        else if( stmt->stmt_until.is_do ) opt_stmt_to_code( stmt, body );
+        else { delete_stmt( body ); opt_stmt_to_code( stmt, NULL ); }
+        opt->stats.branches++;
+        break;
+    }
+
+    case ae_stmt_for:
+    {
+        opt_stmt( opt, stmt->stmt_for.c1 );
+        opt_stmt( opt, stmt->stmt_for.c2 );
+        opt_exp( opt, stmt->stmt_for.c3 );
+        opt_stmt( opt, stmt->stmt_for.body );
+        // array accesses that need no bounds check
+        if( opt->level >= CK_OPTIMIZE_FULL ) opt_bounds_for( opt, stmt );
+        a_Stmt c2 = stmt->stmt_for.c2;
+        if( !c2 || c2->s_type != ae_stmt_exp || !opt_cond( opt, c2->stmt_exp, truth ) ) break;
+        if( truth )
+        {
+            // no test at all
+            delete_stmt( c2 );
+            stmt->stmt_for.c2 = NULL;
+        }
+        else
+        {
+            // only the initializer runs
+            a_Stmt c1 = stmt->stmt_for.c1;
+            delete_stmt( c2 );
+            delete_exp( stmt->stmt_for.c3 );
+            delete_stmt( stmt->stmt_for.body );
+            opt_stmt_to_code( stmt, c1 );
+        }
+        opt->stats.branches++;
+        break;
+    }
+
+    case ae_stmt_foreach:
+        opt_exp( opt, stmt->stmt_foreach.theArray );
+        opt_stmt( opt, stmt->stmt_foreach.body );
+        break;
+
+    case ae_stmt_loop:
+        opt_exp( opt, stmt->stmt_loop.cond );
+        opt_stmt( opt, stmt->stmt_loop.body );
+        break;
+
+    case ae_stmt_return:
+        opt_exp( opt, stmt->stmt_return.val );
+        break;
+
+    default:
+        break;
+    }
+}
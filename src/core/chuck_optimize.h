@@ -0,0 +1,85 @@
+/*----------------------------------------------------------------------------
+  ChucK Concurrent, On-the-fly Audio Programming Language
+    Compiler and Virtual Machine
+
+  Copyright (c) 2004 Ge Wang and Perry R. Cook.  All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+  U.S.A.
+-----------------------------------------------------------------------------*/
+
+//-----------------------------------------------------------------------------
+// file: chuck_optimize.h
+// desc: chuck AST optimizer; runs over the type-checked abstract syntax
+//       tree, between type-checking (pass 3) and emission (pass 4)
+//
+//       level 1: constant folding (int, float, dur, time), constant
+//                member lookups (e.g., Math.PI), and elimination of
+//                branches and loops whose conditions are constant
+//       level 2: level 1 + strength reduction, and bounds-check
+//                elimination for counting loops over arrays
+//-----------------------------------------------------------------------------
+#ifndef __CHUCK_OPTIMIZE_H__
+#define __CHUCK_OPTIMIZE_H__
+
+#include "chuck_def.h"
+#include "chuck_absyn.h"
+#include "chuck_type.h"
+
+
+// optimization levels (e.g., --optimize:N); none by default
+#define CK_OPTIMIZE_NONE             0
+#define CK_OPTIMIZE_BASIC            1
+#define CK_OPTIMIZE_FULL             2
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Optimizer_Stats
+// desc: what the optimizer did to the last program
+//-----------------------------------------------------------------------------
+struct Chuck_Optimizer_Stats
+{
+    // expressions folded into constants
+    t_CKUINT folded;
+    // constant member / global lookups replaced by immediates
+    t_CKUINT members;
+    // branches / loop conditions resolved at compile time
+    t_CKUINT branches;
+    // operations replaced by cheaper equivalents
+    t_CKUINT reduced;
+    // array accesses proven in range
+    t_CKUINT unchecked;
+
+    // constructor
+    Chuck_Optimizer_Stats() : folded(0), members(0), branches(0), reduced(0), unchecked(0) { }
+};
+
+
+
+
+// optimize a type-checked program in place (pass 3.5)
+t_CKBOOL optimize_engine_optimize_prog( Chuck_Env * env, a_Program prog,
+                                        t_CKUINT level,
+                                        te_HowMuch how_much = te_do_all,
+                                        Chuck_Optimizer_Stats * stats = NULL );
+
+
+
+
+#endif
@@ -0,0 +1,255 @@
+/*----------------------------------------------------------------------------
+  ChucK Concurrent, On-the-fly Audio Programming Language
+    Compiler and Virtual Machine
+
+  Copyright (c) 2004 Ge Wang and Perry R. Cook.  All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+  U.S.A.
+-----------------------------------------------------------------------------*/
+
+
+//-----------------------------------------------------------------------------
+// file: chuck_pool.cpp
+// desc: size-class memory pool for VM objects and their data blocks
+//-----------------------------------------------------------------------------
+#include "chuck_pool.h"
+#include <stdlib.h>
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_VM_Pool_Header
+// desc: precedes every block; keeps the payload aligned
+//-----------------------------------------------------------------------------
+struct Chuck_VM_Pool_Header
+{
+    // pool the block came from; NULL for heap blocks
+    Chuck_VM_Pool * pool;
+    // size class (pool blocks only)
+    t_CKUINT sclass;
+};
+
+// header size, rounded up to the alignment
+#define CK_POOL_HEADER_SIZE  ((sizeof(Chuck_VM_Pool_Header) + CK_POOL_ALIGN - 1) & ~(t_CKUINT)(CK_POOL_ALIGN - 1))
+// bytes of a block (header included) in size class `c`
+#define CK_POOL_BLOCK_SIZE(c) (CK_POOL_HEADER_SIZE + ((c) + 1) * CK_POOL_ALIGN)
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: Chuck_VM_Pool()
+// desc: constructor
+//-----------------------------------------------------------------------------
+Chuck_VM_Pool::Chuck_VM_Pool()
+    : m_owner( std::thread::id() ), m_refs(1), m_allocs(0), m_heap_allocs(0), m_capacity(0)
+{
+    for( t_CKUINT i = 0; i < CK_POOL_NUM_CLASSES; i++ )
+    {
+        m_free[i] = NULL;
+        m_remote[i].store( NULL, std::memory_order_relaxed );
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ~Chuck_VM_Pool()
+// desc: destructor
+//-----------------------------------------------------------------------------
+Chuck_VM_Pool::~Chuck_VM_Pool()
+{
+    for( t_CKUINT i = 0; i < m_slabs.size(); i++ )
+        ::free( m_slabs[i] );
+    m_slabs.clear();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: alloc()
+// desc: allocate `size` bytes
+//-----------------------------------------------------------------------------
+void * Chuck_VM_Pool::alloc( t_CKUINT size )
+{
+    // too large, or not the owner: heap
+    if( size > CK_POOL_MAX_SIZE || !is_owner() )
+    {
+        m_heap_allocs.fetch_add( 1, std::memory_order_relaxed );
+        return heap_alloc( size );
+    }
+
+    // size class
+    t_CKUINT sclass = size ? (size - 1) / CK_POOL_ALIGN : 0;
+    // out: take back what other threads freed, then a new slab
+    if( !m_free[sclass] )
+    {
+        m_free[sclass] = m_remote[sclass].exchange( NULL, std::memory_order_acquire );
+        if( !m_free[sclass] && !refill( sclass ) ) return heap_alloc( size );
+    }
+
+    // pop
+    Free * f = m_free[sclass];
+    m_free[sclass] = f->next;
+    // header
+    Chuck_VM_Pool_Header * h = (Chuck_VM_Pool_Header *)f;
+    h->pool = this;
+    h->sclass = sclass;
+    // count
+    m_refs.fetch_add( 1, std::memory_order_relaxed );
+    m_allocs++;
+
+    return (t_CKBYTE *)h + CK_POOL_HEADER_SIZE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: heap_alloc()
+// desc: allocate `size` bytes from the heap
+//-----------------------------------------------------------------------------
+void * Chuck_VM_Pool::heap_alloc( t_CKUINT size )
+{
+    Chuck_VM_Pool_Header * h = (Chuck_VM_Pool_Header *)::malloc( CK_POOL_HEADER_SIZE + size );
+    if( !h ) return NULL;
+    h->pool = NULL;
+    h->sclass = 0;
+    return (t_CKBYTE *)h + CK_POOL_HEADER_SIZE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: free()
+// desc: free a block from alloc() or heap_alloc()
+//-----------------------------------------------------------------------------
+void Chuck_VM_Pool::free( void * ptr )
+{
+    if( !ptr ) return;
+    Chuck_VM_Pool_Header * h = (Chuck_VM_Pool_Header *)((t_CKBYTE *)ptr - CK_POOL_HEADER_SIZE);
+    // heap block
+    if( !h->pool ) { ::free( h ); return; }
+    // pool block
+    h->pool->give_back( h, h->sclass );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: give_back()
+// desc: return a block to its free list
+//-----------------------------------------------------------------------------
+void Chuck_VM_Pool::give_back( void * block, t_CKUINT sclass )
+{
+    Free * f = (Free *)block;
+
+    // owner: onto own list
+    if( is_owner() )
+    {
+        f->next = m_free[sclass];
+        m_free[sclass] = f;
+    }
+    // others: push onto the shared list (push-only, so no ABA)
+    else
+    {
+        f->next = m_remote[sclass].load( std::memory_order_relaxed );
+        while( !m_remote[sclass].compare_exchange_weak( f->next, f,
+                   std::memory_order_release, std::memory_order_relaxed ) ) { }
+    }
+
+    // one less in use
+    unref();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: refill()
+// desc: carve a new slab into blocks of a size class
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_VM_Pool::refill( t_CKUINT sclass )
+{
+    t_CKUINT bsize = CK_POOL_BLOCK_SIZE( sclass );
+    t_CKUINT count = CK_POOL_SLAB_SIZE / bsize;
+    t_CKBYTE * slab = (t_CKBYTE *)::malloc( CK_POOL_SLAB_SIZE );
+    if( !slab ) return FALSE;
+    m_slabs.push_back( slab );
+
+    // link, in address order
+    for( t_CKUINT i = count; i > 0; i-- )
+    {
+        Free * f = (Free *)(slab + (i-1) * bsize);
+        f->next = m_free[sclass];
+        m_free[sclass] = f;
+    }
+    m_capacity += count;
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: detach()
+// desc: let go of the pool
+//-----------------------------------------------------------------------------
+void Chuck_VM_Pool::detach()
+{
+    // nobody allocates from here on
+    m_owner.store( std::thread::id(), std::memory_order_relaxed );
+    // drop the owner's reference
+    unref();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: unref()
+// desc: drop a reference; deletes the pool on the last one
+//-----------------------------------------------------------------------------
+void Chuck_VM_Pool::unref()
+{
+    if( m_refs.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+        delete this;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: stats()
+// desc: get stats (call from the owner thread for exact numbers)
+//-----------------------------------------------------------------------------
+Chuck_VM_Pool_Stats Chuck_VM_Pool::stats() const
+{
+    Chuck_VM_Pool_Stats s;
+    s.allocs = m_allocs;
+    s.heap_allocs = m_heap_allocs.load( std::memory_order_relaxed );
+    // refs held by blocks in use (plus 1 until detached)
+    s.live = m_refs.load( std::memory_order_relaxed ) - 1;
+    s.capacity = m_capacity;
+    s.slabs = m_slabs.size();
+    return s;
+}
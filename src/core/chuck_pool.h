@@ -0,0 +1,150 @@
+/*----------------------------------------------------------------------------
+  ChucK Concurrent, On-the-fly Audio Programming Language
+    Compiler and Virtual Machine
+
+  Copyright (c) 2004 Ge Wang and Perry R. Cook.  All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+  U.S.A.
+-----------------------------------------------------------------------------*/
+
+
+//-----------------------------------------------------------------------------
+// file: chuck_pool.h
+// desc: size-class memory pool for VM objects and their data blocks
+//
+//       each VM owns a pool; blocks of up to CK_POOL_MAX_SIZE bytes are
+//       carved from slabs, one free list per size class (multiples of
+//       CK_POOL_ALIGN), so that instantiating and freeing objects on the
+//       VM thread doesn't go through the general-purpose heap; only the
+//       owner thread (the one running the VM) allocates from the pool,
+//       other threads get heap blocks; any thread may free: the owner
+//       onto its own free list, others onto a lock-free list the owner
+//       takes back on its next miss
+//
+//       every block, pooled or not, has a small header recording where
+//       it came from, so Chuck_VM_Pool::free() needs neither the size
+//       nor the pool
+//-----------------------------------------------------------------------------
+#ifndef __CHUCK_POOL_H__
+#define __CHUCK_POOL_H__
+
+#include "chuck_def.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+// block alignment and size class granularity (bytes)
+#define CK_POOL_ALIGN               16
+// largest block served from the pool (bytes); larger go to the heap
+#define CK_POOL_MAX_SIZE            512
+// number of size classes
+#define CK_POOL_NUM_CLASSES         (CK_POOL_MAX_SIZE / CK_POOL_ALIGN)
+// bytes per slab
+#define CK_POOL_SLAB_SIZE           (64 * 1024)
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_VM_Pool_Stats
+// desc: pool counters
+//-----------------------------------------------------------------------------
+struct Chuck_VM_Pool_Stats
+{
+    // blocks allocated from the pool
+    t_CKUINT allocs;
+    // blocks allocated from the heap (too large, or not the owner thread)
+    t_CKUINT heap_allocs;
+    // pool blocks in use, and the number of blocks the slabs hold
+    t_CKUINT live;
+    t_CKUINT capacity;
+    // slabs allocated
+    t_CKUINT slabs;
+
+    // constructor
+    Chuck_VM_Pool_Stats() : allocs(0), heap_allocs(0), live(0), capacity(0), slabs(0) { }
+    // fraction of slab blocks in use
+    t_CKFLOAT occupancy() const { return capacity ? (t_CKFLOAT)live / capacity : 0; }
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_VM_Pool
+// desc: size-class memory pool
+//-----------------------------------------------------------------------------
+struct Chuck_VM_Pool
+{
+public:
+    // constructor
+    Chuck_VM_Pool();
+
+public:
+    // allocate `size` bytes (aligned to CK_POOL_ALIGN); from the pool if
+    // called on the owner thread and small enough, else from the heap
+    void * alloc( t_CKUINT size );
+    // allocate `size` bytes from the heap, freeable with free()
+    static void * heap_alloc( t_CKUINT size );
+    // free a block from alloc() or heap_alloc(); NULL is ok
+    static void free( void * ptr );
+
+public:
+    // make the calling thread the owner (e.g., the VM's audio thread)
+    void set_owner() { m_owner.store( std::this_thread::get_id(), std::memory_order_relaxed ); }
+    // is the calling thread the owner?
+    t_CKBOOL is_owner() const { return m_owner.load( std::memory_order_relaxed ) == std::this_thread::get_id(); }
+    // let go of the pool; it is deleted once all its blocks are freed
+    void detach();
+    // get stats
+    Chuck_VM_Pool_Stats stats() const;
+
+protected:
+    // only via detach()/free()
+    ~Chuck_VM_Pool();
+    // give back a block (any thread)
+    void give_back( void * block, t_CKUINT sclass );
+    // drop a reference; deletes the pool on the last one
+    void unref();
+    // refill a size class from a new slab (owner only)
+    t_CKBOOL refill( t_CKUINT sclass );
+
+protected:
+    // a free block (overlays the block's header and payload)
+    struct Free { Free * next; };
+    // owner's free lists
+    Free * m_free[CK_POOL_NUM_CLASSES];
+    // free lists pushed by other threads
+    std::atomic<Free *> m_remote[CK_POOL_NUM_CLASSES];
+    // owner thread
+    std::atomic<std::thread::id> m_owner;
+    // slabs, freed with the pool
+    std::vector<void *> m_slabs;
+    // 1 (until detached) + number of pool blocks in use
+    std::atomic<t_CKUINT> m_refs;
+    // stats
+    t_CKUINT m_allocs;
+    std::atomic<t_CKUINT> m_heap_allocs;
+    t_CKUINT m_capacity;
+};
+
+
+
+
+#endif
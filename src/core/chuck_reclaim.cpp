@@ -0,0 +1,210 @@
+/*----------------------------------------------------------------------------
+  ChucK Concurrent, On-the-fly Audio Programming Language
+    Compiler and Virtual Machine
+
+  Copyright (c) 2004 Ge Wang and Perry R. Cook.  All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+  U.S.A.
+-----------------------------------------------------------------------------*/
+
+
+//-----------------------------------------------------------------------------
+// file: chuck_reclaim.cpp
+// desc: deferred reclamation of VM objects
+//-----------------------------------------------------------------------------
+#include "chuck_reclaim.h"
+#include "chuck_oo.h"
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: Chuck_VM_Reclaimer()
+// desc: constructor
+//-----------------------------------------------------------------------------
+Chuck_VM_Reclaimer::Chuck_VM_Reclaimer( t_CKUINT budget )
+    : m_tail(0), m_head(0), m_now(0), m_deferred(0), m_overflowed(0)
+{
+    // power of 2 slots
+    m_cells = new Cell[CK_RECLAIM_QUEUE_SIZE];
+    m_mask = CK_RECLAIM_QUEUE_SIZE - 1;
+    // each slot is free for its first position
+    for( t_CKUINT i = 0; i < CK_RECLAIM_QUEUE_SIZE; i++ )
+    {
+        m_cells[i].seq.store( i, std::memory_order_relaxed );
+        m_cells[i].obj = NULL;
+        m_cells[i].when = 0;
+    }
+
+    set_budget( budget );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ~Chuck_VM_Reclaimer()
+// desc: destructor
+//-----------------------------------------------------------------------------
+Chuck_VM_Reclaimer::~Chuck_VM_Reclaimer()
+{
+    flush();
+    CK_SAFE_DELETE_ARRAY( m_cells );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: defer()
+// desc: queue an object for deletion; FALSE if the queue is full
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_VM_Reclaimer::defer( Chuck_VM_Object * obj )
+{
+    t_CKUINT pos = m_tail.load( std::memory_order_relaxed );
+    Cell * cell = NULL;
+
+    // claim a position
+    for( ;; )
+    {
+        cell = &m_cells[pos & m_mask];
+        t_CKUINT seq = cell->seq.load( std::memory_order_acquire );
+        t_CKINT diff = (t_CKINT)seq - (t_CKINT)pos;
+        // free for this position; try to take it
+        if( diff == 0 )
+        {
+            if( m_tail.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+                break;
+        }
+        // still filled from the last time around: full
+        else if( diff < 0 )
+        {
+            m_overflowed.fetch_add( 1, std::memory_order_relaxed );
+            return FALSE;
+        }
+        // another thread took it; try again
+        else pos = m_tail.load( std::memory_order_relaxed );
+    }
+
+    // fill it, and publish
+    cell->obj = obj;
+    cell->when = (t_CKTIME)m_now.load( std::memory_order_relaxed );
+    cell->seq.store( pos + 1, std::memory_order_release );
+    m_deferred.fetch_add( 1, std::memory_order_relaxed );
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: pop()
+// desc: take the next object off the queue (VM thread only)
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_VM_Reclaimer::pop( Chuck_VM_Object * & obj, t_CKTIME & when )
+{
+    Cell * cell = &m_cells[m_head & m_mask];
+    // not filled (yet)
+    if( cell->seq.load( std::memory_order_acquire ) != m_head + 1 ) return FALSE;
+
+    obj = cell->obj;
+    when = cell->when;
+    cell->obj = NULL;
+    // free for the next time around
+    cell->seq.store( m_head + m_mask + 1, std::memory_order_release );
+    m_head++;
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: depth()
+// desc: objects in the queue right now
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_VM_Reclaimer::depth() const
+{
+    return m_tail.load( std::memory_order_relaxed ) - m_head;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: reclaim()
+// desc: delete up to `max` queued objects (0: the budget)
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_VM_Reclaimer::reclaim( t_CKTIME now, t_CKUINT max )
+{
+    // how many this time
+    if( !max ) max = m_budget;
+
+    Chuck_VM_Object * obj = NULL;
+    t_CKTIME when = 0;
+    t_CKUINT n = 0;
+
+    // depth before
+    m_stats.depth = depth();
+    if( m_stats.depth > m_stats.depth_max ) m_stats.depth_max = m_stats.depth;
+
+    // delete, oldest first; objects these release go to the back
+    while( n < max && pop( obj, when ) )
+    {
+        t_CKDUR latency = now - when;
+        if( latency > m_stats.latency_max ) m_stats.latency_max = latency;
+        m_stats.latency_total += latency;
+        delete obj;
+        n++;
+    }
+
+    // update
+    m_stats.reclaimed += n;
+    m_stats.deferred = m_deferred.load( std::memory_order_relaxed );
+    m_stats.overflowed = m_overflowed.load( std::memory_order_relaxed );
+    // timestamp for objects queued from here on
+    m_now.store( (t_CKUINT)now, std::memory_order_relaxed );
+
+    return n;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: flush()
+// desc: delete everything queued, including objects queued meanwhile
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_VM_Reclaimer::flush()
+{
+    Chuck_VM_Object * obj = NULL;
+    t_CKTIME when = 0;
+    t_CKUINT n = 0;
+
+    while( pop( obj, when ) ) { delete obj; n++; }
+
+    // update
+    m_stats.reclaimed += n;
+    m_stats.deferred = m_deferred.load( std::memory_order_relaxed );
+    m_stats.overflowed = m_overflowed.load( std::memory_order_relaxed );
+    m_stats.depth = 0;
+
+    return n;
+}
@@ -0,0 +1,153 @@
+/*----------------------------------------------------------------------------
+  ChucK Concurrent, On-the-fly Audio Programming Language
+    Compiler and Virtual Machine
+
+  Copyright (c) 2004 Ge Wang and Perry R. Cook.  All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+  U.S.A.
+-----------------------------------------------------------------------------*/
+
+
+//-----------------------------------------------------------------------------
+// file: chuck_reclaim.h
+// desc: deferred reclamation of VM objects
+//
+//       when enabled, a runtime object (see Chuck_VM_Object::reclaimable())
+//       whose reference count drops to 0 is not deleted on the spot (see
+//       Chuck_VM_Object::release()) but put on the lock-free queue of the
+//       VM it came from (Chuck_Object::originVM()), and deleted later by
+//       that VM, a bounded number per block; objects
+//       released by those deletions are queued in turn, so freeing a large
+//       array of objects or a whole UGen graph is spread over several
+//       blocks instead of stalling one audio callback
+//-----------------------------------------------------------------------------
+#ifndef __CHUCK_RECLAIM_H__
+#define __CHUCK_RECLAIM_H__
+
+#include "chuck_def.h"
+#include <atomic>
+
+
+// number of objects the reclaim queue holds; objects released while it
+// is full are deleted right away
+#define CK_RECLAIM_QUEUE_SIZE        (0x1 << 16)
+// default number of objects deleted per block
+#define CK_RECLAIM_BUDGET            256
+
+
+// forward reference
+struct Chuck_VM_Object;
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_VM_Reclaim_Stats
+// desc: what the reclaimer has done so far
+//-----------------------------------------------------------------------------
+struct Chuck_VM_Reclaim_Stats
+{
+    // objects queued for deletion
+    t_CKUINT deferred;
+    // objects deleted from the queue
+    t_CKUINT reclaimed;
+    // objects deleted right away because the queue was full
+    t_CKUINT overflowed;
+    // objects currently in the queue, and the most there have been
+    t_CKUINT depth;
+    t_CKUINT depth_max;
+    // time from queueing to deletion, in samples (to the block): most and total
+    t_CKDUR latency_max;
+    t_CKDUR latency_total;
+
+    // constructor
+    Chuck_VM_Reclaim_Stats() : deferred(0), reclaimed(0), overflowed(0), depth(0),
+        depth_max(0), latency_max(0), latency_total(0) { }
+    // average latency, in samples
+    t_CKDUR latency_avg() const { return reclaimed ? latency_total / reclaimed : 0; }
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_VM_Reclaimer
+// desc: queue of objects waiting to be deleted; any thread may defer(), but
+//       only one (the VM's) may reclaim()
+//-----------------------------------------------------------------------------
+struct Chuck_VM_Reclaimer
+{
+public:
+    // constructor
+    Chuck_VM_Reclaimer( t_CKUINT budget = CK_RECLAIM_BUDGET );
+    // destructor; deletes everything still queued
+    ~Chuck_VM_Reclaimer();
+
+public:
+    // queue an object for deletion; FALSE if the queue is full (in which
+    // case the caller should delete it)
+    t_CKBOOL defer( Chuck_VM_Object * obj );
+    // delete up to `max` queued objects (0: the budget); `now` is the VM's
+    // time, used to measure latency; returns number deleted
+    t_CKUINT reclaim( t_CKTIME now, t_CKUINT max = 0 );
+    // delete everything queued, including objects queued meanwhile
+    t_CKUINT flush();
+
+public:
+    // set/get the number of objects deleted per reclaim()
+    void set_budget( t_CKUINT budget ) { m_budget = budget ? budget : 1; }
+    t_CKUINT budget() const { return m_budget; }
+    // get stats (depth as of the last reclaim())
+    const Chuck_VM_Reclaim_Stats & stats() const { return m_stats; }
+    // objects in the queue right now
+    t_CKUINT depth() const;
+
+protected:
+    // take the next object off the queue; FALSE if empty
+    t_CKBOOL pop( Chuck_VM_Object * & obj, t_CKTIME & when );
+
+protected:
+    // a slot in the queue; seq tells whether it's free or filled for a
+    // given position (bounded multi-producer queue, after D. Vyukov)
+    struct Cell
+    {
+        std::atomic<t_CKUINT> seq;
+        Chuck_VM_Object * obj;
+        t_CKTIME when;
+    };
+    Cell * m_cells;
+    t_CKUINT m_mask;
+    // next position to fill (any thread) and to take (VM thread only)
+    std::atomic<t_CKUINT> m_tail;
+    t_CKUINT m_head;
+    // the VM's time as of the last reclaim(), for timestamping
+    std::atomic<t_CKUINT> m_now;
+    // objects deferred, counted by producers
+    std::atomic<t_CKUINT> m_deferred;
+    std::atomic<t_CKUINT> m_overflowed;
+
+    // objects deleted per reclaim()
+    t_CKUINT m_budget;
+    // stats
+    Chuck_VM_Reclaim_Stats m_stats;
+};
+
+
+
+
+#endif
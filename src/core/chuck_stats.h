@@ -80,6 +80,9 @@ struct Shred_Stat
 public:
     // instructions computed
     t_CKUINT cycles;
+    // member function lookups answered by / missing the inline cache | 1.5.1.7
+    t_CKUINT ic_hits;
+    t_CKUINT ic_misses;
     // shred id
     t_CKUINT xid;
     // parent
@@ -141,6 +144,7 @@ public:
     Shred_Stat() { this->clear(); num_diffs = 8; data = NULL; time = NULL; }
     void clear()
     { xid = 0; parent = 0; state = 0; cycles = 0; activations = 0;
+      ic_hits = 0; ic_misses = 0;
       average_ctrl = 0.0; spork_time = 0.0; active_time = 0.0; wake_time = 0.0;
       free_time = 0.0; name = "no name"; owner = "none"; source = "nowhere";
       while( diffs.size() ) diffs.pop(); diff_total = 0.0;
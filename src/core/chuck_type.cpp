@@ -568,6 +568,8 @@ t_CKBOOL type_engine_init( Chuck_Carrier * carrier )
     init_class_vec3( env, env->ckt_vec3 ); // 1.3.5.3
     init_class_vec4( env, env->ckt_vec4 ); // 1.3.5.3
     init_class_function(env, env->ckt_function ); // 1.5.0.0
+    init_class_deque( env ); // 1.5.1.7
+    init_class_stringbuilder( env ); // 1.5.1.7
 
     // initialize primitive types
     init_primitive_types( env );
@@ -6303,11 +6305,15 @@ Chuck_Type * type_engine_import_ugen_begin( Chuck_Env * env, const char * name,
     info->add_ref();
     info->tick = type->parent->ugen_info->tick;
     info->tickf = type->parent->ugen_info->tickf; // added 1.3.0.0
+    info->tickv = type->parent->ugen_info->tickv; // added 1.5.1.7
+    info->concurrent = type->parent->ugen_info->concurrent; // added 1.5.1.7
     info->pmsg = type->parent->ugen_info->pmsg;
     info->num_ins = type->parent->ugen_info->num_ins;
     info->num_outs = type->parent->ugen_info->num_outs;
-    if( tick ) info->tick = tick;
-    if( tickf ) { info->tickf = tickf; info->tick = NULL; } // added 1.3.0.0
+    // a new tick replaces the parent's block tick (see import_ugen_tickv()),
+    // and must be marked concurrent on its own (see import_ugen_concurrent())
+    if( tick ) { info->tick = tick; info->tickv = NULL; info->concurrent = FALSE; }
+    if( tickf ) { info->tickf = tickf; info->tick = NULL; info->tickv = NULL; info->concurrent = FALSE; } // added 1.3.0.0
     if( pmsg ) info->pmsg = pmsg;
     if( num_ins != CK_NO_VALUE ) info->num_ins = num_ins;
     if( num_outs != CK_NO_VALUE ) info->num_outs = num_outs;
@@ -6357,6 +6363,66 @@ Chuck_Type * type_engine_import_ugen_begin( Chuck_Env * env, const char * name,
 
 
 
+//-----------------------------------------------------------------------------
+// name: type_engine_import_ugen_tickv() | 1.5.1.7
+// desc: add a block tick to the ugen being imported, used in place of its
+//       tick when the VM computes more than one frame at a time (adaptive);
+//       subclasses inherit it, unless they supply their own tick
+//-----------------------------------------------------------------------------
+t_CKBOOL type_engine_import_ugen_tickv( Chuck_Env * env, f_tickv tickv )
+{
+    // make sure we are in a ugen
+    if( !env->class_def || !env->class_def->ugen_info )
+    {
+        // error
+        EM_error2( 0, "import error: import_ugen_tickv invoked outside ugen begin/end" );
+        return FALSE;
+    }
+
+    // a block tick goes with a (mono) tick
+    if( !env->class_def->ugen_info->tick )
+    {
+        // error
+        EM_error2( 0, "import error: import_ugen_tickv: '%s' has no tick",
+                   env->class_def->c_name() );
+        return FALSE;
+    }
+
+    env->class_def->ugen_info->tickv = tickv;
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: type_engine_import_ugen_concurrent() | 1.5.1.7
+// desc: mark the ugen being imported as safe to tick on another thread,
+//       alongside other ugens, when the VM renders with more than one
+//       (see Chuck_UGen_Schedule); its tick (and tickv/tickf) must touch
+//       only the ugen's own data -- no shared state, no random numbers, no
+//       calls into the VM; subclasses inherit it, unless they supply their
+//       own tick
+//-----------------------------------------------------------------------------
+t_CKBOOL type_engine_import_ugen_concurrent( Chuck_Env * env )
+{
+    // make sure we are in a ugen
+    if( !env->class_def || !env->class_def->ugen_info )
+    {
+        // error
+        EM_error2( 0, "import error: import_ugen_concurrent invoked outside ugen begin/end" );
+        return FALSE;
+    }
+
+    env->class_def->ugen_info->concurrent = TRUE;
+
+    return TRUE;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: type_engine_import_uana_begin()
 // desc: ...
@@ -8916,6 +8982,7 @@ Chuck_Type::Chuck_Type( Chuck_Env * env, te_Type _id, const std::string & _n,
     has_constructor = FALSE;
     has_destructor = FALSE;
     allocator = NULL;
+    m_obj_mvars_ready = FALSE;
 
     // default
     originHint = te_originUnknown;
@@ -8953,6 +9020,8 @@ void Chuck_Type::reset()
     size = array_depth = obj_size = 0;
     is_copy = FALSE;
     has_destructor = FALSE;
+    m_obj_mvars.clear();
+    m_obj_mvars_ready = FALSE;
 
     // free only if not locked: to prevent garbage collection after exit
     if( !this->m_locked )
@@ -9030,6 +9099,44 @@ Chuck_Type * Chuck_Type::copy( Chuck_Env * env, Chuck_Context * context ) const
 
 
 
+//-----------------------------------------------------------------------------
+// name: obj_mvars() | 1.5.1.7
+// desc: offsets of the object references declared in this class in ChucK
+//       code; native classes manage their own (through their destructors)
+//-----------------------------------------------------------------------------
+const std::vector<t_CKUINT> & Chuck_Type::obj_mvars()
+{
+    // already figured out
+    if( m_obj_mvars_ready ) return m_obj_mvars;
+
+    // clear
+    m_obj_mvars.clear();
+    // only classes defined in ChucK code (their pre-constructors aren't native)
+    if( !info || !info->pre_ctor || info->pre_ctor->native_func ) return m_obj_mvars;
+
+    // values declared in this class
+    vector<Chuck_Value *> vars;
+    info->get_values( vars );
+    for( t_CKUINT i = 0; i < vars.size(); i++ )
+    {
+        Chuck_Value * value = vars[i];
+        // member object references only
+        if( !value || !value->type || !value->is_member || value->is_static ) continue;
+        if( value->func_ref || value->name.length() == 0 || value->name[0] == '@' ) continue;
+        if( isfunc( env_ref, value->type ) || !isobj( env_ref, value->type ) ) continue;
+        // the offset into the object data
+        m_obj_mvars.push_back( value->offset );
+    }
+
+    // members can still be added until the class is complete
+    m_obj_mvars_ready = is_complete;
+
+    return m_obj_mvars;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: name()
 // desc: get the full name of this type, e.g., "UGen" or "int[][]"
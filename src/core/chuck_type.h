@@ -802,6 +802,11 @@ struct Chuck_UGen_Info : public Chuck_VM_Object
     f_tick tick;
     // multichannel/vector tick function pointer (added 1.3.0.0)
     f_tickf tickf;
+    // mono block tick function pointer; optional, with tick | 1.5.1.7
+    f_tickv tickv;
+    // whether instances may be ticked on another thread, alongside other
+    // ugens (see type_engine_import_ugen_concurrent()) | 1.5.1.7
+    t_CKBOOL concurrent;
     // pmsg function pointer
     f_pmsg pmsg;
     // number of incoming channels
@@ -818,7 +823,7 @@ struct Chuck_UGen_Info : public Chuck_VM_Object
 
     // constructor
     Chuck_UGen_Info()
-    { tick = NULL; tickf = NULL; pmsg = NULL; num_ins = num_outs = 1;
+    { tick = NULL; tickf = NULL; tickv = NULL; concurrent = FALSE; pmsg = NULL; num_ins = num_outs = 1;
       tock = NULL; num_ins_ana = num_outs_ana = 1; }
 };
 
@@ -978,6 +983,13 @@ public:
     const Chuck_Type & operator =( const Chuck_Type & rhs );
     // make a copy of this type struct
     Chuck_Type * copy( Chuck_Env * env, Chuck_Context * context ) const;
+    // part of the type system; delete right away | 1.5.1.7
+    virtual t_CKBOOL reclaimable() const { return FALSE; }
+
+public:
+    // offsets of object references declared in this class (not parents)
+    // in ChucK code; these are released when an instance is deleted | 1.5.1.7
+    const std::vector<t_CKUINT> & obj_mvars();
 
 public:
     // to string: the full name of this type, e.g., "UGen" or "int[][]"
@@ -1034,6 +1046,9 @@ public:
 protected:
     // vector of callbacks on instantiation of this type (or its subclass)
     std::vector<CallbackOnInstantiate> m_cbs_on_instantiate;
+    // cached member object offsets (see obj_mvars()) | 1.5.1.7
+    std::vector<t_CKUINT> m_obj_mvars;
+    t_CKBOOL m_obj_mvars_ready;
     // internal get vector of callbacks (including this and parents), return whether any requires setShredOrigin
     t_CKBOOL do_cbs_on_instantiate( std::vector<CallbackOnInstantiate> & results );
 };
@@ -1259,6 +1274,12 @@ Chuck_Type * type_engine_import_ugen_begin( Chuck_Env * env, const char * name,
 Chuck_Type * type_engine_import_ugen_begin( Chuck_Env * env, const char * name, const char * parent,
                                             Chuck_Namespace * where, f_ctor pre_ctor, f_dtor dtor,
                                             f_tick tick, f_pmsg pmsg,  const char * doc );
+// add a block tick to the ugen being imported; must compute the same as
+// its tick, called once per frame | 1.5.1.7
+t_CKBOOL type_engine_import_ugen_tickv( Chuck_Env * env, f_tickv tickv );
+// mark the ugen being imported as safe to tick on another thread, alongside
+// other ugens: its tick touches only its own data, and never the VM | 1.5.1.7
+t_CKBOOL type_engine_import_ugen_concurrent( Chuck_Env * env );
 Chuck_Type * type_engine_import_uana_begin( Chuck_Env * env, const char * name, const char * parent,
                                             Chuck_Namespace * where, f_ctor pre_ctor, f_dtor dtor,
                                             f_tick tick, f_tock tock, f_pmsg pmsg,
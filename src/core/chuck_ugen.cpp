@@ -39,6 +39,13 @@
 #include "chuck_vm.h"
 #include "chuck_lang.h"
 #include "chuck_errmsg.h"
+#ifndef __DISABLE_THREADS__
+#include "util_platforms.h"
+#include <thread>
+#endif
+
+#include <map>
+#include <algorithm>
 using namespace std;
 
 
@@ -148,6 +155,21 @@ t_CKBOOL fa_lookup( Chuck_UGen ** base, t_CKUINT size, const Chuck_UGen * value
 
 
 
+//-----------------------------------------------------------------------------
+// name: ugen_graph_changed() | 1.5.1.7
+// desc: connections made or broken (or a ugen gone): bump the graph version
+//       of the VM the ugens belong to, so its schedule recompiles
+//-----------------------------------------------------------------------------
+static void ugen_graph_changed( Chuck_UGen * ugen, Chuck_UGen * other = NULL )
+{
+    Chuck_VM * vm = ugen->originVM();
+    if( !vm && other ) vm = other->originVM();
+    if( vm ) vm->graph_changed();
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: Chuck_UGen()
 // desc: constructor
@@ -180,6 +202,7 @@ void Chuck_UGen::init()
 {
     tick = NULL;
     tickf = NULL; // added 1.3.0.0
+    tickv = NULL; // added 1.5.1.7
     pmsg = NULL;
     m_multi_chan = NULL;
     m_multi_chan_size = 0;
@@ -227,6 +250,9 @@ void Chuck_UGen::init()
     m_is_buffered = FALSE;
     // buffer empty for any ugen that is not buffered
     m_buffer.resize( 0 );
+
+    // not yet in any schedule | 1.5.1.7
+    m_schedule_mark = 0;
 }
 
 
@@ -246,6 +272,8 @@ void Chuck_UGen::done()
     // disconnect
     this->disconnect( TRUE );
     m_valid = FALSE;
+    // no schedule may keep this | 1.5.1.7
+    ugen_graph_changed( this );
 
     fa_done( m_src_list, m_src_cap );
     fa_done( m_dest_list, m_dest_cap );
@@ -290,6 +318,10 @@ t_CKBOOL Chuck_UGen::alloc_v( t_CKUINT size )
     {
         m_sum_v = new SAMPLE[size];
         m_current_v = new SAMPLE[size];
+        // silence, as m_current starts out; read before this ugen's first
+        // block when it is in a feedback loop | 1.5.1.7
+        memset( m_sum_v, 0, size * sizeof(SAMPLE) );
+        memset( m_current_v, 0, size * sizeof(SAMPLE) );
 
         return ( m_sum_v != NULL && m_current_v != NULL );
     }
@@ -500,6 +532,8 @@ t_CKBOOL Chuck_UGen::add( Chuck_UGen * src, t_CKBOOL isUpChuck )
         // append
         fa_push_back( m_src_list, m_src_cap, m_num_src, src );
         m_num_src++;
+        // connections changed | 1.5.1.7
+        ugen_graph_changed( this, src );
         src->add_ref();
         src->add_by( this, isUpChuck );
 
@@ -637,6 +671,8 @@ t_CKBOOL Chuck_UGen::remove( Chuck_UGen * src )
                     m_src_list[j-1] = m_src_list[j];
 
                 m_src_list[--m_num_src] = NULL;
+                // connections changed | 1.5.1.7
+                ugen_graph_changed( this, src );
                 src->remove_by( this );
                 src->release();
                 --k;
@@ -757,6 +793,8 @@ void Chuck_UGen::remove_all( )
         {
             // TODO: figure out why this is necessary!
 
+            // connections changed | 1.5.1.7
+            ugen_graph_changed( this, m_src_list[0] );
             // get rid of it, but don't release
             for( t_CKUINT j = 1; j < m_num_src; j++ )
                 m_src_list[j-1] = m_src_list[j];
@@ -857,7 +895,7 @@ t_CKBOOL Chuck_UGen::is_connected_from( Chuck_UGen * src )
 
 //-----------------------------------------------------------------------------
 // name: tick()
-// dsec: ...
+// dsec: pull upstream ugens (recursively), then sum and synthesize
 //-----------------------------------------------------------------------------
 t_CKBOOL Chuck_UGen::system_tick( t_CKTIME now )
 {
@@ -865,12 +903,54 @@ t_CKBOOL Chuck_UGen::system_tick( t_CKTIME now )
         return m_valid;
 
     t_CKUINT i;
-    Chuck_UGen * ugen = NULL;
-    SAMPLE multi;
 
     // part 1: tick upstream ugens
     // inc time
     m_time = now;
+    // tick the src list
+    for( i = 0; i < m_num_src; i++ )
+        if( m_src_list[i]->m_time < now ) m_src_list[i]->system_tick( now );
+    // tick sub-ugens for individual channels
+    for( i = 0; i < m_multi_chan_size; i++ )
+        if( m_multi_chan[i]->m_time < now ) m_multi_chan[i]->system_tick( now );
+    // sum them
+    system_sum();
+
+    // if owner (i.e., this ugen is one of the channels in a multi-channel ugen)
+    if( owner != NULL && owner->m_time < now )
+    {
+        // tick the owner
+        owner->system_tick( now );
+
+        // if the owner has a multichannel tick function (added 1.3.0.0)
+        if( owner->tickf )
+        {
+            // set the latest to the current
+            m_last = m_current;
+            // done, don't want multi-channel subchannels to synthesize
+            // it should be taken care of in the owner (added 1.3.0.0)
+            return TRUE;
+        }
+    }
+
+    // part 2: synthesize with tick function
+    return system_synth();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: system_sum()
+// desc: sum inputs, which have been ticked already (or are being ticked,
+//       in a feedback loop) | 1.5.1.7 (was part of system_tick())
+//-----------------------------------------------------------------------------
+void Chuck_UGen::system_sum()
+{
+    t_CKUINT i;
+    Chuck_UGen * ugen = NULL;
+    SAMPLE multi;
+
     // initial sum
     m_sum = 0.0f;
     // NOTE: if this UGen has more than one input channel:
@@ -880,14 +960,12 @@ t_CKBOOL Chuck_UGen::system_tick( t_CKTIME now )
     if( m_num_src )
     {
         ugen = m_src_list[0];
-        if( ugen->m_time < now ) ugen->system_tick( now );
         m_sum = ugen->m_current;
 
-        // tick the src list
+        // sum the src list
         for( i = 1; i < m_num_src; i++ )
         {
             ugen = m_src_list[i];
-            if( ugen->m_time < now ) ugen->system_tick( now );
             if( ugen->m_valid )
             {
                 if( m_op <= 1 )
@@ -906,20 +984,16 @@ t_CKBOOL Chuck_UGen::system_tick( t_CKTIME now )
         }
     }
 
-    // tick multiple channels
+    // multiple channels
     multi = 0.0f;
     if( m_multi_chan_size )
     {
         // spencer 2012 - use multichannel tick function (added 1.3.0.0)
         if( tickf )
         {
-            // system tick each input channel (added 1.3.0.0)
             for( i = 0; i < m_multi_chan_size; i++ )
             {
                 ugen = m_multi_chan[i];
-                // tick sub-ugens for individual channels
-                if( ugen->m_time < now )
-                    ugen->system_tick( now );
                 // set to tickf input
                 // TODO: if op is not 1?
                 // 1.5.0.0 (nshaheed + ge) | why m_sum + ugen->m_sum?
@@ -935,7 +1009,6 @@ t_CKBOOL Chuck_UGen::system_tick( t_CKTIME now )
             for( i = 0; i < m_multi_chan_size; i++ )
             {
                 ugen = m_multi_chan[i];
-                if( ugen->m_time < now ) ugen->system_tick( now );
                 // multiple channels are added
                 multi += ugen->m_current;
             }
@@ -945,25 +1018,21 @@ t_CKBOOL Chuck_UGen::system_tick( t_CKTIME now )
             m_sum += multi;
         }
     }
+}
 
-    // if owner (i.e., this ugen is one of the channels in a multi-channel ugen)
-    if( owner != NULL && owner->m_time < now )
-    {
-        // tick the owner
-        owner->system_tick( now );
 
-        // if the owner has a multichannel tick function (added 1.3.0.0)
-        if( owner->tickf )
-        {
-            // set the latest to the current
-            m_last = m_current;
-            // done, don't want multi-channel subchannels to synthesize
-            // it should be taken care of in the owner (added 1.3.0.0)
-            return TRUE;
-        }
-    }
 
-    // part 2: synthesize with tick function
+
+//-----------------------------------------------------------------------------
+// name: system_synth()
+// desc: synthesize from the sum | 1.5.1.7 (was part of system_tick())
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_UGen::system_synth()
+{
+    t_CKUINT i;
+    Chuck_UGen * ugen = NULL;
+    SAMPLE multi;
+
     if( m_multi_chan_size && tickf )
     {
         // evaluate multi-channel tickf (added 1.3.0.0)
@@ -1069,33 +1138,70 @@ t_CKBOOL Chuck_UGen::system_tick( t_CKTIME now )
 
 //-----------------------------------------------------------------------------
 // name: tick_v()
-// dsec: ...
+// dsec: pull upstream ugens (recursively), then sum and synthesize a block
 //-----------------------------------------------------------------------------
 t_CKBOOL Chuck_UGen::system_tick_v( t_CKTIME now, t_CKUINT numFrames )
 {
     if( m_time >= now )
         return m_valid;
 
-    t_CKUINT i, j;
-    Chuck_UGen * ugen = NULL;
-    SAMPLE factor;
-    SAMPLE multi;
+    t_CKUINT i;
 
     // inc time
     m_time = now;
 
     // part 1: tick upstream ugens
+    for( i = 0; i < m_num_src; i++ )
+        if( m_src_list[i]->m_time < now ) m_src_list[i]->system_tick_v( now, numFrames );
+    // tick sub-ugens for individual channels
+    for( i = 0; i < m_multi_chan_size; i++ )
+        if( m_multi_chan[i]->m_time < now ) m_multi_chan[i]->system_tick_v( now, numFrames );
+    // sum them
+    system_sum_v( numFrames );
+
+    // if owner
+    if( owner != NULL && owner->m_time < now )
+    {
+        owner->system_tick_v( now, numFrames );
+
+        // if the owner has a multichannel tick function (added 1.3.0.0)
+        if( owner->tickf )
+        {
+            // set the latest to the current
+            m_last = m_current_v[numFrames - 1];
+            // done, don't want multi-channel subchannels to synthesize
+            // it should be taken care of in the owner (added 1.3.0.0)
+            return TRUE;
+        }
+    }
+
+    // part 2: synthesize with tick function
+    return system_synth_v( numFrames );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: system_sum_v()
+// desc: sum a block of inputs, which have been ticked already (or are being
+//       ticked, in a feedback loop) | 1.5.1.7 (was part of system_tick_v())
+//-----------------------------------------------------------------------------
+void Chuck_UGen::system_sum_v( t_CKUINT numFrames )
+{
+    t_CKUINT i, j;
+    Chuck_UGen * ugen = NULL;
+    SAMPLE factor;
+
     if( m_num_src )
     {
         ugen = m_src_list[0];
-        if( ugen->m_time < now ) ugen->system_tick_v( now, numFrames );
         memcpy( m_sum_v, ugen->m_current_v, numFrames * sizeof(SAMPLE) );
 
-        // tick the src list
+        // sum the src list
         for( i = 1; i < m_num_src; i++ )
         {
             ugen = m_src_list[i];
-            if( ugen->m_time < now ) ugen->system_tick_v( now, numFrames );
             if( ugen->m_valid )
             {
                 if( m_op <= 1 )
@@ -1123,17 +1229,14 @@ t_CKBOOL Chuck_UGen::system_tick_v( t_CKTIME now, t_CKUINT numFrames )
         memset( m_sum_v, 0, numFrames * sizeof(SAMPLE) );
     }
 
-    // tick multiple channels
+    // multiple channels
     if( m_multi_chan_size )
     {
         if( tickf )
         {
-            // system tick each input channel (added 1.3.0.0)
             for( int c = 0; c < m_multi_chan_size; c++ )
             {
                 ugen = m_multi_chan[c];
-                // tick sub-ugens for individual channels
-                if( ugen->m_time < now ) ugen->system_tick_v( now, numFrames );
                 // set to tickf input
                 for( int f = 0; f < numFrames; f++ )
                 {
@@ -1150,30 +1253,27 @@ t_CKBOOL Chuck_UGen::system_tick_v( t_CKTIME now, t_CKUINT numFrames )
             for( i = 0; i < m_multi_chan_size; i++ )
             {
                 ugen = m_multi_chan[i];
-                if( ugen->m_time < now ) ugen->system_tick_v( now, numFrames );
                 for( j = 0; j < numFrames; j++ )
                     m_sum_v[j] += ugen->m_current_v[j] * factor;
             }
         }
     }
+}
 
-    // if owner
-    if( owner != NULL && owner->m_time < now )
-    {
-        owner->system_tick_v( now, numFrames );
 
-        // if the owner has a multichannel tick function (added 1.3.0.0)
-        if( owner->tickf )
-        {
-            // set the latest to the current
-            m_last = m_current_v[numFrames - 1];
-            // done, don't want multi-channel subchannels to synthesize
-            // it should be taken care of in the owner (added 1.3.0.0)
-            return TRUE;
-        }
-    }
 
-    // part 2: synthesize with tick function
+
+//-----------------------------------------------------------------------------
+// name: system_synth_v()
+// desc: synthesize a block from the sum | 1.5.1.7 (was part of system_tick_v())
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_UGen::system_synth_v( t_CKUINT numFrames )
+{
+    t_CKUINT j;
+    Chuck_UGen * ugen = NULL;
+    SAMPLE factor;
+    SAMPLE multi;
+
     if( m_multi_chan_size && tickf )
     {
         // evaluate multi-channel tick (added added 1.3.0.0)
@@ -1188,6 +1288,8 @@ t_CKBOOL Chuck_UGen::system_tick_v( t_CKTIME now, t_CKUINT numFrames )
 
             // precompute to save division
             factor = 1.0f / m_multi_chan_size;
+            // NOTE: gain/pan below are the last channel's, as they've been
+            ugen = m_multi_chan[m_multi_chan_size-1];
 
             // supply multichannel tick output to output channels (added 1.3.0.0)
             for( int f = 0; f < numFrames; f++ )
@@ -1258,7 +1360,10 @@ t_CKBOOL Chuck_UGen::system_tick_v( t_CKTIME now, t_CKUINT numFrames )
         if( m_op > 0 )  // UGEN_OP_TICK
         {
             // tick the ugen (Chuck_DL_Api::instance() added 1.3.0.0)
-            if( tick )
+            // the whole block at once, if it can | 1.5.1.7
+            if( tickv )
+                m_valid = tickv( this, m_sum_v, m_current_v, numFrames, Chuck_DL_Api::instance() );
+            else if( tick )
                 for( j = 0; j < numFrames; j++ ) // REFACTOR-2017: remove NULL shred
                     m_valid = tick( this, m_sum_v[j], &(m_current_v[j]), Chuck_DL_Api::instance() );
             if( !m_valid )
@@ -1370,6 +1475,766 @@ Chuck_UGen * Chuck_UGen::outlet()
 
 
 
+//-----------------------------------------------------------------------------
+// name: Chuck_UGen_Schedule()
+// desc: constructor
+//-----------------------------------------------------------------------------
+Chuck_UGen_Schedule::Chuck_UGen_Schedule()
+    : m_threads_wanted( 1 )
+{
+    // compile before first tick
+    m_vm = NULL;
+    m_version = (t_CKUINT)-1;
+    m_mark = 0;
+    m_node = -1;
+    // no workers yet
+    m_threads = 1;
+#ifndef __DISABLE_THREADS__
+    m_num_workers = 0;
+    m_quit = FALSE;
+    m_group_task = 0;
+    m_group_tasks = 0;
+    m_group_now = 0;
+    m_group_frames = 0;
+    m_ticket = 0;
+    m_done = 0;
+#endif
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ~Chuck_UGen_Schedule()
+// desc: destructor
+//-----------------------------------------------------------------------------
+Chuck_UGen_Schedule::~Chuck_UGen_Schedule()
+{
+    stop_workers();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: set_vm()
+// desc: the VM whose ugens these are
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::set_vm( Chuck_VM * vm )
+{
+    m_vm = vm;
+    // recompile
+    m_version = (t_CKUINT)-1;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: graph_version()
+// desc: the VM's graph version, bumped whenever connections among its ugens
+//       are made or broken, or one goes away
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_UGen_Schedule::graph_version() const
+{
+    return m_vm ? m_vm->graph_version() : 0;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: add_root()
+// desc: add a root, in the order they are to be ticked
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::add_root( Chuck_UGen * root )
+{
+    m_roots.push_back( root );
+    // recompile
+    m_version = (t_CKUINT)-1;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: add_ticked()
+// desc: a ugen (and its channels) the caller ticks itself, before tick(),
+//       e.g., adc; these are read as they are, never ticked here
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::add_ticked( Chuck_UGen * ugen )
+{
+    m_ticked.push_back( ugen );
+    // recompile
+    m_version = (t_CKUINT)-1;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: set_threads()
+// desc: how many threads tick_v() may use, counting the caller's (always
+//       1 without threads)
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::set_threads( t_CKUINT threads )
+{
+#ifndef __DISABLE_THREADS__
+    m_threads_wanted.store( threads ? threads : 1 );
+#endif
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: compile()
+// desc: flatten the graph, as it is now
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::compile()
+{
+    t_CKUINT i, j, sums = 0;
+
+    // as of now
+    m_version = graph_version();
+    // new mark
+    m_mark++;
+    // clear
+    m_entries.clear();
+    m_nodes.clear();
+    m_entry_node.clear();
+    m_node = -1;
+
+    // these count as ticked already (as with m_time set by the caller)
+    for( i = 0; i < m_ticked.size(); i++ )
+    {
+        m_ticked[i]->m_schedule_mark = m_mark;
+        for( j = 0; j < m_ticked[i]->m_multi_chan_size; j++ )
+            m_ticked[i]->m_multi_chan[j]->m_schedule_mark = m_mark;
+    }
+
+    // in the order they would be pulled
+    for( i = 0; i < m_roots.size(); i++ )
+        visit( m_roots[i] );
+
+    // so tick() doesn't allocate
+    for( i = 0; i < m_entries.size(); i++ )
+        if( m_entries[i].what == SCHEDULE_SUM ) sums++;
+    m_pending.clear();
+    m_pending.reserve( sums );
+
+    // how tick_v() goes about it
+    m_tasks.clear();
+    m_steps.clear();
+#ifndef __DISABLE_THREADS__
+    if( m_threads > 1 ) { partition(); return; }
+#endif
+    // everything, in order
+    Step all = { 0, m_entries.size(), 0, 0 };
+    m_steps.push_back( all );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: visit()
+// desc: add a ugen, after what it pulls; mirrors system_tick(), with
+//       m_schedule_mark standing in for m_time
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::visit( Chuck_UGen * ugen )
+{
+    t_CKUINT i;
+
+    // already added, or being visited (feedback): either way, read as is
+    if( ugen->m_schedule_mark == m_mark ) return;
+    ugen->m_schedule_mark = m_mark;
+
+    // a node for what this adds, within the one being visited
+    t_CKINT parent = m_node;
+    Node node = { m_entries.size(), 0, 0, parent };
+    m_node = (t_CKINT)m_nodes.size();
+    m_nodes.push_back( node );
+    if( parent >= 0 ) m_nodes[parent].children++;
+
+    // what it pulls
+    for( i = 0; i < ugen->m_num_src; i++ )
+        visit( ugen->m_src_list[i] );
+    for( i = 0; i < ugen->m_multi_chan_size; i++ )
+        visit( ugen->m_multi_chan[i] );
+
+    // a channel that pulls its owner: sum, then the owner, then synthesize
+    // (unless the owner synthesizes for its channels)
+    if( ugen->owner != NULL && ugen->owner->m_schedule_mark != m_mark )
+    {
+        add( ugen, SCHEDULE_SUM );
+        visit( ugen->owner );
+        add( ugen, ugen->owner->tickf ? SCHEDULE_LAST : SCHEDULE_SYNTH );
+    }
+    else
+    {
+        add( ugen, SCHEDULE_TICK );
+    }
+
+    // done with this node
+    m_nodes[m_node].end = m_entries.size();
+    m_node = parent;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: add()
+// desc: add an entry, for the ugen being visited
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::add( Chuck_UGen * ugen, t_CKUINT what )
+{
+    Entry entry = { ugen, what };
+    m_entries.push_back( entry );
+    m_entry_node.push_back( (t_CKUINT)m_node );
+}
+
+
+
+
+#ifndef __DISABLE_THREADS__
+//-----------------------------------------------------------------------------
+// name: ugen_concurrent()
+// desc: whether a ugen may be ticked on another thread, alongside others
+//-----------------------------------------------------------------------------
+static t_CKBOOL ugen_concurrent( Chuck_UGen * ugen )
+{
+    return ugen->type_ref && ugen->type_ref->ugen_info &&
+           ugen->type_ref->ugen_info->concurrent;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: partition()
+// desc: find subgraphs that can be ticked alongside each other: a node
+//       (a ugen and what it alone pulls) qualifies if it is one of two or
+//       more feeding the same ugen, every ugen in it is concurrent, and
+//       everything they read (sources, channels, owners) is inside it, or
+//       ticked by the caller; the outermost of these become tasks, and
+//       tasks one after the other in the schedule are ticked together
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::partition()
+{
+    t_CKUINT i, j, k;
+    // read-only, as far as the schedule goes
+    const t_CKUINT READONLY = (t_CKUINT)-1;
+
+    // where each ugen is first ticked (or summed)
+    std::map<Chuck_UGen *, t_CKUINT> where;
+    for( i = 0; i < m_ticked.size(); i++ )
+    {
+        where[m_ticked[i]] = READONLY;
+        for( j = 0; j < m_ticked[i]->m_multi_chan_size; j++ )
+            where[m_ticked[i]->m_multi_chan[j]] = READONLY;
+    }
+    for( i = 0; i < m_entries.size(); i++ )
+        where.insert( std::make_pair( m_entries[i].ugen, i ) );
+
+    // for each node: the lowest and highest entry read from within it,
+    // and whether all its ugens are concurrent
+    std::vector<t_CKUINT> lo( m_nodes.size(), READONLY );
+    std::vector<t_CKUINT> hi( m_nodes.size(), 0 );
+    std::vector<t_CKBOOL> ok( m_nodes.size(), TRUE );
+    for( i = 0; i < m_entries.size(); i++ )
+    {
+        Chuck_UGen * ugen = m_entries[i].ugen;
+        k = m_entry_node[i];
+        if( !ugen_concurrent( ugen ) ) ok[k] = FALSE;
+        // what it reads
+        for( j = 0; j < ugen->m_num_src + ugen->m_multi_chan_size + 1; j++ )
+        {
+            Chuck_UGen * read = j < ugen->m_num_src ? ugen->m_src_list[j]
+                : j < ugen->m_num_src + ugen->m_multi_chan_size
+                    ? ugen->m_multi_chan[j - ugen->m_num_src] : ugen->owner;
+            if( !read ) continue;
+            std::map<Chuck_UGen *, t_CKUINT>::iterator w = where.find( read );
+            // not in the schedule: to be safe, nothing qualifies around it
+            if( w == where.end() ) { lo[k] = 0; hi[k] = READONLY; continue; }
+            if( w->second == READONLY ) continue;
+            if( w->second < lo[k] ) lo[k] = w->second;
+            if( w->second > hi[k] ) hi[k] = w->second;
+        }
+    }
+    // children into parents (a child always comes after its parent)
+    for( k = m_nodes.size(); k-- > 0; )
+    {
+        t_CKINT parent = m_nodes[k].parent;
+        if( parent < 0 ) continue;
+        if( lo[k] < lo[parent] ) lo[parent] = lo[k];
+        if( hi[k] > hi[parent] ) hi[parent] = hi[k];
+        if( !ok[k] ) ok[parent] = FALSE;
+    }
+
+    // outermost qualifying nodes, in order
+    t_CKUINT skip = 0;
+    for( k = 0; k < m_nodes.size(); k++ )
+    {
+        const Node & node = m_nodes[k];
+        // inside a task already
+        if( node.begin < skip ) continue;
+        if( node.parent < 0 || m_nodes[node.parent].children < 2 ) continue;
+        if( !ok[k] ) continue;
+        if( lo[k] != READONLY && ( lo[k] < node.begin || hi[k] >= node.end ) ) continue;
+        Task task = { node.begin, node.end };
+        m_tasks.push_back( task );
+        skip = node.end;
+    }
+
+    // steps: runs of two or more tasks, one right after the other, and
+    // whatever is between them, in order
+    std::vector<Task> tasks;
+    tasks.swap( m_tasks );
+    t_CKUINT at = 0;
+    for( i = 0; i < tasks.size(); )
+    {
+        // how many in a row
+        for( j = i + 1; j < tasks.size() && tasks[j].begin == tasks[j-1].end; j++ ) { }
+        if( j - i >= 2 )
+        {
+            // what comes before
+            if( tasks[i].begin > at )
+            {
+                Step before = { at, tasks[i].begin, 0, 0 };
+                m_steps.push_back( before );
+            }
+            // the group; biggest first, for balance (order within doesn't
+            // matter, as none reads another)
+            Step group = { tasks[i].begin, tasks[j-1].end, m_tasks.size(), j - i };
+            for( k = i; k < j; k++ ) m_tasks.push_back( tasks[k] );
+            std::stable_sort( m_tasks.begin() + group.task, m_tasks.end(),
+                [](const Task & a, const Task & b) { return a.end - a.begin > b.end - b.begin; } );
+            m_steps.push_back( group );
+            at = group.end;
+        }
+        i = j;
+    }
+    // the rest
+    if( at < m_entries.size() || m_steps.empty() )
+    {
+        Step rest = { at, m_entries.size(), 0, 0 };
+        m_steps.push_back( rest );
+    }
+
+    // log
+    EM_log( CK_LOG_FINER, "ugen schedule: %lu entries, %lu tasks in %lu steps",
+            m_entries.size(), m_tasks.size(), m_steps.size() );
+}
+#endif // __DISABLE_THREADS__
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: tick()
+// desc: tick everything reachable from the roots, one sample
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::tick( t_CKTIME now )
+{
+    // connections changed?
+    if( m_version != graph_version() )
+        compile();
+
+    const Entry * e = m_entries.data();
+    const Entry * end = e + m_entries.size();
+    for( ; e != end; e++ )
+    {
+        Chuck_UGen * ugen = e->ugen;
+        switch( e->what )
+        {
+        case SCHEDULE_TICK:
+            ugen->m_time = now;
+            ugen->system_sum();
+            ugen->system_synth();
+            break;
+        case SCHEDULE_SUM:
+            ugen->m_time = now;
+            ugen->system_sum();
+            m_pending.push_back( ugen );
+            break;
+        case SCHEDULE_SYNTH:
+            ugen->system_synth();
+            m_pending.pop_back();
+            break;
+        case SCHEDULE_LAST:
+            ugen->m_last = ugen->m_current;
+            m_pending.pop_back();
+            break;
+        }
+
+        // connections changed from within a tick (e.g., a Chugen's); the
+        // rest of the schedule may be stale
+        if( m_version != graph_version() )
+        {
+            finish( now, 0 );
+            return;
+        }
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: tick_v()
+// desc: tick everything reachable from the roots, one block
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::tick_v( t_CKTIME now, t_CKUINT numFrames )
+{
+#ifndef __DISABLE_THREADS__
+    // threads changed? (workers, if any, were started by whoever changed
+    // it; groups make do with as many as are there)
+    if( m_threads != m_threads_wanted.load() )
+    {
+        m_threads = m_threads_wanted.load();
+        // partition (or not) anew
+        m_version = (t_CKUINT)-1;
+    }
+#endif
+
+    // connections changed?
+    if( m_version != graph_version() )
+        compile();
+
+    for( t_CKUINT i = 0; i < m_steps.size(); i++ )
+    {
+        const Step * step = &m_steps[i];
+        if( !step->tasks )
+        {
+            // in order; done if connections changed along the way
+            if( !run_v( step->begin, step->end, now, numFrames ) ) return;
+        }
+#ifndef __DISABLE_THREADS__
+        else
+        {
+            // alongside each other
+            run_group( step, now, numFrames );
+            // connections changed meanwhile?
+            if( m_version != graph_version() )
+            {
+                finish( now, numFrames );
+                return;
+            }
+        }
+#endif
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: run_v()
+// desc: tick entries [begin,end) in order, one block; FALSE if connections
+//       changed along the way, and the rest was finished recursively
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_UGen_Schedule::run_v( t_CKUINT begin, t_CKUINT end,
+                                     t_CKTIME now, t_CKUINT numFrames )
+{
+    const Entry * e = m_entries.data() + begin;
+    const Entry * last = m_entries.data() + end;
+    for( ; e != last; e++ )
+    {
+        Chuck_UGen * ugen = e->ugen;
+        switch( e->what )
+        {
+        case SCHEDULE_TICK:
+            ugen->m_time = now;
+            ugen->system_sum_v( numFrames );
+            ugen->system_synth_v( numFrames );
+            break;
+        case SCHEDULE_SUM:
+            ugen->m_time = now;
+            ugen->system_sum_v( numFrames );
+            m_pending.push_back( ugen );
+            break;
+        case SCHEDULE_SYNTH:
+            ugen->system_synth_v( numFrames );
+            m_pending.pop_back();
+            break;
+        case SCHEDULE_LAST:
+            ugen->m_last = ugen->m_current_v[numFrames - 1];
+            m_pending.pop_back();
+            break;
+        }
+
+        // connections changed from within a tick (e.g., a Chugen's); the
+        // rest of the schedule may be stale
+        if( m_version != graph_version() )
+        {
+            finish( now, numFrames );
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: finish()
+// desc: connections changed mid-tick; pull the rest recursively, as before
+//       (numFrames == 0 for one sample); next tick recompiles
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::finish( t_CKTIME now, t_CKUINT numFrames )
+{
+    t_CKUINT i;
+
+    // what hasn't been ticked yet
+    for( i = 0; i < m_roots.size(); i++ )
+    {
+        if( numFrames ) m_roots[i]->system_tick_v( now, numFrames );
+        else m_roots[i]->system_tick( now );
+    }
+
+    // channels summed, waiting on their owners, which are now ticked
+    while( m_pending.size() )
+    {
+        Chuck_UGen * ugen = m_pending.back();
+        m_pending.pop_back();
+        if( ugen->owner->tickf )
+            ugen->m_last = numFrames ? ugen->m_current_v[numFrames - 1] : ugen->m_current;
+        else if( numFrames ) ugen->system_synth_v( numFrames );
+        else ugen->system_synth();
+    }
+}
+
+
+
+
+#ifndef __DISABLE_THREADS__
+// the index part of a ticket, and a group being set up (no task to take)
+#define CK_TICKET_INDEX   0xffffffffULL
+#define CK_TICKET_CLOSED  0xffffffffULL
+//-----------------------------------------------------------------------------
+// name: start_workers()
+// desc: (re)start the worker threads, as many as asked for, less one
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::start_workers()
+{
+    m_mutex.acquire();
+    // stop any running
+    stop_all();
+
+    for( t_CKUINT i = 1; i < m_threads_wanted.load(); i++ )
+    {
+        XThread * thread = new XThread;
+        if( !thread->start( worker, this ) )
+        {
+            // make do with fewer (the caller ticks whatever is left)
+            EM_log( CK_LOG_WARNING, "ugen schedule: cannot start worker thread" );
+            CK_SAFE_DELETE( thread );
+            break;
+        }
+        m_workers.push_back( thread );
+    }
+    m_num_workers.store( m_workers.size() );
+    m_mutex.release();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: stop_workers()
+// desc: stop and join the worker threads
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::stop_workers()
+{
+    m_mutex.acquire();
+    stop_all();
+    m_mutex.release();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: stop_all()
+// desc: stop and join the worker threads (with m_mutex held); a group
+//       under way meanwhile is finished by its caller
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::stop_all()
+{
+    m_num_workers.store( 0 );
+    m_quit.store( TRUE );
+    // wake them all, to quit
+    m_wake.post( m_workers.size() );
+
+    for( t_CKUINT i = 0; i < m_workers.size(); i++ )
+    {
+        // join (without cancelling: it quits on its own)
+        m_workers[i]->wait( -1, false );
+        // joined; nothing left for the destructor to cancel
+        m_workers[i]->clear();
+        CK_SAFE_DELETE( m_workers[i] );
+    }
+    m_workers.clear();
+
+    // (wakes left over, if any, are taken by the next workers, which
+    // find nothing to do and wait again)
+    m_quit.store( FALSE );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: run_group()
+// desc: tick a step's tasks, on the workers and this thread; returns when
+//       all are done; neither locks nor waits for a worker, only for the
+//       tasks taken (a worker that wakes late finds none left)
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::run_group( const Step * step, t_CKTIME now, t_CKUINT numFrames )
+{
+    // the next group's number; only this thread changes it
+    unsigned long long number = (m_ticket.load() >> 32) + 1;
+    Group group = { step->task, step->tasks, now, numFrames };
+    t_CKUINT index, helpers;
+
+    // close the last group (any ticket taken from it is done, as it
+    // returned); a worker that reads what is set below sees it closed
+    m_ticket.store( (number << 32) | CK_TICKET_CLOSED );
+    m_group_task.store( group.task, std::memory_order_release );
+    m_group_tasks.store( group.tasks, std::memory_order_release );
+    m_group_now.store( group.now, std::memory_order_release );
+    m_group_frames.store( group.frames, std::memory_order_release );
+    m_done.store( 0, std::memory_order_relaxed );
+    // open it
+    m_ticket.store( number << 32, std::memory_order_release );
+
+    // wake as many workers as can help
+    helpers = m_num_workers.load( std::memory_order_relaxed );
+    if( helpers > step->tasks - 1 ) helpers = step->tasks - 1;
+    m_wake.post( helpers );
+
+    // pitch in
+    while( take( group, index ) ) work( group, index );
+
+    // wait for the rest
+    while( m_done.load( std::memory_order_acquire ) < step->tasks )
+        std::this_thread::yield();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: take()
+// desc: take the next task of the current group, if any is left
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_UGen_Schedule::take( Group & group, t_CKUINT & index )
+{
+    unsigned long long ticket = m_ticket.load( std::memory_order_acquire );
+
+    for( ;; )
+    {
+        // the group this ticket is from (or a later one, in which case
+        // the ticket has changed, and it is not taken)
+        group.task = m_group_task.load( std::memory_order_acquire );
+        group.tasks = m_group_tasks.load( std::memory_order_acquire );
+        group.now = m_group_now.load( std::memory_order_acquire );
+        group.frames = m_group_frames.load( std::memory_order_acquire );
+        // none left (or closed)
+        index = (t_CKUINT)(ticket & CK_TICKET_INDEX);
+        if( index >= group.tasks ) return FALSE;
+        // take it, unless changed meanwhile (then look again)
+        if( m_ticket.compare_exchange_weak( ticket, ticket + 1,
+                std::memory_order_acq_rel, std::memory_order_acquire ) )
+            return TRUE;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: work()
+// desc: tick a task of a group, as run_v() would, less the checks for
+//       changed connections (concurrent ugens don't make any)
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::work( const Group & group, t_CKUINT index )
+{
+    const Task & task = m_tasks[group.task + index];
+    const Entry * e = m_entries.data() + task.begin;
+    const Entry * last = m_entries.data() + task.end;
+    t_CKTIME now = group.now;
+    t_CKUINT numFrames = group.frames;
+
+    for( ; e != last; e++ )
+    {
+        Chuck_UGen * ugen = e->ugen;
+        switch( e->what )
+        {
+        case SCHEDULE_TICK:
+            ugen->m_time = now;
+            ugen->system_sum_v( numFrames );
+            ugen->system_synth_v( numFrames );
+            break;
+        case SCHEDULE_SUM:
+            ugen->m_time = now;
+            ugen->system_sum_v( numFrames );
+            break;
+        case SCHEDULE_SYNTH:
+            ugen->system_synth_v( numFrames );
+            break;
+        case SCHEDULE_LAST:
+            ugen->m_last = ugen->m_current_v[numFrames - 1];
+            break;
+        }
+    }
+    // done; what it wrote is seen by whoever sees this
+    m_done.fetch_add( 1, std::memory_order_release );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: worker()
+// desc: worker thread: wait to be woken, take tasks while there are any,
+//       repeat; blocked (not polling) while there are no groups, e.g.,
+//       when the VM is not running or not computing in blocks
+//-----------------------------------------------------------------------------
+THREAD_RETURN ( THREAD_TYPE Chuck_UGen_Schedule::worker ) ( void * data )
+{
+    Chuck_UGen_Schedule * schedule = (Chuck_UGen_Schedule *)data;
+    Group group;
+    t_CKUINT index = 0;
+
+    for( ;; )
+    {
+        // wait for a group
+        schedule->m_wake.wait();
+        if( schedule->m_quit.load() ) break;
+        // help with it
+        while( schedule->take( group, index ) )
+            schedule->work( group, index );
+    }
+
+    return (THREAD_RETURN)0;
+}
+#else
+//-----------------------------------------------------------------------------
+// name: start_workers() / stop_workers()
+// desc: no workers without threads
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::start_workers() { }
+void Chuck_UGen_Schedule::stop_workers() { }
+#endif // __DISABLE_THREADS__
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: Chuck_UAna()
 // desc: constructor
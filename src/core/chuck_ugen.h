@@ -40,6 +40,11 @@
 #include "chuck_oo.h"
 #include "chuck_dl.h"
 #include "util_buffers.h"
+#ifndef __DISABLE_THREADS__
+#include "util_thread.h"
+#endif
+#include <vector>
+#include <atomic>
 
 
 // forward reference
@@ -77,6 +82,12 @@ public: // src
     t_CKUINT disconnect( t_CKBOOL recursive );
     t_CKUINT system_tick( t_CKTIME now );
     t_CKUINT system_tick_v( t_CKTIME now, t_CKUINT numFrames );
+    // the two halves of system_tick(), without pulling upstream ugens;
+    // see Chuck_UGen_Schedule | 1.5.1.7
+    void system_sum();
+    t_CKBOOL system_synth();
+    void system_sum_v( t_CKUINT numFrames );
+    t_CKBOOL system_synth_v( t_CKUINT numFrames );
     t_CKBOOL alloc_v( t_CKUINT size );
     t_CKBOOL set_is_buffered( t_CKBOOL buffered );
     void get_buffer( SAMPLE * buffer, t_CKINT num_elem );
@@ -93,6 +104,8 @@ public:
     f_tick tick;
     // multichannel/vectorized tick function (added 1.3.0.0)
     f_tickf tickf;
+    // mono block tick function; optional, with tick (added 1.5.1.7)
+    f_tickv tickv;
     // msg function
     f_pmsg pmsg;
     // channels (if more than one is required)
@@ -157,6 +170,184 @@ public: // data
     // what a hack! (added some time after REFACTOR-2017)
     t_CKBOOL m_is_buffered;
     AccumBuffer m_buffer;
+
+    // last Chuck_UGen_Schedule compile to visit this ugen | 1.5.1.7
+    t_CKUINT m_schedule_mark;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_UGen_Schedule
+// desc: the ugen graph reachable from a set of roots (e.g., dac, blackhole),
+//       flattened into the order system_tick() would visit it, so that the
+//       audio path iterates an array instead of pulling recursively and
+//       checking m_time on every edge; as with m_time, a ugen reached again
+//       while it is being visited (a feedback loop) is read as it was
+//       the sample before | 1.5.1.7
+//
+//       with more than one thread (see set_threads(); not available when
+//       built with __DISABLE_THREADS__), tick_v() also ticks
+//       subgraphs that feed the same mixing point (e.g., voices into a
+//       Gain or dac) alongside each other; only subgraphs of concurrent
+//       ugens (see type_engine_import_ugen_concurrent()) that read nothing
+//       outside themselves qualify, and everything else is ticked in
+//       order on the caller's thread -- each ugen computes exactly what it
+//       would have, so the output is the same, bit for bit
+//-----------------------------------------------------------------------------
+struct Chuck_UGen_Schedule
+{
+public:
+    Chuck_UGen_Schedule();
+    ~Chuck_UGen_Schedule();
+
+public:
+    // the VM whose ugens these are; its graph version says when to recompile
+    void set_vm( Chuck_VM * vm );
+    // add a root, in the order they are to be ticked
+    void add_root( Chuck_UGen * root );
+    // a ugen (and its channels) the caller ticks itself, e.g., adc
+    void add_ticked( Chuck_UGen * ugen );
+    // tick everything reachable from the roots, one sample
+    void tick( t_CKTIME now );
+    // tick everything reachable from the roots, one block
+    void tick_v( t_CKTIME now, t_CKUINT numFrames );
+
+public:
+    // how many threads tick_v() may use, counting the caller's; 1 (the
+    // default, and the only choice without threads) ticks everything on
+    // the caller's; may be called from any thread, and takes effect at
+    // the next tick_v() -- with workers started, as many are
+    // (re)started first, on the thread calling this
+    void set_threads( t_CKUINT threads );
+    // get number of threads
+    t_CKUINT threads() const { return m_threads_wanted.load(); }
+    // (re)start the worker threads, as many as asked for, less one; not
+    // to be called from the audio thread (e.g., when the VM starts)
+    void start_workers();
+    // stop and join the worker threads (also on destruction)
+    void stop_workers();
+
+protected:
+    // flatten the graph, as it is now
+    void compile();
+    // add a ugen and (first) what it pulls
+    void visit( Chuck_UGen * ugen );
+    // add an entry, for the ugen being visited
+    void add( Chuck_UGen * ugen, t_CKUINT what );
+    // tick entries [begin,end) in order; FALSE if connections changed
+    // along the way (and the rest was finished recursively)
+    t_CKBOOL run_v( t_CKUINT begin, t_CKUINT end, t_CKTIME now, t_CKUINT numFrames );
+    // connections changed mid-tick; finish by pulling recursively
+    void finish( t_CKTIME now, t_CKUINT numFrames );
+    // the VM's graph version (see Chuck_VM::graph_changed())
+    t_CKUINT graph_version() const;
+
+protected:
+    // what to do for each ugen
+    enum { SCHEDULE_TICK, SCHEDULE_SUM, SCHEDULE_SYNTH, SCHEDULE_LAST };
+    struct Entry
+    {
+        Chuck_UGen * ugen;
+        t_CKUINT what;
+    };
+    // the flattened graph
+    std::vector<Entry> m_entries;
+    // roots, and ugens ticked by the caller
+    std::vector<Chuck_UGen *> m_roots;
+    std::vector<Chuck_UGen *> m_ticked;
+    // ugens summed but not yet synthesized (their owners are between)
+    std::vector<Chuck_UGen *> m_pending;
+    // the VM, and its graph version as of the last compile
+    Chuck_VM * m_vm;
+    t_CKUINT m_version;
+    // this compile, for Chuck_UGen::m_schedule_mark
+    t_CKUINT m_mark;
+
+protected:
+    // a visit() that added entries [begin,end), for partition()
+    struct Node
+    {
+        t_CKUINT begin;
+        t_CKUINT end;
+        t_CKUINT children;
+        t_CKINT parent;
+    };
+    std::vector<Node> m_nodes;
+    // innermost node of each entry
+    std::vector<t_CKUINT> m_entry_node;
+    // node being visited
+    t_CKINT m_node;
+    // entries [begin,end) that can be ticked alongside others
+    struct Task
+    {
+        t_CKUINT begin;
+        t_CKUINT end;
+    };
+    std::vector<Task> m_tasks;
+    // entries [begin,end), ticked in order (tasks == 0), or as
+    // m_tasks[task .. task+tasks), on as many threads as there are
+    struct Step
+    {
+        t_CKUINT begin;
+        t_CKUINT end;
+        t_CKUINT task;
+        t_CKUINT tasks;
+    };
+    std::vector<Step> m_steps;
+
+protected:
+    // threads asked for, and in use
+    std::atomic<t_CKUINT> m_threads_wanted;
+    t_CKUINT m_threads;
+
+#ifndef __DISABLE_THREADS__
+protected:
+    // find subgraphs that can be ticked alongside each other
+    void partition();
+    // stop and join the worker threads, with m_mutex held
+    void stop_all();
+    // tick a step's tasks, on the workers and this thread
+    void run_group( const Step * step, t_CKTIME now, t_CKUINT numFrames );
+    // a group: tasks m_tasks[task .. task+tasks), and when
+    struct Group
+    {
+        t_CKUINT task;
+        t_CKUINT tasks;
+        t_CKTIME now;
+        t_CKUINT frames;
+    };
+    // take the next task of the current group, if any is left; the group,
+    // as of when it was taken, goes in 'group'
+    t_CKBOOL take( Group & group, t_CKUINT & index );
+    // tick task 'index' of 'group'
+    void work( const Group & group, t_CKUINT index );
+    // worker thread
+    static THREAD_RETURN ( THREAD_TYPE worker ) ( void * data );
+
+protected:
+    // the worker threads, and how many there are
+    std::vector<XThread *> m_workers;
+    std::atomic<t_CKUINT> m_num_workers;
+    // held to start or stop workers (never by the audio thread)
+    XMutex m_mutex;
+    // idle workers wait on this; posted for each worker a group can use
+    XSemaphore m_wake;
+    std::atomic<t_CKBOOL> m_quit;
+    // the current group, set before its tickets are handed out
+    std::atomic<t_CKUINT> m_group_task;
+    std::atomic<t_CKUINT> m_group_tasks;
+    std::atomic<t_CKTIME> m_group_now;
+    std::atomic<t_CKUINT> m_group_frames;
+    // the next ticket: the group's number (high 32 bits) and the index of
+    // the next task to take (low); a ticket is taken by compare-and-swap,
+    // so a worker that read an older group, or a group being set up,
+    // takes none
+    std::atomic<unsigned long long> m_ticket;
+    // tasks done in the current group
+    std::atomic<t_CKUINT> m_done;
+#endif // __DISABLE_THREADS__
 };
 
 
@@ -31,6 +31,10 @@
 //-----------------------------------------------------------------------------
 #include "chuck_vm.h"
 #include "chuck_instr.h"
+#include "chuck_jit.h"
+#include "chuck_reclaim.h"
+#include "chuck_pool.h"
+#include "chuck_cycle.h"
 #include "chuck_lang.h"
 #include "chuck_type.h"
 #include "chuck_dl.h"
@@ -89,6 +93,19 @@ using namespace std;
 
 
 
+//-----------------------------------------------------------------------------
+// VM stack layout (also used by the VM's stack pool)
+//-----------------------------------------------------------------------------
+// minimum stack size | 1.5.1.5 (ge) added
+#define VM_STACK_MINIMUM_SIZE 2048
+// offset in bytes at the beginning of a stack for initializing data
+#define VM_STACK_OFFSET 16
+// overflow padding in bytes, to allow some overflow before detection
+#define VM_STACK_OVERFLOW_PADDING 512
+
+
+
+
 
 //-----------------------------------------------------------------------------
 // name: struct SortByID_LT()
@@ -187,15 +204,27 @@ Chuck_VM::Chuck_VM()
     m_init = FALSE;
     m_halt = TRUE;
     m_is_running = FALSE;
+    m_dispatch = CKVM_DISPATCH_CLASSIC;
 
     // shred management
     m_num_shreds = 0;
     m_shreduler = NULL;
     m_num_dumped_shreds = 0;
+    m_shred_pool_max = CKVM_SHRED_POOL_SIZE; // 1.5.1.7
+    m_reclaimer = NULL; // 1.5.1.7
+    m_collector = NULL; // 1.5.1.7
+    m_pool = NULL; // 1.5.1.7
+    m_realloc_report = FALSE; // 1.5.1.7
+    m_realloc_count = 0; // 1.5.1.7
+    m_ic_hits = 0; // 1.5.1.7
+    m_ic_misses = 0; // 1.5.1.7
+    m_graph_version = 0; // 1.5.1.7
     m_globals_manager = NULL; // 1.4.1.0 (jack)
     m_msg_buffer = NULL;
     m_reply_buffer = NULL;
-    m_event_buffer = NULL;
+    // empty broadcast queue: just the stub | 1.5.1.7
+    m_broadcast_tail.store( &m_broadcast_stub );
+    m_broadcast_head = &m_broadcast_stub;
     m_shred_id = 0;
     m_shred_check4dupes = FALSE; // 1.5.1.5 (ge)
 
@@ -209,6 +238,8 @@ Chuck_VM::Chuck_VM()
     m_input_ref = NULL;
     m_output_ref = NULL;
     m_current_buffer_frames = 0;
+    m_poll = 1; // 1.5.1.7
+    m_block_start = 0; // 1.5.1.7
 }
 
 
@@ -226,6 +257,9 @@ Chuck_VM::~Chuck_VM()
         // cleanup
         shutdown();
     }
+
+    // in case initialize() didn't finish | 1.5.1.7
+    if( m_pool ) { m_pool->detach(); m_pool = NULL; }
 }
 
 
@@ -256,6 +290,9 @@ t_CKBOOL Chuck_VM::initialize( t_CKUINT srate, t_CKUINT dac_chan,
     // lockdown
     Chuck_VM_Object::lock_all();
 
+    // object pool; owned by whichever thread runs the VM | 1.5.1.7
+    m_pool = new Chuck_VM_Pool;
+
     // log
     EM_log( CK_LOG_SYSTEM, "allocating shreduler..." );
     // allocate shreduler
@@ -266,15 +303,12 @@ t_CKBOOL Chuck_VM::initialize( t_CKUINT srate, t_CKUINT dac_chan,
     // log
     EM_log( CK_LOG_SYSTEM, "allocating messaging buffers..." );
     // allocate msg buffer
-    m_msg_buffer = new CBufferSimple;
+    m_msg_buffer = new CBufferMulti;
     m_msg_buffer->initialize( 1024, sizeof(Chuck_Msg *) );
     //m_msg_buffer->join(); // this should return 0
     m_reply_buffer = new CBufferSimple;
     m_reply_buffer->initialize( 1024, sizeof(Chuck_Msg *) );
     //m_reply_buffer->join(); // this should return 0 too
-    m_event_buffer = new CBufferSimple;
-    m_event_buffer->initialize( 1024, sizeof(Chuck_Event *) );
-    //m_event_buffer->join(); // this should also return 0
 
     // 1.4.1.0 (jack): added globals manager
     EM_log( CK_LOG_SYSTEM, "allocating globals manager..." );
@@ -345,14 +379,22 @@ t_CKBOOL Chuck_VM::initialize_synthesis( )
     // log
     EM_log( CK_LOG_SEVERE, "initializing 'blackhole'..." );
     m_bunghole = new Chuck_UGen;
+    // so connections to it count as this VM's (see graph_changed()) | 1.5.1.7
+    m_bunghole->setOriginVM( this );
     m_bunghole->add_ref();
     m_bunghole->lock();
     initialize_object( m_bunghole, env()->ckt_ugen, NULL, this );
     m_bunghole->tick = NULL;
+    m_bunghole->tickv = NULL; // 1.5.1.7
     m_bunghole->alloc_v( m_shreduler->m_max_block_size );
     m_shreduler->m_dac = m_dac;
     m_shreduler->m_adc = m_adc;
     m_shreduler->m_bunghole = m_bunghole;
+    // dac, then bunghole; adc is ticked by the shreduler itself | 1.5.1.7
+    m_shreduler->m_ugen_schedule.set_vm( this );
+    m_shreduler->m_ugen_schedule.add_root( m_dac );
+    m_shreduler->m_ugen_schedule.add_root( m_bunghole );
+    m_shreduler->m_ugen_schedule.add_ticked( m_adc );
     m_shreduler->m_num_dac_channels = m_num_dac_channels;
     m_shreduler->m_num_adc_channels = m_num_adc_channels;
 
@@ -380,6 +422,13 @@ t_CKBOOL Chuck_VM::shutdown()
     // REFACTOR-2017: TODO: don't unlock all objects for all VMs? see relockdown below
     Chuck_VM_Object::unlock_all();
 
+    // free unreachable cycles still waiting to be found, and stop
+    // looking | 1.5.1.7
+    this->set_collect( 0 );
+    // delete objects still waiting, and everything from here on right
+    // away, while the VM is intact | 1.5.1.7
+    this->set_reclaim( 0 );
+
     // REFACTOR-2017: clean up after my global variables
     m_globals_manager->cleanup_global_variables();
     CK_SAFE_DELETE( m_globals_manager );
@@ -407,19 +456,30 @@ t_CKBOOL Chuck_VM::shutdown()
     #endif
 
     // log
-    EM_log( CK_LOG_SYSTEM, "freeing msg/reply/event buffers..." );
+    EM_log( CK_LOG_SYSTEM, "freeing msg/reply buffers..." );
     // free the msg buffer
     CK_SAFE_DELETE( m_msg_buffer );
     // free the reply buffer
     CK_SAFE_DELETE( m_reply_buffer );
-    // free the event buffer
-    CK_SAFE_DELETE( m_event_buffer );
+    // drop msgs held for a frame offset never reached | 1.5.1.7
+    for( std::multimap<t_CKTIME, Chuck_Msg *>::iterator it = m_held_msgs.begin();
+         it != m_held_msgs.end(); it++ ) CK_SAFE_DELETE( it->second );
+    m_held_msgs.clear();
+    // drop queued broadcasts, freeing links of events already gone | 1.5.1.7
+    Chuck_Event_Link * link = NULL;
+    while( (link = pop_broadcast()) )
+    {
+        link->pending.store( 0 );
+        if( !link->event.load() ) delete link;
+    }
 
     // log
     EM_pushlog();
     EM_log( CK_LOG_SEVERE, "freeing dumped shreds..." );
     // do it
     this->release_dump();
+    // and the pools | 1.5.1.7
+    this->clear_pool();
     EM_poplog();
 
     // log
@@ -429,6 +489,18 @@ t_CKBOOL Chuck_VM::shutdown()
     CK_SAFE_RELEASE( m_adc );
     CK_SAFE_RELEASE( m_bunghole );
 
+    // log
+    Chuck_VM_Pool_Stats pstats = m_pool->stats();
+    EM_log( CK_LOG_SYSTEM, "object pool: %lu pooled allocations, %lu from heap",
+            pstats.allocs, pstats.heap_allocs );
+    EM_pushlog();
+    EM_log( CK_LOG_SYSTEM, "%lu slabs, %lu/%lu blocks in use",
+            pstats.slabs, pstats.live, pstats.capacity );
+    EM_poplog();
+    // let go of the object pool; it goes away once objects still alive
+    // (e.g., held by the host) are freed | 1.5.1.7
+    m_pool->detach(); m_pool = NULL;
+
     // set state
     m_init = FALSE;
 
@@ -456,6 +528,9 @@ t_CKBOOL Chuck_VM::start()
 {
     // already running?
     if( m_is_running ) return FALSE;
+    // start threads to tick the ugen graph with, if more than one, here
+    // rather than on the audio thread | 1.5.1.7
+    if( m_shreduler ) m_shreduler->m_ugen_schedule.start_workers();
     // set state
     m_is_running = TRUE;
     // done
@@ -496,19 +571,23 @@ t_CKBOOL Chuck_VM::stop()
 
 //-----------------------------------------------------------------------------
 // name: compute()
-// desc: compute all shreds at one instance in ChucK time
+// desc: compute all shreds at one instance in ChucK time; if `poll`, also
+//       take in what other threads queued (msgs, global requests, event
+//       broadcasts); msgs and requests held for a frame offset are taken
+//       in when due, either way
 //-----------------------------------------------------------------------------
-t_CKBOOL Chuck_VM::compute()
+t_CKBOOL Chuck_VM::compute( t_CKBOOL poll )
 {
     Chuck_VM_Shred *& shred = m_shreduler->m_current_shred;
     Chuck_Msg * msg = NULL;
-    Chuck_Event * event = NULL;
     t_CKBOOL iterate = TRUE;
 
     // REFACTOR-2017: spork queued shreds, handle global messages
     // this is called once per chuck time / sample / "tick"
     // global manager added 1.4.1.0 (jack)
-    m_globals_manager->handle_global_queue_messages();
+    // 1.5.1.7: only when polling, or when a held request is due
+    if( poll || m_globals_manager->has_due( m_shreduler->now_system ) )
+        m_globals_manager->handle_global_queue_messages();
 
     // iterate until no more shreds/events/messages
     while( iterate )
@@ -544,30 +623,25 @@ t_CKBOOL Chuck_VM::compute()
         // set to false for now
         iterate = FALSE;
 
-        // broadcast queued events
-        while( m_event_buffer->get( &event, 1 ) )
+        // take in what other threads queued | 1.5.1.7
+        if( poll )
         {
-            event->broadcast_local();
-            event->broadcast_global();
-            iterate = TRUE;
+            // broadcast queued events
+            if( run_broadcasts() ) iterate = TRUE;
+
+            // process messages; those with a frame offset to come are held
+            while( m_msg_buffer->get( &msg, 1 ) )
+            { if( !hold_msg( msg ) ) process_msg( msg ); iterate = TRUE; }
         }
 
-        // loop over thread-specific queued event buffers (added 1.3.0.0)
-        for( list<CBufferSimple *>::const_iterator i = m_event_buffers.begin();
-             i != m_event_buffers.end(); i++ )
+        // process held messages now due | 1.5.1.7
+        while( m_held_msgs.size() && m_held_msgs.begin()->first <= m_shreduler->now_system )
         {
-            while( (*i)->get( &event, 1 ) )
-            {
-                event->broadcast_local();
-                event->broadcast_global();
-                iterate = TRUE;
-            }
+            msg = m_held_msgs.begin()->second;
+            m_held_msgs.erase( m_held_msgs.begin() );
+            process_msg( msg ); iterate = TRUE;
         }
 
-        // process messages
-        while( m_msg_buffer->get( &msg, 1 ) )
-        { process_msg( msg ); iterate = TRUE; }
-
         // clear dumped shreds
         if( m_num_dumped_shreds > 0 )
             release_dump();
@@ -576,7 +650,27 @@ t_CKBOOL Chuck_VM::compute()
     // continue executing if have shreds left or if don't-halt
     // or if have shreds to add or globals to process
     // (TODO: restrict this to just shred-messages to pass, as it once was?)
-    return ( m_num_shreds || !m_halt || m_globals_manager->more_requests() );
+    return ( m_num_shreds || !m_halt || m_globals_manager->more_requests() || m_held_msgs.size() );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: hold_msg() | 1.5.1.7
+// desc: hold msg until its frame offset into the current block, if that is
+//       still to come; returns FALSE if it is due now
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_VM::hold_msg( Chuck_Msg * msg )
+{
+    // no offset
+    if( !msg->offset ) return FALSE;
+    // when it's due
+    t_CKTIME due = m_block_start + msg->offset;
+    if( due <= m_shreduler->now_system ) return FALSE;
+    // hold it (after any others due at the same time)
+    m_held_msgs.insert( std::make_pair( due, msg ) );
+    return TRUE;
 }
 
 
@@ -591,22 +685,30 @@ t_CKBOOL Chuck_VM::compute()
 //-----------------------------------------------------------------------------
 t_CKBOOL Chuck_VM::run( t_CKINT N, const SAMPLE * input, SAMPLE * output )
 {
+    // this thread allocates from the object pool | 1.5.1.7
+    if( !m_pool->is_owner() ) m_pool->set_owner();
     // copy
     m_input_ref = input; m_output_ref = output; m_current_buffer_frames = N;
     // frame count
     t_CKINT frame = 0;
+    // the frame at which to next take in queued msgs/requests/broadcasts;
+    // frame offsets of queued msgs/requests count from the block start | 1.5.1.7
+    t_CKINT next_poll = 0;
+    m_block_start = m_shreduler->now_system;
 
     // zero output buffer
     memset( output, 0, N*m_num_dac_channels*sizeof(SAMPLE) );
 
-    // for now, check for global variables once per sample (below)
-    // TODO: once per buffer instead? (place here then)
-
     // loop it
     while( N )
     {
+        // take in queued msgs/requests/broadcasts at the start of the
+        // block, then every m_poll frames (see set_poll()) | 1.5.1.7
+        t_CKBOOL poll = ( frame >= next_poll );
+        if( poll ) next_poll = m_poll ? frame + (t_CKINT)m_poll : m_current_buffer_frames;
+
         // compute shreds
-        if( !compute() ) goto vm_stop;
+        if( !compute( poll ) ) goto vm_stop;
 
         // advance the shreduler
         if( !m_shreduler->m_adaptive )
@@ -617,6 +719,13 @@ t_CKBOOL Chuck_VM::run( t_CKINT N, const SAMPLE * input, SAMPLE * output )
         else m_shreduler->advance_v( N, frame );
     }
 
+    // free unreachable cycles, a slice at a time | 1.5.1.7
+    if( m_collector ) m_collector->collect();
+    // delete a slice of released objects, if deferred | 1.5.1.7
+    if( m_reclaimer ) this->gc();
+    // report object pool use | 1.5.1.7
+    CK_VM_DEBUGGER( pool_stats( m_pool, m_shreduler->now_system, m_srate ) );
+
     // clear
     m_input_ref = NULL; m_output_ref = NULL;
 
@@ -628,6 +737,10 @@ vm_stop:
     // log, check so we only log once, in case run() still gets called
     // after the initial stoppage; calling stop after resets m_is_running
     if( m_is_running ) EM_log( CK_LOG_SYSTEM, "stopping virtual machine..." );
+#if CK_VM_DEBUG_ENABLE
+    // report objects and string storage allocated over the run | 1.5.1.7
+    if( m_is_running ) { CK_VM_DEBUGGER( print_stats() ); }
+#endif
 
     // stop | 1.3.5.3
     this->stop();
@@ -643,10 +756,14 @@ vm_stop:
 
 //-----------------------------------------------------------------------------
 // name: gc
-// desc: ...
+// desc: delete up to `amount` deferred objects
 //-----------------------------------------------------------------------------
 void Chuck_VM::gc( t_CKUINT amount )
 {
+    // nothing deferred
+    if( !m_reclaimer || !m_shreduler ) return;
+    // go
+    m_reclaimer->reclaim( m_shreduler->now_system, amount );
 }
 
 
@@ -654,10 +771,116 @@ void Chuck_VM::gc( t_CKUINT amount )
 
 //-----------------------------------------------------------------------------
 // name: gc
-// desc: ...
+// desc: delete the next slice of deferred objects
 //-----------------------------------------------------------------------------
 void Chuck_VM::gc( )
 {
+    // nothing deferred
+    if( !m_reclaimer ) return;
+    // one budget's worth
+    this->gc( m_reclaimer->budget() );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: set_reclaim() | 1.5.1.7
+// desc: defer deletion of released objects, deleting up to `budget` of
+//       them per block; 0 deletes right away
+//-----------------------------------------------------------------------------
+void Chuck_VM::set_reclaim( t_CKUINT budget )
+{
+    // turn on, or change budget
+    if( budget )
+    {
+        if( !m_reclaimer ) m_reclaimer = new Chuck_VM_Reclaimer( budget );
+        else m_reclaimer->set_budget( budget );
+        return;
+    }
+
+    // already off
+    if( !m_reclaimer ) return;
+
+    // stop deferring; anything released from here on is deleted right away
+    // (objects reach the reclaimer through their origin VM's reclaimer())
+    Chuck_VM_Reclaimer * reclaimer = m_reclaimer;
+    m_reclaimer = NULL;
+    // delete what's waiting
+    reclaimer->flush();
+
+    // log
+    const Chuck_VM_Reclaim_Stats & stats = reclaimer->stats();
+    EM_log( CK_LOG_SYSTEM, "deferred object reclamation: %lu deferred, %lu overflowed",
+            stats.deferred, stats.overflowed );
+    EM_pushlog();
+    EM_log( CK_LOG_SYSTEM, "queue depth: max %lu", stats.depth_max );
+    EM_log( CK_LOG_SYSTEM, "latency (samples): max %.0f, avg %.2f",
+            stats.latency_max, stats.latency_avg() );
+    EM_poplog();
+
+    // done
+    CK_SAFE_DELETE( reclaimer );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: set_collect() | 1.5.1.7
+// desc: look for unreachable reference cycles, scanning up to `budget`
+//       objects per block; 0 collects what it can and turns it off
+//-----------------------------------------------------------------------------
+void Chuck_VM::set_collect( t_CKUINT budget )
+{
+    // turn on, or change budget
+    if( budget )
+    {
+        if( !m_collector ) m_collector = new Chuck_VM_Cycle_Collector( budget );
+        else m_collector->set_budget( budget );
+        return;
+    }
+
+    // already off
+    if( !m_collector ) return;
+
+    // free what can be found
+    m_collector->collect_all();
+    // stop noting candidates (objects reach the collector through their
+    // origin VM's collector())
+    Chuck_VM_Cycle_Collector * collector = m_collector;
+    m_collector = NULL;
+
+    // log
+    const Chuck_VM_Cycle_Stats & stats = collector->stats();
+    EM_log( CK_LOG_SYSTEM, "cycle collection: %lu candidates, %lu objects scanned",
+            stats.candidates, stats.scanned );
+    EM_pushlog();
+    EM_log( CK_LOG_SYSTEM, "%lu cycles found, %lu objects freed", stats.cycles, stats.freed );
+    EM_log( CK_LOG_SYSTEM, "time (ms): total %.3f, max slice %.3f",
+            stats.time_total * 1000, stats.time_max * 1000 );
+    EM_poplog();
+
+    // done
+    CK_SAFE_DELETE( collector );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: set_threads() | 1.5.1.7
+// desc: how many threads tick the ugen graph, counting the audio thread,
+//       when computing in blocks (adaptive); takes effect at the next block
+//-----------------------------------------------------------------------------
+void Chuck_VM::set_threads( t_CKUINT threads )
+{
+    if( !m_shreduler ) return;
+    m_shreduler->m_ugen_schedule.set_threads( threads );
+    // already running: (re)start as many workers now, on this thread
+    if( m_is_running ) m_shreduler->m_ugen_schedule.start_workers();
+    // log (always 1 without threads)
+    EM_log( CK_LOG_SYSTEM, "ugen graph threads: %lu", m_shreduler->m_ugen_schedule.threads() );
 }
 
 
@@ -665,13 +888,13 @@ void Chuck_VM::gc( )
 
 //-----------------------------------------------------------------------------
 // name: queue_msg()
-// desc: ...
+// desc: queue a msg for the VM; safe from any thread | 1.5.1.7
+//       returns FALSE if the queue is full (msg not queued)
 //-----------------------------------------------------------------------------
 t_CKBOOL Chuck_VM::queue_msg( Chuck_Msg * msg, t_CKINT count )
 {
     assert( count == 1 );
-    m_msg_buffer->put( &msg, count );
-    return TRUE;
+    return m_msg_buffer->put( &msg, count ) == (t_CKUINT)count;
 }
 
 
@@ -679,21 +902,21 @@ t_CKBOOL Chuck_VM::queue_msg( Chuck_Msg * msg, t_CKINT count )
 
 //-----------------------------------------------------------------------------
 // name: queue_event()
-// desc: since 1.3.0.0 a buffer is passed in associated with each thread
+// desc: queue a broadcast of event, to be carried out by the VM thread;
+//       safe from any thread, and wait-free: requests on an event already
+//       queued are only counted | 1.5.1.7
+//       (buffer no longer used; since 1.3.0.0 it was one per thread)
 //-----------------------------------------------------------------------------
 t_CKBOOL Chuck_VM::queue_event( Chuck_Event * event, t_CKINT count,
                                 CBufferSimple * buffer )
 {
     // sanity
     assert( count == 1 );
-    // if null
-    if( buffer == NULL )
-    {
-        // use non thread-safe buffer
-        buffer = m_event_buffer;
-    }
-    // put into the buffer
-    buffer->put( &event, count );
+    // the event's link
+    Chuck_Event_Link * link = event->link();
+    // count the request; the first since the VM last took it gets it queued
+    if( link->pending.fetch_add( count ) == 0 )
+        push_broadcast( link );
 
     // done
     return TRUE;
@@ -702,6 +925,86 @@ t_CKBOOL Chuck_VM::queue_event( Chuck_Event * event, t_CKINT count,
 
 
 
+//-----------------------------------------------------------------------------
+// name: push_broadcast() | 1.5.1.7
+// desc: push link onto the broadcast queue; any thread
+//-----------------------------------------------------------------------------
+void Chuck_VM::push_broadcast( Chuck_Event_Link * link )
+{
+    // end of the queue
+    link->next.store( NULL, std::memory_order_relaxed );
+    // claim the tail, then link the previous tail to us; until then the
+    // consumer sees the queue end at the previous tail
+    Chuck_Event_Link * prev = m_broadcast_tail.exchange( link, std::memory_order_acq_rel );
+    prev->next.store( link, std::memory_order_release );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: pop_broadcast() | 1.5.1.7
+// desc: pop the next link off the broadcast queue; VM thread only; NULL if
+//       the queue is empty or its next link is still being pushed
+//-----------------------------------------------------------------------------
+Chuck_Event_Link * Chuck_VM::pop_broadcast()
+{
+    Chuck_Event_Link * head = m_broadcast_head;
+    Chuck_Event_Link * next = head->next.load( std::memory_order_acquire );
+    // step over the stub
+    if( head == &m_broadcast_stub )
+    {
+        // empty
+        if( !next ) return NULL;
+        m_broadcast_head = head = next;
+        next = head->next.load( std::memory_order_acquire );
+    }
+    // more after this one
+    if( next ) { m_broadcast_head = next; return head; }
+    // this is the last, unless a push is under way
+    if( head != m_broadcast_tail.load( std::memory_order_acquire ) ) return NULL;
+    // put the stub back behind it, so it can be taken
+    push_broadcast( &m_broadcast_stub );
+    next = head->next.load( std::memory_order_acquire );
+    if( next ) { m_broadcast_head = next; return head; }
+    // a push got between; try again next time
+    return NULL;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: run_broadcasts() | 1.5.1.7
+// desc: broadcast every event on the queue; returns whether there were any
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_VM::run_broadcasts()
+{
+    t_CKBOOL any = FALSE;
+    Chuck_Event_Link * link = NULL;
+
+    while( (link = pop_broadcast()) )
+    {
+        // the event, and the requests on it; any later request queues it again
+        Chuck_Event * event = link->event.load();
+        t_CKUINT count = link->pending.exchange( 0 );
+        // event gone while queued; the link is left for us
+        if( !event ) { delete link; continue; }
+        // hold on to it; the last waiter may hold the last reference
+        CK_SAFE_ADD_REF( event );
+        // waiting shreds need waking once; listeners hear every request
+        event->broadcast_local();
+        for( ; count > 0; count-- ) event->broadcast_global();
+        CK_SAFE_RELEASE( event );
+        any = TRUE;
+    }
+
+    return any;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: create_event_buffer()
 // desc: added 1.3.0.0 to fix uber-crash
@@ -788,8 +1091,7 @@ t_CKUINT Chuck_VM::process_msg( Chuck_Msg * & msg )
         // if shred wasn't created on the outside
         if( !shred )
         {
-            shred = new Chuck_VM_Shred;
-            shred->vm_ref = this;
+            shred = alloc_shred();
             shred->initialize( msg->code );
             shred->name = msg->code->name;
             shred->base_ref = shred->mem;
@@ -1152,10 +1454,8 @@ t_CKTIME Chuck_VM::now() const
 Chuck_VM_Shred * Chuck_VM::spork( Chuck_VM_Code * code, Chuck_VM_Shred * parent,
                                   t_CKBOOL immediate )
 {
-    // allocate a new shred
-    Chuck_VM_Shred * shred = new Chuck_VM_Shred;
-    // set the vm
-    shred->vm_ref = this;
+    // allocate a new shred (or reuse one) | 1.5.1.7
+    Chuck_VM_Shred * shred = alloc_shred();
     // get stack size hints | 1.5.1.5
     t_CKINT mems = parent ? parent->childGetMemSize() : 0;
     t_CKINT regs = parent ? parent->childGetRegSize() : 0;
@@ -1446,8 +1746,9 @@ void Chuck_VM::release_dump( )
         // (ensure we always do this, even if release below doesn't
         // actually delete the shred due to reference count)
         m_shred_dump[i]->detach_ugens();
-        // release
-        CK_SAFE_RELEASE( m_shred_dump[i] );
+        // keep for reuse if possible; otherwise release | 1.5.1.7
+        if( pool_shred( m_shred_dump[i] ) ) m_shred_dump[i] = NULL;
+        else CK_SAFE_RELEASE( m_shred_dump[i] );
     }
 
     // clear the dump
@@ -1459,6 +1760,138 @@ void Chuck_VM::release_dump( )
 
 
 
+//-----------------------------------------------------------------------------
+// name: pool_shred() | 1.5.1.7
+// desc: keep a dumped shred, and its stacks, for reuse by alloc_shred();
+//       only if nothing but the VM refers to it
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_VM::pool_shred( Chuck_VM_Shred * shred )
+{
+    // check
+    if( !m_init || shred->m_ref_count != 1 || m_shred_pool.size() >= m_shred_pool_max )
+        return FALSE;
+
+    // reset, taking the stacks
+    Chuck_VM_Stack * mem = NULL;
+    Chuck_VM_Stack * reg = NULL;
+    shred->recycle( &mem, &reg );
+    // keep the stacks, if there is room
+    if( mem ) { if( m_stack_pool.size() < 2 * m_shred_pool_max ) m_stack_pool.push_back( mem ); else delete mem; }
+    if( reg ) { if( m_stack_pool.size() < 2 * m_shred_pool_max ) m_stack_pool.push_back( reg ); else delete reg; }
+    // keep the shred (with the VM's reference)
+    m_shred_pool.push_back( shred );
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: alloc_shred() | 1.5.1.7
+// desc: get a new shred, reused from the pool if possible
+//-----------------------------------------------------------------------------
+Chuck_VM_Shred * Chuck_VM::alloc_shred()
+{
+    Chuck_VM_Shred * shred = NULL;
+
+    // reuse
+    if( m_shred_pool.size() )
+    {
+        shred = m_shred_pool.back();
+        m_shred_pool.pop_back();
+        // the pool's reference is given up; spork() adds its own
+        shred->m_ref_count = 0;
+    }
+    // or allocate
+    else shred = new Chuck_VM_Shred;
+
+    // set the vm
+    shred->vm_ref = this;
+
+    return shred;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: alloc_stack() | 1.5.1.7
+// desc: get an initialized stack of 'size' bytes, reused if possible
+//-----------------------------------------------------------------------------
+Chuck_VM_Stack * Chuck_VM::alloc_stack( t_CKUINT size )
+{
+    // the size a new stack would have
+    if( size < VM_STACK_MINIMUM_SIZE ) size = VM_STACK_MINIMUM_SIZE;
+
+    // look for one that size, most recently pooled first
+    for( t_CKINT i = (t_CKINT)m_stack_pool.size() - 1; i >= 0; i-- )
+    {
+        Chuck_VM_Stack * stack = m_stack_pool[i];
+        if( stack->m_size != size ) continue;
+        // take it out of the pool
+        m_stack_pool[i] = m_stack_pool.back();
+        m_stack_pool.pop_back();
+        // as good as new
+        stack->reset();
+        return stack;
+    }
+
+    // allocate
+    Chuck_VM_Stack * stack = new Chuck_VM_Stack;
+    if( !stack->initialize( size ) ) CK_SAFE_DELETE( stack );
+
+    return stack;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: set_shred_pool() | 1.5.1.7
+// desc: set maximum number of shreds (and stack pairs) kept for reuse
+//-----------------------------------------------------------------------------
+void Chuck_VM::set_shred_pool( t_CKUINT max )
+{
+    m_shred_pool_max = max;
+
+    // trim
+    while( m_shred_pool.size() > m_shred_pool_max )
+    {
+        CK_SAFE_RELEASE( m_shred_pool.back() );
+        m_shred_pool.pop_back();
+    }
+    while( m_stack_pool.size() > 2 * m_shred_pool_max )
+    {
+        CK_SAFE_DELETE( m_stack_pool.back() );
+        m_stack_pool.pop_back();
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: clear_pool() | 1.5.1.7
+// desc: free everything in the pools
+//-----------------------------------------------------------------------------
+void Chuck_VM::clear_pool()
+{
+    // log
+    EM_log( CK_LOG_FINER, "freeing pooled shreds (%lu) and stacks (%lu)...",
+            m_shred_pool.size(), m_stack_pool.size() );
+
+    for( t_CKUINT i = 0; i < m_shred_pool.size(); i++ )
+        CK_SAFE_RELEASE( m_shred_pool[i] );
+    m_shred_pool.clear();
+    for( t_CKUINT i = 0; i < m_stack_pool.size(); i++ )
+        CK_SAFE_DELETE( m_stack_pool[i] );
+    m_stack_pool.clear();
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // helper function
 //-----------------------------------------------------------------------------
@@ -1551,6 +1984,15 @@ Chuck_VM_Code::Chuck_VM_Code()
 {
     instr = NULL;
     num_instr = 0;
+    threaded = NULL;
+    threaded_inline = TRUE;
+    num_fused = 0;
+    stack_verified = FALSE;
+    reg_depth = 0;
+    mem_depth = 0;
+    jit_count = 0;
+    jit_native = NULL;
+    jit_size = 0;
     stack_depth = 0;
     need_this = FALSE;
     is_static = FALSE;
@@ -1578,18 +2020,121 @@ Chuck_VM_Code::~Chuck_VM_Code()
         CK_SAFE_DELETE_ARRAY( instr );
     }
 
+    // free the direct-threaded form, and any native code
+    CK_SAFE_DELETE_ARRAY( threaded );
+    ck_jit_release( this );
+    // string literals | 1.5.1.7
+    for( t_CKUINT i = 0; i < literals.size(); i++ )
+        Chuck_String::release_literal( literals[i] );
+    literals.clear();
+
     num_instr = 0;
 }
 
 
 
 
-// minimum stack size | 1.5.1.5 (ge) added
-#define VM_STACK_MINIMUM_SIZE 2048
-// offset in bytes at the beginning of a stack for initializing data
-#define VM_STACK_OFFSET 16
-// overflow padding in bytes, to allow some overflow before detection
-#define VM_STACK_OVERFLOW_PADDING 512
+//-----------------------------------------------------------------------------
+// name: threaded_ops()
+// desc: get the direct-threaded form of this code, lowering it on first use;
+//       each slot holds a handler and inline operand for the instruction at
+//       the same index, so pc/next_pc have the same meaning in both forms
+//-----------------------------------------------------------------------------
+Chuck_VM_Threaded_Op * Chuck_VM_Code::threaded_ops()
+{
+    // already lowered
+    if( threaded ) return threaded;
+
+    // allocate
+    threaded = new Chuck_VM_Threaded_Op[num_instr];
+    // lower each instruction
+    for( t_CKUINT i = 0; i < num_instr; i++ )
+        ck_lower_threaded( instr[i], threaded[i], threaded_inline );
+
+    return threaded;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ckvm_verify_merge()
+// desc: merge operand stack depth d into the entry depth of instruction pc,
+//       queueing pc if it has not been seen; depths must agree on all paths
+//-----------------------------------------------------------------------------
+static t_CKBOOL ckvm_verify_merge( std::vector<t_CKINT> & depth,
+                                   std::vector<t_CKUINT> & work,
+                                   t_CKUINT pc, t_CKINT d )
+{
+    // out of range
+    if( pc >= depth.size() ) return FALSE;
+    // first time here
+    if( depth[pc] < 0 ) { depth[pc] = d; work.push_back( pc ); return TRUE; }
+    // seen before; must match
+    return depth[pc] == d;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: verify()
+// desc: abstract interpretation over the instructions, tracking the operand
+//       stack depth along every path from entry; succeeds if each
+//       instruction's stack effect is known, the stack never underflows,
+//       and paths agree on the depth where they meet; on success, reg_depth
+//       holds the maximum depth (in bytes) the code can reach, beyond the
+//       stack pointer on entry
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_VM_Code::verify()
+{
+    // operand stack depth on entry to each instruction (-1: not reached)
+    std::vector<t_CKINT> depth( num_instr, -1 );
+    // instructions yet to visit
+    std::vector<t_CKUINT> work;
+    // for each instruction
+    t_CKUINT pc = 0, target = 0, pop = 0, push = 0;
+    t_CKINT d = 0, max_depth = 0;
+
+    // reset
+    stack_verified = FALSE;
+    reg_depth = 0;
+    // nothing to do
+    if( !num_instr ) return FALSE;
+
+    // start at the entry point, with an empty stack
+    depth[0] = 0;
+    work.push_back( 0 );
+    // go until all reachable instructions are visited
+    while( work.size() )
+    {
+        // next
+        pc = work.back();
+        work.pop_back();
+        // stack effect of the instruction
+        if( !instr[pc]->stack_effect( pop, push ) ) return FALSE;
+        // underflow
+        if( (t_CKINT)pop > depth[pc] ) return FALSE;
+        // depth after
+        d = depth[pc] - (t_CKINT)pop + (t_CKINT)push;
+        // the max
+        if( d > max_depth ) max_depth = d;
+        // jump
+        if( instr[pc]->branch_target( target ) && !ckvm_verify_merge( depth, work, target, d ) )
+            return FALSE;
+        // fall through
+        if( !instr[pc]->is_terminal() && !ckvm_verify_merge( depth, work, pc+1, d ) )
+            return FALSE;
+    }
+
+    // done
+    reg_depth = (t_CKUINT)max_depth;
+    return stack_verified = TRUE;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: initialize()
 // desc: initialize VM stack, with at least 'size' bytes
@@ -1664,6 +2209,23 @@ t_CKBOOL Chuck_VM_Stack::shutdown()
 
 
 
+//-----------------------------------------------------------------------------
+// name: reset() | 1.5.1.7
+// desc: make an initialized stack as good as new (zeroed, sp at the start)
+//-----------------------------------------------------------------------------
+void Chuck_VM_Stack::reset()
+{
+    if( !m_is_init ) return;
+
+    // zero the memory, including header and overflow padding
+    memset( stack - VM_STACK_OFFSET, 0, VM_STACK_OFFSET + m_size + VM_STACK_OVERFLOW_PADDING );
+    // set the sp
+    sp = stack;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: Chuck_VM_Shred()
 // desc: constructor
@@ -1673,12 +2235,14 @@ Chuck_VM_Shred::Chuck_VM_Shred()
     mem = NULL;
     reg = NULL;
     code = code_orig = NULL;
-    next = prev = NULL;
+    heap_index = -1;
+    heap_order = 0;
     instr = NULL;
     parent = NULL;
     base_ref = NULL;
     vm_ref = NULL;
     event = NULL;
+    event_prev = event_next = NULL;
     xid = 0;
 
     // initialize
@@ -1737,17 +2301,21 @@ t_CKBOOL Chuck_VM_Shred::initialize( Chuck_VM_Code * c,
     // verify
     assert( vm_ref != NULL );
 
-    // allocate new stacks
-    mem = new Chuck_VM_Stack;
-    reg = new Chuck_VM_Stack;
-
     // check for default | 1.5.1.5
     if( mem_stack_size == 0 ) mem_stack_size = CKVM_MEM_STACK_SIZE;
     if( reg_stack_size == 0 ) reg_stack_size = CKVM_REG_STACK_SIZE;
+    // verified code is not checked per instruction; make sure it fits | 1.5.1.7
+    if( c && c->stack_verified )
+    {
+        if( mem_stack_size < c->mem_depth ) mem_stack_size = c->mem_depth;
+        if( reg_stack_size < c->reg_depth ) reg_stack_size = c->reg_depth;
+    }
 
-    // initialize mem and reg
-    if( !mem->initialize( mem_stack_size ) ) goto error;
-    if( !reg->initialize( reg_stack_size ) ) goto error;
+    // get mem and reg stacks, reused if possible | 1.5.1.7
+    mem = vm_ref->alloc_stack( mem_stack_size );
+    if( !mem ) goto error;
+    reg = vm_ref->alloc_stack( reg_stack_size );
+    if( !reg ) goto error;
 
     // program counter
     pc = 0;
@@ -1910,6 +2478,54 @@ t_CKBOOL Chuck_VM_Shred::shutdown()
 
 
 
+//-----------------------------------------------------------------------------
+// name: recycle() | 1.5.1.7
+// desc: shutdown shred, and return it to the state of a new shred, so that
+//       the object can be initialize()'d again; if mem_out/reg_out are not
+//       NULL, the stacks are handed over instead of deleted
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_VM_Shred::recycle( Chuck_VM_Stack ** mem_out, Chuck_VM_Stack ** reg_out )
+{
+    // hand over the stacks
+    if( mem_out ) { *mem_out = mem; mem = NULL; }
+    if( reg_out ) { *reg_out = reg; reg = NULL; }
+
+    // release everything else
+    shutdown();
+
+    // back to the state of a new shred (see constructor)
+    instr = NULL;
+    parent = NULL;
+    children.clear();
+    vm_ref = NULL;
+    event = NULL;
+    event_prev = event_next = NULL;
+    xid = 0;
+    name.clear();
+    args.clear();
+    heap_index = -1;
+    heap_order = 0;
+    is_abort = FALSE;
+    is_done = FALSE;
+    is_dumped = FALSE;
+    is_running = FALSE;
+    pc = next_pc = 0;
+    now = 0;
+    start = 0;
+    wake_time = 0;
+    is_immediate_mode = FALSE;
+    is_immediate_mode_violation = FALSE;
+    CK_TRACK( stat = NULL );
+
+    // zero member data (the object itself stays initialized)
+    if( data ) memset( data, 0, data_size );
+
+    return TRUE;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: add()
 // desc: add a ugen to this shred's ugen map
@@ -2061,8 +2677,16 @@ static void ckvm_observe_stackdepth_across_all_shreds( Chuck_VM_Shred * currentS
 //-----------------------------------------------------------------------------
 t_CKBOOL Chuck_VM_Shred::run( Chuck_VM * vm )
 {
+    // check dispatch mode | 1.5.1.7
+    if( vm->dispatch() != CKVM_DISPATCH_CLASSIC ) return run_threaded( vm );
+
     // get the code
     instr = code->instr;
+    // the code last checked for stack verification | 1.5.1.7
+    Chuck_VM_Code * checked_code = code;
+    // verified code has its stack space checked on entry (see Func_Call),
+    // otherwise check for overflow after every instruction
+    t_CKBOOL check_stack = !code->stack_verified;
     is_running = TRUE;
     // pointer to running state
     const t_CKBOOL * loop_running = &(vm_ref->runningState());
@@ -2086,13 +2710,23 @@ CK_VM_STACK_DEBUG( CK_FPRINTF_STDERR( "CK_VM_DEBUG mem sp in: 0x%08lx out: 0x%08
 CK_VM_STACK_DEBUG( CK_FPRINTF_STDERR( "CK_VM_DEBUG reg sp in: 0x%08lx out: 0x%08lx\n",
                    (unsigned long)t_reg_sp, (unsigned long)this->reg->sp ) );
 //-----------------------------------------------------------------------------
-        // detect operand stack overflow | 1.5.1.5
-        if( overflow_( this->reg ) )
-        { ck_handle_overflow( this, vm_ref, "shred operand stack exceeded" ); break; }
-        // detect mem stack overflow ("catch all") | 1.5.1.5
-        // NOTE func-call & alloc instrucions already detect
-        if( overflow_( this->mem ) && is_running ) // <- is_running==FALSE if already detected
-        { ck_handle_overflow( this, vm_ref, "shred memory stack exceeded" ); break; }
+        // stack overflow checks needed for this code? | 1.5.1.7
+        if( check_stack )
+        {
+            // detect operand stack overflow | 1.5.1.5
+            if( overflow_( this->reg ) )
+            { ck_handle_overflow( this, vm_ref, "shred operand stack exceeded" ); break; }
+            // detect mem stack overflow ("catch all") | 1.5.1.5
+            // NOTE func-call & alloc instrucions already detect
+            if( overflow_( this->mem ) && is_running ) // <- is_running==FALSE if already detected
+            { ck_handle_overflow( this, vm_ref, "shred memory stack exceeded" ); break; }
+        }
+        // switched code (function call or return)? | 1.5.1.7
+        if( code != checked_code )
+        {
+            checked_code = code;
+            check_stack = !code->stack_verified;
+        }
 
         // set to next_pc;
         pc = next_pc;
@@ -2121,6 +2755,92 @@ CK_VM_STACK_DEBUG( CK_FPRINTF_STDERR( "CK_VM_DEBUG reg sp in: 0x%08lx out: 0x%08
 
 
 
+//-----------------------------------------------------------------------------
+// name: run_threaded() | 1.5.1.7 (added)
+// desc: run this shred's VM code, using the direct-threaded form of the code;
+//       same semantics as run(), including overflow checks
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_VM_Shred::run_threaded( Chuck_VM * vm )
+{
+    // get the code
+    instr = code->instr;
+    // the code the ops belong to
+    Chuck_VM_Code * ops_code = code;
+    // get the ops
+    Chuck_VM_Threaded_Op * ops = ops_code->threaded_ops();
+    // current op
+    Chuck_VM_Threaded_Op * op = NULL;
+    // whether to check for overflow after every instruction
+    t_CKBOOL check_stack = !ops_code->stack_verified;
+    // whether to count towards compiling hot code
+    t_CKBOOL jit = vm->dispatch() == CKVM_DISPATCH_JIT;
+    is_running = TRUE;
+    // pointer to running state
+    const t_CKBOOL * loop_running = &(vm_ref->runningState());
+
+    // count entry
+    if( jit && ++ops_code->jit_count == CKVM_JIT_THRESHOLD ) ck_jit_compile( ops_code );
+
+    // go!
+    while( is_running && *loop_running && !is_abort )
+    {
+        // the op
+        op = ops + pc;
+        // execute it
+        op->handler( op, vm, this );
+
+        // count backward jumps (loops)
+        if( jit && next_pc <= pc && code == ops_code && ++ops_code->jit_count == CKVM_JIT_THRESHOLD )
+            ck_jit_compile( ops_code );
+
+        // stack overflow checks needed for this code?
+        if( check_stack )
+        {
+            // detect operand stack overflow
+            if( overflow_( this->reg ) )
+            { ck_handle_overflow( this, vm_ref, "shred operand stack exceeded" ); break; }
+            // detect mem stack overflow ("catch all")
+            if( overflow_( this->mem ) && is_running )
+            { ck_handle_overflow( this, vm_ref, "shred memory stack exceeded" ); break; }
+        }
+
+        // switched code (function call or return)?
+        if( code != ops_code )
+        {
+            ops_code = code;
+            ops = ops_code->threaded_ops();
+            check_stack = !ops_code->stack_verified;
+            // count entry (or return)
+            if( jit && ++ops_code->jit_count == CKVM_JIT_THRESHOLD ) ck_jit_compile( ops_code );
+        }
+
+        // set to next_pc;
+        pc = next_pc;
+        // advance program counter
+        next_pc++;
+
+        // track number of cycles
+        CK_TRACK( this->stat->cycles++ );
+        // if enabled, update shred stacks depth observation
+        CK_VM_STACK_OBSERVE( ckvm_observe_stackdepth_across_all_shreds( this ) );
+    }
+
+    // check abort
+    if( is_abort )
+    {
+        // log
+        EM_log( CK_LOG_SYSTEM, "aborting shred (id: %lu)", this->xid );
+        // done
+        is_done = TRUE;
+    }
+
+    // is the shred finished
+    return !is_done;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: yield() | 1.5.0.5 (ge) made this a function from scattered code
 // desc: yield the shred in vm (without advancing time, politely yield to run
@@ -2289,7 +3009,7 @@ Chuck_VM_Shreduler::Chuck_VM_Shreduler()
 {
     now_system = 0;
     vm_ref = NULL;
-    shred_list = NULL;
+    m_shredule_count = 0;
     m_current_shred = NULL;
     m_dac = NULL;
     m_adc = NULL;
@@ -2416,7 +3136,7 @@ t_CKBOOL Chuck_VM_Shreduler::shredule( Chuck_VM_Shred * shred,
                                        t_CKTIME wake_time )
 {
     // sanity check
-    if( shred->prev || shred->next )
+    if( shred->heap_index >= 0 )
     {
         // something is really wrong here - no shred can be
         // shreduled more than once
@@ -2445,43 +3165,15 @@ t_CKBOOL Chuck_VM_Shreduler::shredule( Chuck_VM_Shred * shred,
 
     // set wake time
     shred->wake_time = wake_time;
+    // after any shreds already waiting for the same time
+    shred->heap_order = m_shredule_count++;
 
-    // list empty
-    if( !shred_list )
-        shred_list = shred;
-    else
-    {
-        // pointers to the shred queue
-        Chuck_VM_Shred * curr = shred_list;
-        Chuck_VM_Shred * prev = NULL;
+    // insert into the ready queue
+    shred_heap.push_back( NULL );
+    heap_set( (t_CKINT)shred_heap.size() - 1, shred );
+    heap_up( shred->heap_index );
 
-        while( curr )
-        {
-            // found the place to insert
-            if( curr->wake_time > wake_time )
-                break;
-
-            prev = curr;
-            curr = curr->next;
-        }
-
-        if( !prev )
-        {
-            shred->next = shred_list;
-            if( shred_list ) shred_list->prev = shred;
-            shred_list = shred;
-        }
-        else
-        {
-            // insert the shred in sorted order
-            shred->next = prev->next;
-            shred->prev = prev;
-            if( prev->next ) prev->next->prev = shred;
-            prev->next = shred;
-        }
-    }
-
-    t_CKTIME diff = shred_list->wake_time - this->now_system;
+    t_CKTIME diff = shred_heap[0]->wake_time - this->now_system;
     if( diff < 0 ) diff = 0;
     // if( diff < m_samps_until_next )
     m_samps_until_next = diff;
@@ -2577,11 +3269,9 @@ void Chuck_VM_Shreduler::advance_v( t_CKINT & numLeft, t_CKINT & offset )
     // update time
     m_adc->m_time = this->now_system;
 
-    // PROCESSING
-    m_dac->system_tick_v( this->now_system, numFrames );
-
-    // suck samples
-    m_bunghole->system_tick_v( this->now_system, numFrames );
+    // PROCESSING: dac, then suck samples through bunghole; iterating
+    // the flattened graph instead of pulling recursively | 1.5.1.7
+    m_ugen_schedule.tick_v( this->now_system, numFrames );
 
     // OUTPUT: adaptive block
     for( i = 0; i < numFrames; i++ )
@@ -2654,8 +3344,9 @@ void Chuck_VM_Shreduler::advance( t_CKINT N )
     m_adc->m_last = m_adc->m_current = sum / m_num_adc_channels;
     m_adc->m_time = this->now_system;
 
-    // PROCESSING
-    m_dac->system_tick( this->now_system );
+    // PROCESSING: dac, then suck samples through bunghole; iterating
+    // the flattened graph instead of pulling recursively | 1.5.1.7
+    m_ugen_schedule.tick( this->now_system );
     // OUTPUT
     for( i = 0; i < m_num_dac_channels; i++ )
     {
@@ -2669,9 +3360,6 @@ void Chuck_VM_Shreduler::advance( t_CKINT N )
         output[i] = m_dac->m_multi_chan[i]->m_current; // * .5f;
         #endif
     }
-
-    // suck samples
-    m_bunghole->system_tick( this->now_system );
 }
 
 
@@ -2684,34 +3372,28 @@ void Chuck_VM_Shreduler::advance( t_CKINT N )
 //-----------------------------------------------------------------------------
 Chuck_VM_Shred * Chuck_VM_Shreduler::get( )
 {
-    // shreduler's wait to run list
-    Chuck_VM_Shred * shred = shred_list;
-
-    // check if list empty
-    if( !shred )
+    // check if ready queue empty
+    if( shred_heap.empty() )
     {
         // if empty we are done
         m_samps_until_next = -1;
         return NULL;
     }
 
-    // check the front of the shred wait-to-run list; ready to run?
+    // shreduler's wait to run queue
+    Chuck_VM_Shred * shred = shred_heap[0];
+
+    // check the front of the shred wait-to-run queue; ready to run?
     if( shred->wake_time <= ( this->now_system + .5 ) )
     {
-        // set beginning of list to next
-        shred_list = shred->next;
-
-        // sever links of ready-to-run shred
-        shred->next = NULL;
-        shred->prev = NULL;
+        // take it off the queue
+        heap_remove( 0 );
 
-        // if shred list is non-empty
-        if( shred_list )
+        // if shred queue is non-empty
+        if( shred_heap.size() )
         {
-            // set list head's prev pointer to NULL
-            shred_list->prev = NULL;
             // compute new samps until next
-            m_samps_until_next = shred_list->wake_time - this->now_system;
+            m_samps_until_next = shred_heap[0]->wake_time - this->now_system;
             // clamp to 0
             if( m_samps_until_next < 0 ) m_samps_until_next = 0;
         }
@@ -2727,6 +3409,99 @@ Chuck_VM_Shred * Chuck_VM_Shreduler::get( )
 
 
 
+//-----------------------------------------------------------------------------
+// name: heap_before()
+// desc: does lhs run before rhs? earlier wake time first; for equal wake
+//       times, in the order shreduled
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_VM_Shreduler::heap_before( const Chuck_VM_Shred * lhs, const Chuck_VM_Shred * rhs )
+{
+    if( lhs->wake_time != rhs->wake_time ) return lhs->wake_time < rhs->wake_time;
+    return lhs->heap_order < rhs->heap_order;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: heap_set()
+// desc: place shred at index i of the ready queue
+//-----------------------------------------------------------------------------
+void Chuck_VM_Shreduler::heap_set( t_CKINT i, Chuck_VM_Shred * shred )
+{
+    shred_heap[i] = shred;
+    shred->heap_index = i;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: heap_up()
+// desc: move shred_heap[i] toward the front until in place
+//-----------------------------------------------------------------------------
+void Chuck_VM_Shreduler::heap_up( t_CKINT i )
+{
+    Chuck_VM_Shred * shred = shred_heap[i];
+    while( i > 0 )
+    {
+        t_CKINT parent = (i - 1) / 2;
+        if( !heap_before( shred, shred_heap[parent] ) ) break;
+        heap_set( i, shred_heap[parent] );
+        i = parent;
+    }
+    heap_set( i, shred );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: heap_down()
+// desc: move shred_heap[i] toward the back until in place
+//-----------------------------------------------------------------------------
+void Chuck_VM_Shreduler::heap_down( t_CKINT i )
+{
+    t_CKINT n = (t_CKINT)shred_heap.size();
+    Chuck_VM_Shred * shred = shred_heap[i];
+    while( 2 * i + 1 < n )
+    {
+        // the earlier of the two children
+        t_CKINT child = 2 * i + 1;
+        if( child + 1 < n && heap_before( shred_heap[child+1], shred_heap[child] ) ) child++;
+        if( !heap_before( shred_heap[child], shred ) ) break;
+        heap_set( i, shred_heap[child] );
+        i = child;
+    }
+    heap_set( i, shred );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: heap_remove()
+// desc: take shred_heap[i] out of the ready queue
+//-----------------------------------------------------------------------------
+void Chuck_VM_Shreduler::heap_remove( t_CKINT i )
+{
+    Chuck_VM_Shred * out = shred_heap[i];
+    Chuck_VM_Shred * last = shred_heap.back();
+    shred_heap.pop_back();
+    out->heap_index = -1;
+
+    // fill the hole with the last, and put it in place
+    if( last != out )
+    {
+        heap_set( i, last );
+        heap_up( i );
+        heap_down( last->heap_index );
+    }
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: highest()
 // desc: get ID of shred currently with the highest ID
@@ -2763,24 +3538,15 @@ t_CKBOOL Chuck_VM_Shreduler::replace( Chuck_VM_Shred * out, Chuck_VM_Shred * in
     assert( FALSE );
 
     // sanity check
-    if( !out || !in )
+    if( !out || !in || out->heap_index < 0 )
         return FALSE;
 
-    if( !out->prev )
-        shred_list = in;
-    else
-        out->prev->next = in;
-
-    if( out->next )
-        out->next->prev = in;
-
-    in->next = out->next;
-    in->prev = out->prev;
-
-    out->next = out->prev = NULL;
-
+    // take out's place in the queue
     in->wake_time = out->wake_time;
     in->start = in->wake_time;
+    in->heap_order = out->heap_order;
+    heap_set( out->heap_index, in );
+    out->heap_index = -1;
 
     return TRUE;
 }
@@ -2812,18 +3578,12 @@ t_CKBOOL Chuck_VM_Shreduler::remove( Chuck_VM_Shred * out )
     }
 
     // sanity check
-    if( !out->prev && !out->next && out != shred_list )
+    if( out->heap_index < 0 || out->heap_index >= (t_CKINT)shred_heap.size() ||
+        shred_heap[out->heap_index] != out )
         return FALSE;
 
-    if( !out->prev )
-        shred_list = out->next;
-    else
-        out->prev->next = out->next;
-
-    if( out->next )
-        out->next->prev = out->prev;
-
-    out->next = out->prev = NULL;
+    // take it off the queue
+    heap_remove( out->heap_index );
 
     return TRUE;
 }
@@ -2837,19 +3597,17 @@ t_CKBOOL Chuck_VM_Shreduler::remove( Chuck_VM_Shred * out )
 //-----------------------------------------------------------------------------
 Chuck_VM_Shred * Chuck_VM_Shreduler::lookup( t_CKUINT xid ) const
 {
-    Chuck_VM_Shred * shred = shred_list;
+    Chuck_VM_Shred * shred = NULL;
 
     // current shred?
     if( m_current_shred != NULL && m_current_shred->xid == xid )
         return m_current_shred;
 
-    // look for in shreduled list
-    while( shred )
+    // look for in shreduled queue
+    for( t_CKUINT i = 0; i < shred_heap.size(); i++ )
     {
-        if( shred->xid == xid )
-            return shred;
-
-        shred = shred->next;
+        if( shred_heap[i]->xid == xid )
+            return shred_heap[i];
     }
 
     // blocked?
@@ -2884,17 +3642,12 @@ void Chuck_VM_Shreduler::get_ready_shreds( std::vector<Chuck_VM_Shred *> & shred
     // clear; if not clear, then will append to existing contents
     if( clearVector ) shreds.clear();
 
-    // shred pointer
-    Chuck_VM_Shred * shred = shred_list;
-
-    // traverse shred list
-    while( shred )
-    {
-        // add
-        shreds.push_back( shred );
-        // next
-        shred = shred->next;
-    }
+    // where the ready shreds start
+    t_CKUINT start = shreds.size();
+    // add
+    shreds.insert( shreds.end(), shred_heap.begin(), shred_heap.end() );
+    // sort by wake time (in the heap, only the first is in place)
+    std::sort( shreds.begin() + start, shreds.end(), heap_before );
 }
 
 
@@ -3054,7 +3807,7 @@ void Chuck_VM_Shreduler::get_all_shred_ids( std::vector<t_CKUINT> & shredIDs,
 //-----------------------------------------------------------------------------
 void Chuck_VM_Shreduler::status( Chuck_VM_Status * status )
 {
-    Chuck_VM_Shred * shred = shred_list;
+    Chuck_VM_Shred * shred = NULL;
 
     t_CKUINT srate = vm_ref->srate(); // 1.3.5.3; was: Digitalio::sampling_rate();
     t_CKUINT s = (t_CKUINT)now_system;
@@ -3287,10 +4040,8 @@ t_CKBOOL Chuck_VM_MFunInvoker::setup( Chuck_Func * func, t_CKUINT func_vt_offset
     instructions.push_back( instr_pushThis );
     // reg dup last (push this again) (for member func resolution)
     instructions.push_back( new Chuck_Instr_Reg_Dup_Last);
-    // dot member func
-    instructions.push_back( new Chuck_Instr_Dot_Member_Func(func_vt_offset) );
-    // func to code
-    instructions.push_back( new Chuck_Instr_Func_To_Code );
+    // dot member func, straight to code (with func to code folded in)
+    instructions.push_back( new Chuck_Instr_Dot_Member_Func(func_vt_offset, TRUE) );
     // push stack depth (in bytes)
     instructions.push_back( new Chuck_Instr_Reg_Push_Imm(args_size_bytes) );
     // func call
@@ -3369,6 +4120,8 @@ t_CKBOOL Chuck_VM_MFunInvoker::setup( Chuck_Func * func, t_CKUINT func_vt_offset
     code->stack_depth = 0;
     // TODO: should this be this true?
     code->need_this = FALSE;
+    // operands are patched on each invoke(); don't inline them | 1.5.1.7
+    code->threaded_inline = FALSE;
 
     // create dedicated shred
     shred = new Chuck_VM_Shred;
@@ -3730,6 +4483,7 @@ void Chuck_VM_Debug::print_stats()
     DEBUG_LOG( TC::blue("VM DEBUG: total destructed: %ld",true).c_str(), m_numDestructed );
     DEBUG_LOG( TC::blue("VM DEBUG: total add refs: %ld",true).c_str(), m_numAddRefs );
     DEBUG_LOG( TC::blue("VM DEBUG: total release refs: %ld",true).c_str(), m_numReleases );
+    DEBUG_LOG( TC::blue("VM DEBUG: total string storage allocations: %ld",true).c_str(), m_numStringStorage );
 }
 
 
@@ -3743,6 +4497,42 @@ void Chuck_VM_Debug::reset_stats()
     m_numDestructed = 0;
     m_numAddRefs = 0;
     m_numReleases = 0;
+    m_poolLastAllocs = 0;
+    m_poolLastTime = 0;
+    m_numStringStorage = 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// print object pool stats, once per second of VM time | 1.5.1.7
+//-----------------------------------------------------------------------------
+void Chuck_VM_Debug::pool_stats( Chuck_VM_Pool * pool, t_CKTIME now, t_CKUINT srate )
+{
+    // not yet
+    if( !pool || now - m_poolLastTime < srate ) return;
+
+    // allocations since last time, per second
+    Chuck_VM_Pool_Stats stats = pool->stats();
+    t_CKUINT allocs = stats.allocs + stats.heap_allocs;
+    t_CKFLOAT rate = (allocs - m_poolLastAllocs) * srate / (now - m_poolLastTime);
+    DEBUG_LOG( TC::blue("VM DEBUG: pool allocations/sec: %.1f (%lu from heap total)",true).c_str(), rate, stats.heap_allocs );
+    DEBUG_LOG( TC::blue("VM DEBUG: pool occupancy: %.1f%% (%lu/%lu blocks, %lu slabs)",true).c_str(),
+               stats.occupancy() * 100, stats.live, stats.capacity, stats.slabs );
+
+    // remember
+    m_poolLastAllocs = allocs;
+    m_poolLastTime = now;
+}
+
+
+//-----------------------------------------------------------------------------
+// count string storage (re)allocations, i.e., past the string's own small
+// buffer or its previous capacity | 1.5.1.7
+//-----------------------------------------------------------------------------
+void Chuck_VM_Debug::string_storage( Chuck_String * str )
+{
+    // count
+    m_numStringStorage++;
 }
 
 
@@ -56,6 +56,18 @@
 #define CKVM_MEM_STACK_SIZE          (0x1 << 16)
 #define CKVM_REG_STACK_SIZE          (0x1 << 14)
 
+// instruction dispatch modes | 1.5.1.7
+// classic: call each Chuck_Instr's virtual execute()
+// threaded: run a direct-threaded form of the code (handler + inline operand)
+// jit: threaded, and compile hot code to native code where supported
+#define CKVM_DISPATCH_CLASSIC        0
+#define CKVM_DISPATCH_THREADED       1
+#define CKVM_DISPATCH_JIT            2
+
+// default number of finished shreds (and stack pairs) kept for reuse by
+// each VM, instead of being freed and re-allocated on spork | 1.5.1.7
+#define CKVM_SHRED_POOL_SIZE         128
+
 
 // forward references
 struct Chuck_Instr;
@@ -65,7 +77,9 @@ struct Chuck_VM_FTable;
 struct Chuck_Msg;
 struct Chuck_Globals_Manager; // added 1.4.1.0 (jack)
 struct Chuck_Instr_Reg_Push_Imm; // 1.5.1.5 (ge)
+struct Chuck_VM_Threaded_Op; // 1.5.1.7
 class CBufferSimple;
+class CBufferMulti;
 #ifndef __DISABLE_SERIAL__
 // hack: spencer?
 struct Chuck_IO_Serial;
@@ -94,6 +108,8 @@ public:
     t_CKBOOL initialize( t_CKUINT size );
     // shutdown and cleanup stack
     t_CKBOOL shutdown();
+    // make an initialized stack as good as new, for reuse | 1.5.1.7
+    void reset();
 
 //-----------------------------------------------------------------------------
 // data
@@ -126,12 +142,44 @@ public:
     Chuck_VM_Code();
     // destructor
     virtual ~Chuck_VM_Code();
+    // owned by the compiler/VM; delete right away | 1.5.1.7
+    virtual t_CKBOOL reclaimable() const { return FALSE; }
+
+public:
+    // get the direct-threaded form of this code (lowered on first use)
+    Chuck_VM_Threaded_Op * threaded_ops();
+    // statically verify operand stack use; on success sets stack_verified
+    // and reg_depth | 1.5.1.7
+    t_CKBOOL verify();
 
 public:
     // array of Chuck_Instr *, should always end with Chuck_Instr_EOF
     Chuck_Instr ** instr;
     // size of the array
     t_CKUINT num_instr;
+    // direct-threaded form of instr; NULL until lowered | 1.5.1.7
+    Chuck_VM_Threaded_Op * threaded;
+    // whether operands may be inlined when lowering; set to FALSE for
+    // code whose instructions are patched at runtime | 1.5.1.7
+    t_CKBOOL threaded_inline;
+    // number of instructions eliminated by superinstruction fusion when
+    // this code was emitted (i.e., num_instr is that much smaller) | 1.5.1.7
+    t_CKUINT num_fused;
+    // whether the stack use of this code is statically known; if so the VM
+    // checks stack space once on entry instead of after each instruction,
+    // using the following (in bytes, relative to the stack pointers on
+    // entry) | 1.5.1.7
+    t_CKBOOL stack_verified;
+    // maximum depth of the operand (reg) stack
+    t_CKUINT reg_depth;
+    // maximum depth of local variables on the memory stack
+    t_CKUINT mem_depth;
+    // number of entries and backward jumps seen by the JIT dispatch mode,
+    // which compiles this code on reaching CKVM_JIT_THRESHOLD | 1.5.1.7
+    t_CKUINT jit_count;
+    // compiled native code (see chuck_jit.h), and its size in bytes
+    void * jit_native;
+    t_CKUINT jit_size;
 
     // name of this code
     std::string name;
@@ -148,6 +196,8 @@ public:
 
     // filename this code came from (added 1.3.0.0)
     std::string filename;
+    // slots of the string literals this code pushes | 1.5.1.7
+    std::vector<Chuck_String **> literals;
 
     // native func types
     enum { NATIVE_UNKNOWN, NATIVE_CTOR, NATIVE_DTOR, NATIVE_MFUN, NATIVE_SFUN };
@@ -170,6 +220,8 @@ public:
     Chuck_VM_Shred( );
     // destructor
     virtual ~Chuck_VM_Shred( );
+    // owned by the VM (and its pool); delete right away | 1.5.1.7
+    virtual t_CKBOOL reclaimable() const { return FALSE; }
 
     // initialize shred
     t_CKBOOL initialize( Chuck_VM_Code * c,
@@ -177,8 +229,13 @@ public:
                          t_CKUINT reg_st_size = 0 );
     // shutdown shred
     t_CKBOOL shutdown();
+    // shutdown shred, and return it to the state of a new shred; the
+    // object (and its stacks, if pass NULL) can then be reused | 1.5.1.7
+    t_CKBOOL recycle( Chuck_VM_Stack ** mem_out, Chuck_VM_Stack ** reg_out );
     // run the shred on vm
     t_CKBOOL run( Chuck_VM * vm );
+    // run the shred on vm, using direct-threaded dispatch | 1.5.1.7
+    t_CKBOOL run_threaded( Chuck_VM * vm );
     // yield the shred in vm (without advancing time, politely yield to run
     // all other shreds waiting to run at the current (i.e., 0::second +=> now;)
     t_CKBOOL yield(); // 1.5.0.5 (ge) made this a function from scattered code
@@ -257,6 +314,9 @@ public:
 
     // event shred is waiting on
     Chuck_Event * event;
+    // neighbors in that event's list of waiting shreds | 1.5.1.7
+    Chuck_VM_Shred * event_prev;
+    Chuck_VM_Shred * event_next;
     // map of ugens for the shred
     std::map<Chuck_UGen *, Chuck_UGen *> m_ugen_map;
     // references kept by the shred itself (e.g., when sporking member functions)
@@ -269,9 +329,10 @@ public: // id
     std::vector<std::string> args;
 
 public:
-    // linked list
-    Chuck_VM_Shred * prev;
-    Chuck_VM_Shred * next;
+    // position in the shreduler's ready queue; -1 if not shreduled | 1.5.1.7
+    t_CKINT heap_index;
+    // order shreduled in; breaks ties between equal wake times (FIFO)
+    t_CKUINT heap_order;
 
     // tracking
     CK_TRACK( Shred_Stat * stat );
@@ -492,6 +553,17 @@ public: // for event related shred queue (shred interface part 4)
     t_CKBOOL add_blocked( Chuck_VM_Shred * shred );
     t_CKBOOL remove_blocked( Chuck_VM_Shred * shred );
 
+protected: // ready queue (binary heap by wake time, then order) | 1.5.1.7
+    // does lhs run before rhs?
+    static t_CKBOOL heap_before( const Chuck_VM_Shred * lhs, const Chuck_VM_Shred * rhs );
+    // put shred_heap[i] in its place, moving up or down
+    void heap_up( t_CKINT i );
+    void heap_down( t_CKINT i );
+    // place shred at index i
+    void heap_set( t_CKINT i, Chuck_VM_Shred * shred );
+    // take shred_heap[i] out
+    void heap_remove( t_CKINT i );
+
 //-----------------------------------------------------------------------------
 // data
 //-----------------------------------------------------------------------------
@@ -501,8 +573,11 @@ public:
     // added ge: 1.3.5.3
     Chuck_VM * vm_ref;
 
-    // shreds to be shreduled
-    Chuck_VM_Shred * shred_list;
+    // shreds to be shreduled; a binary heap, earliest wake time first and
+    // in order shreduled for equal wake times | 1.5.1.7 (was sorted list)
+    std::vector<Chuck_VM_Shred *> shred_heap;
+    // number of shredulings so far (see Chuck_VM_Shred::heap_order)
+    t_CKUINT m_shredule_count;
     // shreds waiting on events
     std::map<Chuck_VM_Shred *, Chuck_VM_Shred *> blocked;
     // current shred | TODO: ref count?
@@ -514,6 +589,8 @@ public:
     Chuck_UGen * m_bunghole;
     t_CKUINT m_num_dac_channels;
     t_CKUINT m_num_adc_channels;
+    // what dac and bunghole pull, flattened | 1.5.1.7
+    Chuck_UGen_Schedule m_ugen_schedule;
 
     // status cache
     Chuck_VM_Status m_status;
@@ -541,6 +618,8 @@ public:
     Chuck_VM();
     // destructor
     virtual ~Chuck_VM();
+    // owns the reclaimer; delete right away | 1.5.1.7
+    virtual t_CKBOOL reclaimable() const { return FALSE; }
 
 public:
     // initialize VM
@@ -565,6 +644,23 @@ public: // run state; 1.3.5.3
     // const access state directly (should be called from inside VM only)
     const t_CKBOOL & runningState() const { return m_is_running; }
 
+public: // instruction dispatch | 1.5.1.7
+    // set how shreds execute VM code (see CKVM_DISPATCH_*)
+    void set_dispatch( t_CKUINT mode ) { m_dispatch = mode; }
+    // get dispatch mode
+    t_CKUINT dispatch() const { return m_dispatch; }
+
+public: // shred and stack pools | 1.5.1.7
+    // get a new shred (with vm_ref set), reused from the pool if possible
+    Chuck_VM_Shred * alloc_shred();
+    // get an initialized stack of 'size' bytes, reused if possible
+    Chuck_VM_Stack * alloc_stack( t_CKUINT size );
+    // set maximum number of shreds (and stack pairs) kept for reuse;
+    // 0 disables pooling
+    void set_shred_pool( t_CKUINT max );
+    // get maximum number of shreds kept for reuse
+    t_CKUINT shred_pool() const { return m_shred_pool_max; }
+
 public: // shredsuck
     // spork code as shred; if not immediate, enqueue for next sample
     // REFACTOR-2017: added immediate flag
@@ -587,8 +683,21 @@ public: // audio
 public: // running the machine
     // compute next N frames
     t_CKBOOL run( t_CKINT numFrames, const SAMPLE * input, SAMPLE * output );
-    // compute all shreds for current time
-    t_CKBOOL compute();
+    // compute all shreds for current time; `poll`: also take in msgs,
+    // global requests, and event broadcasts queued by other threads
+    t_CKBOOL compute( t_CKBOOL poll = TRUE );
+    // how often run() takes in what other threads queued: at the start
+    // of each block, then every `frames` frames; 1: every frame
+    // (default); 0: once per block | 1.5.1.7
+    void set_poll( t_CKUINT frames ) { m_poll = frames; }
+    // get poll interval, in frames (0: once per block)
+    t_CKUINT poll() const { return m_poll; }
+    // how many threads tick the ugen graph, counting the audio thread,
+    // when computing in blocks (adaptive); see Chuck_UGen_Schedule | 1.5.1.7
+    void set_threads( t_CKUINT threads );
+    // when the current (or last) block started; frame offsets of queued
+    // msgs and global requests count from here | 1.5.1.7
+    t_CKTIME block_start() const { return m_block_start; }
     // abort current running shred
     t_CKBOOL abort_current_shred();
 
@@ -596,8 +705,49 @@ public: // invoke functions
     t_CKBOOL invoke_static( Chuck_VM_Shred * shred );
 
 public: // garbage collection
+    // delete the next slice of deferred objects (see set_reclaim())
     void gc();
+    // delete up to `amount` deferred objects
     void gc( t_CKUINT amount );
+    // defer deletion of released objects, deleting up to `budget` of
+    // them per block; 0 deletes right away (default) | 1.5.1.7
+    void set_reclaim( t_CKUINT budget );
+    // get the reclaimer (NULL if objects are deleted right away)
+    Chuck_VM_Reclaimer * reclaimer() const { return m_reclaimer; }
+    // look for unreachable reference cycles, scanning up to `budget`
+    // objects per block; 0 collects what it can and turns it off
+    // (default) | 1.5.1.7
+    void set_collect( t_CKUINT budget );
+    // get the cycle collector (NULL if off)
+    Chuck_VM_Cycle_Collector * collector() const { return m_collector; }
+
+public: // object memory | 1.5.1.7
+    // get the pool objects and their data are allocated from (see
+    // chuck_pool.h); NULL after shutdown
+    Chuck_VM_Pool * pool() const { return m_pool; }
+    // set/get whether to print each reallocation of (this VM's) array
+    // storage (see Chuck_Array::grow_check())
+    void set_realloc_report( t_CKBOOL report ) { m_realloc_report = report; }
+    t_CKBOOL realloc_report() const { return m_realloc_report; }
+    // count a reallocation of array (or deque) storage; get the count
+    void count_realloc() { m_realloc_count++; }
+    t_CKUINT reallocs() const { return m_realloc_count; }
+
+public: // inline caches | 1.5.1.7
+    // count a member function lookup answered by a call site's inline
+    // cache, or one that went through the vtable (see
+    // Chuck_Instr_Dot_Member_Func); get the counts
+    void count_ic_hit() { m_ic_hits++; }
+    void count_ic_miss() { m_ic_misses++; }
+    t_CKUINT ic_hits() const { return m_ic_hits; }
+    t_CKUINT ic_misses() const { return m_ic_misses; }
+
+public: // ugen graph | 1.5.1.7
+    // note that a connection among this VM's ugens was made or broken, or
+    // one went away (any thread); the ugen schedule recompiles when the
+    // version changes (see Chuck_UGen_Schedule)
+    void graph_changed() { m_graph_version++; }
+    t_CKUINT graph_version() const { return m_graph_version.load( std::memory_order_relaxed ); }
 
 public: // VM message queue
     // queue message to process at next VM compute block (thread-safe but not synchronous)
@@ -611,9 +761,11 @@ public: // VM message queue
     // get reply from reply buffer
     Chuck_Msg * get_reply();
 
-    // CBufferSimple added 1.3.0.0 to fix uber-crash
+    // queue a broadcast of event, from any thread; wait-free | 1.5.1.7
+    // (buffer is no longer used; kept for compatibility, added 1.3.0.0)
     t_CKBOOL queue_event( Chuck_Event * event, t_CKINT num_msg = 1, CBufferSimple * buffer = NULL );
     // added 1.3.0.0 to fix uber-crash (allocates and attaches new buffer)
+    // NOTE since 1.5.1.7 events are no longer carried by these buffers
     CBufferSimple * create_event_buffer();
     // added 1.3.0.0 to fix uber-crash (detaches and deletes buffer)
     void destroy_event_buffer( CBufferSimple * buffer );
@@ -659,6 +811,8 @@ public:
     t_CKUINT m_num_dac_channels;
     t_CKBOOL m_halt;
     t_CKBOOL m_is_running;
+    // instruction dispatch mode | 1.5.1.7
+    t_CKUINT m_dispatch;
 
     // for shreduler, ge: 1.3.5.3
     const SAMPLE * input_ref() { return m_input_ref; }
@@ -671,6 +825,10 @@ protected:
     const SAMPLE * m_input_ref;
     SAMPLE * m_output_ref;
     t_CKUINT m_current_buffer_frames;
+    // frames between taking in queued msgs/requests/broadcasts | 1.5.1.7
+    t_CKUINT m_poll;
+    // when the current block started | 1.5.1.7
+    t_CKTIME m_block_start;
 
 public:
     // protected, but needs to be accessible from Globals Manager (1.4.1.0)
@@ -685,6 +843,10 @@ protected:
                          t_CKBOOL dec = TRUE );
     void dump_shred( Chuck_VM_Shred * shred );
     void release_dump();
+    // keep a dumped shred (and its stacks) for reuse; FALSE if can't
+    t_CKBOOL pool_shred( Chuck_VM_Shred * shred );
+    // free everything in the pools
+    void clear_pool();
 
 protected:
     t_CKBOOL m_init;
@@ -699,15 +861,49 @@ protected:
     // place to put dumped shreds
     std::vector<Chuck_VM_Shred *> m_shred_dump;
     t_CKUINT m_num_dumped_shreds;
-
-    // message queue
-    CBufferSimple * m_msg_buffer;
+    // finished shreds and stacks kept for reuse | 1.5.1.7
+    std::vector<Chuck_VM_Shred *> m_shred_pool;
+    std::vector<Chuck_VM_Stack *> m_stack_pool;
+    t_CKUINT m_shred_pool_max;
+    // deferred object deletion | 1.5.1.7
+    Chuck_VM_Reclaimer * m_reclaimer;
+    // cycle collection | 1.5.1.7
+    Chuck_VM_Cycle_Collector * m_collector;
+    // object memory pool | 1.5.1.7
+    Chuck_VM_Pool * m_pool;
+    // array storage reallocations: report each? how many | 1.5.1.7
+    t_CKBOOL m_realloc_report;
+    t_CKUINT m_realloc_count;
+    // inline cache hits and misses, over all call sites | 1.5.1.7
+    t_CKUINT m_ic_hits;
+    t_CKUINT m_ic_misses;
+    // ugen graph version | 1.5.1.7
+    std::atomic<t_CKUINT> m_graph_version;
+
+    // message queue (any thread may queue_msg() | 1.5.1.7)
+    CBufferMulti * m_msg_buffer;
     CBufferSimple * m_reply_buffer;
-    CBufferSimple * m_event_buffer;
+    // msgs with a frame offset, held until due (VM thread) | 1.5.1.7
+    std::multimap<t_CKTIME, Chuck_Msg *> m_held_msgs;
+    // hold msg if its frame offset is still to come; FALSE if due now
+    t_CKBOOL hold_msg( Chuck_Msg * msg );
 
     // TODO: vector? (added 1.3.0.0 to fix uber-crash)
     std::list<CBufferSimple *> m_event_buffers;
 
+protected: // queued event broadcasts | 1.5.1.7
+    // push an event's link onto the broadcast queue (any thread)
+    void push_broadcast( Chuck_Event_Link * link );
+    // pop the next link off the broadcast queue (VM thread); NULL if none
+    Chuck_Event_Link * pop_broadcast();
+    // carry out queued broadcasts; returns whether there were any
+    t_CKBOOL run_broadcasts();
+    // intrusive multi-producer, single-consumer queue of event links,
+    // after Vyukov; producers push with a single atomic exchange
+    std::atomic<Chuck_Event_Link *> m_broadcast_tail;
+    Chuck_Event_Link * m_broadcast_head;
+    Chuck_Event_Link m_broadcast_stub;
+
 protected:
     // 1.4.1.0 (jack): manager for global variables
     Chuck_Globals_Manager * m_globals_manager;
@@ -788,6 +984,10 @@ struct Chuck_Msg
     // argument array pointer
     std::vector<std::string> * args;
 
+    // frame offset into the block in which the VM takes this msg in,
+    // for sample-accurate timing; 0: right away | 1.5.1.7
+    t_CKUINT offset;
+
     // constructor
     Chuck_Msg() : args(NULL) { clear(); }
     // destructor
@@ -919,6 +1119,11 @@ public:
     void print_stats();
     // reset stats
     void reset_stats();
+    // print object pool allocations per second and occupancy, at most
+    // once per second of VM time | 1.5.1.7
+    void pool_stats( Chuck_VM_Pool * pool, t_CKTIME now, t_CKUINT srate );
+    // call this when a string (re)allocates its storage (tracking) | 1.5.1.7
+    void string_storage( Chuck_String * str );
 
 public:
     // one func to get info using runtime types
@@ -981,6 +1186,11 @@ protected:
     t_CKUINT m_numDestructed;
     t_CKUINT m_numAddRefs;
     t_CKUINT m_numReleases;
+    // pool stats as of the last pool_stats() | 1.5.1.7
+    t_CKUINT m_poolLastAllocs;
+    t_CKTIME m_poolLastTime;
+    // string storage (re)allocations | 1.5.1.7
+    t_CKUINT m_numStringStorage;
 };
 #endif
 
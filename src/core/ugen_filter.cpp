@@ -167,6 +167,10 @@ DLL_QUERY filter_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "BPF", "FilterBasic", env->global(),
                                         BPF_ctor, NULL, BPF_tick, BPF_pmsg, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.1.7
+    if( !type_engine_import_ugen_tickv( env, BPF_tickv ) ) goto error;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     type_engine_import_add_ex(env, "filter/bpf.ck");
 
@@ -206,6 +210,10 @@ DLL_QUERY filter_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "BRF", "FilterBasic", env->global(),
                                         BRF_ctor, NULL, BRF_tick, BRF_pmsg, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.1.7
+    if( !type_engine_import_ugen_tickv( env, BRF_tickv ) ) goto error;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     type_engine_import_add_ex(env, "filter/brf.ck");
 
@@ -245,6 +253,10 @@ DLL_QUERY filter_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "LPF", "FilterBasic", env->global(),
                                         RLPF_ctor, NULL, RLPF_tick, RLPF_pmsg, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.1.7
+    if( !type_engine_import_ugen_tickv( env, RLPF_tickv ) ) goto error;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // add examples
     type_engine_import_add_ex(env, "filter/lpf.ck");
@@ -286,6 +298,10 @@ DLL_QUERY filter_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "HPF", "FilterBasic", env->global(),
                                         RHPF_ctor, NULL, RHPF_tick, RHPF_pmsg, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.1.7
+    if( !type_engine_import_ugen_tickv( env, RHPF_tickv ) ) goto error;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // add examples
     type_engine_import_add_ex(env, "filter/hpf.ck");
@@ -327,6 +343,10 @@ DLL_QUERY filter_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "ResonZ", "FilterBasic", env->global(),
                                         ResonZ_ctor, NULL, ResonZ_tick, ResonZ_pmsg, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.1.7
+    if( !type_engine_import_ugen_tickv( env, ResonZ_tickv ) ) goto error;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // freq
     func = make_new_mfun( "float", "freq", ResonZ_ctrl_freq );
@@ -367,6 +387,10 @@ DLL_QUERY filter_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "BiQuad", "UGen", env->global(),
                                         biquad_ctor, biquad_dtor, biquad_tick, NULL, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.1.7
+    if( !type_engine_import_ugen_tickv( env, biquad_tickv ) ) goto error;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // member variable
     biquad_offset_data = type_engine_import_mvar ( env, "int", "@biquad_data", FALSE );
@@ -1019,6 +1043,18 @@ struct FilterBasic_data
 
 };
 
+// block tick for FilterBasic filters: run `tick` over the block on a copy of
+// the state, which the compiler can keep in registers (it can't assume `out`
+// doesn't alias `d`) | 1.5.1.7
+template <SAMPLE (FilterBasic_data::*tick)( SAMPLE )>
+static inline void FilterBasic_tickv( FilterBasic_data * d, SAMPLE * in, SAMPLE * out, t_CKUINT nframes )
+{
+    FilterBasic_data f = *d;
+    for( t_CKUINT i = 0; i < nframes; i++ ) out[i] = (f.*tick)( in[i] );
+    d->m_y1 = f.m_y1;
+    d->m_y2 = f.m_y2;
+}
+
 struct Teabox_data
 {
     //Teabox sensor interface read
@@ -1345,6 +1381,18 @@ CK_DLL_TICK( BPF_tick )
 }
 
 
+//-----------------------------------------------------------------------------
+// name: BPF_tickv()
+// desc: block TICK function | 1.5.1.7
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( BPF_tickv )
+{
+    FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
+    FilterBasic_tickv<&FilterBasic_data::tick_bpf>( d, in, out, nframes );
+    return TRUE;
+}
+
+
 //-----------------------------------------------------------------------------
 // name: BPF_ctrl_freq()
 // desc: CTRL function
@@ -1481,6 +1529,18 @@ CK_DLL_TICK( BRF_tick )
 }
 
 
+//-----------------------------------------------------------------------------
+// name: BRF_tickv()
+// desc: block TICK function | 1.5.1.7
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( BRF_tickv )
+{
+    FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
+    FilterBasic_tickv<&FilterBasic_data::tick_brf>( d, in, out, nframes );
+    return TRUE;
+}
+
+
 //-----------------------------------------------------------------------------
 // name: BRF_ctrl_freq()
 // desc: CTRL function
@@ -1622,6 +1682,18 @@ CK_DLL_TICK( RLPF_tick )
 }
 
 
+//-----------------------------------------------------------------------------
+// name: RLPF_tickv()
+// desc: block TICK function | 1.5.1.7
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( RLPF_tickv )
+{
+    FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
+    FilterBasic_tickv<&FilterBasic_data::tick_rlpf>( d, in, out, nframes );
+    return TRUE;
+}
+
+
 //-----------------------------------------------------------------------------
 // name: RLPF_ctrl_freq()
 // desc: CTRL function
@@ -1760,6 +1832,18 @@ CK_DLL_TICK( ResonZ_tick )
 }
 
 
+//-----------------------------------------------------------------------------
+// name: ResonZ_tickv()
+// desc: block TICK function | 1.5.1.7
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( ResonZ_tickv )
+{
+    FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
+    FilterBasic_tickv<&FilterBasic_data::tick_resonz>( d, in, out, nframes );
+    return TRUE;
+}
+
+
 //-----------------------------------------------------------------------------
 // name: ResonZ_ctrl_freq()
 // desc: CTRL function
@@ -1907,6 +1991,18 @@ CK_DLL_TICK( RHPF_tick )
 }
 
 
+//-----------------------------------------------------------------------------
+// name: RHPF_tickv()
+// desc: block TICK function | 1.5.1.7
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( RHPF_tickv )
+{
+    FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
+    FilterBasic_tickv<&FilterBasic_data::tick_rhpf>( d, in, out, nframes );
+    return TRUE;
+}
+
+
 //-----------------------------------------------------------------------------
 // name: RHPF_ctrl_freq()
 // desc: CTRL function
@@ -2175,6 +2271,43 @@ CK_DLL_TICK( biquad_tick )
     return TRUE;
 }
 
+//-----------------------------------------------------------------------------
+// name: biquad_tickv()
+// desc: block TICK function; as biquad_tick(), with the state in locals,
+//       written back after the block | 1.5.1.7
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( biquad_tickv )
+{
+    biquad_data * d = (biquad_data *)OBJ_MEMBER_UINT(SELF, biquad_offset_data );
+
+    SAMPLE a0 = d->m_a0, a1 = d->m_a1, a2 = d->m_a2;
+    SAMPLE b0 = d->m_b0, b1 = d->m_b1, b2 = d->m_b2;
+    SAMPLE input0 = d->m_input0, input1 = d->m_input1, input2 = d->m_input2;
+    SAMPLE output0 = d->m_output0, output1 = d->m_output1, output2 = d->m_output2;
+
+    for( t_CKUINT i = 0; i < nframes; i++ )
+    {
+        input0 = a0 * in[i];
+        output0 = b0 * input0 + b1 * input1 + b2 * input2;
+        output0 -= a2 * output2 + a1 * output1;
+        input2 = input1;
+        input1 = input0;
+        output2 = output1;
+        output1 = output0;
+
+        // be normal
+        CK_DDN(output1);
+        CK_DDN(output2);
+
+        out[i] = (SAMPLE)output0;
+    }
+
+    d->m_input0 = input0; d->m_input1 = input1; d->m_input2 = input2;
+    d->m_output0 = output0; d->m_output1 = output1; d->m_output2 = output2;
+
+    return TRUE;
+}
+
 void biquad_set_reson( biquad_data * d )
 {
     d->m_a2 = (SAMPLE)(d->prad * d->prad);
@@ -71,6 +71,7 @@ CK_DLL_CGET( HPF_cget_freq );
 CK_DLL_CTOR( BPF_ctor );
 CK_DLL_DTOR( BPF_dtor );
 CK_DLL_TICK( BPF_tick );
+CK_DLL_TICKV( BPF_tickv );
 CK_DLL_PMSG( BPF_pmsg );
 CK_DLL_CTRL( BPF_ctrl_freq );
 CK_DLL_CGET( BPF_cget_freq );
@@ -82,6 +83,7 @@ CK_DLL_CTRL( BPF_ctrl_set );
 CK_DLL_CTOR( BRF_ctor );
 CK_DLL_DTOR( BRF_dtor );
 CK_DLL_TICK( BRF_tick );
+CK_DLL_TICKV( BRF_tickv );
 CK_DLL_PMSG( BRF_pmsg );
 CK_DLL_CTRL( BRF_ctrl_freq );
 CK_DLL_CGET( BRF_cget_freq );
@@ -93,6 +95,7 @@ CK_DLL_CTRL( BRF_ctrl_set );
 CK_DLL_CTOR( RLPF_ctor );
 CK_DLL_DTOR( RLPF_dtor );
 CK_DLL_TICK( RLPF_tick );
+CK_DLL_TICKV( RLPF_tickv );
 CK_DLL_PMSG( RLPF_pmsg );
 CK_DLL_CTRL( RLPF_ctrl_freq );
 CK_DLL_CGET( RLPF_cget_freq );
@@ -104,6 +107,7 @@ CK_DLL_CTRL( RLPF_ctrl_set );
 CK_DLL_CTOR( RHPF_ctor );
 CK_DLL_DTOR( RHPF_dtor );
 CK_DLL_TICK( RHPF_tick );
+CK_DLL_TICKV( RHPF_tickv );
 CK_DLL_PMSG( RHPF_pmsg );
 CK_DLL_CTRL( RHPF_ctrl_freq );
 CK_DLL_CGET( RHPF_cget_freq );
@@ -115,6 +119,7 @@ CK_DLL_CTRL( RHPF_ctrl_set );
 CK_DLL_CTOR( ResonZ_ctor );
 CK_DLL_DTOR( ResonZ_dtor );
 CK_DLL_TICK( ResonZ_tick );
+CK_DLL_TICKV( ResonZ_tickv );
 CK_DLL_PMSG( ResonZ_pmsg );
 CK_DLL_CTRL( ResonZ_ctrl_freq );
 CK_DLL_CGET( ResonZ_cget_freq );
@@ -134,6 +139,7 @@ CK_DLL_PMSG( filter_pmsg );
 CK_DLL_CTOR( biquad_ctor );
 CK_DLL_DTOR( biquad_dtor );
 CK_DLL_TICK( biquad_tick );
+CK_DLL_TICKV( biquad_tickv );
 
 CK_DLL_CTRL( biquad_ctrl_pfreq );
 CK_DLL_CGET( biquad_cget_pfreq );
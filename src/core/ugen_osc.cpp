@@ -36,12 +36,30 @@
 #include "chuck_type.h"
 #include "chuck_ugen.h"
 #include "chuck_compile.h"
+#include "chuck_errmsg.h"
 #include <math.h>
 #include <stdio.h>
+#ifndef __DISABLE_THREADS__
+#include "util_thread.h"
+#endif
+
+// SIMD block kernels (see below) | 1.5.1.7
+#if !defined(__CHUCK_NO_SIMD__) && (defined(__x86_64__) || defined(_M_X64))
+  // SSE2 is part of x86-64
+  #define __OSC_SSE2__
+  #include <emmintrin.h>
+  // AVX2, if the CPU has it (compiled for it per function; gcc / clang)
+  #if defined(__GNUC__) || defined(__clang__)
+    #define __OSC_AVX2__
+    #include <immintrin.h>
+  #endif
+#endif
 
 static t_CKUINT g_srateOsc = 0;
 // for member data offset
 static t_CKUINT osc_offset_data = 0;
+// which block kernels are in use (see below) | 1.5.1.7
+static const char * osc_kernels_name();
 
 
 //-----------------------------------------------------------------------------
@@ -52,6 +70,8 @@ DLL_QUERY osc_query( Chuck_DL_Query * QUERY )
 {
     // srate
     g_srateOsc = QUERY->srate;
+    // log | 1.5.1.7
+    EM_log( CK_LOG_FINE, "oscillator block kernels: %s", osc_kernels_name() );
     // get the env
     Chuck_Env * env = QUERY->env();
 
@@ -76,6 +96,10 @@ DLL_QUERY osc_query( Chuck_DL_Query * QUERY )
                                         osc_ctor, osc_dtor, osc_tick, osc_pmsg,
                                         doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.1.7
+    if( !type_engine_import_ugen_tickv( env, osc_tickv ) ) goto error;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // add member variable
     osc_offset_data = type_engine_import_mvar( env, "int", "@osc_data", FALSE );
@@ -135,6 +159,10 @@ DLL_QUERY osc_query( Chuck_DL_Query * QUERY )
                                         NULL, NULL, osc_tick, NULL,
                                         doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.1.7
+    if( !type_engine_import_ugen_tickv( env, osc_tickv ) ) goto error;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // add examples | 1.5.0.0 added
     if( !type_engine_import_add_ex( env, "basic/phasor.ck" ) ) goto error;
@@ -150,6 +178,19 @@ DLL_QUERY osc_query( Chuck_DL_Query * QUERY )
                                         NULL, NULL, sinosc_tick, NULL,
                                         doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.1.7
+    if( !type_engine_import_ugen_tickv( env, sinosc_tickv ) ) goto error;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
+
+    // add ctrl: table | 1.5.1.7
+    func = make_new_mfun( "int", "table", sinosc_ctrl_table );
+    func->add_arg( "int", "size" );
+    func->doc = "set size of a shared sine table to interpolate, instead of computing sin() for every sample: 0 (default) computes; otherwise rounded up to a power of two from 256 to 65536; larger tables are more accurate (worst error about -82dB at 256, -106dB at 1024, -130dB at 4096), smaller ones kinder to the cache. Returns the size used.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "int", "table", sinosc_cget_table );
+    func->doc = "get size of the sine table being interpolated; 0 if computing sin().";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
 
     // add examples | 1.5.0.0 (ge)
     type_engine_import_add_ex( env, "otf_05.ck" );
@@ -173,6 +214,10 @@ DLL_QUERY osc_query( Chuck_DL_Query * QUERY )
                                         NULL, NULL, triosc_tick, NULL,
                                         doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.1.7
+    if( !type_engine_import_ugen_tickv( env, triosc_tickv ) ) goto error;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     func = make_new_mfun( "float", "width", osc_ctrl_width );
     func->add_arg( "float", "width" );
@@ -225,6 +270,10 @@ DLL_QUERY osc_query( Chuck_DL_Query * QUERY )
                                         NULL, NULL, pulseosc_tick, NULL,
                                         doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.1.7
+    if( !type_engine_import_ugen_tickv( env, pulseosc_tickv ) ) goto error;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     func = make_new_mfun( "float", "width", osc_ctrl_width );
     func->add_arg( "float", "width" );
@@ -264,6 +313,112 @@ DLL_QUERY osc_query( Chuck_DL_Query * QUERY )
     // end the class import
     type_engine_import_class_end( env );
 
+    //---------------------------------------------------------------------
+    // blsawosc - band-limited sawtooth oscillator | 1.5.1.7
+    //---------------------------------------------------------------------
+    doc = "a band-limited sawtooth wave oscillator: as SawOsc, but without aliasing. Reads shared, precomputed wavetables (one per octave of frequency) that hold only the harmonics below Nyquist; like BlitSaw, at a fraction of the cost.";
+    if( !type_engine_import_ugen_begin( env, "BLSawOsc", "Osc", env->global(),
+                                        blsawosc_ctor, NULL, blsawosc_tick, NULL,
+                                        doc.c_str() ) )
+        return FALSE;
+    // block tick
+    if( !type_engine_import_ugen_tickv( env, blsawosc_tickv ) ) goto error;
+    // safe to tick alongside other ugens
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
+
+    func = make_new_mfun( "float", "width", sawosc_ctrl_width );
+    func->add_arg( "float", "width" );
+    func->doc = "whether sawtooth wave is to fall (0) or rise (1).";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "float", "width", osc_cget_width );
+    func->doc = "whether sawtooth wave is to fall (0) or rise (1).";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add examples
+    if( !type_engine_import_add_ex( env, "basic/blosc.ck" ) ) goto error;
+
+    // end the class import
+    type_engine_import_class_end( env );
+
+
+    //---------------------------------------------------------------------
+    // bltriosc - band-limited triangle oscillator | 1.5.1.7
+    //---------------------------------------------------------------------
+    doc = "a band-limited triangle wave oscillator: as TriOsc (at width 0.5), but without aliasing. Reads shared, precomputed wavetables (one per octave of frequency) that hold only the harmonics below Nyquist.";
+    if( !type_engine_import_ugen_begin( env, "BLTriOsc", "Osc", env->global(),
+                                        bltriosc_ctor, NULL, blosc_tick, NULL,
+                                        doc.c_str() ) )
+        return FALSE;
+    // block tick
+    if( !type_engine_import_ugen_tickv( env, blosc_tickv ) ) goto error;
+    // safe to tick alongside other ugens
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
+
+    // add examples
+    if( !type_engine_import_add_ex( env, "basic/blosc.ck" ) ) goto error;
+
+    // end the class import
+    type_engine_import_class_end( env );
+
+
+    //---------------------------------------------------------------------
+    // blpulseosc - band-limited pulse-width oscillator | 1.5.1.7
+    //---------------------------------------------------------------------
+    doc = "a band-limited pulse width oscillator: as PulseOsc, but without aliasing. The difference of two band-limited sawtooth waves, a width apart, read from shared, precomputed wavetables.";
+    if( !type_engine_import_ugen_begin( env, "BLPulseOsc", "Osc", env->global(),
+                                        blpulseosc_ctor, NULL, blpulseosc_tick, NULL,
+                                        doc.c_str() ) )
+        return FALSE;
+    // block tick
+    if( !type_engine_import_ugen_tickv( env, blpulseosc_tickv ) ) goto error;
+    // safe to tick alongside other ugens
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
+
+    func = make_new_mfun( "float", "width", osc_ctrl_width );
+    func->add_arg( "float", "width" );
+    func->doc = "set width of duty cycle [0,1).";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "float", "width", osc_cget_width );
+    func->doc = "get width of duty cycle [0,1).";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add examples
+    if( !type_engine_import_add_ex( env, "basic/blosc.ck" ) ) goto error;
+
+    // end the class import
+    type_engine_import_class_end( env );
+
+
+    //---------------------------------------------------------------------
+    // blsqrosc - band-limited square wave oscillator | 1.5.1.7
+    //---------------------------------------------------------------------
+    doc = "a band-limited square wave oscillator: as SqrOsc, but without aliasing (same as BLPulseOsc with 0.5 duty cycle, from its own table).";
+    if( !type_engine_import_ugen_begin( env, "BLSqrOsc", "BLPulseOsc", env->global(),
+                                        blsqrosc_ctor, NULL, blosc_tick, NULL,
+                                        doc.c_str() ) )
+        return FALSE;
+    // block tick
+    if( !type_engine_import_ugen_tickv( env, blosc_tickv ) ) goto error;
+    // safe to tick alongside other ugens
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
+
+    func = make_new_mfun( "float", "width", sqrosc_ctrl_width );
+    func->doc = "set width of duty cycle (always 0.5).";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    // (reads its own table, so setting the width has no effect)
+    func = make_new_mfun( "float", "width", sqrosc_ctrl_width );
+    func->add_arg( "float", "width" );
+    func->doc = "set width of duty cycle (always 0.5).";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // add examples
+    if( !type_engine_import_add_ex( env, "basic/blosc.ck" ) ) goto error;
+
+    // end the class import
+    type_engine_import_class_end( env );
+
     // include GenX!!!
     if( !genX_query( QUERY ) )
         return FALSE;
@@ -281,6 +436,227 @@ error:
 
 
 
+//-----------------------------------------------------------------------------
+// wavetables | 1.5.1.7
+// one period of a waveform at 2^bits points (plus 2 past the end, so reading
+// a point and the next never wraps), interpolated linearly; band-limited
+// waveforms are mipmapped: level k holds only harmonics up to (harmonics>>k),
+// and an oscillator reads the first level whose top harmonic is still under
+// Nyquist at its frequency -- so no harmonic ever folds back; the levels
+// depend only on frequency as a fraction of the sample rate, so one set per
+// waveform serves every sample rate; made the first time they are asked for,
+// and shared by every oscillator (in every VM) for the life of the process
+//-----------------------------------------------------------------------------
+// waveforms
+enum Osc_Waveform
+{
+    OSC_WAVE_SINE = 0,
+    // rising, from -1 to 1, as SawOsc (jump at phase .75)
+    OSC_WAVE_SAW,
+    // 1 then -1, as SqrOsc
+    OSC_WAVE_SQUARE,
+    // from 0 up to 1, down to -1, and back, as TriOsc
+    OSC_WAVE_TRIANGLE,
+    OSC_WAVE_COUNT
+};
+
+// sine table sizes (SinOsc.table())
+#define OSC_TABLE_MIN_BITS 8
+#define OSC_TABLE_MAX_BITS 16
+// band-limited tables: 4096 points; harmonics 512, 256, ..., 1 (8 points or
+// more per period of the top harmonic, for linear interpolation)
+#define OSC_BL_BITS 12
+#define OSC_BL_HARMONICS 512
+#define OSC_BL_LEVELS 10
+
+struct Osc_Wavetable
+{
+    // points per period (a power of two)
+    t_CKUINT size;
+    // most harmonics (level 0)
+    t_CKUINT harmonics;
+    // number of levels
+    t_CKUINT levels;
+    // levels * (size + 2) points
+    t_CKSINGLE * data;
+
+    // constructor
+    Osc_Wavetable() : size(0), harmonics(0), levels(0), data(NULL) { }
+    // destructor
+    ~Osc_Wavetable() { CK_SAFE_DELETE_ARRAY( data ); }
+
+    // points of level k
+    const t_CKSINGLE * level( t_CKUINT k ) const { return data + k * (size + 2); }
+};
+
+// the tables, by waveform and log2 size
+static Osc_Wavetable * g_osc_wavetables[OSC_WAVE_COUNT][OSC_TABLE_MAX_BITS+1] = { { NULL } };
+#ifndef __DISABLE_THREADS__
+// for making them
+static XMutex g_osc_wavetable_mutex;
+#endif
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: osc_wavetable_make()
+// desc: make the table of a waveform at 2^bits points; sines have 1 level,
+//       band-limited waveforms OSC_BL_LEVELS
+//-----------------------------------------------------------------------------
+static Osc_Wavetable * osc_wavetable_make( Osc_Waveform wave, t_CKUINT bits )
+{
+    Osc_Wavetable * w = new Osc_Wavetable;
+    w->size = (t_CKUINT)1 << bits;
+    w->harmonics = wave == OSC_WAVE_SINE ? 1 : OSC_BL_HARMONICS;
+    w->levels = wave == OSC_WAVE_SINE ? 1 : OSC_BL_LEVELS;
+    w->data = new t_CKSINGLE[w->levels * (w->size + 2)];
+
+    // one period of sin(), to sum harmonics from
+    t_CKUINT size = w->size, i, h;
+    t_CKFLOAT * sine = new t_CKFLOAT[size];
+    for( i = 0; i < size; i++ ) sine[i] = ::sin( CK_TWO_PI * i / size );
+    // the sum so far (at each point)
+    t_CKFLOAT * sum = new t_CKFLOAT[size + 2];
+    for( i = 0; i < size + 2; i++ ) sum[i] = 0;
+    // the saw is shifted by a quarter period, to line up with SawOsc
+    t_CKUINT shift = wave == OSC_WAVE_SAW ? size / 4 : 0;
+
+    // from the fewest harmonics (last level) up, adding each level's
+    t_CKUINT from = 1;
+    for( t_CKINT k = (t_CKINT)w->levels - 1; k >= 0; k-- )
+    {
+        t_CKUINT to = w->harmonics >> k;
+        for( h = from; h <= to; h++ )
+        {
+            // Fourier series coefficient of harmonic h
+            t_CKFLOAT c = 0;
+            switch( wave )
+            {
+                case OSC_WAVE_SINE: c = h == 1 ? 1.0 : 0.0; break;
+                case OSC_WAVE_SAW: c = -2.0 / (CK_ONE_PI * h); break;
+                case OSC_WAVE_SQUARE: c = h % 2 ? 4.0 / (CK_ONE_PI * h) : 0.0; break;
+                case OSC_WAVE_TRIANGLE: c = h % 2 ? ((h % 4 == 1) ? 8.0 : -8.0) / (CK_ONE_PI * CK_ONE_PI * h * h) : 0.0; break;
+                default: break;
+            }
+            if( c == 0.0 ) continue;
+            // sin( 2pi h (i + shift) / size ), exactly from the table
+            for( i = 0; i < size + 2; i++ ) sum[i] += c * sine[(h * (i + shift)) & (size - 1)];
+        }
+        from = to + 1;
+
+        // this level
+        t_CKSINGLE * points = w->data + k * (size + 2);
+        for( i = 0; i < size + 2; i++ ) points[i] = (t_CKSINGLE)sum[i];
+    }
+
+    // clean up
+    CK_SAFE_DELETE_ARRAY( sine );
+    CK_SAFE_DELETE_ARRAY( sum );
+
+    return w;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: osc_wavetable()
+// desc: get the shared table of a waveform at 2^bits points, making it if
+//       needed; not called from tick functions; the table is made outside
+//       the lock (it can take a while), so a thread asking for another
+//       table, or for one already made, doesn't wait on it
+//-----------------------------------------------------------------------------
+static const Osc_Wavetable * osc_wavetable( Osc_Waveform wave, t_CKUINT bits )
+{
+    #ifndef __DISABLE_THREADS__
+    g_osc_wavetable_mutex.acquire();
+    #endif
+    const Osc_Wavetable * w = g_osc_wavetables[wave][bits];
+    #ifndef __DISABLE_THREADS__
+    g_osc_wavetable_mutex.release();
+    #endif
+    // made already
+    if( w ) return w;
+
+    // made the first time it is asked for
+    Osc_Wavetable * made = osc_wavetable_make( wave, bits );
+
+    #ifndef __DISABLE_THREADS__
+    g_osc_wavetable_mutex.acquire();
+    #endif
+    // check again: another thread may have made it meanwhile
+    if( !g_osc_wavetables[wave][bits] ) { g_osc_wavetables[wave][bits] = made; made = NULL; }
+    w = g_osc_wavetables[wave][bits];
+    #ifndef __DISABLE_THREADS__
+    g_osc_wavetable_mutex.release();
+    #endif
+
+    // if so, use theirs
+    CK_SAFE_DELETE( made );
+
+    return w;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: osc_wavetable_level()
+// desc: which level to read at `num` (phase increment, in periods per
+//       sample): the first whose top harmonic is under Nyquist
+//-----------------------------------------------------------------------------
+static inline t_CKUINT osc_wavetable_level( const Osc_Wavetable * w, t_CKFLOAT num )
+{
+    // top harmonic * num must be <= .5
+    t_CKFLOAT limit = .5 / w->harmonics;
+    t_CKUINT k = 0;
+    if( num < 0 ) num = -num;
+    while( num > limit && k + 1 < w->levels ) { limit *= 2; k++; }
+    return k;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: osc_table_interp()
+// desc: interpolate a table of `size` points (a power of two; one period) at
+//       `index` (in points, >= 0), wrapping around; for oscillator tables and
+//       GenX tables alike
+//-----------------------------------------------------------------------------
+template <typename T>
+static inline t_CKFLOAT osc_table_interp( const T * table, t_CKUINT size, t_CKFLOAT index )
+{
+    // point and fraction
+    t_CKUINT lo = (t_CKUINT)index;
+    t_CKUINT hi = lo + 1;
+    t_CKFLOAT alpha = index - lo;
+    // wrap
+    lo &= size - 1;
+    hi &= size - 1;
+    // interpolate
+    return table[lo] * (1. - alpha) + table[hi] * alpha;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: osc_table_lookup()
+// desc: interpolate a wavetable level at any phase (in periods)
+//-----------------------------------------------------------------------------
+static inline t_CKFLOAT osc_table_lookup( const t_CKSINGLE * table, t_CKUINT size,
+                                          t_CKFLOAT phase )
+{
+    // wrap to [0,1]
+    if( phase < 0.0 || phase > 1.0 ) phase -= ::floor( phase );
+    return osc_table_interp( table, size, phase * size );
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: struct Osc_Data
 // desc: ...
@@ -295,6 +671,10 @@ struct Osc_Data
 
     t_CKFLOAT phase;
 
+    // shared wavetable (SinOsc.table(), band-limited oscillators), or NULL
+    // to compute the waveform | 1.5.1.7
+    const Osc_Wavetable * wave;
+
     Osc_Data()
     {
         num = 0.0;
@@ -303,6 +683,7 @@ struct Osc_Data
         width = 0.5;
         srate = g_srateOsc;
         phase = 0.0;
+        wave = NULL;
     }
 };
 
@@ -477,7 +858,8 @@ CK_DLL_TICK( sinosc_tick )
     }
 
     // set output
-    *out = (SAMPLE) ::sin( d->phase * CK_TWO_PI );
+    if( d->wave ) *out = (SAMPLE) osc_table_lookup( d->wave->level(0), d->wave->size, d->phase );
+    else *out = (SAMPLE) ::sin( d->phase * CK_TWO_PI );
 
     if( inc_phase )
     {
@@ -636,6 +1018,727 @@ CK_DLL_TICK( pulseosc_tick )
 // sqrosc_tick is pulseosc_tick at width=0.5 -pld;
 
 
+
+
+//-----------------------------------------------------------------------------
+// block ticks | 1.5.1.7
+// with input, sync/FM can change the frequency or phase every frame, so
+// these go through the tick functions above; free-running, they step the
+// phase in a register, and compute the same samples as those would
+//-----------------------------------------------------------------------------
+// step phase forward one frame; keep it between 0 and 1
+static inline t_CKFLOAT osc_next_phase( t_CKFLOAT phase, t_CKFLOAT num )
+{
+    phase += num;
+    if( phase > 1.0 ) phase -= 1.0;
+    else if( phase < 0.0 ) phase += 1.0;
+    return phase;
+}
+
+// frames of phase stepped at a time, before shaping them into samples
+#define OSC_CHUNK 64
+
+// step `n` phases into `buffer`; returns the phase after them
+static inline t_CKFLOAT osc_phases( t_CKFLOAT * buffer, t_CKUINT n,
+                                    t_CKFLOAT phase, t_CKFLOAT num )
+{
+    for( t_CKUINT i = 0; i < n; i++ )
+    {
+        buffer[i] = phase;
+        phase = osc_next_phase( phase, num );
+    }
+    return phase;
+}
+
+// same, plus `offset`, each wrapped to [0,1] (for reading a table)
+static inline t_CKFLOAT osc_phases_wrapped( t_CKFLOAT * buffer, t_CKUINT n,
+                                            t_CKFLOAT phase, t_CKFLOAT num,
+                                            t_CKFLOAT offset )
+{
+    for( t_CKUINT i = 0; i < n; i++ )
+    {
+        t_CKFLOAT x = phase + offset;
+        buffer[i] = x >= 0.0 && x <= 1.0 ? x : x - ::floor( x );
+        phase = osc_next_phase( phase, num );
+    }
+    return phase;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// block kernels | 1.5.1.7
+// stepping the phase is serial (each frame from the last), but turning a
+// buffer of phases into samples is not: these do it 2 (SSE2) or 4 (AVX2)
+// frames at a time, with the same arithmetic as the tick functions, so the
+// output is the same as the scalar versions; the fastest the CPU supports is
+// picked once, at load time
+//-----------------------------------------------------------------------------
+struct Osc_Kernels
+{
+    // Osc / Phasor: the phase itself
+    void (*phasor)( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n );
+    // TriOsc / SawOsc
+    void (*tri)( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n, t_CKFLOAT width );
+    // PulseOsc / SqrOsc
+    void (*pulse)( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n, t_CKFLOAT width );
+    // from a wavetable level (phases in [0,1])
+    void (*table)( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n,
+                   const t_CKSINGLE * table, t_CKUINT size );
+    // which
+    const char * name;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// scalar kernels: as in the tick functions; also finish off what the SIMD
+// kernels leave over
+//-----------------------------------------------------------------------------
+static void osc_phasor_scalar( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n )
+{
+    for( t_CKUINT i = 0; i < n; i++ ) out[i] = (SAMPLE)phase[i];
+}
+
+static void osc_tri_scalar( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n, t_CKFLOAT width )
+{
+    for( t_CKUINT i = 0; i < n; i++ )
+    {
+        // as in triosc_tick()
+        t_CKFLOAT p = phase[i] + .25; if( p > 1.0 ) p -= 1.0;
+        if( p < width ) out[i] = (SAMPLE) (width == 0.0) ? 1.0 : -1.0 + 2.0 * p / width;
+        else out[i] = (SAMPLE) (width == 1.0) ? 0 : 1.0 - 2.0 * (p - width) / (1.0 - width);
+    }
+}
+
+static void osc_pulse_scalar( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n, t_CKFLOAT width )
+{
+    for( t_CKUINT i = 0; i < n; i++ ) out[i] = (SAMPLE) (phase[i] < width) ? 1.0 : -1.0;
+}
+
+static void osc_table_scalar( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n,
+                             const t_CKSINGLE * table, t_CKUINT size )
+{
+    for( t_CKUINT i = 0; i < n; i++ )
+    {
+        // as in osc_table_interp(), without wrapping: phase[i] * size
+        // is at most size, and the table has 2 points past that
+        t_CKFLOAT x = phase[i] * size;
+        t_CKUINT j = (t_CKUINT)x;
+        t_CKFLOAT f = x - j;
+        t_CKFLOAT a = table[j], b = table[j+1];
+        out[i] = (SAMPLE)(a * (1. - f) + b * f);
+    }
+}
+
+
+
+
+#ifdef __OSC_SSE2__
+//-----------------------------------------------------------------------------
+// SSE2 kernels: 2 frames at a time
+//-----------------------------------------------------------------------------
+static inline void osc_store_sse2( SAMPLE * out, __m128d v )
+{
+#if defined(__CHUCK_USE_64_BIT_SAMPLE__)
+    _mm_storeu_pd( out, v );
+#else
+    _mm_storel_pi( (__m64 *)out, _mm_cvtpd_ps( v ) );
+#endif
+}
+
+// a where mask, else b
+static inline __m128d osc_select_sse2( __m128d mask, __m128d a, __m128d b )
+{
+    return _mm_or_pd( _mm_and_pd( mask, a ), _mm_andnot_pd( mask, b ) );
+}
+
+static void osc_phasor_sse2( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n )
+{
+    t_CKUINT i = 0;
+    for( ; i + 2 <= n; i += 2 ) osc_store_sse2( out + i, _mm_loadu_pd( phase + i ) );
+    osc_phasor_scalar( phase + i, out + i, n - i );
+}
+
+static void osc_tri_sse2( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n, t_CKFLOAT width )
+{
+    const __m128d one = _mm_set1_pd( 1.0 ), two = _mm_set1_pd( 2.0 );
+    const __m128d quarter = _mm_set1_pd( .25 ), w = _mm_set1_pd( width );
+    const __m128d wfall = _mm_set1_pd( 1.0 - width );
+    t_CKUINT i = 0;
+    for( ; i + 2 <= n; i += 2 )
+    {
+        // p = phase + .25, wrapped
+        __m128d p = _mm_add_pd( _mm_loadu_pd( phase + i ), quarter );
+        p = _mm_sub_pd( p, _mm_and_pd( _mm_cmpgt_pd( p, one ), one ) );
+        // rising: -1 + 2p/w; falling: 1 - 2(p-w)/(1-w)
+        __m128d rise = width == 0.0 ? one : _mm_add_pd( _mm_set1_pd( -1.0 ),
+                       _mm_div_pd( _mm_mul_pd( two, p ), w ) );
+        __m128d fall = width == 1.0 ? _mm_setzero_pd() : _mm_sub_pd( one,
+                       _mm_div_pd( _mm_mul_pd( two, _mm_sub_pd( p, w ) ), wfall ) );
+        osc_store_sse2( out + i, osc_select_sse2( _mm_cmplt_pd( p, w ), rise, fall ) );
+    }
+    osc_tri_scalar( phase + i, out + i, n - i, width );
+}
+
+static void osc_pulse_sse2( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n, t_CKFLOAT width )
+{
+    const __m128d one = _mm_set1_pd( 1.0 ), minus = _mm_set1_pd( -1.0 );
+    const __m128d w = _mm_set1_pd( width );
+    t_CKUINT i = 0;
+    for( ; i + 2 <= n; i += 2 )
+    {
+        __m128d mask = _mm_cmplt_pd( _mm_loadu_pd( phase + i ), w );
+        osc_store_sse2( out + i, osc_select_sse2( mask, one, minus ) );
+    }
+    osc_pulse_scalar( phase + i, out + i, n - i, width );
+}
+
+static void osc_table_sse2( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n,
+                           const t_CKSINGLE * table, t_CKUINT size )
+{
+    const __m128d sz = _mm_set1_pd( (t_CKFLOAT)size );
+    t_CKUINT i = 0;
+    for( ; i + 2 <= n; i += 2 )
+    {
+        // point and fraction
+        __m128d x = _mm_mul_pd( _mm_loadu_pd( phase + i ), sz );
+        __m128i j = _mm_cvttpd_epi32( x );
+        __m128d f = _mm_sub_pd( x, _mm_cvtepi32_pd( j ) );
+        // no gather in SSE2
+        int j0 = _mm_cvtsi128_si32( j );
+        int j1 = _mm_cvtsi128_si32( _mm_shuffle_epi32( j, 1 ) );
+        __m128d a = _mm_set_pd( table[j1], table[j0] );
+        __m128d b = _mm_set_pd( table[j1+1], table[j0+1] );
+        // interpolate
+        __m128d g = _mm_sub_pd( _mm_set1_pd( 1. ), f );
+        osc_store_sse2( out + i, _mm_add_pd( _mm_mul_pd( a, g ), _mm_mul_pd( b, f ) ) );
+    }
+    osc_table_scalar( phase + i, out + i, n - i, table, size );
+}
+#endif // __OSC_SSE2__
+
+
+
+
+#ifdef __OSC_AVX2__
+//-----------------------------------------------------------------------------
+// AVX2 kernels: 4 frames at a time
+//-----------------------------------------------------------------------------
+#define OSC_AVX2 __attribute__((target("avx2")))
+
+OSC_AVX2 static inline void osc_store_avx2( SAMPLE * out, __m256d v )
+{
+#if defined(__CHUCK_USE_64_BIT_SAMPLE__)
+    _mm256_storeu_pd( out, v );
+#else
+    _mm_storeu_ps( out, _mm256_cvtpd_ps( v ) );
+#endif
+}
+
+OSC_AVX2 static void osc_phasor_avx2( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n )
+{
+    t_CKUINT i = 0;
+    for( ; i + 4 <= n; i += 4 ) osc_store_avx2( out + i, _mm256_loadu_pd( phase + i ) );
+    osc_phasor_scalar( phase + i, out + i, n - i );
+}
+
+OSC_AVX2 static void osc_tri_avx2( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n, t_CKFLOAT width )
+{
+    const __m256d one = _mm256_set1_pd( 1.0 ), two = _mm256_set1_pd( 2.0 );
+    const __m256d quarter = _mm256_set1_pd( .25 ), w = _mm256_set1_pd( width );
+    const __m256d wfall = _mm256_set1_pd( 1.0 - width );
+    t_CKUINT i = 0;
+    for( ; i + 4 <= n; i += 4 )
+    {
+        // p = phase + .25, wrapped
+        __m256d p = _mm256_add_pd( _mm256_loadu_pd( phase + i ), quarter );
+        p = _mm256_sub_pd( p, _mm256_and_pd( _mm256_cmp_pd( p, one, _CMP_GT_OQ ), one ) );
+        // rising: -1 + 2p/w; falling: 1 - 2(p-w)/(1-w)
+        __m256d rise = width == 0.0 ? one : _mm256_add_pd( _mm256_set1_pd( -1.0 ),
+                       _mm256_div_pd( _mm256_mul_pd( two, p ), w ) );
+        __m256d fall = width == 1.0 ? _mm256_setzero_pd() : _mm256_sub_pd( one,
+                       _mm256_div_pd( _mm256_mul_pd( two, _mm256_sub_pd( p, w ) ), wfall ) );
+        osc_store_avx2( out + i, _mm256_blendv_pd( fall, rise, _mm256_cmp_pd( p, w, _CMP_LT_OQ ) ) );
+    }
+    osc_tri_scalar( phase + i, out + i, n - i, width );
+}
+
+OSC_AVX2 static void osc_pulse_avx2( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n, t_CKFLOAT width )
+{
+    const __m256d one = _mm256_set1_pd( 1.0 ), minus = _mm256_set1_pd( -1.0 );
+    const __m256d w = _mm256_set1_pd( width );
+    t_CKUINT i = 0;
+    for( ; i + 4 <= n; i += 4 )
+    {
+        __m256d mask = _mm256_cmp_pd( _mm256_loadu_pd( phase + i ), w, _CMP_LT_OQ );
+        osc_store_avx2( out + i, _mm256_blendv_pd( minus, one, mask ) );
+    }
+    osc_pulse_scalar( phase + i, out + i, n - i, width );
+}
+
+OSC_AVX2 static void osc_table_avx2( const t_CKFLOAT * phase, SAMPLE * out, t_CKUINT n,
+                                    const t_CKSINGLE * table, t_CKUINT size )
+{
+    const __m256d sz = _mm256_set1_pd( (t_CKFLOAT)size );
+    t_CKUINT i = 0;
+    for( ; i + 4 <= n; i += 4 )
+    {
+        // point and fraction
+        __m256d x = _mm256_mul_pd( _mm256_loadu_pd( phase + i ), sz );
+        __m128i j = _mm256_cvttpd_epi32( x );
+        __m256d f = _mm256_sub_pd( x, _mm256_cvtepi32_pd( j ) );
+        // gather the point and the next
+        __m256d a = _mm256_cvtps_pd( _mm_i32gather_ps( table, j, 4 ) );
+        __m256d b = _mm256_cvtps_pd( _mm_i32gather_ps( table + 1, j, 4 ) );
+        // interpolate
+        __m256d g = _mm256_sub_pd( _mm256_set1_pd( 1. ), f );
+        osc_store_avx2( out + i, _mm256_add_pd( _mm256_mul_pd( a, g ), _mm256_mul_pd( b, f ) ) );
+    }
+    osc_table_scalar( phase + i, out + i, n - i, table, size );
+}
+#endif // __OSC_AVX2__
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: osc_kernels_pick()
+// desc: the fastest kernels this CPU can run
+//-----------------------------------------------------------------------------
+static Osc_Kernels osc_kernels_pick()
+{
+    Osc_Kernels k = { osc_phasor_scalar, osc_tri_scalar, osc_pulse_scalar,
+                      osc_table_scalar, "scalar" };
+#ifdef __OSC_SSE2__
+    Osc_Kernels sse2 = { osc_phasor_sse2, osc_tri_sse2, osc_pulse_sse2,
+                         osc_table_sse2, "SSE2" };
+    k = sse2;
+#endif
+#ifdef __OSC_AVX2__
+    // (may run before main)
+    __builtin_cpu_init();
+    if( __builtin_cpu_supports( "avx2" ) )
+    {
+        Osc_Kernels avx2 = { osc_phasor_avx2, osc_tri_avx2, osc_pulse_avx2,
+                             osc_table_avx2, "AVX2" };
+        k = avx2;
+    }
+#endif
+    return k;
+}
+
+// the kernels in use
+static const Osc_Kernels g_osc_kernels = osc_kernels_pick();
+// which
+static const char * osc_kernels_name() { return g_osc_kernels.name; }
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: osc_tickv()
+// desc: block tick for Osc / Phasor
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( osc_tickv )
+{
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    t_CKFLOAT buffer[OSC_CHUNK];
+    t_CKUINT i, n;
+
+    // with input
+    if( ((Chuck_UGen *)SELF)->m_num_src )
+    {
+        for( i = 0; i < nframes; i++ ) osc_tick( SELF, in[i], &out[i], API );
+        return TRUE;
+    }
+
+    // free-running
+    t_CKFLOAT phase = d->phase;
+    for( i = 0; i < nframes; i += n )
+    {
+        n = ck_min( nframes - i, (t_CKUINT)OSC_CHUNK );
+        phase = osc_phases( buffer, n, phase, d->num );
+        g_osc_kernels.phasor( buffer, out + i, n );
+    }
+    d->phase = phase;
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: sinosc_tickv()
+// desc: block tick for SinOsc
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( sinosc_tickv )
+{
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    t_CKFLOAT buffer[OSC_CHUNK];
+    t_CKUINT i, n;
+
+    // with input
+    if( ((Chuck_UGen *)SELF)->m_num_src )
+    {
+        for( i = 0; i < nframes; i++ ) sinosc_tick( SELF, in[i], &out[i], API );
+        return TRUE;
+    }
+
+    // free-running
+    t_CKFLOAT phase = d->phase, num = d->num;
+    // from the sine table
+    if( d->wave )
+    {
+        for( i = 0; i < nframes; i += n )
+        {
+            n = ck_min( nframes - i, (t_CKUINT)OSC_CHUNK );
+            phase = osc_phases_wrapped( buffer, n, phase, num, 0 );
+            g_osc_kernels.table( buffer, out + i, n, d->wave->level(0), d->wave->size );
+        }
+    }
+    // from sin(), as in sinosc_tick()
+    else
+    {
+        for( i = 0; i < nframes; i++ )
+        {
+            out[i] = (SAMPLE) ::sin( phase * CK_TWO_PI );
+            phase = osc_next_phase( phase, num );
+        }
+    }
+    d->phase = phase;
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: triosc_tickv()
+// desc: block tick for TriOsc / SawOsc
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( triosc_tickv )
+{
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    t_CKFLOAT buffer[OSC_CHUNK];
+    t_CKUINT i, n;
+
+    // with input
+    if( ((Chuck_UGen *)SELF)->m_num_src )
+    {
+        for( i = 0; i < nframes; i++ ) triosc_tick( SELF, in[i], &out[i], API );
+        return TRUE;
+    }
+
+    // free-running
+    t_CKFLOAT phase = d->phase;
+    for( i = 0; i < nframes; i += n )
+    {
+        n = ck_min( nframes - i, (t_CKUINT)OSC_CHUNK );
+        phase = osc_phases( buffer, n, phase, d->num );
+        g_osc_kernels.tri( buffer, out + i, n, d->width );
+    }
+    d->phase = phase;
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: pulseosc_tickv()
+// desc: block tick for PulseOsc / SqrOsc
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( pulseosc_tickv )
+{
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    t_CKFLOAT buffer[OSC_CHUNK];
+    t_CKUINT i, n;
+
+    // with input
+    if( ((Chuck_UGen *)SELF)->m_num_src )
+    {
+        for( i = 0; i < nframes; i++ ) pulseosc_tick( SELF, in[i], &out[i], API );
+        return TRUE;
+    }
+
+    // free-running
+    t_CKFLOAT phase = d->phase;
+    for( i = 0; i < nframes; i += n )
+    {
+        n = ck_min( nframes - i, (t_CKUINT)OSC_CHUNK );
+        phase = osc_phases( buffer, n, phase, d->num );
+        g_osc_kernels.pulse( buffer, out + i, n, d->width );
+    }
+    d->phase = phase;
+
+    return TRUE;
+}
+
+
+//-----------------------------------------------------------------------------
+// band-limited oscillators | 1.5.1.7
+// as SawOsc, SqrOsc, TriOsc and PulseOsc (same phase, direction, and
+// controls), but reading the band-limited wavetables above, at the level
+// for the current frequency; a pulse is the difference of two saws, a width
+// apart: r(x-w) - r(x) + 2w-1, for a rising saw r
+//-----------------------------------------------------------------------------
+// take input, per Osc.sync(); returns whether to advance the phase
+static inline t_CKBOOL osc_sync_input( Osc_Data * d, SAMPLE in )
+{
+    // sync frequency to input
+    if( d->sync == 0 )
+    {
+        d->freq = in;
+        d->num = ::fmod( d->freq / d->srate, 1.0 );
+    }
+    // sync phase to input
+    else if( d->sync == 1 )
+    {
+        d->phase = in;
+        return FALSE;
+    }
+    // FM synthesis
+    else if( d->sync == 2 )
+    {
+        d->num = ::fmod( (d->freq + in) / d->srate, 1.0 );
+    }
+
+    return TRUE;
+}
+
+// the saw table is shifted a quarter period (to line up with SawOsc); this
+// reads it unshifted
+#define OSC_SAW_SHIFT (-.25)
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: blsawosc_ctor()
+// desc: ...
+//-----------------------------------------------------------------------------
+CK_DLL_CTOR( blsawosc_ctor )
+{
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    d->wave = osc_wavetable( OSC_WAVE_SAW, OSC_BL_BITS );
+    // rising, as SawOsc
+    d->width = 1.0;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: bltriosc_ctor()
+// desc: ...
+//-----------------------------------------------------------------------------
+CK_DLL_CTOR( bltriosc_ctor )
+{
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    d->wave = osc_wavetable( OSC_WAVE_TRIANGLE, OSC_BL_BITS );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: blpulseosc_ctor()
+// desc: ...
+//-----------------------------------------------------------------------------
+CK_DLL_CTOR( blpulseosc_ctor )
+{
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    // from saws
+    d->wave = osc_wavetable( OSC_WAVE_SAW, OSC_BL_BITS );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: blsqrosc_ctor()
+// desc: ...
+//-----------------------------------------------------------------------------
+CK_DLL_CTOR( blsqrosc_ctor )
+{
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    // its own table: one read instead of two
+    d->wave = osc_wavetable( OSC_WAVE_SQUARE, OSC_BL_BITS );
+    d->width = 0.5;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: blosc_tick()
+// desc: tick for BLTriOsc / BLSqrOsc: read the table
+//-----------------------------------------------------------------------------
+CK_DLL_TICK( blosc_tick )
+{
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    t_CKBOOL inc_phase = ((Chuck_UGen *)SELF)->m_num_src ? osc_sync_input( d, in ) : TRUE;
+    const Osc_Wavetable * w = d->wave;
+
+    // read the level for this frequency
+    *out = (SAMPLE)osc_table_lookup( w->level( osc_wavetable_level( w, d->num ) ), w->size, d->phase );
+
+    if( inc_phase ) d->phase = osc_next_phase( d->phase, d->num );
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: blsawosc_tick()
+// desc: tick for BLSawOsc: read the table, rising or falling
+//-----------------------------------------------------------------------------
+CK_DLL_TICK( blsawosc_tick )
+{
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    t_CKBOOL inc_phase = ((Chuck_UGen *)SELF)->m_num_src ? osc_sync_input( d, in ) : TRUE;
+    const Osc_Wavetable * w = d->wave;
+
+    // read the level for this frequency
+    SAMPLE v = (SAMPLE)osc_table_lookup( w->level( osc_wavetable_level( w, d->num ) ), w->size, d->phase );
+    *out = d->width == 0.0 ? -v : v;
+
+    if( inc_phase ) d->phase = osc_next_phase( d->phase, d->num );
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: blpulseosc_tick()
+// desc: tick for BLPulseOsc: two saws, a width apart
+//-----------------------------------------------------------------------------
+CK_DLL_TICK( blpulseosc_tick )
+{
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    t_CKBOOL inc_phase = ((Chuck_UGen *)SELF)->m_num_src ? osc_sync_input( d, in ) : TRUE;
+    const Osc_Wavetable * w = d->wave;
+    const t_CKSINGLE * table = w->level( osc_wavetable_level( w, d->num ) );
+
+    // r(x-w) - r(x) + 2w-1 (each rounded to SAMPLE, as in blpulseosc_tickv)
+    SAMPLE a = (SAMPLE)osc_table_lookup( table, w->size, d->phase + (OSC_SAW_SHIFT - d->width) );
+    SAMPLE b = (SAMPLE)osc_table_lookup( table, w->size, d->phase + OSC_SAW_SHIFT );
+    *out = (SAMPLE)( (t_CKFLOAT)a - b + (2 * d->width - 1) );
+
+    if( inc_phase ) d->phase = osc_next_phase( d->phase, d->num );
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: blosc_tickv()
+// desc: block tick for BLTriOsc / BLSqrOsc
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( blosc_tickv )
+{
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    t_CKFLOAT buffer[OSC_CHUNK];
+    t_CKUINT i, n;
+
+    // with input
+    if( ((Chuck_UGen *)SELF)->m_num_src )
+    {
+        for( i = 0; i < nframes; i++ ) blosc_tick( SELF, in[i], &out[i], API );
+        return TRUE;
+    }
+
+    // free-running: one level for the block
+    const Osc_Wavetable * w = d->wave;
+    const t_CKSINGLE * table = w->level( osc_wavetable_level( w, d->num ) );
+    t_CKFLOAT phase = d->phase;
+    for( i = 0; i < nframes; i += n )
+    {
+        n = ck_min( nframes - i, (t_CKUINT)OSC_CHUNK );
+        phase = osc_phases_wrapped( buffer, n, phase, d->num, 0 );
+        g_osc_kernels.table( buffer, out + i, n, table, w->size );
+    }
+    d->phase = phase;
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: blsawosc_tickv()
+// desc: block tick for BLSawOsc
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( blsawosc_tickv )
+{
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    t_CKUINT i;
+
+    // rising: same as the others
+    blosc_tickv( SELF, in, out, nframes, API );
+    // falling
+    if( d->width == 0.0 && !((Chuck_UGen *)SELF)->m_num_src )
+        for( i = 0; i < nframes; i++ ) out[i] = -out[i];
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: blpulseosc_tickv()
+// desc: block tick for BLPulseOsc
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( blpulseosc_tickv )
+{
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    t_CKFLOAT buffer[OSC_CHUNK];
+    SAMPLE other[OSC_CHUNK];
+    t_CKUINT i, j, n;
+
+    // with input
+    if( ((Chuck_UGen *)SELF)->m_num_src )
+    {
+        for( i = 0; i < nframes; i++ ) blpulseosc_tick( SELF, in[i], &out[i], API );
+        return TRUE;
+    }
+
+    // free-running: one level for the block
+    const Osc_Wavetable * w = d->wave;
+    const t_CKSINGLE * table = w->level( osc_wavetable_level( w, d->num ) );
+    t_CKFLOAT phase = d->phase, next = phase, offset = 2 * d->width - 1;
+    for( i = 0; i < nframes; i += n )
+    {
+        n = ck_min( nframes - i, (t_CKUINT)OSC_CHUNK );
+        // r(x-w)
+        osc_phases_wrapped( buffer, n, phase, d->num, OSC_SAW_SHIFT - d->width );
+        g_osc_kernels.table( buffer, out + i, n, table, w->size );
+        // r(x)
+        next = osc_phases_wrapped( buffer, n, phase, d->num, OSC_SAW_SHIFT );
+        g_osc_kernels.table( buffer, other, n, table, w->size );
+        // difference
+        for( j = 0; j < n; j++ ) out[i+j] = (SAMPLE)( (t_CKFLOAT)out[i+j] - other[j] + offset );
+        phase = next;
+    }
+    d->phase = phase;
+
+    return TRUE;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: osc_ctrl_freq()
 // desc: set oscillator frequency
@@ -894,6 +1997,53 @@ CK_DLL_CGET( osc_cget_sync )
 
 
 
+//-----------------------------------------------------------------------------
+// name: sinosc_ctrl_table()
+// desc: set size of sine table to read from; 0 to compute sin() | 1.5.1.7
+//-----------------------------------------------------------------------------
+CK_DLL_CTRL( sinosc_ctrl_table )
+{
+    // get data
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    // get size
+    t_CKINT size = GET_CK_INT(ARGS);
+
+    // 0 (or less): compute
+    if( size <= 0 )
+    {
+        d->wave = NULL;
+    }
+    else
+    {
+        // round up to a power of two, within bounds
+        t_CKUINT bits = OSC_TABLE_MIN_BITS;
+        while( bits < OSC_TABLE_MAX_BITS && ((t_CKINT)1 << bits) < size ) bits++;
+        // shared table
+        d->wave = osc_wavetable( OSC_WAVE_SINE, bits );
+    }
+
+    // return
+    RETURN->v_int = d->wave ? (t_CKINT)d->wave->size : 0;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: sinosc_cget_table()
+// desc: get size of sine table read from; 0 if computing sin() | 1.5.1.7
+//-----------------------------------------------------------------------------
+CK_DLL_CGET( sinosc_cget_table )
+{
+    // get data
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    // return
+    RETURN->v_int = d->wave ? (t_CKINT)d->wave->size : 0;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: osc_pmsg()
 // desc: ...
@@ -1255,8 +2405,6 @@ CK_DLL_TICK( genX_tick )
 
     t_CKDOUBLE in_index = 0.0;
     t_CKDOUBLE scaled_index = 0.0;
-    t_CKDOUBLE alpha = 0.0, omAlpha = 0.0;
-    t_CKUINT lowIndex = 0, hiIndex = 0;
     t_CKDOUBLE outvalue = 0.0;
 
     // if input
@@ -1270,21 +2418,9 @@ CK_DLL_TICK( genX_tick )
         scaled_index = 0.;
     }
 
-    // set up interpolation parameters
-    lowIndex = (t_CKUINT)scaled_index;
-    hiIndex = lowIndex + 1;
-    alpha = scaled_index - lowIndex;
-    omAlpha = 1. - alpha;
-
-    // check table index ranges
-    while(lowIndex >= genX_tableSize) lowIndex -= genX_tableSize;
-    while(hiIndex >= genX_tableSize) hiIndex -= genX_tableSize;
-
-    // could just call
-    // outvalue = genX_lookup(in_index);?
-
-    // calculate output value with linear interpolation
-    outvalue = d->genX_table[lowIndex]*omAlpha + d->genX_table[hiIndex]*alpha;
+    // calculate output value with linear interpolation, wrapping around
+    // (same as the oscillator wavetables) | 1.5.1.7
+    outvalue = osc_table_interp( d->genX_table, genX_tableSize, scaled_index );
 
     // set output
     *out = (SAMPLE)outvalue;
@@ -1304,8 +2440,6 @@ CK_DLL_CTRL( genX_lookup )
 
     t_CKFLOAT in_index;
     t_CKFLOAT scaled_index;
-    t_CKFLOAT alpha, omAlpha;
-    t_CKUINT lowIndex, hiIndex;
     t_CKFLOAT outvalue;
 
     in_index = GET_NEXT_FLOAT(ARGS);
@@ -1314,18 +2448,9 @@ CK_DLL_CTRL( genX_lookup )
     if (in_index < 0.) in_index = -in_index;
     scaled_index = in_index * (genX_tableSize - 1); //drive with phasor [0, 1]
 
-    //set up interpolation parameters
-    lowIndex = (t_CKUINT)scaled_index;
-    hiIndex = lowIndex + 1;
-    alpha = scaled_index - lowIndex;
-    omAlpha = 1. - alpha;
-
-    //check table index ranges
-    while(lowIndex >= genX_tableSize) lowIndex -= genX_tableSize;
-    while(hiIndex >= genX_tableSize) hiIndex -= genX_tableSize;
-
-    //calculate output value with linear interpolation
-    outvalue = d->genX_table[lowIndex]*omAlpha + d->genX_table[hiIndex]*alpha;
+    //calculate output value with linear interpolation, wrapping around
+    // (same as the oscillator wavetables) | 1.5.1.7
+    outvalue = osc_table_interp( d->genX_table, genX_tableSize, scaled_index );
 
     RETURN->v_float = (t_CKFLOAT)outvalue;
 
@@ -45,6 +45,7 @@ DLL_QUERY osc_query( Chuck_DL_Query * query );
 CK_DLL_CTOR( osc_ctor );
 CK_DLL_DTOR( osc_dtor );
 CK_DLL_TICK( osc_tick );
+CK_DLL_TICKV( osc_tickv );
 CK_DLL_PMSG( osc_pmsg );
 CK_DLL_CTRL( osc_ctrl_freq );
 CK_DLL_CGET( osc_cget_freq );
@@ -59,12 +60,17 @@ CK_DLL_CGET( osc_cget_sync );
 
 // sinosc
 CK_DLL_TICK( sinosc_tick );
+CK_DLL_TICKV( sinosc_tickv );
+CK_DLL_CTRL( sinosc_ctrl_table );
+CK_DLL_CGET( sinosc_cget_table );
 
 // pulseosc
 CK_DLL_TICK( pulseosc_tick );
+CK_DLL_TICKV( pulseosc_tickv );
 
 // triosc
 CK_DLL_TICK( triosc_tick );
+CK_DLL_TICKV( triosc_tickv );
 
 // sawosc
 CK_DLL_CTOR( sawosc_ctor );
@@ -74,6 +80,18 @@ CK_DLL_CTRL( sawosc_ctrl_width );
 CK_DLL_CTOR( sqrosc_ctor );
 CK_DLL_CTRL( sqrosc_ctrl_width );
 
+// band-limited oscillators | 1.5.1.7
+CK_DLL_CTOR( blsawosc_ctor );
+CK_DLL_CTOR( bltriosc_ctor );
+CK_DLL_CTOR( blpulseosc_ctor );
+CK_DLL_CTOR( blsqrosc_ctor );
+CK_DLL_TICK( blosc_tick );
+CK_DLL_TICKV( blosc_tickv );
+CK_DLL_TICK( blsawosc_tick );
+CK_DLL_TICKV( blsawosc_tickv );
+CK_DLL_TICK( blpulseosc_tick );
+CK_DLL_TICKV( blpulseosc_tickv );
+
 
 //-----------------------------------------------------------------------------
 // file: ugen_genX
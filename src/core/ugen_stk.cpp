@@ -1370,6 +1370,8 @@ Modified for Stk 4.0 by Gary Scavone.";
     if( !type_engine_import_ugen_begin( env, "BandedWG", "StkInstrument", env->global(),
                         BandedWG_ctor, BandedWG_dtor,
                         BandedWG_tick, BandedWG_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     type_engine_import_add_ex(env, "stk/band-o-matic.ck");
     type_engine_import_add_ex(env, "stk/bandedwg.ck");
@@ -1664,6 +1666,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "Bowed", "StkInstrument", env->global(),
                         Bowed_ctor, Bowed_dtor,
                         Bowed_tick, Bowed_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     type_engine_import_add_ex(env, "stk/bowed.ck");
     type_engine_import_add_ex(env, "stk/bowed2.ck");
@@ -1752,6 +1756,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "Brass", "StkInstrument", env->global(),
                         Brass_ctor, Brass_dtor,
                         Brass_tick, Brass_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     type_engine_import_add_ex(env, "stk/brass.ck");
     type_engine_import_add_ex(env, "stk/brass2.ck");
@@ -2078,6 +2084,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "Mandolin", "StkInstrument", env->global(),
                         Mandolin_ctor, Mandolin_dtor,
                         Mandolin_tick, Mandolin_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     type_engine_import_add_ex(env, "stk/mandolin.ck");
     type_engine_import_add_ex(env, "stk/mand-o-matic.ck");
@@ -2177,6 +2185,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "ModalBar", "StkInstrument", env->global(),
                         ModalBar_ctor, ModalBar_dtor,
                         ModalBar_tick, ModalBar_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     type_engine_import_add_ex(env, "stk/modalbar.ck");
     type_engine_import_add_ex(env, "stk/modalbar2.ck");
@@ -2334,6 +2344,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "Moog", "StkInstrument", env->global(),
                         Moog_ctor, Moog_dtor,
                         Moog_tick, Moog_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     type_engine_import_add_ex(env, "stk/moog.ck");
     type_engine_import_add_ex(env, "stk/moog2.ck");
@@ -2739,6 +2751,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "StifKarp", "StkInstrument", env->global(),
                         StifKarp_ctor, StifKarp_dtor,
                         StifKarp_tick, StifKarp_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     type_engine_import_add_ex(env, "stk/stifkarp.ck");
     type_engine_import_add_ex(env, "stk/stif-o-karp.ck");
@@ -2956,6 +2970,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "FM", "StkInstrument", env->global(),
                                         FM_ctor, FM_dtor,
                                         FM_tick, FM_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // member variable
     // all subclasses of FM must use this offset, as this is where the inherited
@@ -3125,6 +3141,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "BeeThree", "FM", env->global(),
                         BeeThree_ctor, BeeThree_dtor,
                         BeeThree_tick, BeeThree_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // add examples
     type_engine_import_add_ex(env, "hid/keyboard-organ.ck");
@@ -3162,6 +3180,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "FMVoices", "FM", env->global(),
                         FMVoices_ctor, FMVoices_dtor,
                         FMVoices_tick, FMVoices_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     func = make_new_mfun( "float", "vowel", FMVoices_ctrl_vowel ); //!select vowel
     func->add_arg( "float", "value" );
@@ -3222,6 +3242,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "HevyMetl", "FM", env->global(),
                         HevyMetl_ctor, HevyMetl_dtor,
                         HevyMetl_tick, HevyMetl_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // add examples
     if( !type_engine_import_add_ex( env, "stk/hevymetl-algo3.ck" ) ) goto error;
@@ -3261,6 +3283,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "HnkyTonk", "FM", env->global(),
         HnkyTonk_ctor, HnkyTonk_dtor,
         HnkyTonk_tick, HnkyTonk_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // add examples
     if( !type_engine_import_add_ex( env, "stk/honkeytonk-algo1.ck" ) ) goto error;
@@ -3298,6 +3322,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "FrencHrn", "FM", env->global(),
         FrencHrn_ctor, FrencHrn_dtor,
         FrencHrn_tick, FrencHrn_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // add examples
     if( !type_engine_import_add_ex( env, "stk/frenchrn-algo2.ck" ) ) goto error;
@@ -3335,6 +3361,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "KrstlChr", "FM", env->global(),
         KrstlChr_ctor, KrstlChr_dtor,
         KrstlChr_tick, KrstlChr_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // add examples
     if( !type_engine_import_add_ex( env, "stk/krstlchr-algo7.ck" ) ) goto error;
@@ -3373,6 +3401,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "PercFlut", "FM", env->global(),
                         PercFlut_ctor, PercFlut_dtor,
                         PercFlut_tick, PercFlut_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // add examples
     if( !type_engine_import_add_ex( env, "ctrl/ctrl_sequencer.ck" ) ) goto error;
@@ -3411,6 +3441,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "Rhodey", "FM", env->global(),
                         Rhodey_ctor, Rhodey_dtor,
                         Rhodey_tick, Rhodey_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     type_engine_import_add_ex(env, "stk/rhodey.ck");
 
@@ -3447,6 +3479,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "TubeBell", "FM", env->global(),
                         TubeBell_ctor, TubeBell_dtor,
                         TubeBell_tick, TubeBell_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // end the class import
     type_engine_import_class_end( env );
@@ -3482,6 +3516,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "Wurley", "FM", env->global(),
                         Wurley_ctor, Wurley_dtor,
                         Wurley_tick, Wurley_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     type_engine_import_add_ex(env, "stk/wurley.ck");
     type_engine_import_add_ex(env, "stk/wurley2.ck");
@@ -3508,6 +3544,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "Delay", "UGen", env->global(),
                         Delay_ctor, Delay_dtor,
                         Delay_tick, Delay_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // add examples
     if( !type_engine_import_add_ex( env, "basic/comb.ck" ) ) goto error;
@@ -3557,6 +3595,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "DelayA", "UGen", env->global(),
                         DelayA_ctor, DelayA_dtor,
                         DelayA_tick, DelayA_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
     // member variable
     DelayA_offset_data = type_engine_import_mvar ( env, "int", "@DelayA_data", FALSE );
     if( DelayA_offset_data == CK_INVALID_OFFSET ) goto error;
@@ -3604,6 +3644,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "DelayL", "UGen", env->global(),
                         DelayL_ctor, DelayL_dtor,
                         DelayL_tick, DelayL_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     type_engine_import_add_ex(env, "basic/delay.ck");
     type_engine_import_add_ex(env, "basic/i-robot.ck");
@@ -3651,6 +3693,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "Echo", "UGen", env->global(),
                         Echo_ctor, Echo_dtor,
                         Echo_tick, Echo_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // add examples
     type_engine_import_add_ex(env, "basic/echo.ck");
@@ -3705,6 +3749,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "Envelope", "UGen", env->global(),
                         Envelope_ctor, Envelope_dtor,
                         Envelope_tick, Envelope_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     type_engine_import_add_ex(env, "basic/envelope.ck");
     type_engine_import_add_ex(env, "basic/chirp2.ck");
@@ -3794,6 +3840,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "ADSR", "Envelope", env->global(),
                                         ADSR_ctor, ADSR_dtor,
                                         ADSR_tick, ADSR_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     type_engine_import_add_ex(env, "basic/adsr.ck");
     type_engine_import_add_ex(env, "basic/blit2.ck");
@@ -3909,6 +3957,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
 
     if( !type_engine_import_ugen_begin( env, "BiQuadStk", "UGen", env->global(),
                         BiQuad_ctor, BiQuad_tick, BiQuad_pmsg ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
     //member variable
     BiQuad_offset_data = type_engine_import_mvar ( env, "int", "@BiQuad_data", FALSE );
     if( BiQuad_offset_data == CK_INVALID_OFFSET ) goto error;
@@ -4025,6 +4075,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "OnePole", "UGen", env->global(),
                         OnePole_ctor, OnePole_dtor,
                         OnePole_tick, OnePole_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // member variable
     OnePole_offset_data = type_engine_import_mvar ( env, "int", "@OnePole_data", FALSE );
@@ -4074,6 +4126,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "TwoPole", "UGen", env->global(),
                         TwoPole_ctor, TwoPole_dtor,
                         TwoPole_tick, TwoPole_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     type_engine_import_add_ex(env, "shred/powerup.ck");
 
@@ -4149,6 +4203,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "OneZero", "UGen", env->global(),
                         OneZero_ctor, OneZero_dtor,
                         OneZero_tick, OneZero_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     //member variable
     OneZero_offset_data = type_engine_import_mvar ( env, "int", "@OneZero_data", FALSE );
@@ -4200,6 +4256,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "TwoZero", "UGen", env->global(),
                         TwoZero_ctor, TwoZero_dtor,
                         TwoZero_tick, TwoZero_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     //member variable
     TwoZero_offset_data = type_engine_import_mvar ( env, "int", "@TwoZero_data", FALSE );
@@ -4268,6 +4326,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "PoleZero", "UGen", env->global(),
                         PoleZero_ctor, PoleZero_dtor,
                         PoleZero_tick, PoleZero_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     //member variable
     PoleZero_offset_data = type_engine_import_mvar ( env, "int", "@PoleZero_data", FALSE );
@@ -4346,6 +4406,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "JCRev", "UGen", env->global(),
                         JCRev_ctor, JCRev_dtor,
                         JCRev_tick, JCRev_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     //member variable
     JCRev_offset_data = type_engine_import_mvar ( env, "int", "@JCRev_data", FALSE );
@@ -4379,6 +4441,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "NRev", "UGen", env->global(),
                         NRev_ctor, NRev_dtor,
                         NRev_tick, NRev_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     //member variable
     NRev_offset_data = type_engine_import_mvar ( env, "int", "@NRev_data", FALSE );
@@ -4412,6 +4476,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "PRCRev", "UGen", env->global(),
                         PRCRev_ctor, PRCRev_dtor,
                         PRCRev_tick, PRCRev_pmsg, doc.c_str() ) ) return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     //member variable
     PRCRev_offset_data = type_engine_import_mvar ( env, "int", "@PRCRev_data", FALSE );
@@ -384,6 +384,8 @@ DLL_QUERY xxx_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "Noise", "UGen", env->global(),
                                         NULL, NULL, noise_tick, NULL, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.1.7
+    if( !type_engine_import_ugen_tickv( env, noise_tickv ) ) goto error;
 
     if( !type_engine_import_add_ex( env, "basic/wind.ck" ) ) goto error;
     if( !type_engine_import_add_ex( env, "shred/powerup.ck" ) ) goto error;
@@ -458,6 +460,10 @@ DLL_QUERY xxx_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "Impulse", "UGen", env->global(),
                                         impulse_ctor, impulse_dtor, impulse_tick, NULL, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.1.7
+    if( !type_engine_import_ugen_tickv( env, impulse_tickv ) ) goto error;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // add ctrl: value
     //func = make_new_mfun( "float", "value", impulse_ctrl_value );
@@ -517,6 +523,10 @@ DLL_QUERY xxx_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "Step", "UGen", env->global(),
                                         step_ctor, step_dtor, step_tick, NULL, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.1.7
+    if( !type_engine_import_ugen_tickv( env, step_tickv ) ) goto error;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // add examples | 1.5.0.0 (ge)
     if( !type_engine_import_add_ex( env, "basic/step.ck" ) ) goto error;
@@ -562,6 +572,8 @@ DLL_QUERY xxx_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "HalfRect", "UGen", env->global(),
                                         NULL, NULL, halfrect_tick, NULL, doc.c_str() ) )
         return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // end import
     if( !type_engine_import_class_end( env ) )
@@ -580,6 +592,8 @@ DLL_QUERY xxx_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "FullRect", "UGen", env->global(),
                                         NULL, NULL, fullrect_tick, NULL, doc.c_str() ) )
         return FALSE;
+    // safe to tick alongside other ugens | 1.5.1.7
+    if( !type_engine_import_ugen_concurrent( env ) ) goto error;
 
     // end import
     if( !type_engine_import_class_end( env ) )
@@ -1893,6 +1907,18 @@ CK_DLL_TICK( noise_tick )
 }
 
 
+//-----------------------------------------------------------------------------
+// name: noise_tickv()
+// desc: block tick | 1.5.1.7
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( noise_tickv )
+{
+    for( t_CKUINT i = 0; i < nframes; i++ )
+        out[i] = (SAMPLE)( -1.0 + 2.0 * ck_random_f() );
+    return TRUE;
+}
+
+
 enum { NOISE_WHITE=0, NOISE_PINK, NOISE_BROWN, NOISE_FBM, NOISE_FLIP, NOISE_XOR };
 
 class CNoise_Data
@@ -2171,6 +2197,25 @@ CK_DLL_TICK( impulse_tick )
 
 
 
+//-----------------------------------------------------------------------------
+// name: impulse_tickv()
+// desc: block tick: the impulse, if any, on the first frame | 1.5.1.7
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( impulse_tickv )
+{
+    Pulse_Data * d = (Pulse_Data *)OBJ_MEMBER_UINT(SELF, impulse_offset_data);
+    memset( out, 0, nframes * sizeof(SAMPLE) );
+    if( d->when && nframes )
+    {
+        out[0] = d->value;
+        d->when = 0;
+    }
+
+    return TRUE;
+}
+
+
+
 //-----------------------------------------------------------------------------
 // name: impulse_ctrl_next()
 // desc: ...
@@ -2237,6 +2282,19 @@ CK_DLL_TICK( step_tick )
 }
 
 
+//-----------------------------------------------------------------------------
+// name: step_tickv()
+// desc: block tick | 1.5.1.7
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( step_tickv )
+{
+    SAMPLE v = *(SAMPLE *)OBJ_MEMBER_UINT(SELF, step_offset_data);
+    for( t_CKUINT i = 0; i < nframes; i++ ) out[i] = v;
+
+    return TRUE;
+}
+
+
 //-----------------------------------------------------------------------------
 // name: step_ctrl_next()
 // desc: ...
@@ -73,6 +73,7 @@ CK_DLL_CGET( mix2_cget_value );
 
 // noise
 CK_DLL_TICK( noise_tick );
+CK_DLL_TICKV( noise_tickv );
 
 // cnoise
 CK_DLL_CTOR( cnoise_ctor );
@@ -85,6 +86,7 @@ CK_DLL_CTRL( cnoise_ctrl_fprob );
 CK_DLL_CTOR( impulse_ctor );
 CK_DLL_DTOR( impulse_dtor );
 CK_DLL_TICK( impulse_tick );
+CK_DLL_TICKV( impulse_tickv );
 CK_DLL_CTRL( impulse_ctrl_next );
 CK_DLL_CGET( impulse_cget_next );
 
@@ -92,6 +94,7 @@ CK_DLL_CGET( impulse_cget_next );
 CK_DLL_CTOR( step_ctor );
 CK_DLL_DTOR( step_dtor );
 CK_DLL_TICK( step_tick );
+CK_DLL_TICKV( step_tickv );
 CK_DLL_CTRL( step_ctrl_next );
 CK_DLL_CGET( step_cget_next );
 
@@ -35,6 +35,8 @@
 #include "chuck_compile.h"
 #include "chuck_errmsg.h"
 #include "chuck_instr.h"
+#include "chuck_cycle.h"
+#include "chuck_reclaim.h"
 #include "chuck.h"
 
 #include "util_string.h"
@@ -67,6 +69,27 @@ CK_DLL_SFUN( machine_version_impl );
 CK_DLL_SFUN( machine_setloglevel_impl );
 CK_DLL_SFUN( machine_getloglevel_impl );
 CK_DLL_SFUN( machine_refcount_impl);
+CK_DLL_SFUN( machine_collect_impl );
+CK_DLL_SFUN( machine_setCollectBudget_impl );
+CK_DLL_SFUN( machine_getCollectBudget_impl );
+CK_DLL_SFUN( machine_collectScanned_impl );
+CK_DLL_SFUN( machine_collectCycles_impl );
+CK_DLL_SFUN( machine_collectFreed_impl );
+CK_DLL_SFUN( machine_collectTime_impl );
+CK_DLL_SFUN( machine_setReclaimBudget_impl );
+CK_DLL_SFUN( machine_getReclaimBudget_impl );
+CK_DLL_SFUN( machine_reclaimDeferred_impl );
+CK_DLL_SFUN( machine_reclaimFreed_impl );
+CK_DLL_SFUN( machine_reclaimOverflowed_impl );
+CK_DLL_SFUN( machine_reclaimDepth_impl );
+CK_DLL_SFUN( machine_reclaimDepthMax_impl );
+CK_DLL_SFUN( machine_reclaimLatency_impl );
+CK_DLL_SFUN( machine_reclaimLatencyMax_impl );
+CK_DLL_SFUN( machine_reallocs_impl );
+CK_DLL_SFUN( machine_setReallocReport_impl );
+CK_DLL_SFUN( machine_getReallocReport_impl );
+CK_DLL_SFUN( machine_icHits_impl );
+CK_DLL_SFUN( machine_icMisses_impl );
 CK_DLL_SFUN( machine_opOverloadPush_impl);
 CK_DLL_SFUN( machine_opOverloadPop_impl);
 CK_DLL_SFUN( machine_opOverloadReset_impl);
@@ -264,6 +287,76 @@ DLL_QUERY machine_query( Chuck_DL_Query * QUERY )
     QUERY->add_arg( QUERY, "Object", "obj" );
     QUERY->doc_func( QUERY, "get an object's current internal reference count; this is intended for testing or curiosity; NOTE: this function intentionally does not take into account any reference counting related to the calling of this function (normally all functions increments the reference count for objects passed as arguments and decrements upon returning)" );
 
+    // cycle collection | 1.5.1.7
+    QUERY->add_sfun( QUERY, machine_collect_impl, "int", "collect" );
+    QUERY->doc_func( QUERY, "free unreachable reference cycles (e.g., a doubly-linked list no longer referred to) now, instead of a slice at a time between blocks; returns the number of objects freed; does nothing unless cycle collection is on (see collectBudget() or --collect:<N>)." );
+
+    QUERY->add_sfun( QUERY, machine_setCollectBudget_impl, "int", "collectBudget" );
+    QUERY->add_arg( QUERY, "int", "budget" );
+    QUERY->doc_func( QUERY, "set the number of objects the cycle collector scans between blocks, turning it on if it is off; 0 frees what cycles it can and turns it off. Returns the new budget." );
+
+    QUERY->add_sfun( QUERY, machine_getCollectBudget_impl, "int", "collectBudget" );
+    QUERY->doc_func( QUERY, "get the number of objects the cycle collector scans between blocks; 0 if it is off." );
+
+    QUERY->add_sfun( QUERY, machine_collectScanned_impl, "int", "collectScanned" );
+    QUERY->doc_func( QUERY, "get the number of objects the cycle collector has scanned so far." );
+
+    QUERY->add_sfun( QUERY, machine_collectCycles_impl, "int", "collectCycles" );
+    QUERY->doc_func( QUERY, "get the number of unreachable cycles the cycle collector has found so far." );
+
+    QUERY->add_sfun( QUERY, machine_collectFreed_impl, "int", "collectFreed" );
+    QUERY->doc_func( QUERY, "get the number of objects in unreachable cycles the cycle collector has freed so far." );
+
+    QUERY->add_sfun( QUERY, machine_collectTime_impl, "float", "collectTime" );
+    QUERY->doc_func( QUERY, "get the (wall clock) time the cycle collector has spent so far, in milliseconds." );
+
+    // deferred object reclamation | 1.5.1.7
+    QUERY->add_sfun( QUERY, machine_setReclaimBudget_impl, "int", "reclaimBudget" );
+    QUERY->add_arg( QUERY, "int", "budget" );
+    QUERY->doc_func( QUERY, "set the number of released objects deleted between blocks, turning deferred reclamation on if it is off (objects whose last reference goes away are then queued, and deleted a slice at a time); 0 deletes what is queued and turns it off. Returns the new budget." );
+
+    QUERY->add_sfun( QUERY, machine_getReclaimBudget_impl, "int", "reclaimBudget" );
+    QUERY->doc_func( QUERY, "get the number of released objects deleted between blocks; 0 if deferred reclamation is off (see reclaimBudget( int ) or --reclaim:<N>)." );
+
+    QUERY->add_sfun( QUERY, machine_reclaimDeferred_impl, "int", "reclaimDeferred" );
+    QUERY->doc_func( QUERY, "get the number of released objects queued for deletion so far (as of the last block)." );
+
+    QUERY->add_sfun( QUERY, machine_reclaimFreed_impl, "int", "reclaimFreed" );
+    QUERY->doc_func( QUERY, "get the number of queued objects deleted so far." );
+
+    QUERY->add_sfun( QUERY, machine_reclaimOverflowed_impl, "int", "reclaimOverflowed" );
+    QUERY->doc_func( QUERY, "get the number of released objects deleted right away because the queue was full (as of the last block)." );
+
+    QUERY->add_sfun( QUERY, machine_reclaimDepth_impl, "int", "reclaimDepth" );
+    QUERY->doc_func( QUERY, "get the number of released objects waiting in the queue right now." );
+
+    QUERY->add_sfun( QUERY, machine_reclaimDepthMax_impl, "int", "reclaimDepthMax" );
+    QUERY->doc_func( QUERY, "get the most released objects there have been waiting in the queue at the start of a block." );
+
+    QUERY->add_sfun( QUERY, machine_reclaimLatency_impl, "dur", "reclaimLatency" );
+    QUERY->doc_func( QUERY, "get the average time from an object being queued to its deletion (to the block)." );
+
+    QUERY->add_sfun( QUERY, machine_reclaimLatencyMax_impl, "dur", "reclaimLatencyMax" );
+    QUERY->doc_func( QUERY, "get the longest time from an object being queued to its deletion (to the block)." );
+
+    // array reallocations | 1.5.1.7
+    QUERY->add_sfun( QUERY, machine_reallocs_impl, "int", "reallocs" );
+    QUERY->doc_func( QUERY, "get the number of times array (or deque) storage has been reallocated to grow (e.g., by << past an array's capacity) so far; compare before and after a section of code to verify that it does not reallocate. See also array.reserve() and array.fixed()." );
+
+    QUERY->add_sfun( QUERY, machine_setReallocReport_impl, "int", "reallocReport" );
+    QUERY->add_arg( QUERY, "int", "report" );
+    QUERY->doc_func( QUERY, "set whether to print each reallocation of array storage as it happens (see also --report-realloc:on); returns the setting." );
+
+    QUERY->add_sfun( QUERY, machine_getReallocReport_impl, "int", "reallocReport" );
+    QUERY->doc_func( QUERY, "get whether each reallocation of array storage is printed." );
+
+    // inline caches | 1.5.1.7
+    QUERY->add_sfun( QUERY, machine_icHits_impl, "int", "icHits" );
+    QUERY->doc_func( QUERY, "get the number of member function calls so far whose function was found in the call site's inline cache (i.e., the receiver's type was seen there before)." );
+
+    QUERY->add_sfun( QUERY, machine_icMisses_impl, "int", "icMisses" );
+    QUERY->doc_func( QUERY, "get the number of member function calls so far whose function was looked up in the receiver's vtable (first sight of a type at a call site, or more types than the cache holds)." );
+
     // add examples
     QUERY->add_ex( QUERY, "machine/eval.ck" );
     QUERY->add_ex( QUERY, "machine/eval-global.ck" );
@@ -609,6 +702,123 @@ CK_DLL_SFUN( machine_refcount_impl )
     RETURN->v_int = obj != NULL ? obj->m_ref_count-1 : 0;
 }
 
+CK_DLL_SFUN( machine_collect_impl )
+{
+    Chuck_VM_Cycle_Collector * collector = VM->collector();
+    RETURN->v_int = collector ? collector->collect_all() : 0;
+}
+
+CK_DLL_SFUN( machine_setCollectBudget_impl )
+{
+    // arg
+    t_CKINT budget = GET_NEXT_INT(ARGS);
+    // set
+    VM->set_collect( budget < 0 ? 0 : budget );
+    // return
+    RETURN->v_int = VM->collector() ? VM->collector()->budget() : 0;
+}
+
+CK_DLL_SFUN( machine_getCollectBudget_impl )
+{
+    RETURN->v_int = VM->collector() ? VM->collector()->budget() : 0;
+}
+
+CK_DLL_SFUN( machine_collectScanned_impl )
+{
+    RETURN->v_int = VM->collector() ? VM->collector()->stats().scanned : 0;
+}
+
+CK_DLL_SFUN( machine_collectCycles_impl )
+{
+    RETURN->v_int = VM->collector() ? VM->collector()->stats().cycles : 0;
+}
+
+CK_DLL_SFUN( machine_collectFreed_impl )
+{
+    RETURN->v_int = VM->collector() ? VM->collector()->stats().freed : 0;
+}
+
+CK_DLL_SFUN( machine_collectTime_impl )
+{
+    RETURN->v_float = VM->collector() ? VM->collector()->stats().time_total * 1000 : 0;
+}
+
+CK_DLL_SFUN( machine_setReclaimBudget_impl )
+{
+    // arg
+    t_CKINT budget = GET_NEXT_INT(ARGS);
+    // set
+    VM->set_reclaim( budget < 0 ? 0 : budget );
+    // return
+    RETURN->v_int = VM->reclaimer() ? VM->reclaimer()->budget() : 0;
+}
+
+CK_DLL_SFUN( machine_getReclaimBudget_impl )
+{
+    RETURN->v_int = VM->reclaimer() ? VM->reclaimer()->budget() : 0;
+}
+
+CK_DLL_SFUN( machine_reclaimDeferred_impl )
+{
+    RETURN->v_int = VM->reclaimer() ? VM->reclaimer()->stats().deferred : 0;
+}
+
+CK_DLL_SFUN( machine_reclaimFreed_impl )
+{
+    RETURN->v_int = VM->reclaimer() ? VM->reclaimer()->stats().reclaimed : 0;
+}
+
+CK_DLL_SFUN( machine_reclaimOverflowed_impl )
+{
+    RETURN->v_int = VM->reclaimer() ? VM->reclaimer()->stats().overflowed : 0;
+}
+
+CK_DLL_SFUN( machine_reclaimDepth_impl )
+{
+    RETURN->v_int = VM->reclaimer() ? VM->reclaimer()->depth() : 0;
+}
+
+CK_DLL_SFUN( machine_reclaimDepthMax_impl )
+{
+    RETURN->v_int = VM->reclaimer() ? VM->reclaimer()->stats().depth_max : 0;
+}
+
+CK_DLL_SFUN( machine_reclaimLatency_impl )
+{
+    RETURN->v_dur = VM->reclaimer() ? VM->reclaimer()->stats().latency_avg() : 0;
+}
+
+CK_DLL_SFUN( machine_reclaimLatencyMax_impl )
+{
+    RETURN->v_dur = VM->reclaimer() ? VM->reclaimer()->stats().latency_max : 0;
+}
+
+CK_DLL_SFUN( machine_reallocs_impl )
+{
+    RETURN->v_int = VM->reallocs();
+}
+
+CK_DLL_SFUN( machine_setReallocReport_impl )
+{
+    VM->set_realloc_report( GET_NEXT_INT(ARGS) != 0 );
+    RETURN->v_int = VM->realloc_report();
+}
+
+CK_DLL_SFUN( machine_getReallocReport_impl )
+{
+    RETURN->v_int = VM->realloc_report();
+}
+
+CK_DLL_SFUN( machine_icHits_impl )
+{
+    RETURN->v_int = VM->ic_hits();
+}
+
+CK_DLL_SFUN( machine_icMisses_impl )
+{
+    RETURN->v_int = VM->ic_misses();
+}
+
 CK_DLL_SFUN( machine_opOverloadPush_impl)
 {
     VM->env()->op_registry.push();
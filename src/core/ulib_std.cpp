@@ -795,7 +795,10 @@ CK_DLL_SFUN( itoa_impl )
     t_CKINT i = GET_CK_INT(ARGS);
     // TODO: memory leak, please fix.  Thanks.
     Chuck_String * a = (Chuck_String *)instantiate_and_initialize_object( SHRED->vm_ref->env()->ckt_string, SHRED );
-    a->set( ck_itoa( i ) );
+    // format in place, without a temporary | 1.5.1.7
+    char buffer[128];
+    t_CKUINT len = ck_itoa( i, buffer, sizeof(buffer) );
+    a->set( buffer, len );
     RETURN->v_string = a;
 }
 
@@ -805,7 +808,10 @@ CK_DLL_SFUN( ftoa_impl )
     t_CKFLOAT f = GET_NEXT_FLOAT(ARGS);
     t_CKINT p = GET_NEXT_INT(ARGS);
     Chuck_String * a = (Chuck_String *)instantiate_and_initialize_object( SHRED->vm_ref->env()->ckt_string, SHRED );
-    a->set( ck_ftoa( f, (t_CKUINT)p ) );
+    // format in place, without a temporary | 1.5.1.7
+    char buffer[128];
+    t_CKUINT len = ck_ftoa( f, (t_CKUINT)p, buffer, sizeof(buffer) );
+    a->set( buffer, len );
     RETURN->v_string = a;
 }
 
@@ -35,6 +35,8 @@
 #include "util_buffers.h"
 #include "chuck_errmsg.h"
 #include <stdlib.h>
+#include <string.h>
+#include <thread>
 
 
 #ifndef CALLBACK
@@ -50,7 +52,20 @@
 CBufferAdvance::CBufferAdvance()
 {
     m_data = NULL;
-    m_data_width = m_write_offset = m_max_elem = 0; // = m_read_offset
+    m_data_width = m_max_elem = 0;
+    m_num_readers = 0;
+    m_write_offset.store( 0 );
+    m_notifying.store( 0 );
+    m_event_buffer = NULL;
+
+    // the first chunk of readers
+    for( UINT__ i = 0; i < READERS_PER_CHUNK; i++ )
+    {
+        m_readers.readers[i].read_offset = 0;
+        m_readers.readers[i].active = FALSE;
+        m_readers.readers[i].event.store( NULL );
+    }
+    m_readers.next.store( NULL );
 }
 
 
@@ -83,9 +98,8 @@ BOOL__ CBufferAdvance::initialize( UINT__ num_elem, UINT__ width, CBufferSimple
         return false;
 
     m_data_width = width;
-    //m_read_offset = 0;
-    m_write_offset = 0;
-    m_max_elem = (SINT__)num_elem;
+    m_write_offset.store( 0 );
+    m_max_elem = num_elem;
 
     m_event_buffer = event_buffer;
 
@@ -101,14 +115,52 @@ BOOL__ CBufferAdvance::initialize( UINT__ num_elem, UINT__ width, CBufferSimple
 //-----------------------------------------------------------------------------
 void CBufferAdvance::cleanup()
 {
+    // readers beyond the first chunk
+    ReaderChunk * chunk = m_readers.next.load();
+    while( chunk )
+    {
+        ReaderChunk * next = chunk->next.load();
+        delete chunk;
+        chunk = next;
+    }
+    m_readers.next.store( NULL );
+    for( UINT__ i = 0; i < READERS_PER_CHUNK; i++ )
+    {
+        m_readers.readers[i].active = FALSE;
+        m_readers.readers[i].event.store( NULL );
+    }
+    m_num_readers = 0;
+    m_free = std::queue<UINT__>();
+
     if( !m_data )
         return;
 
     free( m_data );
 
     m_data = NULL;
-    m_data_width = 0;
-    m_write_offset = m_max_elem = 0; // = m_read_offset
+    m_data_width = m_max_elem = 0;
+    m_write_offset.store( 0 );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: reader()
+// desc: a reader's place at the given index; NULL if none | 1.5.1.7
+//-----------------------------------------------------------------------------
+CBufferAdvance::ReadOffset * CBufferAdvance::reader( UINT__ read_offset_index ) const
+{
+    // make sure index is valid
+    if( read_offset_index >= m_num_readers )
+        return NULL;
+
+    // find its chunk
+    const ReaderChunk * chunk = &m_readers;
+    for( UINT__ i = read_offset_index / READERS_PER_CHUNK; i > 0; i-- )
+        chunk = chunk->next.load( std::memory_order_relaxed );
+
+    return (ReadOffset *)&chunk->readers[read_offset_index % READERS_PER_CHUNK];
 }
 
 
@@ -120,34 +172,45 @@ void CBufferAdvance::cleanup()
 //-----------------------------------------------------------------------------
 UINT__ CBufferAdvance::join( Chuck_Event * event )
 {
-    // TODO: necessary?
-    #ifndef __DISABLE_THREADS__
-    m_mutex.acquire();
-    #endif
-
     // index of new pointer that will be pushed back
     UINT__ read_offset_index;
 
-    // add new pointer pointing (as pointers do) to current write offset
-    // (shreds don't get interrupted, so m_write_offset will always be correct, right?)
-    // (uh, hope so...)
+    // reuse a resigned place...
     if( !m_free.empty() )
     {
         read_offset_index = m_free.front();
         m_free.pop();
-        //assert( read_offset_index < m_read_offsets.size() );
-        m_read_offsets[read_offset_index] = ReadOffset( m_write_offset, event );
     }
+    // ...or add one
     else
     {
-        read_offset_index = m_read_offsets.size();
-        m_read_offsets.push_back( ReadOffset( m_write_offset, event ) );
+        read_offset_index = m_num_readers;
+        // out of room: add a chunk (set up first, then linked in last,
+        // since the writer may be walking the chunks) | 1.5.1.7
+        if( read_offset_index && read_offset_index % READERS_PER_CHUNK == 0 )
+        {
+            ReaderChunk * chunk = new ReaderChunk;
+            for( UINT__ i = 0; i < READERS_PER_CHUNK; i++ )
+            {
+                chunk->readers[i].read_offset = 0;
+                chunk->readers[i].active = FALSE;
+                chunk->readers[i].event.store( NULL, std::memory_order_relaxed );
+            }
+            chunk->next.store( NULL, std::memory_order_relaxed );
+            // the last chunk
+            ReaderChunk * last = &m_readers;
+            while( last->next.load( std::memory_order_relaxed ) )
+                last = last->next.load( std::memory_order_relaxed );
+            last->next.store( chunk, std::memory_order_release );
+        }
+        m_num_readers++;
     }
 
-    // TODO: necessary?
-    #ifndef __DISABLE_THREADS__
-    m_mutex.release();
-    #endif
+    // start reading from what's put next
+    ReadOffset * r = reader( read_offset_index );
+    r->read_offset = m_write_offset.load( std::memory_order_acquire );
+    r->active = TRUE;
+    r->event.store( event, std::memory_order_release );
 
     // return index
     return read_offset_index;
@@ -161,227 +224,268 @@ UINT__ CBufferAdvance::join( Chuck_Event * event )
 void CBufferAdvance::resign( UINT__ read_offset_index )
 {
     // make sure read_offset_index passed in is valid
-    if( read_offset_index >= m_read_offsets.size() )
+    ReadOffset * r = reader( read_offset_index );
+    if( !r || !r->active )
         return;
 
-    // TODO: necessary?
-    #ifndef __DISABLE_THREADS__
-    m_mutex.acquire();
-    #endif
+    // "invalidate" the pointer at that index
+    r->active = FALSE;
+    // no more notifying its event...
+    r->event.store( NULL, std::memory_order_seq_cst );
+    // ...but a put() may have picked it up already; let that finish, so
+    // the event can go away once we return (a short wait, and only here)
+    while( m_notifying.load( std::memory_order_seq_cst ) )
+        std::this_thread::yield();
 
     // add this index to free queue
     m_free.push( read_offset_index );
-
-    // "invalidate" the pointer at that index
-    m_read_offsets[read_offset_index].read_offset = -1;
-    m_read_offsets[read_offset_index].event = NULL;
-
-    // TODO: necessary?
-    #ifndef __DISABLE_THREADS__
-    m_mutex.release();
-    #endif
 }
 
 
 //-----------------------------------------------------------------------------
 // name: put()
-// desc: put
+// desc: put (writer only); wait-free
 //-----------------------------------------------------------------------------
-/*void CBufferAdvance::put( void * data, UINT__ num_elem )
+void CBufferAdvance::put( void * data, UINT__ num_elem )
 {
-    UINT__ i, j;
+    UINT__ i;
     BYTE__ * d = (BYTE__ *)data;
+    UINT__ write = m_write_offset.load( std::memory_order_relaxed );
 
     // copy
     for( i = 0; i < num_elem; i++ )
     {
-        for( j = 0; j < m_data_width; j++ )
+        memcpy( m_data + (write % m_max_elem) * m_data_width,
+                d + i * m_data_width, m_data_width );
+        // publish; readers lapped by now skip ahead in get()
+        m_write_offset.store( ++write, std::memory_order_release );
+    }
+
+    // notify readers (once per put; the VM combines requests anyway)
+    m_notifying.store( 1, std::memory_order_seq_cst );
+    for( ReaderChunk * chunk = &m_readers; chunk;
+         chunk = chunk->next.load( std::memory_order_acquire ) )
+    {
+        for( i = 0; i < READERS_PER_CHUNK; i++ )
         {
-            m_data[m_write_offset*m_data_width+j] = d[i*m_data_width+j];
+            Chuck_Event * event = chunk->readers[i].event.load( std::memory_order_seq_cst );
+            if( event ) event->queue_broadcast( m_event_buffer );
         }
+    }
+    m_notifying.store( 0, std::memory_order_release );
+}
 
-        // move the write
-        m_write_offset++;
 
-        // wrap
-        if( m_write_offset >= m_max_elem )
-            m_write_offset = 0;
-    }
-}*/
 
 
-void CBufferAdvance::put( void * data, UINT__ num_elem )
+//-----------------------------------------------------------------------------
+// name: empty()
+// desc: whether reader at index has caught up
+//-----------------------------------------------------------------------------
+BOOL__ CBufferAdvance::empty( UINT__ read_offset_index )
+{
+    // make sure index is valid
+    ReadOffset * r = reader( read_offset_index );
+    if( !r || !r->active )
+        return TRUE;
+
+    // see if caught up
+    return r->read_offset == m_write_offset.load( std::memory_order_acquire );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: get()
+// desc: get (reader at index); wait-free
+//-----------------------------------------------------------------------------
+UINT__ CBufferAdvance::get( void * data, UINT__ num_elem, UINT__ read_offset_index )
 {
-    UINT__ i, j;
+    UINT__ i = 0;
     BYTE__ * d = (BYTE__ *)data;
 
-    // TODO: necessary?
-    #ifndef __DISABLE_THREADS__
-    m_mutex.acquire();
-    #endif
+    // make sure index is valid
+    ReadOffset * r = reader( read_offset_index );
+    if( !r || !r->active )
+        return 0;
+
+    UINT__ read = r->read_offset;
+    UINT__ write = m_write_offset.load( std::memory_order_acquire );
 
-    // copy
-    for( i = 0; i < num_elem; i++ )
+    // copy, until caught up with write
+    while( i < num_elem && read != write )
     {
-        for( j = 0; j < m_data_width; j++ )
-        {
-            m_data[m_write_offset*m_data_width+j] = d[i*m_data_width+j];
-        }
+        // lapped: skip to the oldest element the writer can't be writing
+        if( write - read >= m_max_elem )
+            read = write - m_max_elem + 1;
 
-        // move the write
-        m_write_offset++;
-        // wrap
-        if( m_write_offset >= m_max_elem )
-            m_write_offset = 0;
+        memcpy( d + i * m_data_width,
+                m_data + (read % m_max_elem) * m_data_width, m_data_width );
 
-        // possibility of expelling evil shreds
-        for( j = 0; j < m_read_offsets.size(); j++ )
-        {
-            if( m_write_offset == m_read_offsets[j].read_offset )
-            {
-                // inform shred with index j that it has lost its privileges?
-                // invalidate its read_offset
-                // m_read_offsets[j].read_offset = -1;
-            }
+        // did the writer get to this slot while we were copying?
+        std::atomic_thread_fence( std::memory_order_acquire );
+        write = m_write_offset.load( std::memory_order_relaxed );
+        if( write - read >= m_max_elem )
+            continue;
 
-            if( m_read_offsets[j].event )
-                m_read_offsets[j].event->queue_broadcast( m_event_buffer );
-        }
+        // move read
+        read++;
+        i++;
     }
 
-    // TODO: necessary?
-    #ifndef __DISABLE_THREADS__
-    m_mutex.release();
-    #endif
+    // update read offset at given index
+    r->read_offset = read;
+
+    // return number of elems
+    return i;
 }
 
 
 
 
 //-----------------------------------------------------------------------------
-// name: get()
-// desc: get
+// name: CBufferSimple()
+// desc: constructor
 //-----------------------------------------------------------------------------
-/*UINT__ CBufferAdvance::get( void * data, UINT__ num_elem )
+CBufferSimple::CBufferSimple()
 {
-    UINT__ i, j;
-    BYTE__ * d = (BYTE__ *)data;
+    m_data = NULL;
+    m_data_width = m_mask = 0;
+    m_read_offset.store( 0 );
+    m_write_offset.store( 0 );
+    m_write_seen = m_read_seen = 0;
+}
 
-    // read catch up with write
-    if( m_read_offset == m_write_offset )
-        return 0;
 
-    // copy
-    for( i = 0; i < num_elem; i++ )
-    {
-        for( j = 0; j < m_data_width; j++ )
-        {
-            d[i*m_data_width+j] = m_data[m_read_offset*m_data_width+j];
-        }
 
-        // move read
-        m_read_offset++;
 
-        // catch up
-        if( m_read_offset == m_write_offset )
-        {
-            i++;
-            break;
-        }
+//-----------------------------------------------------------------------------
+// name: ~CBufferSimple()
+// desc: destructor
+//-----------------------------------------------------------------------------
+CBufferSimple::~CBufferSimple()
+{
+    this->cleanup();
+}
 
-        // wrap
-        if( m_read_offset >= m_max_elem )
-            m_read_offset = 0;
-    }
 
-    // return number of elems
-    return 1;
-}*/
 
 
-BOOL__ CBufferAdvance::empty( UINT__ read_offset_index )
+//-----------------------------------------------------------------------------
+// name: initialize()
+// desc: initialize
+//-----------------------------------------------------------------------------
+BOOL__ CBufferSimple::initialize( UINT__ num_elem, UINT__ width )
 {
-    // make sure index is valid
-    if( read_offset_index >= m_read_offsets.size() )
-        return TRUE;
-    if( m_read_offsets[read_offset_index].read_offset < 0 )
-        return TRUE;
+    // cleanup
+    cleanup();
 
-    SINT__ m_read_offset = m_read_offsets[read_offset_index].read_offset;
+    // round up to a power of two
+    UINT__ size = 1;
+    while( size < num_elem ) size <<= 1;
 
-    // see if caught up
-    return m_read_offset == m_write_offset;
+    // allocate
+    m_data = (BYTE__ *)malloc( size * width );
+    if( !m_data )
+        return false;
+
+    m_data_width = width;
+    m_mask = size - 1;
+    m_read_offset.store( 0 );
+    m_write_offset.store( 0 );
+    m_write_seen = m_read_seen = 0;
+
+    return true;
 }
 
 
-UINT__ CBufferAdvance::get( void * data, UINT__ num_elem, UINT__ read_offset_index )
+
+
+//-----------------------------------------------------------------------------
+// name: cleanup()
+// desc: cleanup
+//-----------------------------------------------------------------------------
+void CBufferSimple::cleanup()
 {
-    UINT__ i, j;
-    BYTE__ * d = (BYTE__ *)data;
+    if( !m_data )
+        return;
 
-    // TODO: necessary?
-    #ifndef __DISABLE_THREADS__
-    m_mutex.acquire();
-    #endif
+    free( m_data );
 
-    // make sure index is valid
-    if( read_offset_index >= m_read_offsets.size() )
-    {
-        #ifndef __DISABLE_THREADS__
-        m_mutex.release();
-        #endif
-        return 0;
-    }
-    if( m_read_offsets[read_offset_index].read_offset < 0 )
-    {
-        #ifndef __DISABLE_THREADS__
-        m_mutex.release();
-        #endif
-        return 0;
-    }
+    m_data = NULL;
+    m_data_width = m_mask = 0;
+    m_read_offset.store( 0 );
+    m_write_offset.store( 0 );
+    m_write_seen = m_read_seen = 0;
+}
 
-    SINT__ m_read_offset = m_read_offsets[read_offset_index].read_offset;
 
-    // read catch up with write
-    if( m_read_offset == m_write_offset )
-    {
-        #ifndef __DISABLE_THREADS__
-        m_mutex.release();
-        #endif
-        return 0;
-    }
+
+
+//-----------------------------------------------------------------------------
+// name: put()
+// desc: put (writer only); returns number put, fewer if full
+//-----------------------------------------------------------------------------
+UINT__ CBufferSimple::put( void * data, UINT__ num_elem )
+{
+    UINT__ i;
+    BYTE__ * d = (BYTE__ *)data;
+    UINT__ write = m_write_offset.load( std::memory_order_relaxed );
 
     // copy
     for( i = 0; i < num_elem; i++ )
     {
-        for( j = 0; j < m_data_width; j++ )
+        // full, as of the last look at the reader? look again
+        if( write - m_read_seen > m_mask )
         {
-            d[i*m_data_width+j] = m_data[m_read_offset*m_data_width+j];
+            m_read_seen = m_read_offset.load( std::memory_order_acquire );
+            if( write - m_read_seen > m_mask ) break;
         }
 
-        // move read
-        m_read_offset++;
-        // wrap
-        if( m_read_offset >= m_max_elem )
-            m_read_offset = 0;
+        memcpy( m_data + (write & m_mask) * m_data_width,
+                d + i * m_data_width, m_data_width );
+        write++;
+    }
+
+    // publish them all at once
+    m_write_offset.store( write, std::memory_order_release );
+
+    return i;
+}
 
-        // catch up
-        if( m_read_offset == m_write_offset )
+
+
+
+//-----------------------------------------------------------------------------
+// name: get()
+// desc: get (reader only); returns number got
+//-----------------------------------------------------------------------------
+UINT__ CBufferSimple::get( void * data, UINT__ num_elem )
+{
+    UINT__ i;
+    BYTE__ * d = (BYTE__ *)data;
+    UINT__ read = m_read_offset.load( std::memory_order_relaxed );
+
+    // copy
+    for( i = 0; i < num_elem; i++ )
+    {
+        // caught up, as of the last look at the writer? look again
+        if( read == m_write_seen )
         {
-            i++;
-            break;
+            m_write_seen = m_write_offset.load( std::memory_order_acquire );
+            if( read == m_write_seen ) break;
         }
-    }
 
-    // update read offset at given index
-    m_read_offsets[read_offset_index].read_offset = m_read_offset;
+        memcpy( d + i * m_data_width,
+                m_data + (read & m_mask) * m_data_width, m_data_width );
+        read++;
+    }
 
-    // TODO: necessary?
-    #ifndef __DISABLE_THREADS__
-    m_mutex.release();
-    #endif
+    // hand the slots back to the writer
+    if( i ) m_read_offset.store( read, std::memory_order_release );
 
-    // return number of elems
+    // return number of elems (was: 1, for any number)
     return i;
 }
 
@@ -389,23 +493,39 @@ UINT__ CBufferAdvance::get( void * data, UINT__ num_elem, UINT__ read_offset_ind
 
 
 //-----------------------------------------------------------------------------
-// name: CBufferSimple()
+// name: size()
+// desc: number of elements waiting
+//-----------------------------------------------------------------------------
+UINT__ CBufferSimple::size() const
+{
+    return m_write_offset.load( std::memory_order_acquire ) -
+           m_read_offset.load( std::memory_order_acquire );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: CBufferMulti()
 // desc: constructor
 //-----------------------------------------------------------------------------
-CBufferSimple::CBufferSimple()
+CBufferMulti::CBufferMulti()
 {
     m_data = NULL;
-    m_data_width = m_read_offset = m_write_offset = m_max_elem = 0;
+    m_data_width = m_mask = 0;
+    m_seq = NULL;
+    m_write_offset.store( 0 );
+    m_read_offset = 0;
 }
 
 
 
 
 //-----------------------------------------------------------------------------
-// name: ~CBufferSimple()
+// name: ~CBufferMulti()
 // desc: destructor
 //-----------------------------------------------------------------------------
-CBufferSimple::~CBufferSimple()
+CBufferMulti::~CBufferMulti()
 {
     this->cleanup();
 }
@@ -417,20 +537,29 @@ CBufferSimple::~CBufferSimple()
 // name: initialize()
 // desc: initialize
 //-----------------------------------------------------------------------------
-BOOL__ CBufferSimple::initialize( UINT__ num_elem, UINT__ width )
+BOOL__ CBufferMulti::initialize( UINT__ num_elem, UINT__ width )
 {
     // cleanup
     cleanup();
 
+    // round up to a power of two
+    UINT__ size = 1;
+    while( size < num_elem ) size <<= 1;
+
     // allocate
-    m_data = (BYTE__ *)malloc( num_elem * width );
+    m_data = (BYTE__ *)malloc( size * width );
     if( !m_data )
         return false;
+    m_seq = new std::atomic<UINT__>[size];
+
+    // each slot free for its first position
+    for( UINT__ i = 0; i < size; i++ )
+        m_seq[i].store( i, std::memory_order_relaxed );
 
     m_data_width = width;
+    m_mask = size - 1;
+    m_write_offset.store( 0 );
     m_read_offset = 0;
-    m_write_offset = 0;
-    m_max_elem = num_elem;
 
     return true;
 }
@@ -442,15 +571,18 @@ BOOL__ CBufferSimple::initialize( UINT__ num_elem, UINT__ width )
 // name: cleanup()
 // desc: cleanup
 //-----------------------------------------------------------------------------
-void CBufferSimple::cleanup()
+void CBufferMulti::cleanup()
 {
     if( !m_data )
         return;
 
     free( m_data );
+    CK_SAFE_DELETE_ARRAY( m_seq );
 
     m_data = NULL;
-    m_data_width = m_read_offset = m_write_offset = m_max_elem = 0;
+    m_data_width = m_mask = 0;
+    m_write_offset.store( 0 );
+    m_read_offset = 0;
 }
 
 
@@ -458,34 +590,42 @@ void CBufferSimple::cleanup()
 
 //-----------------------------------------------------------------------------
 // name: put()
-// desc: put
+// desc: put (any thread); returns number put, fewer if full
 //-----------------------------------------------------------------------------
-void CBufferSimple::put( void * data, UINT__ num_elem )
+UINT__ CBufferMulti::put( void * data, UINT__ num_elem )
 {
-    UINT__ i, j;
+    UINT__ i;
     BYTE__ * d = (BYTE__ *)data;
 
-#ifndef __DISABLE_THREADS__
-    m_mutex.acquire();
-#endif
-
-    // copy
     for( i = 0; i < num_elem; i++ )
     {
-        for( j = 0; j < m_data_width; j++ )
+        UINT__ pos = m_write_offset.load( std::memory_order_relaxed );
+        UINT__ slot = 0;
+
+        // claim a position
+        for( ;; )
         {
-            m_data[m_write_offset*m_data_width+j] = d[i*m_data_width+j];
+            slot = pos & m_mask;
+            SINT__ diff = (SINT__)m_seq[slot].load( std::memory_order_acquire ) - (SINT__)pos;
+            // free for this position; try to take it
+            if( diff == 0 )
+            {
+                if( m_write_offset.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+                    break;
+            }
+            // still filled from the last time around: full
+            else if( diff < 0 )
+                return i;
+            // another writer took it; try again
+            else pos = m_write_offset.load( std::memory_order_relaxed );
         }
 
-        // move the write
-        // Aug 2014 - spencer
-        // change to fully "atomic" increment+wrap
-        m_write_offset = (m_write_offset + 1) % m_max_elem;
+        // fill it, and publish
+        memcpy( m_data + slot * m_data_width, d + i * m_data_width, m_data_width );
+        m_seq[slot].store( pos + 1, std::memory_order_release );
     }
 
-#ifndef __DISABLE_THREADS__
-    m_mutex.release();
-#endif
+    return i;
 }
 
 
@@ -493,48 +633,27 @@ void CBufferSimple::put( void * data, UINT__ num_elem )
 
 //-----------------------------------------------------------------------------
 // name: get()
-// desc: get
+// desc: get (reader only); returns number got
 //-----------------------------------------------------------------------------
-UINT__ CBufferSimple::get( void * data, UINT__ num_elem )
+UINT__ CBufferMulti::get( void * data, UINT__ num_elem )
 {
-    UINT__ i, j;
+    UINT__ i;
     BYTE__ * d = (BYTE__ *)data;
 
-    // read catch up with write
-    if( m_read_offset == m_write_offset )
-        return 0;
-
-#ifndef __DISABLE_THREADS__
-    m_mutex.acquire();
-#endif
-
-    // copy
     for( i = 0; i < num_elem; i++ )
     {
-        for( j = 0; j < m_data_width; j++ )
-        {
-            d[i*m_data_width+j] = m_data[m_read_offset*m_data_width+j];
-        }
-
-        // move read
-        // Aug 2014 - spencer
-        // change to fully "atomic" increment+wrap
-        m_read_offset = (m_read_offset + 1) % m_max_elem;
-
-        // catch up
-        if( m_read_offset == m_write_offset )
-        {
-            i++;
+        UINT__ slot = m_read_offset & m_mask;
+        // not filled (yet)
+        if( m_seq[slot].load( std::memory_order_acquire ) != m_read_offset + 1 )
             break;
-        }
-    }
 
-#ifndef __DISABLE_THREADS__
-    m_mutex.release();
-#endif
+        memcpy( d + i * m_data_width, m_data + slot * m_data_width, m_data_width );
+        // free for the next time around
+        m_seq[slot].store( m_read_offset + m_mask + 1, std::memory_order_release );
+        m_read_offset++;
+    }
 
-    // return number of elems
-    return 1; // shouldn't it return i?
+    return i;
 }
 
 
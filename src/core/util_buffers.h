@@ -43,6 +43,7 @@
 #include <vector>
 #include <queue>
 #include <iostream>
+#include <atomic>
 
 #define DWORD__                t_CKUINT
 #define SINT__                 t_CKINT
@@ -59,9 +60,19 @@
 class CBufferSimple;
 
 
+// cache line size, for keeping counters written by different threads apart
+#define CK_CACHE_LINE_SIZE     64
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: class CBufferAdvance
-// desc: circular buffer
+// desc: circular buffer - one writer, any number of readers (each joins
+//       to get its own read position); readers must all be on one thread
+//       (e.g., the VM's), and may fall behind: a reader lapped by the writer
+//       skips ahead, losing the oldest elements
+//       1.5.1.7: wait-free; was locked on every put() and get()
 //-----------------------------------------------------------------------------
 class CBufferAdvance
 {
@@ -83,27 +94,39 @@ public:
 protected:
     BYTE__ * m_data;
     UINT__   m_data_width;
-    //UINT__   m_read_offset;
+    UINT__   m_max_elem;
 
-    // this holds the offset allocated by join(), paired with an optional
-    // Chuck_Event to notify when things are put in the buffer
+    // this holds the position allocated by join(), paired with an optional
+    // Chuck_Event to notify when things are put in the buffer; kept in
+    // chunks that are only ever added, so the writer can walk them while
+    // readers join and resign
     struct ReadOffset
     {
-        SINT__ read_offset;
-        Chuck_Event * event;
-        ReadOffset( SINT__ ro, Chuck_Event * e = NULL )
-        { read_offset = ro; event = e; }
+        // position (ever-increasing, like the writer's)
+        UINT__ read_offset;
+        // in use
+        BOOL__ active;
+        // event to notify; only set/cleared by readers
+        std::atomic<Chuck_Event *> event;
+    };
+    enum { READERS_PER_CHUNK = 16 };
+    struct ReaderChunk
+    {
+        ReadOffset readers[READERS_PER_CHUNK];
+        std::atomic<ReaderChunk *> next;
     };
-    std::vector<ReadOffset> m_read_offsets;
+    ReaderChunk m_readers;
+    UINT__ m_num_readers;
     std::queue<UINT__> m_free;
+    // a reader's place at the given index; NULL if none
+    ReadOffset * reader( UINT__ read_offset_index ) const;
 
-    SINT__   m_write_offset;
-    SINT__   m_max_elem;
-
-    // TODO: necessary?
-    #ifndef __DISABLE_THREADS__
-    XMutex m_mutex;
-    #endif
+    // writer's position (ever-increasing); element i is in slot i % size
+    BYTE__ m_pad0[CK_CACHE_LINE_SIZE];
+    std::atomic<UINT__> m_write_offset;
+    // whether the writer is notifying readers' events (see resign())
+    std::atomic<UINT__> m_notifying;
+    BYTE__ m_pad1[CK_CACHE_LINE_SIZE];
 
     CBufferSimple * m_event_buffer;
 };
@@ -113,7 +136,10 @@ protected:
 
 //-----------------------------------------------------------------------------
 // name: class CBufferSimple
-// desc: circular buffer - one reader one writer
+// desc: circular buffer - one reader one writer; wait-free
+//       size is rounded up to a power of two; put() drops what doesn't fit
+//       1.5.1.7: atomic positions on separate cache lines (was: a lock
+//       around every put() and get())
 //-----------------------------------------------------------------------------
 class CBufferSimple
 {
@@ -126,20 +152,70 @@ public:
     void cleanup();
 
 public:
+    // get up to num_elem; returns number of elements got (reader only)
     UINT__ get( void * data, UINT__ num_elem );
-    void put( void * data, UINT__ num_elem );
+    // put num_elem; returns number put, fewer if full (writer only)
+    UINT__ put( void * data, UINT__ num_elem );
+    // number of elements waiting
+    UINT__ size() const;
 
 protected:
     BYTE__ * m_data;
     UINT__   m_data_width;
-    UINT__   m_read_offset;
-    UINT__   m_write_offset;
-    UINT__   m_max_elem;
+    UINT__   m_mask;
+
+    // positions (ever-increasing, wrapped by m_mask); each with the side
+    // that writes it, on its own cache line, along with that side's last
+    // look at the other's position
+    BYTE__ m_pad0[CK_CACHE_LINE_SIZE];
+    std::atomic<UINT__> m_read_offset;
+    UINT__ m_write_seen;
+    BYTE__ m_pad1[CK_CACHE_LINE_SIZE];
+    std::atomic<UINT__> m_write_offset;
+    UINT__ m_read_seen;
+    BYTE__ m_pad2[CK_CACHE_LINE_SIZE];
+};
 
-#ifndef __DISABLE_THREADS__
-    // added | 1.5.1.5 (ge & andrew) twilight zone
-    XMutex m_mutex;
-#endif
+
+
+
+//-----------------------------------------------------------------------------
+// name: class CBufferMulti
+// desc: circular buffer - any number of writers, one reader; writers never
+//       block each other, and each writer's elements come out in order
+//       (bounded multi-producer queue, after D. Vyukov)
+//       size is rounded up to a power of two; put() drops what doesn't fit
+//       1.5.1.7 added
+//-----------------------------------------------------------------------------
+class CBufferMulti
+{
+public:
+    CBufferMulti();
+    ~CBufferMulti();
+
+public:
+    BOOL__ initialize( UINT__ num_elem, UINT__ width );
+    void cleanup();
+
+public:
+    // get up to num_elem; returns number of elements got (reader only)
+    UINT__ get( void * data, UINT__ num_elem );
+    // put num_elem; returns number put, fewer if full (any thread)
+    UINT__ put( void * data, UINT__ num_elem );
+
+protected:
+    BYTE__ * m_data;
+    UINT__   m_data_width;
+    UINT__   m_mask;
+    // per slot: position it's free for (== pos) or filled for (== pos+1)
+    std::atomic<UINT__> * m_seq;
+
+    // next position to fill (writers) and to take (reader)
+    BYTE__ m_pad0[CK_CACHE_LINE_SIZE];
+    std::atomic<UINT__> m_write_offset;
+    BYTE__ m_pad1[CK_CACHE_LINE_SIZE];
+    UINT__ m_read_offset;
+    BYTE__ m_pad2[CK_CACHE_LINE_SIZE];
 };
 
 
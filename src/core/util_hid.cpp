@@ -312,8 +312,9 @@ static void Hid_callback( void * target, IOReturn result,
 
 // CFRunLoop source for open/close device operations
 static CFRunLoopSourceRef hidOpSource = NULL;
-// cbuffer for open/close device operations
-static CBufferSimple * hid_operation_buffer = NULL;
+// cbuffer for open/close device operations; any VM's thread may put
+// (1.5.1.7: multi-writer)
+static CBufferMulti * hid_operation_buffer = NULL;
 // callback for open/close device operations
 static void Hid_do_operation( void * info );
 
@@ -1434,7 +1435,7 @@ void Hid_init2()
     mouse_names = new xmultimap< string, OSX_Hid_Device * >;
     keyboard_names = new xmultimap< string, OSX_Hid_Device * >;
 
-    hid_operation_buffer = new CBufferSimple;
+    hid_operation_buffer = new CBufferMulti;
     hid_operation_buffer->initialize( 20, sizeof( OSX_Hid_op ) );
 
     CFMutableDictionaryRef hidMatchDictionary = IOServiceMatching( kIOHIDDeviceKey );
@@ -4595,10 +4596,13 @@ struct WiiRemoteOp
     } op;
 
     int index;
+    // message to send (send only); carried in the op, so concurrent sends
+    // cannot be paired with each other's messages | 1.5.1.7
+    HidMsg msg;
 };
 
-static CBufferSimple * WiiRemoteOp_cbuf = NULL;
-static CBufferSimple * WiiRemoteOp_msgbuf = NULL;
+// any VM's thread may put (1.5.1.7: multi-writer)
+static CBufferMulti * WiiRemoteOp_cbuf = NULL;
 
 static void WiiRemote_cfrl_callback( void * info )
 {
@@ -4645,37 +4649,35 @@ static void WiiRemote_cfrl_callback( void * info )
                 break;
 
             case WiiRemoteOp::send:
-                if( WiiRemoteOp_msgbuf->get( &msg, 1 ) )
+                msg = wro.msg;
+                // double-check remote number for validity
+                if( wro.index < 0 || wro.index >= wiiremotes->size() ||
+                    ( *wiiremotes )[wro.index] == NULL ||
+                    !( *wiiremotes )[wro.index]->is_connected() )
                 {
-                    // double-check remote number for validity
-                    if( wro.index < 0 || wro.index >= wiiremotes->size() ||
-                        ( *wiiremotes )[wro.index] == NULL ||
-                        !( *wiiremotes )[wro.index]->is_connected() )
-                    {
-                        // report failure
-                        HidInManager::push_message( msg );
-                        break;
-                    }
+                    // report failure
+                    HidInManager::push_message( msg );
+                    break;
+                }
 
-                    switch( msg.type )
-                    {
-                        case CK_HID_LED:
-                            if( msg.eid < 0 || msg.eid >= 4 )
-                            {
-                                // report failure
-                                HidInManager::push_message( msg );
-                                break;
-                            }
+                switch( msg.type )
+                {
+                    case CK_HID_LED:
+                        if( msg.eid < 0 || msg.eid >= 4 )
+                        {
+                            // report failure
+                            HidInManager::push_message( msg );
+                            break;
+                        }
 
-                            ( *wiiremotes )[wro.index]->set_led( msg.eid, msg.idata[0] );
+                        ( *wiiremotes )[wro.index]->set_led( msg.eid, msg.idata[0] );
 
-                            break;
+                        break;
 
-                        case CK_HID_FORCE_FEEDBACK:
-                            ( *wiiremotes )[wro.index]->enable_force_feedback( msg.idata[0] );
+                    case CK_HID_FORCE_FEEDBACK:
+                        ( *wiiremotes )[wro.index]->enable_force_feedback( msg.idata[0] );
 
-                            break;
-                    }
+                        break;
                 }
 
                 break;
@@ -4705,11 +4707,8 @@ void WiiRemote_init()
     wiiremotes = new xvector< WiiRemote * >;
     wr_addresses = new map< BluetoothDeviceAddress, WiiRemote * >;
 
-    WiiRemoteOp_cbuf = new CBufferSimple;
-    WiiRemoteOp_cbuf->initialize( 20, sizeof( WiiRemoteOp ) );
-
-    WiiRemoteOp_msgbuf = new CBufferSimple;
-    WiiRemoteOp_msgbuf->initialize( 100, sizeof( HidMsg ) );
+    WiiRemoteOp_cbuf = new CBufferMulti;
+    WiiRemoteOp_cbuf->initialize( 100, sizeof( WiiRemoteOp ) );
 #endif // __CK_HID_WIIREMOTE
 }
 
@@ -4805,11 +4804,10 @@ int WiiRemote_send( int wr, const HidMsg * msg )
 
     wiiremote->unlock();
 
-    WiiRemoteOp_msgbuf->put( ( void * )msg, 1 );
-
     WiiRemoteOp wro;
     wro.op = WiiRemoteOp::send;
     wro.index = wr;
+    wro.msg = *msg;
 
     WiiRemoteOp_cbuf->put( &wro, 1 );
 
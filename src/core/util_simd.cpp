@@ -0,0 +1,308 @@
+/*----------------------------------------------------------------------------
+  ChucK Concurrent, On-the-fly Audio Programming Language
+    Compiler and Virtual Machine
+
+  Copyright (c) 2004 Ge Wang and Perry R. Cook.  All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+  U.S.A.
+-----------------------------------------------------------------------------*/
+
+
+//-----------------------------------------------------------------------------
+// file: util_simd.cpp
+// desc: bulk kernels over contiguous runs of t_CKFLOAT (double)
+//-----------------------------------------------------------------------------
+#include "util_simd.h"
+#include <math.h>
+
+// pick a 2-wide double vector unit; only what the target enables by
+// default, so no extra compiler flags are needed
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define CK_SIMD_2 1
+  typedef __m128d ck_v2;
+  #define ck_v2_load(p)     _mm_loadu_pd(p)
+  #define ck_v2_store(p,v)  _mm_storeu_pd(p,v)
+  #define ck_v2_set(x)      _mm_set1_pd(x)
+  #define ck_v2_add(a,b)    _mm_add_pd(a,b)
+  #define ck_v2_sub(a,b)    _mm_sub_pd(a,b)
+  #define ck_v2_mul(a,b)    _mm_mul_pd(a,b)
+  #define ck_v2_min(a,b)    _mm_min_pd(a,b)
+  #define ck_v2_max(a,b)    _mm_max_pd(a,b)
+  #define ck_v2_abs(a)      _mm_andnot_pd(_mm_set1_pd(-0.0),a)
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  #include <arm_neon.h>
+  #define CK_SIMD_2 1
+  typedef float64x2_t ck_v2;
+  #define ck_v2_load(p)     vld1q_f64(p)
+  #define ck_v2_store(p,v)  vst1q_f64(p,v)
+  #define ck_v2_set(x)      vdupq_n_f64(x)
+  #define ck_v2_add(a,b)    vaddq_f64(a,b)
+  #define ck_v2_sub(a,b)    vsubq_f64(a,b)
+  #define ck_v2_mul(a,b)    vmulq_f64(a,b)
+  #define ck_v2_min(a,b)    vminq_f64(a,b)
+  #define ck_v2_max(a,b)    vmaxq_f64(a,b)
+  #define ck_v2_abs(a)      vabsq_f64(a)
+#endif
+
+#ifdef CK_SIMD_2
+// sum of the two lanes
+static inline t_CKFLOAT ck_v2_hsum( ck_v2 v )
+{ t_CKFLOAT t[2]; ck_v2_store( t, v ); return t[0] + t[1]; }
+#endif
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_vec_add()
+// desc: dst[i] = a[i] + b[i]
+//-----------------------------------------------------------------------------
+void ck_vec_add( t_CKFLOAT * dst, const t_CKFLOAT * a, const t_CKFLOAT * b, t_CKUINT n )
+{
+    t_CKUINT i = 0;
+#ifdef CK_SIMD_2
+    for( ; i + 4 <= n; i += 4 )
+    {
+        ck_v2 x0 = ck_v2_add( ck_v2_load(a+i), ck_v2_load(b+i) );
+        ck_v2 x1 = ck_v2_add( ck_v2_load(a+i+2), ck_v2_load(b+i+2) );
+        ck_v2_store( dst+i, x0 ); ck_v2_store( dst+i+2, x1 );
+    }
+#endif
+    for( ; i < n; i++ ) dst[i] = a[i] + b[i];
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_vec_mul()
+// desc: dst[i] = a[i] * b[i]
+//-----------------------------------------------------------------------------
+void ck_vec_mul( t_CKFLOAT * dst, const t_CKFLOAT * a, const t_CKFLOAT * b, t_CKUINT n )
+{
+    t_CKUINT i = 0;
+#ifdef CK_SIMD_2
+    for( ; i + 4 <= n; i += 4 )
+    {
+        ck_v2 x0 = ck_v2_mul( ck_v2_load(a+i), ck_v2_load(b+i) );
+        ck_v2 x1 = ck_v2_mul( ck_v2_load(a+i+2), ck_v2_load(b+i+2) );
+        ck_v2_store( dst+i, x0 ); ck_v2_store( dst+i+2, x1 );
+    }
+#endif
+    for( ; i < n; i++ ) dst[i] = a[i] * b[i];
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_vec_scale()
+// desc: dst[i] = a[i] * s
+//-----------------------------------------------------------------------------
+void ck_vec_scale( t_CKFLOAT * dst, const t_CKFLOAT * a, t_CKFLOAT s, t_CKUINT n )
+{
+    t_CKUINT i = 0;
+#ifdef CK_SIMD_2
+    ck_v2 vs = ck_v2_set( s );
+    for( ; i + 4 <= n; i += 4 )
+    {
+        ck_v2 x0 = ck_v2_mul( ck_v2_load(a+i), vs );
+        ck_v2 x1 = ck_v2_mul( ck_v2_load(a+i+2), vs );
+        ck_v2_store( dst+i, x0 ); ck_v2_store( dst+i+2, x1 );
+    }
+#endif
+    for( ; i < n; i++ ) dst[i] = a[i] * s;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_vec_abs()
+// desc: dst[i] = |a[i]|
+//-----------------------------------------------------------------------------
+void ck_vec_abs( t_CKFLOAT * dst, const t_CKFLOAT * a, t_CKUINT n )
+{
+    t_CKUINT i = 0;
+#ifdef CK_SIMD_2
+    for( ; i + 4 <= n; i += 4 )
+    {
+        ck_v2 x0 = ck_v2_abs( ck_v2_load(a+i) );
+        ck_v2 x1 = ck_v2_abs( ck_v2_load(a+i+2) );
+        ck_v2_store( dst+i, x0 ); ck_v2_store( dst+i+2, x1 );
+    }
+#endif
+    for( ; i < n; i++ ) dst[i] = fabs( a[i] );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_vec_clamp()
+// desc: dst[i] = a[i] limited to [lo,hi]
+//-----------------------------------------------------------------------------
+void ck_vec_clamp( t_CKFLOAT * dst, const t_CKFLOAT * a, t_CKFLOAT lo, t_CKFLOAT hi, t_CKUINT n )
+{
+    t_CKUINT i = 0;
+#ifdef CK_SIMD_2
+    ck_v2 vlo = ck_v2_set( lo ), vhi = ck_v2_set( hi );
+    for( ; i + 4 <= n; i += 4 )
+    {
+        ck_v2 x0 = ck_v2_min( ck_v2_max( ck_v2_load(a+i), vlo ), vhi );
+        ck_v2 x1 = ck_v2_min( ck_v2_max( ck_v2_load(a+i+2), vlo ), vhi );
+        ck_v2_store( dst+i, x0 ); ck_v2_store( dst+i+2, x1 );
+    }
+#endif
+    for( ; i < n; i++ )
+    {
+        t_CKFLOAT x = a[i] > lo ? a[i] : lo;
+        dst[i] = x < hi ? x : hi;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_vec_interp()
+// desc: dst[i] = a[i] + (b[i]-a[i]) * t
+//-----------------------------------------------------------------------------
+void ck_vec_interp( t_CKFLOAT * dst, const t_CKFLOAT * a, const t_CKFLOAT * b, t_CKFLOAT t, t_CKUINT n )
+{
+    t_CKUINT i = 0;
+#ifdef CK_SIMD_2
+    ck_v2 vt = ck_v2_set( t );
+    for( ; i + 4 <= n; i += 4 )
+    {
+        ck_v2 a0 = ck_v2_load(a+i), a1 = ck_v2_load(a+i+2);
+        ck_v2 x0 = ck_v2_add( a0, ck_v2_mul( ck_v2_sub( ck_v2_load(b+i), a0 ), vt ) );
+        ck_v2 x1 = ck_v2_add( a1, ck_v2_mul( ck_v2_sub( ck_v2_load(b+i+2), a1 ), vt ) );
+        ck_v2_store( dst+i, x0 ); ck_v2_store( dst+i+2, x1 );
+    }
+#endif
+    for( ; i < n; i++ ) dst[i] = a[i] + (b[i] - a[i]) * t;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_vec_dot()
+// desc: sum of a[i] * b[i]; summed in lanes, so the last bits may differ
+//       from a left-to-right loop
+//-----------------------------------------------------------------------------
+t_CKFLOAT ck_vec_dot( const t_CKFLOAT * a, const t_CKFLOAT * b, t_CKUINT n )
+{
+    t_CKUINT i = 0;
+    t_CKFLOAT sum = 0;
+#ifdef CK_SIMD_2
+    ck_v2 s0 = ck_v2_set( 0 ), s1 = ck_v2_set( 0 );
+    for( ; i + 4 <= n; i += 4 )
+    {
+        s0 = ck_v2_add( s0, ck_v2_mul( ck_v2_load(a+i), ck_v2_load(b+i) ) );
+        s1 = ck_v2_add( s1, ck_v2_mul( ck_v2_load(a+i+2), ck_v2_load(b+i+2) ) );
+    }
+    sum = ck_v2_hsum( ck_v2_add( s0, s1 ) );
+#endif
+    for( ; i < n; i++ ) sum += a[i] * b[i];
+    return sum;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_vec_sum()
+// desc: sum of a[i]; summed in lanes, like ck_vec_dot()
+//-----------------------------------------------------------------------------
+t_CKFLOAT ck_vec_sum( const t_CKFLOAT * a, t_CKUINT n )
+{
+    t_CKUINT i = 0;
+    t_CKFLOAT sum = 0;
+#ifdef CK_SIMD_2
+    ck_v2 s0 = ck_v2_set( 0 ), s1 = ck_v2_set( 0 );
+    for( ; i + 4 <= n; i += 4 )
+    {
+        s0 = ck_v2_add( s0, ck_v2_load(a+i) );
+        s1 = ck_v2_add( s1, ck_v2_load(a+i+2) );
+    }
+    sum = ck_v2_hsum( ck_v2_add( s0, s1 ) );
+#endif
+    for( ; i < n; i++ ) sum += a[i];
+    return sum;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_vec_min()
+// desc: smallest a[i]; 0 if n is 0
+//-----------------------------------------------------------------------------
+t_CKFLOAT ck_vec_min( const t_CKFLOAT * a, t_CKUINT n )
+{
+    if( n == 0 ) return 0;
+    t_CKUINT i = 0;
+    t_CKFLOAT m = a[0];
+#ifdef CK_SIMD_2
+    if( n >= 4 )
+    {
+        ck_v2 m0 = ck_v2_load(a), m1 = ck_v2_load(a+2);
+        for( i = 4; i + 4 <= n; i += 4 )
+        {
+            m0 = ck_v2_min( m0, ck_v2_load(a+i) );
+            m1 = ck_v2_min( m1, ck_v2_load(a+i+2) );
+        }
+        t_CKFLOAT t[2]; ck_v2_store( t, ck_v2_min( m0, m1 ) );
+        m = t[0] < t[1] ? t[0] : t[1];
+    }
+#endif
+    for( ; i < n; i++ ) if( a[i] < m ) m = a[i];
+    return m;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_vec_max()
+// desc: largest a[i]; 0 if n is 0
+//-----------------------------------------------------------------------------
+t_CKFLOAT ck_vec_max( const t_CKFLOAT * a, t_CKUINT n )
+{
+    if( n == 0 ) return 0;
+    t_CKUINT i = 0;
+    t_CKFLOAT m = a[0];
+#ifdef CK_SIMD_2
+    if( n >= 4 )
+    {
+        ck_v2 m0 = ck_v2_load(a), m1 = ck_v2_load(a+2);
+        for( i = 4; i + 4 <= n; i += 4 )
+        {
+            m0 = ck_v2_max( m0, ck_v2_load(a+i) );
+            m1 = ck_v2_max( m1, ck_v2_load(a+i+2) );
+        }
+        t_CKFLOAT t[2]; ck_v2_store( t, ck_v2_max( m0, m1 ) );
+        m = t[0] > t[1] ? t[0] : t[1];
+    }
+#endif
+    for( ; i < n; i++ ) if( a[i] > m ) m = a[i];
+    return m;
+}
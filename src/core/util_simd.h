@@ -0,0 +1,64 @@
+/*----------------------------------------------------------------------------
+  ChucK Concurrent, On-the-fly Audio Programming Language
+    Compiler and Virtual Machine
+
+  Copyright (c) 2004 Ge Wang and Perry R. Cook.  All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+  U.S.A.
+-----------------------------------------------------------------------------*/
+
+
+//-----------------------------------------------------------------------------
+// file: util_simd.h
+// desc: bulk kernels over contiguous runs of t_CKFLOAT (double)
+//
+//       used by the bulk array operations (float[], complex[], polar[],
+//       vec2[], vec3[], vec4[]); each run is treated as a flat sequence
+//       of n floats, so multi-component elements are processed per
+//       component; SSE2 (x86-64 baseline) or NEON (aarch64) where the
+//       compiler provides them, portable loops otherwise; dst may be
+//       the same as either input, but must not partially overlap it
+//-----------------------------------------------------------------------------
+#ifndef __UTIL_SIMD_H__
+#define __UTIL_SIMD_H__
+
+#include "chuck_def.h"
+
+
+// dst[i] = a[i] + b[i]
+void ck_vec_add( t_CKFLOAT * dst, const t_CKFLOAT * a, const t_CKFLOAT * b, t_CKUINT n );
+// dst[i] = a[i] * b[i]
+void ck_vec_mul( t_CKFLOAT * dst, const t_CKFLOAT * a, const t_CKFLOAT * b, t_CKUINT n );
+// dst[i] = a[i] * s
+void ck_vec_scale( t_CKFLOAT * dst, const t_CKFLOAT * a, t_CKFLOAT s, t_CKUINT n );
+// dst[i] = |a[i]|
+void ck_vec_abs( t_CKFLOAT * dst, const t_CKFLOAT * a, t_CKUINT n );
+// dst[i] = a[i] limited to [lo,hi]
+void ck_vec_clamp( t_CKFLOAT * dst, const t_CKFLOAT * a, t_CKFLOAT lo, t_CKFLOAT hi, t_CKUINT n );
+// dst[i] = a[i] + (b[i]-a[i]) * t
+void ck_vec_interp( t_CKFLOAT * dst, const t_CKFLOAT * a, const t_CKFLOAT * b, t_CKFLOAT t, t_CKUINT n );
+// sum of a[i] * b[i]
+t_CKFLOAT ck_vec_dot( const t_CKFLOAT * a, const t_CKFLOAT * b, t_CKUINT n );
+// sum of a[i]
+t_CKFLOAT ck_vec_sum( const t_CKFLOAT * a, t_CKUINT n );
+// smallest / largest a[i]; 0 if n is 0
+t_CKFLOAT ck_vec_min( const t_CKFLOAT * a, t_CKUINT n );
+t_CKFLOAT ck_vec_max( const t_CKFLOAT * a, t_CKUINT n );
+
+
+#endif
@@ -60,11 +60,7 @@ using namespace std;
 string ck_itoa( t_CKINT val )
 {
     char buffer[128];
-#ifdef _WIN64
-    snprintf( buffer, 128, "%lld", val );
-#else
-    snprintf( buffer, 128, "%ld", val );
-#endif
+    ck_itoa( val, buffer, 128 );
     return string(buffer);
 }
 
@@ -77,17 +73,47 @@ string ck_itoa( t_CKINT val )
 //-----------------------------------------------------------------------------
 string ck_ftoa( t_CKFLOAT val, t_CKUINT precision )
 {
-    char str[32];
     char buffer[128];
-    if( precision > 32 ) precision = 32;
-    snprintf( str, 32, "%%.%lif", (long)precision );
-    snprintf( buffer, 128, str, val );
+    ck_ftoa( val, precision, buffer, 128 );
     return string(buffer);
 }
 
 
 
 
+//-----------------------------------------------------------------------------
+// name: ck_itoa()
+// desc: int to ascii, into a caller buffer, without allocating; returns
+//       the length (truncated to fit) | 1.5.1.7
+//-----------------------------------------------------------------------------
+t_CKUINT ck_itoa( t_CKINT val, char * buffer, t_CKUINT size )
+{
+#ifdef _WIN64
+    int n = snprintf( buffer, size, "%lld", val );
+#else
+    int n = snprintf( buffer, size, "%ld", val );
+#endif
+    return n < 0 ? 0 : ( (t_CKUINT)n < size ? n : size-1 );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_ftoa()
+// desc: float to ascii, into a caller buffer, without allocating; returns
+//       the length (truncated to fit) | 1.5.1.7
+//-----------------------------------------------------------------------------
+t_CKUINT ck_ftoa( t_CKFLOAT val, t_CKUINT precision, char * buffer, t_CKUINT size )
+{
+    if( precision > 32 ) precision = 32;
+    int n = snprintf( buffer, size, "%.*f", (int)precision, val );
+    return n < 0 ? 0 : ( (t_CKUINT)n < size ? n : size-1 );
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: ck_atoul()
 // desc: ascii to unsigned long
@@ -43,6 +43,10 @@
 std::string ck_itoa( t_CKINT val );
 // float to ascii
 std::string ck_ftoa( t_CKFLOAT val, t_CKUINT precision );
+// int to ascii, into a caller buffer; returns the length | 1.5.1.7
+t_CKUINT ck_itoa( t_CKINT val, char * buffer, t_CKUINT size );
+// float to ascii, into a caller buffer; returns the length | 1.5.1.7
+t_CKUINT ck_ftoa( t_CKFLOAT val, t_CKUINT precision, char * buffer, t_CKUINT size );
 // ascii to unsigned long
 unsigned long ck_atoul( const std::string & s, int base = 10 );
 // ascii to signed long
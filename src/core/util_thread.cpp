@@ -35,6 +35,8 @@
 #include "util_buffers.h"
 #include "util_platforms.h"
 #include "chuck_errmsg.h"
+#include <errno.h>
+#include <limits.h>
 
 
 
@@ -251,6 +253,80 @@ void XMutex::release( )
 
 
 
+//-----------------------------------------------------------------------------
+// name: XSemaphore()
+// desc: constructor, with an initial count | 1.5.1.7
+//-----------------------------------------------------------------------------
+XSemaphore::XSemaphore( t_CKUINT count )
+{
+#if defined(__PLATFORM_APPLE__)
+    sem = dispatch_semaphore_create( (long)count );
+#elif ( defined(__PLATFORM_LINUX__) || defined(__WINDOWS_PTHREAD__) )
+    sem_init( &sem, 0, (unsigned int)count );
+#elif defined(__PLATFORM_WINDOWS__)
+    sem = CreateSemaphore( NULL, (LONG)count, LONG_MAX, NULL );
+#endif
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ~XSemaphore()
+// desc: destructor (no thread may be waiting) | 1.5.1.7
+//-----------------------------------------------------------------------------
+XSemaphore::~XSemaphore( )
+{
+#if defined(__PLATFORM_APPLE__)
+    dispatch_release( sem );
+#elif ( defined(__PLATFORM_LINUX__) || defined(__WINDOWS_PTHREAD__) )
+    sem_destroy( &sem );
+#elif defined(__PLATFORM_WINDOWS__)
+    CloseHandle( sem );
+#endif
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: wait()
+// desc: block until the count is above zero, and take one | 1.5.1.7
+//-----------------------------------------------------------------------------
+void XSemaphore::wait( )
+{
+#if defined(__PLATFORM_APPLE__)
+    dispatch_semaphore_wait( sem, DISPATCH_TIME_FOREVER );
+#elif ( defined(__PLATFORM_LINUX__) || defined(__WINDOWS_PTHREAD__) )
+    // again if interrupted by a signal
+    while( sem_wait( &sem ) != 0 && errno == EINTR ) { }
+#elif defined(__PLATFORM_WINDOWS__)
+    WaitForSingleObject( sem, INFINITE );
+#endif
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: post()
+// desc: add 'count', waking up to as many waiting threads; does not block,
+//       so may be called from the audio thread | 1.5.1.7
+//-----------------------------------------------------------------------------
+void XSemaphore::post( t_CKUINT count )
+{
+#if defined(__PLATFORM_APPLE__)
+    for( t_CKUINT i = 0; i < count; i++ ) dispatch_semaphore_signal( sem );
+#elif ( defined(__PLATFORM_LINUX__) || defined(__WINDOWS_PTHREAD__) )
+    for( t_CKUINT i = 0; i < count; i++ ) sem_post( &sem );
+#elif defined(__PLATFORM_WINDOWS__)
+    if( count ) ReleaseSemaphore( sem, (LONG)count, NULL );
+#endif
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: shared()
 // desc: get XWriteThread shared instance
@@ -62,6 +62,17 @@ template<typename T> class CircularBuffer;
   #define CHUCK_THREAD HANDLE
 #endif
 
+// semaphore (unnamed sem_t is not available on apple) | 1.5.1.7
+#if defined(__PLATFORM_APPLE__)
+  #include <dispatch/dispatch.h>
+  typedef dispatch_semaphore_t SEMAPHORE;
+#elif ( defined(__PLATFORM_LINUX__) || defined(__WINDOWS_PTHREAD__) )
+  #include <semaphore.h>
+  typedef sem_t SEMAPHORE;
+#elif defined(__PLATFORM_WINDOWS__)
+  typedef HANDLE SEMAPHORE;
+#endif
+
 
 
 
@@ -151,6 +162,28 @@ protected:
 
 
 
+//-----------------------------------------------------------------------------
+// name: struct XSemaphore
+// desc: counting semaphore; wait() blocks until the count is above zero and
+//       takes one, post() adds to it, waking as many waiting | 1.5.1.7
+//-----------------------------------------------------------------------------
+struct XSemaphore
+{
+public:
+    XSemaphore( t_CKUINT count = 0 );
+    ~XSemaphore();
+
+public:
+    void wait();
+    void post( t_CKUINT count = 1 );
+
+protected:
+    SEMAPHORE sem;
+};
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: XWriteThread()
 // desc: utility class for scheduling writes to be executed on a separate
@@ -0,0 +1,291 @@
+//-----------------------------------------------------------------------------
+// file: example-5-events.cpp
+// desc: Looking to integrate ChucK as a component inside another host program?
+//       Here is an example of waking ChucK shreds from many C++ threads at
+//       once, by broadcasting a ChucK global Event -- which also measures
+//       how well this holds up under contention
+//
+//       queue_broadcast() may be called from any thread; it asks the VM to
+//       broadcast the event the next time it runs (e.g., in the next call
+//       to the_chuck->run()), without waiting on a lock; requests made on
+//       the same event before then are carried out together
+//
+//       INITIALIZATION
+//         1. #include "chuck.h"
+//         2. make a new ChucK instance, e.g., the_chuck = new ChucK();
+//         3. set parameters, initialize and start the ChucK instance
+//         4. add code with a global Event and shreds waiting on it
+//         5. run once so the globals exist, then look up the event
+//
+//       RUNTIME
+//         1. start N producer threads, each calling queue_broadcast() on
+//            the event as fast as it can, timing each call
+//         2. meanwhile, the main thread calls the_chuck->run(), and
+//            watches a global int the shreds count their wake-ups in
+//         3. report requests per second, the cost of each request, and
+//            the longest wait between a request and a wake-up
+//
+//       USAGE
+//         example-5-events [producers] [requests per producer]
+//-----------------------------------------------------------------------------
+#include "chuck.h"
+#include "chuck_globals.h" // for globals
+#include "chuck_oo.h" // for Chuck_Event
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+using namespace std;
+
+
+//-----------------------------------------------------------------------------
+// global things for this example
+//-----------------------------------------------------------------------------
+// our ChucK instance
+ChucK * the_chuck = NULL;
+// audio input buffer
+SAMPLE * g_inputBuffer = NULL;
+// audio output buffer
+SAMPLE * g_outputBuffer = NULL;
+// our audio buffer size
+t_CKINT g_bufferSize = 0;
+
+// the event to broadcast
+Chuck_Event * g_event = NULL;
+// producers still going
+std::atomic<t_CKINT> g_producing( 0 );
+// time (ns) of the earliest request not yet seen to wake anyone; 0 if none
+std::atomic<t_CKINT> g_first_pending( 0 );
+
+// per-producer results
+struct Producer_Stats
+{
+    t_CKINT requests = 0;
+    t_CKINT total_ns = 0;
+    t_CKINT max_ns = 0;
+};
+
+// the ChucK side: shreds waiting on a global event, counting wake-ups
+const char * g_code =
+    "global Event tick;\n"
+    "global int wakes;\n"
+    "fun void waiter() { while( true ) { tick => now; wakes++; } }\n"
+    "for( 0 => int i; i < 8; i++ ) spork ~ waiter();\n"
+    "while( true ) 1::second => now;\n";
+
+
+//-----------------------------------------------------------------------------
+// function prototypes
+//-----------------------------------------------------------------------------
+// current time in nanoseconds
+t_CKINT now_ns();
+// producer thread
+void producer( Producer_Stats * stats, t_CKINT count );
+// allocate global audio buffers
+void alloc_global_buffers( t_CKINT bufferSize );
+// de-allocate global audio buffers
+void cleanup_global_buffers();
+
+
+
+
+//-----------------------------------------------------------------------------
+// host program entry point
+//-----------------------------------------------------------------------------
+int main( int argc, char ** argv )
+{
+    // number of producer threads
+    t_CKINT numProducers = argc > 1 ? atoi( argv[1] ) : 4;
+    // requests per producer
+    t_CKINT numRequests = argc > 2 ? atoi( argv[2] ) : 200000;
+    if( numProducers < 1 ) numProducers = 1;
+    if( numRequests < 1 ) numRequests = 1;
+
+    //-------------------------------------------------------------------------
+    // ChucK initialization
+    //-------------------------------------------------------------------------
+    // instantiate a ChucK instance
+    the_chuck = new ChucK();
+
+    // set some parameters: sample rate
+    the_chuck->setParam( CHUCK_PARAM_SAMPLE_RATE, 44100 );
+    // number of input channels
+    the_chuck->setParam( CHUCK_PARAM_INPUT_CHANNELS, 0 );
+    // number of output channels
+    the_chuck->setParam( CHUCK_PARAM_OUTPUT_CHANNELS, 2 );
+    // we decide when to stop
+    the_chuck->setParam( CHUCK_PARAM_VM_HALT, FALSE );
+    // set hint so internally can advise things like async data writes etc.
+    the_chuck->setParam( CHUCK_PARAM_IS_REALTIME_AUDIO_HINT, FALSE );
+
+    // allocate audio buffers, also after parameters are set
+    alloc_global_buffers( 64 );
+
+    // initialize ChucK, after the parameters are set
+    the_chuck->init();
+    // start ChucK VM and synthesis engine
+    the_chuck->start();
+
+    // compile the waiting shreds
+    if( !the_chuck->compileCode( g_code, "", 1 ) )
+    {
+        // got error, baillng out...
+        exit( 1 );
+    }
+
+    // run once, so the globals are made and the shreds are waiting
+    the_chuck->run( g_inputBuffer, g_outputBuffer, g_bufferSize );
+    // the event (NOTE: lower_case version; this is the thread calling run())
+    g_event = the_chuck->globals()->get_global_event( "tick" );
+    if( !g_event )
+    {
+        cerr << "cannot find global Event 'tick'" << endl;
+        exit( 1 );
+    }
+
+    //-------------------------------------------------------------------------
+    // producers
+    //-------------------------------------------------------------------------
+    vector<Producer_Stats> stats( numProducers );
+    vector<std::thread> threads;
+    g_producing = numProducers;
+    // start time
+    t_CKINT start = now_ns();
+    for( t_CKINT i = 0; i < numProducers; i++ )
+        threads.push_back( std::thread( producer, &stats[i], numRequests ) );
+
+    //-------------------------------------------------------------------------
+    // ChucK runtime
+    //-------------------------------------------------------------------------
+    t_CKINT blocks = 0;
+    t_CKINT wakes = 0;
+    t_CKINT maxLatency = 0;
+    // until the producers are done, then once more for the last requests
+    for( t_CKBOOL last = FALSE; !last; )
+    {
+        last = (g_producing.load() == 0);
+        // run ChucK for the next `bufferSize`
+        the_chuck->run( g_inputBuffer, g_outputBuffer, g_bufferSize );
+        blocks++;
+
+        // did anyone wake?
+        t_CKINT w = the_chuck->globals()->get_global_int_value( "wakes" );
+        if( w != wakes )
+        {
+            wakes = w;
+            // the longest anyone's request went unanswered
+            t_CKINT first = g_first_pending.exchange( 0 );
+            if( first && now_ns() - first > maxLatency ) maxLatency = now_ns() - first;
+        }
+    }
+    // end time
+    t_CKINT elapsed = now_ns() - start;
+
+    // wait for producers
+    for( t_CKUINT i = 0; i < threads.size(); i++ ) threads[i].join();
+
+    //-------------------------------------------------------------------------
+    // report
+    //-------------------------------------------------------------------------
+    t_CKINT requests = 0, total = 0, maxCall = 0;
+    for( t_CKUINT i = 0; i < stats.size(); i++ )
+    {
+        requests += stats[i].requests;
+        total += stats[i].total_ns;
+        if( stats[i].max_ns > maxCall ) maxCall = stats[i].max_ns;
+    }
+
+    cerr << "producers: " << numProducers << ", requests: " << requests << endl;
+    cerr << "elapsed: " << elapsed / 1000000.0 << " ms, "
+         << "requests/sec: " << (t_CKINT)(requests / (elapsed / 1e9)) << endl;
+    cerr << "queue_broadcast(): avg " << (t_CKFLOAT)total / requests << " ns, "
+         << "max " << maxCall / 1000.0 << " us" << endl;
+    cerr << "VM blocks: " << blocks << ", wake-ups: " << wakes << ", "
+         << "max request-to-wake: " << maxLatency / 1000.0 << " us" << endl;
+
+    // deallocate
+    cleanup_global_buffers();
+
+    // clean up ChucK
+    CK_SAFE_DELETE( the_chuck );
+
+    return 0;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// current time in nanoseconds
+//-----------------------------------------------------------------------------
+t_CKINT now_ns()
+{
+    return (t_CKINT)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// producer thread: broadcast as fast as we can, timing each request
+//-----------------------------------------------------------------------------
+void producer( Producer_Stats * stats, t_CKINT count )
+{
+    for( t_CKINT i = 0; i < count; i++ )
+    {
+        t_CKINT before = now_ns();
+        // note the earliest request not yet answered
+        t_CKINT none = 0;
+        g_first_pending.compare_exchange_strong( none, before );
+        // ask the VM to broadcast (safe from any thread)
+        g_event->queue_broadcast();
+        t_CKINT took = now_ns() - before;
+
+        stats->requests++;
+        stats->total_ns += took;
+        if( took > stats->max_ns ) stats->max_ns = took;
+    }
+
+    // done
+    g_producing--;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// initialize global audio buffers
+//-----------------------------------------------------------------------------
+void alloc_global_buffers( t_CKINT bufferSize )
+{
+    // good practice to clean, in case this function is called more than once
+    cleanup_global_buffers();
+
+    // allocate audio buffers as expected by ChucK's run() function below
+    g_inputBuffer = new SAMPLE[bufferSize * the_chuck->getParamInt(CHUCK_PARAM_INPUT_CHANNELS)];
+    g_outputBuffer = new SAMPLE[bufferSize * the_chuck->getParamInt(CHUCK_PARAM_OUTPUT_CHANNELS)];
+    // zero out
+    memset( g_inputBuffer, 0, bufferSize * the_chuck->getParamInt(CHUCK_PARAM_INPUT_CHANNELS) );
+    memset( g_outputBuffer, 0, bufferSize * the_chuck->getParamInt(CHUCK_PARAM_OUTPUT_CHANNELS) );
+    // set the buffer size
+    g_bufferSize = bufferSize;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// cleanup global audio buffers
+//-----------------------------------------------------------------------------
+void cleanup_global_buffers()
+{
+    // reclaim memory
+    CK_SAFE_DELETE_ARRAY( g_inputBuffer );
+    CK_SAFE_DELETE_ARRAY( g_outputBuffer );
+    // reset
+    g_bufferSize = 0;
+}
@@ -0,0 +1,357 @@
+//-----------------------------------------------------------------------------
+// file: example-6-buffers.cpp
+// desc: Looking to integrate ChucK as a component inside another host program?
+//       Hosts and device threads (MIDI, HID, ...) hand data to the ChucK VM
+//       through the circular buffers in util_buffers.h; this example puts
+//       those buffers under stress from several threads, checks that
+//       nothing is lost, reordered, or torn, and times them against a
+//       buffer with a lock around every put() and get()
+//
+//       CBufferSimple  -- one writer, one reader; wait-free
+//       CBufferMulti   -- any number of writers, one reader
+//       CBufferAdvance -- one writer, many readers (each joins for its
+//                         own read position); wait-free
+//
+//       USAGE
+//         example-6-buffers [elements per writer]
+//-----------------------------------------------------------------------------
+#include "chuck_def.h"
+#include "util_buffers.h"
+#include "util_thread.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+using namespace std;
+
+
+//-----------------------------------------------------------------------------
+// global things for this example
+//-----------------------------------------------------------------------------
+// elements each writer puts
+t_CKUINT g_count = 1000000;
+// failures seen
+t_CKUINT g_failures = 0;
+
+// an element several words wide, to catch torn reads
+struct Wide
+{
+    t_CKUINT seq;
+    t_CKUINT copy[3];
+};
+
+// a circular buffer with a lock around every put() and get(), as
+// CBufferSimple was before it was made wait-free; for comparison
+class Locked_Buffer
+{
+public:
+    Locked_Buffer( t_CKUINT num_elem ) : m_data( num_elem ), m_read( 0 ), m_write( 0 ) { }
+    t_CKUINT put( t_CKUINT * data, t_CKUINT num_elem )
+    {
+        m_mutex.acquire();
+        for( t_CKUINT i = 0; i < num_elem; i++ )
+        {
+            m_data[m_write] = data[i];
+            m_write = (m_write + 1) % m_data.size();
+        }
+        m_mutex.release();
+        return num_elem;
+    }
+    t_CKUINT get( t_CKUINT * data, t_CKUINT num_elem )
+    {
+        t_CKUINT i = 0;
+        m_mutex.acquire();
+        for( ; i < num_elem && m_read != m_write; i++ )
+        {
+            data[i] = m_data[m_read];
+            m_read = (m_read + 1) % m_data.size();
+        }
+        m_mutex.release();
+        return i;
+    }
+protected:
+    vector<t_CKUINT> m_data;
+    t_CKUINT m_read, m_write;
+    XMutex m_mutex;
+};
+
+
+//-----------------------------------------------------------------------------
+// function prototypes
+//-----------------------------------------------------------------------------
+// current time in nanoseconds
+t_CKUINT now_ns();
+// report a failure
+void fail( const char * what, t_CKUINT expected, t_CKUINT got );
+// the stress tests
+void stress_simple();
+void stress_multi( t_CKUINT writers );
+void stress_advance( t_CKUINT readers );
+// time a buffer: put-to-get latency from another thread, and uncontended cost
+template <typename BUFFER> void time_buffer( const char * name, BUFFER & buffer );
+
+
+
+
+//-----------------------------------------------------------------------------
+// host program entry point
+//-----------------------------------------------------------------------------
+int main( int argc, char ** argv )
+{
+    // elements per writer
+    if( argc > 1 ) g_count = strtoul( argv[1], NULL, 10 );
+    if( g_count < 1 ) g_count = 1;
+
+    //-------------------------------------------------------------------------
+    // stress: every element arrives, in order, and whole
+    //-------------------------------------------------------------------------
+    stress_simple();
+    stress_multi( 4 );
+    stress_advance( 4 );
+
+    //-------------------------------------------------------------------------
+    // timing: wait-free vs. locked
+    //-------------------------------------------------------------------------
+    CBufferSimple simple; simple.initialize( 1024, sizeof(t_CKUINT) );
+    CBufferMulti multi; multi.initialize( 1024, sizeof(t_CKUINT) );
+    Locked_Buffer locked( 1024 );
+    time_buffer( "CBufferSimple", simple );
+    time_buffer( "CBufferMulti", multi );
+    time_buffer( "locked", locked );
+
+    cerr << (g_failures ? "FAILED" : "all good") << endl;
+    return g_failures ? 1 : 0;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// one writer, one reader; the writer retries when full
+//-----------------------------------------------------------------------------
+void stress_simple()
+{
+    CBufferSimple buffer;
+    buffer.initialize( 256, sizeof(Wide) );
+
+    std::thread writer( [&buffer]()
+    {
+        for( t_CKUINT i = 0; i < g_count; )
+        {
+            Wide w = { i, { i, i, i } };
+            if( buffer.put( &w, 1 ) ) i++;
+            else std::this_thread::yield();
+        }
+    } );
+
+    // read them all back, in order
+    Wide w;
+    for( t_CKUINT next = 0; next < g_count; )
+    {
+        if( !buffer.get( &w, 1 ) ) { std::this_thread::yield(); continue; }
+        if( w.seq != next ) fail( "CBufferSimple: order", next, w.seq );
+        if( w.copy[0] != w.seq || w.copy[2] != w.seq ) fail( "CBufferSimple: torn", w.seq, w.copy[2] );
+        next = w.seq + 1;
+    }
+    writer.join();
+
+    cerr << "CBufferSimple: " << g_count << " elements checked" << endl;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// many writers, one reader; each writer's elements arrive in order
+//-----------------------------------------------------------------------------
+void stress_multi( t_CKUINT writers )
+{
+    CBufferMulti buffer;
+    buffer.initialize( 256, sizeof(Wide) );
+
+    vector<std::thread> threads;
+    for( t_CKUINT t = 0; t < writers; t++ )
+    {
+        threads.push_back( std::thread( [&buffer, t]()
+        {
+            for( t_CKUINT i = 0; i < g_count; )
+            {
+                // writer in the top bits
+                t_CKUINT v = (t << 48) | i;
+                Wide w = { v, { v, v, v } };
+                if( buffer.put( &w, 1 ) ) i++;
+                else std::this_thread::yield();
+            }
+        } ) );
+    }
+
+    // next expected from each writer
+    vector<t_CKUINT> next( writers, 0 );
+    Wide w;
+    for( t_CKUINT got = 0; got < writers * g_count; )
+    {
+        if( !buffer.get( &w, 1 ) ) { std::this_thread::yield(); continue; }
+        t_CKUINT t = w.seq >> 48, i = w.seq & 0xffffffffffffULL;
+        if( t >= writers ) { fail( "CBufferMulti: writer", writers, t ); continue; }
+        if( i != next[t] ) fail( "CBufferMulti: order", next[t], i );
+        if( w.copy[0] != w.seq || w.copy[2] != w.seq ) fail( "CBufferMulti: torn", w.seq, w.copy[2] );
+        next[t] = i + 1;
+        got++;
+    }
+    for( t_CKUINT t = 0; t < writers; t++ ) threads[t].join();
+
+    cerr << "CBufferMulti: " << writers << " writers, "
+         << writers * g_count << " elements checked" << endl;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// one writer, many readers on one thread; readers may be lapped (and skip
+// ahead), but never see an element twice, out of order, or torn
+//-----------------------------------------------------------------------------
+void stress_advance( t_CKUINT readers )
+{
+    CBufferAdvance buffer;
+    buffer.initialize( 256, sizeof(Wide) );
+
+    // join, and remember where each is
+    vector<t_CKUINT> index, last, seen;
+    for( t_CKUINT r = 0; r < readers; r++ )
+    {
+        index.push_back( buffer.join() );
+        last.push_back( 0 );
+        seen.push_back( 0 );
+    }
+
+    std::atomic<t_CKUINT> done( 0 );
+    std::thread writer( [&buffer, &done]()
+    {
+        // start at 1, so 0 means nothing seen
+        for( t_CKUINT i = 1; i <= g_count; i++ )
+        {
+            Wide w = { i, { i, i, i } };
+            buffer.put( &w, 1 );
+            // for the first half, let readers catch up now and then;
+            // after that, lap them
+            if( i < g_count / 2 && i % 128 == 0 ) std::this_thread::yield();
+        }
+        done = 1;
+    } );
+
+    // read round-robin; resign and rejoin one reader along the way
+    Wide w;
+    for( t_CKUINT n = 0; ; n++ )
+    {
+        t_CKBOOL writing = !done.load();
+        t_CKBOOL any = FALSE;
+        for( t_CKUINT r = 0; r < readers; r++ )
+        {
+            while( buffer.get( &w, 1, index[r] ) )
+            {
+                if( w.seq <= last[r] ) fail( "CBufferAdvance: order", last[r] + 1, w.seq );
+                if( w.copy[0] != w.seq || w.copy[2] != w.seq ) fail( "CBufferAdvance: torn", w.seq, w.copy[2] );
+                last[r] = w.seq;
+                seen[r]++;
+                any = TRUE;
+            }
+        }
+        if( n == 1000 )
+        {
+            buffer.resign( index[0] );
+            index[0] = buffer.join();
+        }
+        if( !writing && !any ) break;
+        if( !any ) std::this_thread::yield();
+    }
+    writer.join();
+
+    // everyone got the last one
+    for( t_CKUINT r = 0; r < readers; r++ )
+        if( last[r] != g_count ) fail( "CBufferAdvance: last", g_count, last[r] );
+
+    cerr << "CBufferAdvance: " << readers << " readers, elements seen:";
+    for( t_CKUINT r = 0; r < readers; r++ ) cerr << " " << seen[r];
+    cerr << " (of " << g_count << ")" << endl;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// time a buffer: put-to-get latency from another thread, and uncontended
+// cost of a put() and get()
+//-----------------------------------------------------------------------------
+template <typename BUFFER>
+void time_buffer( const char * name, BUFFER & buffer )
+{
+    // uncontended: put and get on this thread
+    t_CKUINT v = 0, start = now_ns();
+    for( t_CKUINT i = 0; i < g_count; i++ )
+    {
+        buffer.put( &i, 1 );
+        buffer.get( &v, 1 );
+    }
+    t_CKUINT uncontended = now_ns() - start;
+
+    // latency: a writer sends its time; we note when it arrives
+    t_CKUINT samples = std::min( g_count, (t_CKUINT)100000 );
+    std::atomic<t_CKUINT> received( 0 );
+    std::thread writer( [&buffer, &received, samples]()
+    {
+        for( t_CKUINT i = 0; i < samples; i++ )
+        {
+            t_CKUINT sent = now_ns();
+            buffer.put( &sent, 1 );
+            // one in flight at a time
+            while( received.load() <= i ) std::this_thread::yield();
+        }
+    } );
+    vector<t_CKUINT> latency;
+    latency.reserve( samples );
+    while( latency.size() < samples )
+    {
+        if( buffer.get( &v, 1 ) )
+        {
+            latency.push_back( now_ns() - v );
+            received++;
+        }
+        else std::this_thread::yield();
+    }
+    writer.join();
+
+    std::sort( latency.begin(), latency.end() );
+    cerr << name << ": put+get " << (t_CKFLOAT)uncontended / g_count << " ns; "
+         << "latency median " << latency[samples / 2] << " ns, "
+         << "99% " << latency[samples * 99 / 100] << " ns, "
+         << "max " << latency[samples - 1] / 1000 << " us" << endl;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// current time in nanoseconds
+//-----------------------------------------------------------------------------
+t_CKUINT now_ns()
+{
+    return (t_CKUINT)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// report a failure (first few only)
+//-----------------------------------------------------------------------------
+void fail( const char * what, t_CKUINT expected, t_CKUINT got )
+{
+    if( g_failures++ < 10 )
+        cerr << "[" << what << "]: expected " << expected << ", got " << got << endl;
+}
@@ -0,0 +1,226 @@
+//-----------------------------------------------------------------------------
+// file: example-7-poll.cpp
+// desc: Looking to integrate ChucK as a component inside another host program?
+//       By default, the ChucK VM checks for messages, global requests, and
+//       event broadcasts from other threads at every sample; at high sample
+//       rates, most of those checks find nothing. This example has the VM
+//       check once per block (or every N frames) instead, and uses frame
+//       offsets to keep requests sample-accurate anyway
+//
+//       INITIALIZATION
+//         1. #include "chuck.h"
+//         2. make a new ChucK instance, e.g., the_chuck = new ChucK();
+//         3. set CHUCK_PARAM_VM_POLL: 0 checks once per block; N checks
+//            at the start of each block and every N frames after; 1 checks
+//            every frame (default)
+//         4. set other parameters, initialize and start ChucK instance
+//
+//       RUNTIME
+//         1. before each block, broadcast a global Event at a given frame
+//            offset into the block, e.g.,
+//            the_chuck->globals()->broadcastGlobalEvent( "hit", offset );
+//         2. call the_chuck->run(); a shred waiting on the event notes the
+//            sample it woke up on, which should be exactly that offset
+//         3. then time blocks with each poll setting
+//
+//       USAGE
+//         example-7-poll [blocks]
+//-----------------------------------------------------------------------------
+#include "chuck.h"
+#include "chuck_globals.h" // for globals
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+using namespace std;
+
+
+//-----------------------------------------------------------------------------
+// global things for this example
+//-----------------------------------------------------------------------------
+// audio input buffer
+SAMPLE * g_inputBuffer = NULL;
+// audio output buffer
+SAMPLE * g_outputBuffer = NULL;
+// our audio buffer size
+const t_CKINT g_bufferSize = 256;
+// number of output channels
+const t_CKINT g_outChannels = 2;
+
+// the ChucK side: note the sample each broadcast wakes us on
+const char * g_code =
+    "global Event hit;\n"
+    "global int wokeAt;\n"
+    "fun void listen() { while( true ) { hit => now; (now/samp) $ int => wokeAt; } }\n"
+    "spork ~ listen();\n"
+    "SinOsc s => dac;\n"
+    "while( true ) 1::second => now;\n";
+
+
+//-----------------------------------------------------------------------------
+// function prototypes
+//-----------------------------------------------------------------------------
+// current time in nanoseconds
+t_CKINT now_ns();
+// make and start a ChucK instance with the given poll setting
+ChucK * make_chuck( t_CKINT poll );
+// check broadcasts at frame offsets land on the frame asked for
+t_CKINT check_offsets( t_CKINT poll );
+// time `blocks` blocks with the given poll setting; ns per block
+t_CKFLOAT time_blocks( t_CKINT poll, t_CKINT blocks );
+
+
+
+
+//-----------------------------------------------------------------------------
+// host program entry point
+//-----------------------------------------------------------------------------
+int main( int argc, char ** argv )
+{
+    // number of blocks to time
+    t_CKINT blocks = argc > 1 ? atoi( argv[1] ) : 20000;
+    if( blocks < 1 ) blocks = 1;
+
+    // audio buffers (no input)
+    g_inputBuffer = new SAMPLE[g_bufferSize];
+    g_outputBuffer = new SAMPLE[g_bufferSize * g_outChannels];
+
+    //-------------------------------------------------------------------------
+    // sample-accuracy, with the VM checking every frame, every 16, and once
+    //-------------------------------------------------------------------------
+    t_CKINT failures = 0;
+    failures += check_offsets( 1 );
+    failures += check_offsets( 16 );
+    failures += check_offsets( 0 );
+
+    //-------------------------------------------------------------------------
+    // cost per block
+    //-------------------------------------------------------------------------
+    t_CKFLOAT every = time_blocks( 1, blocks );
+    t_CKFLOAT sub = time_blocks( 16, blocks );
+    t_CKFLOAT once = time_blocks( 0, blocks );
+    cerr << "per block of " << g_bufferSize << " frames: "
+         << "every frame " << every / 1000 << " us, "
+         << "every 16 " << sub / 1000 << " us, "
+         << "once " << once / 1000 << " us" << endl;
+
+    // deallocate
+    CK_SAFE_DELETE_ARRAY( g_inputBuffer );
+    CK_SAFE_DELETE_ARRAY( g_outputBuffer );
+
+    cerr << (failures ? "FAILED" : "all good") << endl;
+    return failures ? 1 : 0;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// make and start a ChucK instance with the given poll setting
+//-----------------------------------------------------------------------------
+ChucK * make_chuck( t_CKINT poll )
+{
+    // instantiate a ChucK instance
+    ChucK * the_chuck = new ChucK();
+
+    // set some parameters: sample rate
+    the_chuck->setParam( CHUCK_PARAM_SAMPLE_RATE, 96000 );
+    // number of input channels
+    the_chuck->setParam( CHUCK_PARAM_INPUT_CHANNELS, 0 );
+    // number of output channels
+    the_chuck->setParam( CHUCK_PARAM_OUTPUT_CHANNELS, g_outChannels );
+    // we decide when to stop
+    the_chuck->setParam( CHUCK_PARAM_VM_HALT, FALSE );
+    // how often to check for requests from other threads
+    the_chuck->setParam( CHUCK_PARAM_VM_POLL, poll );
+
+    // initialize ChucK, after the parameters are set
+    the_chuck->init();
+    // start ChucK VM and synthesis engine
+    the_chuck->start();
+
+    // compile the listening shred
+    if( !the_chuck->compileCode( g_code, "", 1 ) )
+    {
+        // got error, baillng out...
+        exit( 1 );
+    }
+
+    // run once, so the globals are made and the shred is waiting
+    the_chuck->run( g_inputBuffer, g_outputBuffer, g_bufferSize );
+
+    return the_chuck;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// broadcast at various frame offsets; each must wake the shred on exactly
+// that frame of the block; returns number of failures
+//-----------------------------------------------------------------------------
+t_CKINT check_offsets( t_CKINT poll )
+{
+    ChucK * the_chuck = make_chuck( poll );
+    t_CKINT failures = 0;
+
+    // including past the end of the block, which lands in the next one
+    t_CKINT offsets[] = { 0, 1, 7, 100, 255, 300 };
+    for( t_CKUINT i = 0; i < sizeof(offsets)/sizeof(offsets[0]); i++ )
+    {
+        // where this block starts
+        t_CKINT start = (t_CKINT)the_chuck->now();
+        // ask for a broadcast at this offset into the block
+        the_chuck->globals()->broadcastGlobalEvent( "hit", offsets[i] );
+        // run two blocks, in case it is due in the next one
+        the_chuck->run( g_inputBuffer, g_outputBuffer, g_bufferSize );
+        the_chuck->run( g_inputBuffer, g_outputBuffer, g_bufferSize );
+
+        // when did it land?
+        t_CKINT woke = the_chuck->globals()->get_global_int_value( "wokeAt" );
+        if( woke != start + offsets[i] )
+        {
+            cerr << "[poll " << poll << "]: offset " << offsets[i] << " landed at "
+                 << woke - start << endl;
+            failures++;
+        }
+    }
+
+    cerr << "poll " << poll << ": " << (failures ? "offsets missed" : "offsets on time") << endl;
+
+    // clean up ChucK
+    CK_SAFE_DELETE( the_chuck );
+    return failures;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// time `blocks` blocks with the given poll setting; ns per block
+//-----------------------------------------------------------------------------
+t_CKFLOAT time_blocks( t_CKINT poll, t_CKINT blocks )
+{
+    ChucK * the_chuck = make_chuck( poll );
+
+    t_CKINT start = now_ns();
+    for( t_CKINT i = 0; i < blocks; i++ )
+        the_chuck->run( g_inputBuffer, g_outputBuffer, g_bufferSize );
+    t_CKINT elapsed = now_ns() - start;
+
+    // clean up ChucK
+    CK_SAFE_DELETE( the_chuck );
+    return (t_CKFLOAT)elapsed / blocks;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// current time in nanoseconds
+//-----------------------------------------------------------------------------
+t_CKINT now_ns()
+{
+    return (t_CKINT)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
@@ -0,0 +1,234 @@
+//-----------------------------------------------------------------------------
+// file: example-8-threads.cpp
+// desc: Looking to integrate ChucK as a component inside another host program?
+//       By default, the ChucK VM ticks every unit generator on the thread
+//       that calls run(); a large patch (hundreds of voices feeding a
+//       reverb) can keep one core busy while the rest sit idle. When
+//       computing in blocks (adaptive), the VM can instead tick voices that
+//       feed the same mixing point alongside each other, on as many threads
+//       as it is given; the output is the same, bit for bit. This example
+//       times one block on 1 to N threads, and checks the output against
+//       that of 1 thread
+//
+//       INITIALIZATION
+//         1. #include "chuck.h"
+//         2. make a new ChucK instance, e.g., the_chuck = new ChucK();
+//         3. set CHUCK_PARAM_VM_ADAPTIVE to compute in blocks, e.g., the
+//            size of the buffers passed to run()
+//         4. set CHUCK_PARAM_VM_THREADS: how many threads to tick the ugen
+//            graph with, counting the one calling run(); 1 (default)
+//         5. set other parameters, initialize and start ChucK instance
+//
+//       RUNTIME
+//         1. call the_chuck->run() as usual; CHUCK_PARAM_VM_THREADS may also
+//            be changed between calls, taking effect from the next block
+//
+//       USAGE
+//         example-8-threads [voices] [blocks] [max threads]
+//-----------------------------------------------------------------------------
+#include "chuck.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+using namespace std;
+
+
+//-----------------------------------------------------------------------------
+// global things for this example
+//-----------------------------------------------------------------------------
+// audio input buffer
+SAMPLE * g_inputBuffer = NULL;
+// our audio buffer size
+const t_CKINT g_bufferSize = 256;
+// number of output channels
+const t_CKINT g_outChannels = 2;
+// number of voices
+t_CKINT g_voices = 256;
+
+// the ChucK side: voices into a mix, a reverb, and the dac; notes on and
+// off every so often (%d: number of voices)
+const char * g_code =
+    "Math.srandom( 1 );\n"
+    "Gain mix => NRev rev => dac; .05 => rev.mix; 4.0 / %d => mix.gain;\n"
+    "StkInstrument voices[0];\n"
+    "for( 0 => int i; i < %d; i++ )\n"
+    "{\n"
+    "    StkInstrument @ v;\n"
+    "    if( i %% 5 == 0 ) new Rhodey @=> v;\n"
+    "    else if( i %% 5 == 1 ) new Wurley @=> v;\n"
+    "    else if( i %% 5 == 2 ) new TubeBell @=> v;\n"
+    "    else if( i %% 5 == 3 ) new BeeThree @=> v;\n"
+    "    else new Mandolin @=> v;\n"
+    "    v => mix; 110 + i * 3 => v.freq;\n"
+    "    voices << v;\n"
+    "}\n"
+    "for( 0 => int n; true; n++ )\n"
+    "{\n"
+    "    for( 0 => int i; i < voices.size(); i++ )\n"
+    "    {\n"
+    "        if( (i + n) %% 4 == 0 ) .8 => voices[i].noteOn;\n"
+    "        else if( (i + n) %% 4 == 2 ) .5 => voices[i].noteOff;\n"
+    "    }\n"
+    "    50::ms => now;\n"
+    "}\n";
+
+
+//-----------------------------------------------------------------------------
+// function prototypes
+//-----------------------------------------------------------------------------
+// current time in nanoseconds
+t_CKINT now_ns();
+// make and start a ChucK instance, computing in blocks on `threads` threads
+ChucK * make_chuck( t_CKINT threads );
+// run `blocks` blocks, keeping the output; `threads` (if not NULL) for each
+// block in turn; returns ns per block
+t_CKFLOAT run_blocks( ChucK * the_chuck, t_CKINT blocks, vector<SAMPLE> & output,
+                      const vector<t_CKINT> * threads = NULL );
+
+
+
+
+//-----------------------------------------------------------------------------
+// host program entry point
+//-----------------------------------------------------------------------------
+int main( int argc, char ** argv )
+{
+    // number of voices
+    if( argc > 1 ) g_voices = atoi( argv[1] );
+    if( g_voices < 1 ) g_voices = 1;
+    // number of blocks to time
+    t_CKINT blocks = argc > 2 ? atoi( argv[2] ) : 1000;
+    if( blocks < 1 ) blocks = 1;
+    // up to how many threads
+    t_CKINT maxThreads = argc > 3 ? atoi( argv[3] ) : (t_CKINT)std::thread::hardware_concurrency();
+    if( maxThreads < 1 ) maxThreads = 4;
+
+    // audio input buffer (no input)
+    g_inputBuffer = new SAMPLE[g_bufferSize];
+    memset( g_inputBuffer, 0, g_bufferSize * sizeof(SAMPLE) );
+
+    cerr << g_voices << " voices, " << blocks << " blocks of " << g_bufferSize
+         << " frames, 1 to " << maxThreads << " threads ("
+         << std::thread::hardware_concurrency() << " cores)" << endl;
+
+    //-------------------------------------------------------------------------
+    // 1 to N threads: same output, and how long a block takes
+    //-------------------------------------------------------------------------
+    t_CKINT failures = 0;
+    vector<SAMPLE> serial, output;
+    t_CKFLOAT one = 0;
+    for( t_CKINT t = 1; t <= maxThreads; t++ )
+    {
+        ChucK * the_chuck = make_chuck( t );
+        t_CKFLOAT ns = run_blocks( the_chuck, blocks, t == 1 ? serial : output );
+        CK_SAFE_DELETE( the_chuck );
+
+        // same as 1 thread, bit for bit?
+        t_CKBOOL same = t == 1 || !memcmp( serial.data(), output.data(), serial.size() * sizeof(SAMPLE) );
+        if( !same ) failures++;
+        if( t == 1 ) one = ns;
+        fprintf( stderr, "threads %2ld: %9.1f us per block, speedup x%.2f%s\n",
+                 (long)t, ns / 1000, one / ns, same ? "" : " -- OUTPUT DIFFERS" );
+    }
+
+    //-------------------------------------------------------------------------
+    // changing threads while running: still the same output
+    //-------------------------------------------------------------------------
+    vector<t_CKINT> threads;
+    for( t_CKINT i = 0; i < blocks; i++ )
+        threads.push_back( 1 + (i / 10) % maxThreads );
+    ChucK * the_chuck = make_chuck( 1 );
+    run_blocks( the_chuck, blocks, output, &threads );
+    CK_SAFE_DELETE( the_chuck );
+    t_CKBOOL same = !memcmp( serial.data(), output.data(), serial.size() * sizeof(SAMPLE) );
+    if( !same ) failures++;
+    cerr << "changing threads every 10 blocks: output "
+         << (same ? "the same" : "DIFFERS") << endl;
+
+    // deallocate
+    CK_SAFE_DELETE_ARRAY( g_inputBuffer );
+
+    cerr << (failures ? "FAILED" : "all good") << endl;
+    return failures ? 1 : 0;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// make and start a ChucK instance, computing in blocks on `threads` threads
+//-----------------------------------------------------------------------------
+ChucK * make_chuck( t_CKINT threads )
+{
+    // instantiate a ChucK instance
+    ChucK * the_chuck = new ChucK();
+
+    // set some parameters: sample rate
+    the_chuck->setParam( CHUCK_PARAM_SAMPLE_RATE, 48000 );
+    // number of input channels
+    the_chuck->setParam( CHUCK_PARAM_INPUT_CHANNELS, 0 );
+    // number of output channels
+    the_chuck->setParam( CHUCK_PARAM_OUTPUT_CHANNELS, g_outChannels );
+    // we decide when to stop
+    the_chuck->setParam( CHUCK_PARAM_VM_HALT, FALSE );
+    // compute in blocks, as big as ours
+    the_chuck->setParam( CHUCK_PARAM_VM_ADAPTIVE, g_bufferSize );
+    // how many threads to tick the ugen graph with
+    the_chuck->setParam( CHUCK_PARAM_VM_THREADS, threads );
+
+    // initialize ChucK, after the parameters are set
+    the_chuck->init();
+    // start ChucK VM and synthesis engine
+    the_chuck->start();
+
+    // the patch, for this many voices
+    vector<char> code( strlen( g_code ) + 64 );
+    snprintf( code.data(), code.size(), g_code, (int)g_voices, (int)g_voices );
+    if( !the_chuck->compileCode( code.data(), "", 1 ) )
+    {
+        // got error, baillng out...
+        exit( 1 );
+    }
+
+    return the_chuck;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// run `blocks` blocks, keeping the output; `threads` (if not NULL) for each
+// block in turn; returns ns per block
+//-----------------------------------------------------------------------------
+t_CKFLOAT run_blocks( ChucK * the_chuck, t_CKINT blocks, vector<SAMPLE> & output,
+                      const vector<t_CKINT> * threads )
+{
+    output.assign( blocks * g_bufferSize * g_outChannels, 0 );
+
+    t_CKINT start = now_ns();
+    for( t_CKINT i = 0; i < blocks; i++ )
+    {
+        if( threads ) the_chuck->setParam( CHUCK_PARAM_VM_THREADS, (*threads)[i] );
+        the_chuck->run( g_inputBuffer, &output[i * g_bufferSize * g_outChannels], g_bufferSize );
+    }
+    t_CKINT elapsed = now_ns() - start;
+
+    return (t_CKFLOAT)elapsed / blocks;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// current time in nanoseconds
+//-----------------------------------------------------------------------------
+t_CKINT now_ns()
+{
+    return (t_CKINT)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
@@ -262,6 +262,9 @@ void usage()
     CK_FPRINTF_STDERR( "                callback|deprecate:{stop|warn|ignore}|chugin-probe\n" );
     CK_FPRINTF_STDERR( "                chugin-load:{on|off}|chugin-path:<path>|chugin:<name>\n" );
     CK_FPRINTF_STDERR( "                color:{on|off}|pid-file:<path>|cmd-listener:{on|off}\n" );
+    CK_FPRINTF_STDERR( "                dispatch:{classic|threaded|jit}|optimize:<N>\n" );
+    CK_FPRINTF_STDERR( "                shred-pool:<N>|reclaim:<N>|collect:<N>\n" );
+    CK_FPRINTF_STDERR( "                report-realloc:{on|off}|poll:<N>|threads:<N>\n" );
     CK_FPRINTF_STDERR( "%s", TC::set_blue().c_str() );
     CK_FPRINTF_STDERR( "   [commands] = add|replace|remove|remove.all|status|time|\n" );
     CK_FPRINTF_STDERR( "                clear.vm|reset.id|abort.shred|exit\n" );
@@ -612,6 +615,14 @@ t_CKBOOL go( int argc, const char ** argv )
     t_CKINT  adaptive_size = 0;
     t_CKINT  log_level = CK_LOG_CORE;
     t_CKINT  deprecate_level = 1; // 1 == warn
+    t_CKINT  vm_dispatch = CKVM_DISPATCH_CLASSIC; // 1.5.1.7
+    t_CKINT  optimize_level = CK_OPTIMIZE_NONE; // 1.5.1.7
+    t_CKINT  shred_pool = CKVM_SHRED_POOL_SIZE; // 1.5.1.7
+    t_CKINT  reclaim = 0; // 0 == delete right away | 1.5.1.7
+    t_CKINT  collect = 0; // 0 == no cycle collection | 1.5.1.7
+    t_CKINT  report_realloc = 0; // 1 == print array reallocations | 1.5.1.7
+    t_CKINT  vm_poll = 1; // 1 == take in queued msgs every sample, 0 == once per block | 1.5.1.7
+    t_CKINT  vm_threads = 1; // threads to tick the ugen graph with, in blocks (adaptive) | 1.5.1.7
     t_CKINT  chugin_load = 1; // 1 == auto (variable added 1.3.0.0)
     // whether to enable this VM to receive OTF commands over network
     t_CKBOOL enableOTF = TRUE;
@@ -865,6 +876,87 @@ t_CKBOOL go( int argc, const char ** argv )
                     break;
                 }
             }
+            // (added 1.5.1.7)
+            else if( !strncmp(argv[i], "--dispatch:", sizeof("--dispatch:")-1) )
+            {
+                // get the rest
+                string arg = tolower(argv[i]+sizeof("--dispatch:")-1);
+                if( arg == "classic" ) vm_dispatch = CKVM_DISPATCH_CLASSIC;
+                else if( arg == "threaded" ) vm_dispatch = CKVM_DISPATCH_THREADED;
+                else if( arg == "jit" ) vm_dispatch = CKVM_DISPATCH_JIT;
+                else
+                {
+                    // error
+                    errorMessage1 = "invalid arguments for '--dispatch:'";
+                    errorMessage2 = " |- looking for CLASSIC, THREADED, or JIT";
+                    break;
+                }
+            }
+            // (added 1.5.1.7)
+            else if( !strncmp(argv[i], "--optimize:", sizeof("--optimize:")-1) )
+            {
+                // get the rest
+                const char * arg = argv[i]+sizeof("--optimize:")-1;
+                if( arg[0] >= '0' && arg[0] <= '0'+CK_OPTIMIZE_FULL && arg[1] == '\0' )
+                    optimize_level = arg[0] - '0';
+                else
+                {
+                    // error
+                    errorMessage1 = "invalid arguments for '--optimize:'";
+                    errorMessage2 = " |- looking for 0 (off), 1 (basic), or 2 (full)";
+                    break;
+                }
+            }
+            // (added 1.5.1.7)
+            else if( !strncmp(argv[i], "--shred-pool:", sizeof("--shred-pool:")-1) )
+            {
+                // get the rest
+                shred_pool = atoi( argv[i]+sizeof("--shred-pool:")-1 );
+                if( shred_pool < 0 ) shred_pool = 0;
+            }
+            // (added 1.5.1.7)
+            else if( !strncmp(argv[i], "--reclaim:", sizeof("--reclaim:")-1) )
+            {
+                // get the rest
+                reclaim = atoi( argv[i]+sizeof("--reclaim:")-1 );
+                if( reclaim < 0 ) reclaim = 0;
+            }
+            // (added 1.5.1.7)
+            else if( !strncmp(argv[i], "--collect:", sizeof("--collect:")-1) )
+            {
+                // get the rest
+                collect = atoi( argv[i]+sizeof("--collect:")-1 );
+                if( collect < 0 ) collect = 0;
+            }
+            // (added 1.5.1.7)
+            else if( !strncmp(argv[i], "--poll:", sizeof("--poll:")-1) )
+            {
+                // get the rest
+                vm_poll = atoi( argv[i]+sizeof("--poll:")-1 );
+                if( vm_poll < 0 ) vm_poll = 0;
+            }
+            // (added 1.5.1.7)
+            else if( !strncmp(argv[i], "--threads:", sizeof("--threads:")-1) )
+            {
+                // get the rest
+                vm_threads = atoi( argv[i]+sizeof("--threads:")-1 );
+                if( vm_threads < 1 ) vm_threads = 1;
+            }
+            // (added 1.5.1.7)
+            else if( !strncmp(argv[i], "--report-realloc:", sizeof("--report-realloc:")-1) )
+            {
+                // get the rest
+                string arg = tolower(argv[i]+sizeof("--report-realloc:")-1);
+                if( arg == "on" ) report_realloc = 1;
+                else if( arg == "off" ) report_realloc = 0;
+                else
+                {
+                    // error
+                    errorMessage1 = "invalid arguments for '--report-realloc:'...";
+                    errorMessage2 = "...(looking for ON or OFF)";
+                    break;
+                }
+            }
             // (added 1.3.0.0)
             else if( !strncmp(argv[i], "--chugin-load:", sizeof("--chugin-load:")-1) )
             {
@@ -1264,12 +1356,20 @@ t_CKBOOL go( int argc, const char ** argv )
     the_chuck->setParam( CHUCK_PARAM_OUTPUT_CHANNELS, dac_chans );
     the_chuck->setParam( CHUCK_PARAM_VM_ADAPTIVE, adaptive_size );
     the_chuck->setParam( CHUCK_PARAM_VM_HALT, (t_CKINT)(vm_halt) );
+    the_chuck->setParam( CHUCK_PARAM_VM_DISPATCH, vm_dispatch );
+    the_chuck->setParam( CHUCK_PARAM_VM_SHRED_POOL, shred_pool );
+    the_chuck->setParam( CHUCK_PARAM_VM_RECLAIM, reclaim );
+    the_chuck->setParam( CHUCK_PARAM_VM_COLLECT, collect );
+    the_chuck->setParam( CHUCK_PARAM_VM_REPORT_REALLOC, report_realloc );
+    the_chuck->setParam( CHUCK_PARAM_VM_POLL, vm_poll );
+    the_chuck->setParam( CHUCK_PARAM_VM_THREADS, vm_threads );
     the_chuck->setParam( CHUCK_PARAM_OTF_PORT, g_otf_port );
     the_chuck->setParam( CHUCK_PARAM_OTF_ENABLE, (t_CKINT)enableOTF );
     // only print warning if say --loop is specified, signalling interest in using this VM as a server | 1.5.1.2
     the_chuck->setParam( CHUCK_PARAM_OTF_PRINT_WARNINGS, (t_CKINT)(vm_halt == FALSE) );
     the_chuck->setParam( CHUCK_PARAM_DUMP_INSTRUCTIONS, (t_CKINT)dump );
     the_chuck->setParam( CHUCK_PARAM_AUTO_DEPEND, (t_CKINT)auto_depend );
+    the_chuck->setParam( CHUCK_PARAM_COMPILER_OPTIMIZE, optimize_level );
     the_chuck->setParam( CHUCK_PARAM_DEPRECATE_LEVEL, deprecate_level );
     // set hint, so internally can advise things like async data writes etc.
     the_chuck->setParam( CHUCK_PARAM_IS_REALTIME_AUDIO_HINT, g_enable_realtime_audio );
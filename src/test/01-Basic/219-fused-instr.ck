@@ -0,0 +1,46 @@
+// test instruction sequences that the emitter fuses into
+// superinstructions (immediate / variable operands, stores,
+// compare-and-branch), in both file-level and function scope
+
+0 => int failed;
+
+// file scope (global stack base)
+0 => int i; 0 => int sum; 1.0 => float f; 0.5 => float g;
+while( i < 10 ) { sum + i => sum; i + 1 => i; f * g + 1.0 => f; }
+if( sum != 45 ) 1 => failed;
+if( i - 3 != 7 || i * 3 != 30 ) 1 => failed;
+if( f - 1.9990234375 != 0.0 ) 1 => failed;
+
+// function scope (local stack)
+fun int loop( int n )
+{
+    0 => int k; 0 => int acc;
+    for( 0 => k; k < n; k++ ) { acc + k * k => acc; acc - 1 => acc; }
+    return acc;
+}
+if( loop( 10 ) != 275 ) 1 => failed;
+
+fun float scale( float x, float y )
+{
+    x * y => float z; z + y => z; z - x => z;
+    return z;
+}
+if( scale( 2.0, 3.0 ) != 7.0 ) 1 => failed;
+
+// float compare with NaN must not take the branch either way
+Math.sqrt( -1.0 ) => float nan;
+if( !Math.isnan( nan ) ) 1 => failed;
+if( nan < 1.0 ) 1 => failed;
+if( !(nan >= 1.0) ) { } else 1 => failed;
+if( nan == nan ) 1 => failed;
+if( !(nan != nan) ) 1 => failed;
+
+// short-circuit
+0 => int calls;
+fun int touch() { calls++; return 1; }
+if( 0 && touch() ) 1 => failed;
+if( !(1 || touch()) ) 1 => failed;
+if( calls != 0 ) 1 => failed;
+
+if( !failed ) <<< "success" >>>;
+else <<< "failure" >>>;
@@ -0,0 +1,50 @@
+// test expressions and branches the optimizer resolves at compile
+// time; results must match what the VM would compute at runtime
+
+0 => int failed;
+
+// int arithmetic, wrap-around, and things left to runtime
+if( 2 + 3 * 4 != 14 ) 1 => failed;
+if( 7 / 2 != 3 || -7 % 3 != -1 ) 1 => failed;
+if( (1 << 4) - 1 != 15 || (0xff & ~0x0f) != 0xf0 ) 1 => failed;
+if( Math.INT_MAX + 1 != -Math.INT_MAX - 1 ) 1 => failed;
+
+// float, with implicit casts
+if( 1 / 4.0 != 0.25 || 3 + 0.5 != 3.5 ) 1 => failed;
+if( (3.7 $ int) != 3 || (-3.7 $ int) != -3 ) 1 => failed;
+if( Math.PI / 2 != Math.PI * 0.5 ) 1 => failed;
+
+// dur and time
+1::second / 4 => dur quarter;
+if( quarter != 250::ms ) 1 => failed;
+if( 1::samp * 44100 / 44100 != samp ) 1 => failed;
+if( (now + 2::second) - now != 2::second ) 1 => failed;
+
+// strength reduction on variables
+5 => int n; 3.0 => float x;
+if( n * 1 != 5 || n + 0 != 5 || n - 0 != 5 || n / 1 != 5 ) 1 => failed;
+if( x / 2 != 1.5 || x / 0.25 != 12.0 || x * 1 != 3.0 ) 1 => failed;
+
+// unreachable branches; short-circuit must not evaluate
+0 => int calls;
+fun int touch() { calls++; return 1; }
+if( false ) { touch(); 1 => failed; }
+if( 0 && touch() ) 1 => failed;
+if( !(1 || touch()) ) 1 => failed;
+if( true ) { 1 => int y; } else { 1 => failed; }
+1 => int y; // no clash with the branch's scope
+while( false ) { touch(); }
+for( 0 => int k; false; k++ ) { touch(); }
+if( calls != 0 ) 1 => failed;
+
+// constant loops still terminate through break
+0 => int count;
+while( true ) { if( ++count == 3 ) break; }
+do { count++; } while( false );
+if( count != 4 ) 1 => failed;
+
+// conditional expression
+if( (1 ? 2 : 3) != 2 ) 1 => failed;
+
+if( !failed ) <<< "success" >>>;
+else <<< "failure" >>>;
@@ -0,0 +1,60 @@
+// hot loops and functions, long enough to be compiled under
+// --dispatch:jit; results must match the interpreter exactly
+
+0 => int failed;
+
+// int arithmetic, compares, and branches
+0 => int sum; 1 => int prod;
+for( 0 => int i; i < 5000; i++ )
+{
+    sum + i * 3 - 1 => sum;
+    if( i % 7 == 0 ) prod * 3 => prod;
+    if( i >= 4990 && i != 4995 ) sum - 2 => sum;
+}
+if( sum != 37487482 ) 1 => failed;
+
+// float accumulation, in the same order as the interpreter
+0.0 => float acc; 1.0 => float x;
+0 => int n;
+while( n < 3000 )
+{
+    acc + x * 0.5 - 0.25 => acc;
+    x / 1.0001 => x;
+    if( acc > 100.0 ) acc - 100.0 => acc;
+    n++;
+}
+if( acc < 0.0 || acc > 100.0 || x >= 1.0 ) 1 => failed;
+
+// NaN compares (false except !=)
+Math.sqrt( -1.0 ) => float nan;
+0 => int nans;
+for( 0 => int i; i < 2000; i++ )
+{
+    if( nan < 1.0 || nan > 1.0 || nan <= 1.0 || nan >= 1.0 || nan == nan ) 1 => failed;
+    if( nan != nan ) nans++;
+}
+if( nans != 2000 ) 1 => failed;
+
+// functions called often, with locals
+fun int tri( int k )
+{
+    0 => int t;
+    for( 1 => int j; j <= k; j++ ) t + j => t;
+    return t;
+}
+0 => int tris;
+for( 0 => int i; i < 1500; i++ ) tris + tri( i % 10 ) => tris;
+if( tris != 24750 ) 1 => failed;
+
+// float functions
+fun float poly( float v ) { return v * v * 2.0 - v + 0.5; }
+0.0 => float p;
+for( 0 => int i; i < 1500; i++ ) p + poly( i / 1000.0 ) => p;
+if( Math.fabs( p - 1873.5005 ) > 1e-6 ) 1 => failed;
+
+// time and yields inside a hot loop
+now => time start;
+for( 0 => int i; i < 1200; i++ ) 1::samp => now;
+if( now - start != 1200::samp ) 1 => failed;
+
+if( !failed ) <<< "success" >>>;
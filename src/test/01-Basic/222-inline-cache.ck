@@ -0,0 +1,49 @@
+// member function call sites seeing one, a few, and many receiver
+// types; each call must resolve to the receiver's own override
+
+class Base
+{
+    1 => int x;
+    fun int get() { return x; }
+    fun int id() { return 0; }
+}
+class A extends Base { fun int id() { return 1; } }
+class B extends Base { fun int id() { return 2; } }
+class C extends A { fun int id() { return 3; } }
+class D extends B { fun int id() { return 4; } }
+class E extends Base { fun int id() { return 5; } }
+
+0 => int failed;
+
+// monomorphic: one lookup, then answered by the cache
+Base b;
+0 => int sum;
+Machine.icHits() => int hits;
+for( 0 => int i; i < 100; i++ ) sum + b.get() => sum;
+if( sum != 100 ) 1 => failed;
+if( Machine.icHits() - hits < 99 ) 1 => failed;
+
+// polymorphic, then more types than the cache holds
+Machine.icMisses() => int misses;
+Base @ objs[6];
+new Base @=> objs[0]; new A @=> objs[1]; new B @=> objs[2];
+new C @=> objs[3]; new D @=> objs[4]; new E @=> objs[5];
+for( 0 => int round; round < 10; round++ )
+{
+    for( 0 => int i; i < objs.size(); i++ )
+    {
+        if( objs[i].id() != i ) 1 => failed;
+        i => objs[i].x;
+        if( objs[i].get() != i ) 1 => failed;
+    }
+}
+// the cache holds four types; the other two miss every round
+if( Machine.icMisses() - misses < 10 ) 1 => failed;
+
+// field access through the same call site, int and float
+class P { 0 => int n; 0.0 => float f; }
+P p;
+for( 0 => int i; i < 10; i++ ) { p.n + 2 => p.n; p.f + 0.5 => p.f; }
+if( p.n != 20 || p.f != 5.0 ) 1 => failed;
+
+if( !failed ) <<< "success" >>>;
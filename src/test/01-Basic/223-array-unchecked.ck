@@ -0,0 +1,50 @@
+// counting loops over arrays, whose accesses are compiled without
+// bounds checks, next to loops that must keep them
+
+0 => int failed;
+
+// int and float loads and stores
+int a[100]; float f[100]; dur d[100];
+for( 0 => int i; i < a.size(); i++ ) i * 2 => a[i];
+for( 0 => int i; i < f.size(); i++ ) { a[i] * 0.5 => f[i]; i::samp => d[i]; }
+0 => int sum; 0.0 => float fsum; 0::samp => dur dsum;
+for( 0 => int i; i < a.size(); i++ ) { sum + a[i] => sum; fsum + f[i] => fsum; dsum + d[i] => dsum; }
+if( sum != 9900 || fsum != 4950.0 || dsum != 4950::samp ) 1 => failed;
+
+// in-place updates, starting part way, with an outer index variable
+0 => int k;
+for( 10 => k; k < a.size(); ++k ) { a[k]++; 2.0 +=> f[k]; }
+if( a[9] != 18 || a[10] != 21 || a[99] != 199 ) 1 => failed;
+if( f[9] != 9.0 || f[10] != 12.0 ) 1 => failed;
+
+// natives on primitives, nested loops, and an empty array
+int empty[0];
+for( 0 => int i; i < empty.size(); i++ ) 1 => failed;
+for( 0 => int i; i < f.size(); i++ )
+{
+    Math.sqrt( i * i ) => f[i];
+    for( 0 => int j; j < 2; j++ ) f[i] + 1.0 => f[i];
+}
+if( f[50] != 52.0 ) 1 => failed;
+
+// shrinks inside the loop: must stay checked
+int b[10];
+for( 0 => int i; i < b.size(); i++ ) { if( i == 5 ) b.popBack(); i => b[i]; }
+if( b.size() != 9 || b[8] != 8 ) 1 => failed;
+
+// index reassigned inside the loop: must stay checked (negative indexing)
+int c[4];
+for( 0 => int i; i < c.size(); i++ ) { i - 4 => int j; j => c[j]; }
+if( c[0] != -4 || c[3] != -1 ) 1 => failed;
+
+// array rebound inside the loop: must stay checked
+int e[8]; int g[4];
+for( 0 => int i; i < e.size(); i++ ) { if( i == 3 ) g @=> e; if( i < e.size() ) i => e[i]; }
+if( e.size() != 4 || g[3] != 3 ) 1 => failed;
+
+// time passes inside the loop: must stay checked
+float h[4];
+for( 0 => int i; i < h.size(); i++ ) { 1::samp => now; i => h[i]; }
+if( h[3] != 3.0 ) 1 => failed;
+
+if( !failed ) <<< "success" >>>;
@@ -0,0 +1,36 @@
+// many shreds waking at the same and at different times; those
+// waking at the same time must run in the order they were shreduled
+
+0 => int failed;
+int order[0];
+
+fun void wake( int id, dur d )
+{
+    d => now;
+    order << id;
+}
+
+// ids 0..299; wake time by id % 3, so ties within each group
+Shred @ shreds[300];
+for( 0 => int i; i < 300; i++ )
+    spork ~ wake( i, ((i % 3) * 10 + 5)::samp ) @=> shreds[i];
+
+// remove every 7th, while all are waiting
+1::samp => now;
+0 => int removed;
+for( 0 => int i; i < 300; 7 +=> i ) { shreds[i].exit(); removed++; }
+
+50::samp => now;
+if( order.size() != 300 - removed ) 1 => failed;
+
+// group 0 first, then 1, then 2; ascending within each group
+-1 => int last;
+for( 0 => int i; i < order.size(); i++ )
+{
+    if( order[i] % 7 == 0 ) 1 => failed;
+    if( last >= 0 && ( order[i] % 3 < last % 3 ||
+                     ( order[i] % 3 == last % 3 && order[i] < last ) ) ) 1 => failed;
+    order[i] => last;
+}
+
+if( !failed ) <<< "success" >>>;
@@ -0,0 +1,39 @@
+// waves of short-lived shreds, which reuse the shreds and stacks of
+// those that finished before them; each must start out as new
+
+0 => int failed;
+0 => int count;
+int seen[0];
+
+fun void note( int n )
+{
+    // locals start zeroed, even on a reused stack
+    int x; float y; int a[4];
+    if( x != 0 || y != 0.0 || a[3] != 0 ) 1 => failed;
+    99 => x; 1.5 => y; 7 => a[3];
+    // a fresh id each time
+    seen << me.id();
+    1::samp => now;
+    if( x != 99 || a[3] != 7 ) 1 => failed;
+    count++;
+}
+
+// a shred whose reference is kept can't be reused
+Shred @ kept;
+for( 0 => int wave; wave < 20; wave++ )
+{
+    for( 0 => int i; i < 50; i++ )
+    {
+        spork ~ note( i ) @=> Shred @ s;
+        if( i == 0 && wave == 0 ) s @=> kept;
+    }
+    // let them finish, and be cleaned up
+    5::samp => now;
+}
+if( count != 1000 || kept.done() != 1 ) 1 => failed;
+
+// ids are unique
+for( 1 => int i; i < seen.size(); i++ )
+    if( seen[i] <= seen[i-1] ) 1 => failed;
+
+if( !failed ) <<< "success" >>>;
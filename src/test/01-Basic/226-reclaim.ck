@@ -0,0 +1,80 @@
+// large arrays of objects and whole UGen graphs let go at once, while
+// time goes on; (with --reclaim:<N>, their deletion is spread over the
+// blocks that follow)
+
+0 => int failed;
+0 => int done;
+
+class Node
+{
+    int value;
+    Node @ next;
+    string name;
+}
+
+// a long linked list and an array of objects, freed when the shred ends
+fun void lists( int round )
+{
+    Node @ head;
+    for( 0 => int i; i < 2000; i++ )
+    {
+        Node n; i => n.value; "n" + i => n.name; head @=> n.next; n @=> head;
+    }
+    Node nodes[5000];
+    for( 0 => int i; i < nodes.size(); i++ ) i + round => nodes[i].value;
+
+    // walk before letting go
+    0 => int count; head @=> Node @ p;
+    while( p != null ) { count++; p.next @=> p; }
+    if( count != 2000 || head.name != "n1999" ) 1 => failed;
+    if( nodes[4999].value != 4999 + round ) 1 => failed;
+    done++;
+}
+
+// a UGen graph, dropped while the next one plays
+fun void graph()
+{
+    SinOsc s[200]; Gain g => blackhole;
+    for( 0 => int i; i < s.size(); i++ ) { s[i] => g; 0.001 => s[i].gain; }
+    10::samp => now;
+    done++;
+}
+
+for( 0 => int round; round < 5; round++ )
+{
+    spork ~ lists( round );
+    spork ~ graph();
+    // a few blocks apart
+    1000::samp => now;
+    // objects created in the meantime start out new
+    Node fresh;
+    if( fresh.value != 0 || fresh.next != null || fresh.name != "" ) 1 => failed;
+}
+
+if( done != 10 ) 1 => failed;
+
+// the stats, when on (e.g., --reclaim:4)
+if( Machine.reclaimBudget() )
+{
+    if( Machine.reclaimDeferred() == 0 || Machine.reclaimFreed() == 0 ) 1 => failed;
+    if( Machine.reclaimFreed() > Machine.reclaimDeferred() ) 1 => failed;
+    if( Machine.reclaimDepthMax() == 0 ) 1 => failed;
+    if( Machine.reclaimLatencyMax() < Machine.reclaimLatency() ) 1 => failed;
+}
+else if( Machine.reclaimDeferred() || Machine.reclaimDepth() ) 1 => failed;
+
+// turned on (or changed) from code, then put back
+Machine.reclaimBudget() => int was;
+if( Machine.reclaimBudget( 1000 ) != 1000 ) 1 => failed;
+Machine.reclaimFreed() => int freed;
+fun void drop() { Node nodes[100]; }
+drop();
+// the array is queued until the next block; its elements after that
+if( Machine.reclaimDepth() < 1 ) 1 => failed;
+// (behind anything still queued from above)
+for( 0 => int k; k < 100 && Machine.reclaimDepth(); k++ ) 1000::samp => now;
+if( Machine.reclaimDepth() != 0 ) 1 => failed;
+if( Machine.reclaimFreed() - freed < 101 ) 1 => failed;
+if( Machine.reclaimBudget( was ) != was ) 1 => failed;
+
+if( !failed ) <<< "success" >>>;
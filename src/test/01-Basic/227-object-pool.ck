@@ -0,0 +1,44 @@
+// objects, strings, events, and arrays allocated and freed over and
+// over (reusing pool blocks); each must start out zeroed, and large
+// ones (beyond the pool's size classes) must work the same
+
+0 => int failed;
+
+class Small { int a; float b; }
+class Big
+{
+    // data block larger than the biggest size class
+    float f[0];
+    int i0; int i1; int i2; int i3; int i4; int i5; int i6; int i7;
+    int i8; int i9; int i10; int i11; int i12; int i13; int i14; int i15;
+    float g0; float g1; float g2; float g3; float g4; float g5; float g6; float g7;
+    float g8; float g9; float g10; float g11; float g12; float g13; float g14; float g15;
+    vec4 v0; vec4 v1; vec4 v2; vec4 v3; vec4 v4; vec4 v5; vec4 v6; vec4 v7;
+    string s;
+}
+
+for( 0 => int round; round < 200; round++ )
+{
+    Small sm; Big bg; Event e; string str;
+    if( sm.a != 0 || sm.b != 0.0 ) 1 => failed;
+    if( bg.i15 != 0 || bg.g15 != 0.0 || bg.v7.w != 0.0 || bg.s != "" ) 1 => failed;
+    if( str != "" ) 1 => failed;
+    round => sm.a; round => bg.i15; round => bg.g15; @(1,2,3,round) => bg.v7;
+    "r" + round => bg.s; bg.s => str;
+    int ia[round % 7 + 1]; float fa[round % 5 + 1];
+    for( 0 => int i; i < ia.size(); i++ ) if( ia[i] != 0 ) 1 => failed;
+    for( 0 => int i; i < fa.size(); i++ ) if( fa[i] != 0.0 ) 1 => failed;
+    round => ia[0]; round => fa[0];
+    if( bg.v7.w != round || str != "r" + round || sm.a != round ) 1 => failed;
+}
+
+// many alive at once, then freed, then again
+for( 0 => int pass; pass < 3; pass++ )
+{
+    Small @ many[3000];
+    for( 0 => int i; i < many.size(); i++ ) { new Small @=> many[i]; i => many[i].a; }
+    for( 0 => int i; i < many.size(); i++ ) if( many[i].a != i || many[i].b != 0.0 ) 1 => failed;
+    1::samp => now;
+}
+
+if( !failed ) <<< "success" >>>;
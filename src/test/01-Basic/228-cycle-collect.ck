@@ -0,0 +1,71 @@
+// objects that refer to each other, dropped while still linked; with
+// cycle collection on, they are found and freed, and live ones are not
+
+0 => int failed;
+
+// a doubly-linked list of voices
+class Voice
+{
+    int id;
+    Voice @ prev;
+    Voice @ next;
+}
+
+// a parent whose children point back to it
+class Child { Parent @ parent; float x; }
+class Parent { Child kids[0]; }
+
+// scan 64 objects between blocks
+Machine.collectBudget( 64 );
+if( Machine.collectBudget() != 64 ) 1 => failed;
+
+fun Voice chain( int n )
+{
+    Voice head; head @=> Voice @ last;
+    for( 1 => int i; i < n; i++ )
+    {
+        Voice v; i => v.id;
+        v @=> last.next; last @=> v.prev;
+        v @=> last;
+    }
+    return head;
+}
+
+fun void family( int n )
+{
+    Parent p;
+    for( 0 => int i; i < n; i++ )
+    {
+        Child c; p @=> c.parent; i => c.x;
+        p.kids << c;
+    }
+}
+
+// keep one list, drop the rest
+chain( 10 ) @=> Voice @ kept;
+for( 0 => int i; i < 20; i++ ) { chain( 10 ); family( 5 ); }
+
+// let slices run between blocks
+1::second => now;
+if( Machine.collectCycles() < 40 ) 1 => failed;
+if( Machine.collectFreed() < 20 * 10 + 20 * 6 ) 1 => failed;
+if( Machine.collectScanned() < Machine.collectFreed() ) 1 => failed;
+if( Machine.collectTime() < 0.0 ) 1 => failed;
+
+// the one kept is intact
+0 => int count; kept @=> Voice @ v;
+while( v != null ) { if( v.id != count ) 1 => failed; count++; v.next @=> v; }
+if( count != 10 ) 1 => failed;
+if( kept.next.prev != kept ) 1 => failed;
+
+// a self-reference, dropped, freed on request
+Voice self; self @=> self.next;
+Machine.collectFreed() => int before;
+null @=> self;
+if( Machine.collect() != 1 || Machine.collectFreed() != before + 1 ) 1 => failed;
+
+// turn it off
+Machine.collectBudget( 0 );
+if( Machine.collectBudget() != 0 || Machine.collectFreed() != 0 ) 1 => failed;
+
+if( !failed ) <<< "success" >>>;
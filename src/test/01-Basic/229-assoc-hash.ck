@@ -0,0 +1,62 @@
+// associative arrays with many keys, erased and re-added keys, keys
+// that change, and keys returned in sorted order on request
+
+0 => int failed;
+
+// note names to frequencies
+["C", "C#", "D", "D#", "E", "F", "F#", "G", "G#", "A", "A#", "B"] @=> string names[];
+float freq[0];
+for( 0 => int oct; oct < 8; oct++ )
+    for( 0 => int i; i < names.size(); i++ )
+        Std.mtof( 12 + oct * 12 + i ) => freq[names[i] + oct];
+if( freq["A4"] != 440.0 || freq["C0"] != Std.mtof( 12 ) ) 1 => failed;
+if( freq["H4"] != 0.0 || freq.isInMap( "H4" ) ) 1 => failed;
+
+// erase every other, then add them back with new values
+0 => int k;
+for( 0 => int oct; oct < 8; oct++ )
+    for( 0 => int i; i < names.size(); i++ )
+        if( k++ % 2 ) freq.erase( names[i] + oct );
+if( freq.isInMap( "C#0" ) || !freq.isInMap( "D0" ) ) 1 => failed;
+for( 0 => int oct; oct < 8; oct++ )
+    for( 0 => int i; i < names.size(); i++ )
+        if( !freq.isInMap( names[i] + oct ) ) -1.0 => freq[names[i] + oct];
+string keys[0];
+freq.getKeys( keys );
+if( keys.size() != 96 || freq["C#0"] != -1.0 || freq["D0"] != Std.mtof( 14 ) ) 1 => failed;
+
+// sorted on request
+freq.getKeys( keys, true );
+for( 1 => int i; i < keys.size(); i++ )
+    if( keys[i-1] >= keys[i] ) 1 => failed;
+
+// updates in place
+int count[0];
+for( 0 => int i; i < 1000; i++ ) count["k" + (i % 37)]++;
+5 +=> count["k0"];
+if( count["k0"] != 28 + 5 || count["k36"] != 27 ) 1 => failed;
+
+// a string key that changes
+"first" => string key;
+1 => count[key];
+"second" => key;
+if( count[key] != 0 || count["first"] != 1 ) 1 => failed;
+2 => count[key];
+if( count["second"] != 2 ) 1 => failed;
+
+// empty key, and vec types
+3 => count[""];
+vec3 v[0]; @(1,2,3) => v["a"]; v["a"].z + 1 => v["a"].z;
+complex c[0]; #(1,2) => c["x"];
+if( count[""] != 3 || v["a"] != @(1,2,4) || c["x"].im != 2 ) 1 => failed;
+
+// objects, with reference counts
+Object o;
+Object objs[0];
+for( 0 => int i; i < 100; i++ ) o @=> objs["o" + i];
+if( Machine.refcount( o ) != 101 ) 1 => failed;
+for( 0 => int i; i < 50; i++ ) objs.erase( "o" + i );
+null @=> objs["o50"];
+if( Machine.refcount( o ) != 50 || objs["o99"] != o || objs["o0"] != null ) 1 => failed;
+
+if( !failed ) <<< "success" >>>;
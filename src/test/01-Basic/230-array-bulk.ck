@@ -0,0 +1,66 @@
+// bulk operations on float-based arrays, checked against the same
+// work done one element at a time
+
+0 => int failed;
+fun int near( float a, float b ) { return Math.fabs( a - b ) < 1e-9; }
+
+// float[], with odd sizes so both the wide and the leftover paths run
+float a[103]; float b[103]; float out[0];
+for( 0 => int i; i < a.size(); i++ ) { Math.sin( i ) => a[i]; i * 0.01 - 0.5 => b[i]; }
+
+a.add( b, out );
+if( out.size() != a.size() ) 1 => failed;
+for( 0 => int i; i < a.size(); i++ ) if( out[i] != a[i] + b[i] ) 1 => failed;
+a.mul( b, out );
+for( 0 => int i; i < a.size(); i++ ) if( out[i] != a[i] * b[i] ) 1 => failed;
+a.scale( 3.0, out );
+for( 0 => int i; i < a.size(); i++ ) if( out[i] != a[i] * 3.0 ) 1 => failed;
+a.abs( out );
+for( 0 => int i; i < a.size(); i++ ) if( out[i] != Math.fabs( a[i] ) ) 1 => failed;
+a.clamp( -0.5, 0.25, out );
+for( 0 => int i; i < a.size(); i++ ) if( out[i] != Math.max( -0.5, Math.min( a[i], 0.25 ) ) ) 1 => failed;
+a.interp( b, 0.25, out );
+for( 0 => int i; i < a.size(); i++ ) if( !near( out[i], a[i] + ( b[i] - a[i] ) * 0.25 ) ) 1 => failed;
+
+// reductions (summed in a different order, so within a tolerance)
+0.0 => float dot; 0.0 => float sum; a[0] => float lo; a[0] => float hi;
+for( 0 => int i; i < a.size(); i++ )
+{
+    a[i] * b[i] +=> dot; a[i] +=> sum;
+    Math.min( lo, a[i] ) => lo; Math.max( hi, a[i] ) => hi;
+}
+if( !near( a.dot( b ), dot ) || !near( a.sum(), sum ) ) 1 => failed;
+if( a.min() != lo || a.max() != hi ) 1 => failed;
+
+// in place; the other array is untouched
+a @=> float c[]; float d[a.size()];
+for( 0 => int i; i < a.size(); i++ ) a[i] => d[i];
+c.add( b ); c.scale( 0.5 ); c.abs();
+for( 0 => int i; i < a.size(); i++ ) if( c[i] != Math.fabs( ( d[i] + b[i] ) * 0.5 ) ) 1 => failed;
+if( !near( b[100], 0.5 ) ) 1 => failed;
+
+// copy ranges, overlapping within one array, and from another
+float r[8]; for( 0 => int i; i < 8; i++ ) i => r[i];
+r.copyRange( 0, 2, 5 );
+if( r[1] != 1 || r[2] != 0 || r[6] != 4 || r[7] != 7 ) 1 => failed;
+float s[3]; s.copyRange( r, 5, 0, 3 );
+if( s[0] != 3 || s[2] != 7 ) 1 => failed;
+
+// multi-component elements work per component
+vec3 v[5]; vec3 w[5]; vec3 vo[0];
+for( 0 => int i; i < 5; i++ ) { @( i, -i, 1 ) => v[i]; @( 1, 2, 3 ) => w[i]; }
+v.mul( w, vo ); v.abs();
+if( vo[4] != @( 4, -8, 3 ) || v[3] != @( 3, 3, 1 ) ) 1 => failed;
+if( v.dot( w ) != 45 || v.sum() != 25 || v.max() != 4 ) 1 => failed;
+complex z[2]; #( 1, 2 ) => z[0]; #( -3, 4 ) => z[1];
+z.scale( 2 ); if( z[1] != #( -6, 8 ) ) 1 => failed;
+
+// empty arrays
+float e[0]; float e2[0];
+e.add( e2 ); if( e.sum() != 0 || e.min() != 0 ) 1 => failed;
+
+// a mismatched size stops the shred
+fun void mismatch() { float x[3]; float y[4]; x.add( y ); 1 => failed; }
+spork ~ mismatch(); me.yield();
+
+if( !failed ) <<< "success" >>>;
@@ -0,0 +1,78 @@
+// IntDeque, FloatDeque, and ObjectDeque: both ends, growth past the
+// initial capacity, wrap-around, fixed capacity, and references
+
+0 => int failed;
+
+// as a queue and as a stack, growing well past the initial capacity
+IntDeque q;
+for( 0 => int i; i < 1000; i++ ) q.pushBack( i );
+if( q.size() != 1000 || q.capacity() < 1000 ) 1 => failed;
+for( 0 => int i; i < 500; i++ ) if( q.popFront() != i ) 1 => failed;
+for( 999 => int i; i >= 900; i-- ) if( q.popBack() != i ) 1 => failed;
+if( q.size() != 400 || q.front() != 500 || q.back() != 899 ) 1 => failed;
+if( q.get( 0 ) != 500 || q.get( -1 ) != 899 || q.get( 10 ) != 510 ) 1 => failed;
+q.set( 1, -7 ); if( q.get( 1 ) != -7 ) 1 => failed;
+
+// wrap-around at both ends, growing from a small capacity
+IntDeque w;
+w.capacity( 8 );
+for( 0 => int round; round < 100; round++ )
+{
+    w.pushFront( round ); w.pushBack( -round );
+    if( w.popBack() != -round || w.popFront() != round ) 1 => failed;
+    w.pushFront( round );
+}
+if( w.size() != 100 || w.front() != 99 || w.back() != 0 ) 1 => failed;
+w.clear(); if( w.size() != 0 ) 1 => failed;
+
+// fixed: pushing onto a full deque drops from the other end
+FloatDeque f;
+f.capacity( 4 ) => int fcap;
+f.fixed( 1 );
+for( 0 => int i; i < 10; i++ ) f.pushBack( i * 0.5 );
+if( f.size() != fcap || f.capacity() != fcap ) 1 => failed;
+if( f.front() != ( 10 - fcap ) * 0.5 || f.back() != 4.5 ) 1 => failed;
+f.pushFront( -1.0 );
+if( f.front() != -1.0 || f.back() != 4.0 ) 1 => failed;
+
+// objects stay alive while in the deque, and after being popped
+class Item { int n; }
+ObjectDeque objs;
+for( 0 => int i; i < 20; i++ ) { Item it; i => it.n; objs.pushBack( it ); }
+for( 0 => int i; i < 20; i++ )
+{
+    objs.popFront() $ Item @=> Item it;
+    if( it.n != i ) 1 => failed;
+}
+Item keep; 5 => keep.n;
+objs.pushBack( keep ); objs.pushBack( null );
+if( objs.get( 1 ) != null || objs.front() != keep ) 1 => failed;
+objs.set( 1, keep ); if( objs.back() != keep ) 1 => failed;
+objs.clear();
+if( keep.n != 5 ) 1 => failed;
+
+// a pop hands the deque's reference over (here, to be let go)
+Machine.refcount( keep ) => int refs;
+objs.pushBack( keep ); objs.pushBack( keep );
+if( Machine.refcount( keep ) != refs + 2 ) 1 => failed;
+objs.popBack();
+if( Machine.refcount( keep ) != refs + 1 ) 1 => failed;
+objs.popFront();
+if( Machine.refcount( keep ) != refs || objs.size() ) 1 => failed;
+
+// growing is counted as a reallocation; not within capacity, or if fixed
+Machine.reallocs() => int reallocs;
+IntDeque g; g.capacity( 64 );
+for( 0 => int i; i < 64; i++ ) g.pushBack( i );
+if( Machine.reallocs() != reallocs ) 1 => failed;
+g.pushFront( -1 );
+if( Machine.reallocs() != reallocs + 1 || g.capacity() != 128 ) 1 => failed;
+FloatDeque h; h.capacity( 2 ); h.fixed( 1 );
+for( 0 => int i; i < 10; i++ ) h.pushBack( i );
+if( Machine.reallocs() != reallocs + 1 ) 1 => failed;
+
+// popping an empty deque stops the shred
+fun void empty() { IntDeque e; e.popBack(); 1 => failed; }
+spork ~ empty(); me.yield();
+
+if( !failed ) <<< "success" >>>;
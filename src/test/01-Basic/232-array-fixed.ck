@@ -0,0 +1,48 @@
+// arrays with reserved, fixed capacity: growing within capacity never
+// reallocates; growing past it fails instead of reallocating
+
+0 => int failed;
+
+// reserve, then append without reallocating
+float buf[0];
+if( buf.reserve( 64 ) < 64 || buf.size() != 0 ) 1 => failed;
+buf.fixed( 1 );
+if( !buf.fixed() ) 1 => failed;
+vec3 v[0]; v.reserve( 16 ); v.fixed( 1 );
+// (reserving counts as a reallocation, so count from here)
+Machine.reallocs() => int before;
+for( 0 => int i; i < 64; i++ ) buf << i;
+for( 0 => int i; i < 16; i++ ) v << @( i, i, i );
+buf.size( 32 ); buf.size( 64 );
+buf.clear();
+for( 0 => int i; i < 64; i++ ) buf << i * 2;
+if( Machine.reallocs() != before ) 1 => failed;
+if( buf.size() != 64 || buf[63] != 126 || v[15] != @( 15, 15, 15 ) ) 1 => failed;
+
+// object arrays too; storage past the size starts out null
+Object objs[0]; objs.reserve( 8 ); objs.fixed( 1 );
+for( 0 => int i; i < 8; i++ ) objs << new Object;
+objs.popBack(); objs << null;
+if( objs.size() != 8 || objs[7] != null ) 1 => failed;
+
+// an array that is not fixed reallocates as it grows, and is counted
+int grow[0];
+Machine.reallocs() => before;
+for( 0 => int i; i < 100; i++ ) grow << i;
+if( Machine.reallocs() <= before ) 1 => failed;
+// once unfixed, a fixed array can grow again
+buf.fixed( 0 ); buf << 1.0;
+if( buf.size() != 65 ) 1 => failed;
+
+// growing a fixed array past capacity stops the shred
+fun void append()
+{
+    int a[4]; a.fixed( 1 );
+    a.capacity() => int cap;
+    for( 0 => int i; i <= cap; i++ ) a << i;
+    1 => failed;
+}
+fun void resize() { float a[4]; a.fixed( 1 ); a.size( 1000 ); 1 => failed; }
+spork ~ append(); spork ~ resize(); me.yield();
+
+if( !failed ) <<< "success" >>>;
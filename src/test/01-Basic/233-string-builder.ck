@@ -0,0 +1,46 @@
+// StringBuilder, and string literals, which are shared by every use
+// of the same literal in a piece of code; assigning to a variable
+// holding one must not change the literal
+
+0 => int failed;
+
+// appends of each kind, chained
+StringBuilder sb;
+sb.append( "a" ).append( 12 ).append( -3 ).appendChar( '_' );
+sb.append( 1.5 ).appendChar( ' ' ).append( 2.26, 1 ).append( 7.0, 0 );
+if( sb.toString() != "a12-3_1.5000 2.37" ) 1 => failed;
+if( sb.length() != 17 ) 1 => failed;
+
+// clear keeps the storage
+sb.reserve( 100 ) => int cap;
+if( cap < 100 ) 1 => failed;
+sb.clear();
+if( sb.length() != 0 || sb.capacity() != cap || sb.toString() != "" ) 1 => failed;
+
+// copy into a string variable, in place
+string s;
+sb.append( "/osc/" ).append( 5 );
+sb.copyTo( s ) @=> string t;
+if( s != "/osc/5" || t != s ) 1 => failed;
+
+// literals: assignment to a variable holding one makes a copy
+"hello" @=> string h;
+"world" => h;
+if( "hello" != "hel" + "lo" || h != "world" ) 1 => failed;
+"abc" @=> string g;
+"d" +=> g; 5 +=> g; 1.5 +=> g;
+if( g != "abcd51.5000" || "abc".length() != 3 ) 1 => failed;
+
+// repeated in a loop: each pass starts from the literal
+for( 0 => int i; i < 3; i++ )
+{
+    "x" @=> string x;
+    i +=> x;
+    if( x != "x" + i ) 1 => failed;
+}
+
+// numbers on either side
+if( 3 + "a" != "3a" || 2.5 + "b" != "2.5000b" || "c" + 7 != "c7" ) 1 => failed;
+if( Std.itoa( -42 ) != "-42" || Std.ftoa( 3.14159, 2 ) != "3.14" ) 1 => failed;
+
+if( !failed ) <<< "success" >>>;
@@ -0,0 +1,62 @@
+// shreds waiting on events: signal wakes the one waiting longest,
+// broadcast wakes the rest in order, and a shred removed while
+// waiting is forgotten by its event
+
+0 => int failed;
+int order[0];
+Event e;
+
+fun void waiter( int id )
+{
+    e => now;
+    order << id;
+}
+
+// 0..19 wait, in order
+Shred @ shreds[20];
+for( 0 => int i; i < 20; i++ ) spork ~ waiter( i ) @=> shreds[i];
+me.yield();
+
+// first two by signal
+e.signal(); e.signal();
+me.yield();
+if( order.size() != 2 || order[0] != 0 || order[1] != 1 ) 1 => failed;
+
+// remove some while waiting: the head, the tail, and between
+shreds[2].exit(); shreds[19].exit(); shreds[10].exit();
+me.yield();
+
+// the rest by broadcast, in order
+e.broadcast();
+me.yield();
+if( order.size() != 17 ) 1 => failed;
+for( 1 => int i; i < order.size(); i++ )
+{
+    if( order[i] <= order[i-1] ) 1 => failed;
+    if( order[i] == 2 || order[i] == 10 || order[i] == 19 ) 1 => failed;
+}
+
+// nothing left waiting
+e.signal(); e.broadcast();
+me.yield();
+if( order.size() != 17 ) 1 => failed;
+
+// wait again on the same event, after it was emptied
+spork ~ waiter( 100 );
+me.yield();
+e.broadcast();
+me.yield();
+if( order.size() != 18 || order[17] != 100 ) 1 => failed;
+
+// an event dropped while a shred still waits on it
+fun void orphan()
+{
+    Event x;
+    x => now;
+}
+spork ~ orphan() @=> Shred @ o;
+me.yield();
+o.exit();
+me.yield();
+
+if( !failed ) <<< "success" >>>;
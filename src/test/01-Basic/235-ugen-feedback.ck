@@ -0,0 +1,45 @@
+// feedback loops read the previous sample of whichever ugen closes
+// the loop; connections made and broken between samples take effect
+// on the next one, including from inside a Chugen's tick
+
+0 => int failed;
+
+// g1 = step + g2 (last sample); g2 = g1 / 2
+Step st => Gain g1 => Gain g2 => g1; .5 => g2.gain; 1 => st.next;
+g2 => blackhole;
+1.0 => float expect;
+for( 0 => int i; i < 20; i++ )
+{
+    1::samp => now;
+    if( Std.fabs( g1.last() - expect ) > .000001 ) 1 => failed;
+    if( Std.fabs( g2.last() - expect / 2 ) > .000001 ) 1 => failed;
+    1 + expect / 2 => expect;
+}
+
+// break the loop; g1 follows step alone
+g2 =< g1;
+1::samp => now;
+if( g1.last() != 1 ) 1 => failed;
+
+// a Chugen that connects (and disconnects) another ugen as it goes
+Step one => Gain sum => blackhole; 1 => one.next;
+Step two; 2 => two.next;
+class Toggle extends Chugen
+{
+    0 => int n;
+    fun float tick( float in )
+    {
+        if( n++ % 2 == 0 ) two => sum; else two =< sum;
+        return in;
+    }
+}
+Step z => Toggle t => blackhole;
+// each change lands by the next sample: 3, 1, 3, 1, ...
+1::samp => now;
+for( 0 => int i; i < 10; i++ )
+{
+    1::samp => now;
+    if( sum.last() != ( i % 2 == 0 ? 3 : 1 ) ) 1 => failed;
+}
+
+if( !failed ) <<< "success" >>>;
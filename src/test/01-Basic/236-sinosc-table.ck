@@ -0,0 +1,38 @@
+// SinOsc.table(): sizes round up to a power of two within bounds;
+// reading the shared table stays close to sin(), free-running and
+// with FM input; 0 goes back to computing sin()
+
+0 => int failed;
+
+SinOsc s;
+if( s.table() != 0 ) 1 => failed;
+if( s.table( 1000 ) != 1024 ) 1 => failed;
+if( s.table() != 1024 ) 1 => failed;
+if( s.table( 1 ) != 256 ) 1 => failed;
+if( s.table( 1000000 ) != 65536 ) 1 => failed;
+if( s.table( 0 ) != 0 ) 1 => failed;
+
+// exact and table, side by side
+SinOsc a => blackhole; SinOsc b => blackhole;
+437.77 => a.freq => b.freq; b.table( 4096 );
+// same, frequency modulated
+SinOsc m => SinOsc fa => blackhole; m => SinOsc fb => blackhole;
+2 => fa.sync => fb.sync; 300 => m.gain; 5 => m.freq; fb.table( 4096 );
+
+for( 0 => int i; i < 5000; i++ )
+{
+    1::samp => now;
+    if( Std.fabs( a.last() - b.last() ) > .000001 ) 1 => failed;
+    if( Std.fabs( fa.last() - fb.last() ) > .000001 ) 1 => failed;
+}
+
+// back to sin(): the same, exactly
+b.table( 0 );
+a.phase() => b.phase;
+for( 0 => int i; i < 100; i++ )
+{
+    1::samp => now;
+    if( a.last() != b.last() ) 1 => failed;
+}
+
+if( !failed ) <<< "success" >>>;
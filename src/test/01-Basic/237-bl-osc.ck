@@ -0,0 +1,24 @@
+// band-limited oscillators: a pulse at width .5 is the square; a falling
+// saw is the rising one, upside down; near Nyquist only the fundamental
+// is left (a sine, of the saw's first harmonic: 2/pi)
+
+0 => int failed;
+
+BLSqrOsc sq => blackhole; BLPulseOsc pu => blackhole;
+BLSawOsc up => blackhole; BLSawOsc down => blackhole; 0 => down.width;
+BLSawOsc high => blackhole;
+if( down.width() != 0 || up.width() != 1 || sq.width( .2 ) != .5 ) 1 => failed;
+110 => sq.freq => pu.freq => up.freq => down.freq;
+(second / samp) * .4 => high.freq;
+
+0.0 => float peak;
+for( 0 => int i; i < 2000; i++ )
+{
+    1::samp => now;
+    if( Std.fabs( sq.last() - pu.last() ) > .00001 ) 1 => failed;
+    if( up.last() != -down.last() ) 1 => failed;
+    if( Std.fabs( high.last() ) > peak ) Std.fabs( high.last() ) => peak;
+}
+if( Std.fabs( peak - 2 / pi ) > .001 ) 1 => failed;
+
+if( !failed ) <<< "success" >>>;
@@ -0,0 +1,45 @@
+// bulk operations on complex[] and polar[]: only those that hold for
+// the values (not just their components) are allowed
+
+0 => int failed;
+fun int near( complex a, complex b ) { return Math.fabs( a.re - b.re ) < 1e-9 && Math.fabs( a.im - b.im ) < 1e-9; }
+
+// complex[]: add, scale, interp, copyRange
+complex z[3]; complex w[3]; complex out[0];
+#( 1, 2 ) => z[0]; #( -3, 4 ) => z[1]; #( 0, 1 ) => z[2];
+#( 0, 1 ) => w[0]; #( 1, 1 ) => w[1]; #( 0, 1 ) => w[2];
+z.add( w, out );
+if( !near( out[0], #( 1, 3 ) ) || !near( out[1], #( -2, 5 ) ) || !near( out[2], #( 0, 2 ) ) ) 1 => failed;
+z.scale( -2, out );
+if( !near( out[1], #( 6, -8 ) ) ) 1 => failed;
+z.interp( w, .5, out );
+if( !near( out[0], #( .5, 1.5 ) ) ) 1 => failed;
+z.copyRange( 1, 0, 2 );
+if( !near( z[0], #( -3, 4 ) ) || !near( z[1], #( 0, 1 ) ) ) 1 => failed;
+
+// polar[]: copyRange
+polar p[2]; polar q[2];
+%( 1, pi/2 ) => p[0]; %( 2, pi/4 ) => p[1];
+q.copyRange( p, 0, 0, 2 );
+if( q[1].mag != 2 || q[1].phase != pi/4 ) 1 => failed;
+
+// vec2[] (same storage as complex[]) keeps every operation
+vec2 v[1]; vec2 u[1]; @( 2, 3 ) => v[0]; @( 4, 5 ) => u[0];
+v.mul( u ); if( v[0] != @( 8, 15 ) || v.max() != 15 ) 1 => failed;
+
+// the others stop the shred instead of working per component
+0 => int stopped;
+fun void cabs() { complex c[1]; #( 3, 4 ) => c[0]; c.abs(); 1 => failed; }
+fun void cclamp() { complex c[1]; c.clamp( 0, 1 ); 1 => failed; }
+fun void csum() { complex c[1]; c.sum(); 1 => failed; }
+fun void cmin() { complex c[1]; c.min(); 1 => failed; }
+fun void cmax() { complex c[1]; c.max(); 1 => failed; }
+fun void cmulvec() { complex c[1]; vec2 d[1]; c.mul( d ); 1 => failed; }
+fun void cdotvec() { complex c[1]; vec2 d[1]; c.dot( d ); 1 => failed; }
+fun void paddvec() { polar a[1]; vec2 d[1]; a.add( d ); 1 => failed; }
+fun void pscale() { polar a[1]; a.scale( 2 ); 1 => failed; }
+spork ~ cabs(); spork ~ cclamp(); spork ~ csum(); spork ~ cmin(); spork ~ cmax();
+spork ~ cmulvec(); spork ~ cdotvec(); spork ~ paddvec(); spork ~ pscale();
+me.yield();
+
+if( !failed ) <<< "success" >>>;
@@ -0,0 +1,28 @@
+// changing a string that came from a literal (one string per distinct
+// literal in a piece of code) changes only that string: the code pushes
+// a fresh copy of the literal from then on
+
+0 => int failed;
+
+// through a function argument
+fun void m( string s ) { s.setCharAt( 0, 'Z' ); }
+m( "abc" );
+if( "abc" != "a" + "bc" || "abc".charAt( 0 ) != 'a' ) 1 => failed;
+
+// through an array element
+string arr[0];
+arr << "key";
+arr[0].setCharAt( 0, 'M' );
+if( arr[0] != "Mey" || "key".charAt( 0 ) != 'k' ) 1 => failed;
+
+// again and again, from the same place
+fun string first( string s ) { s.setCharAt( 0, 'Q' ); return s; }
+for( 0 => int i; i < 3; i++ )
+    if( first( "pqr" ) != "Qqr" || "pqr".charAt( 0 ) != 'p' ) 1 => failed;
+
+// other mutating methods
+"value" @=> string v;
+v.replace( 0, "V" ); v.insert( 0, "_" ); v.erase( 1, 1 );
+if( v != "_alue" || "value".length() != 5 || "value".charAt( 0 ) != 'v' ) 1 => failed;
+
+if( !failed ) <<< "success" >>>;
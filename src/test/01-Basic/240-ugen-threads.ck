@@ -0,0 +1,40 @@
+// voices feeding one mix, ticked alongside each other on worker
+// threads under --adaptive:<N> --threads:<N> (see test.py); identical
+// voices must stay identical, bit for bit, and the mix their sum
+
+8 => int N;
+SinOsc s[N]; LPF f[N]; Gain mix => blackhole;
+for( 0 => int i; i < N; i++ )
+{
+    s[i] => f[i] => mix;
+    440 => s[i].freq;
+    2000 => f[i].freq;
+}
+
+0 => int failed;
+0 => int moved;
+for( 0 => int k; k < 200; k++ )
+{
+    64::samp => now;
+    0.0 => float sum;
+    for( 0 => int i; i < N; i++ )
+    {
+        // ticked once, like the others (not skipped, not twice)
+        if( f[i].last() != f[0].last() ) 1 => failed;
+        f[i].last() +=> sum;
+    }
+    if( Math.fabs( mix.last() - sum ) > 1e-5 ) 1 => failed;
+    if( f[0].last() != 0 ) 1 => moved;
+}
+
+// and again, after the graph changes
+LPF extra[N];
+for( 0 => int i; i < N; i++ ) s[i] => extra[i] => mix;
+for( 0 => int k; k < 50; k++ )
+{
+    64::samp => now;
+    for( 0 => int i; i < N; i++ )
+        if( extra[i].last() != extra[0].last() ) 1 => failed;
+}
+
+if( !failed && moved ) <<< "success" >>>;
@@ -0,0 +1,72 @@
+// block ticks (tickv) against per-sample ticks: each ugen is recorded
+// sample by sample, and a digest of every sample printed; the answer
+// is from a per-sample run, and test.py runs this again with
+// --adaptive:<N> (see testFlags), where the same ugens tick in blocks
+
+// one source of noise, so the random sequence is the same either way
+Math.srandom( 1234 );
+Noise n;
+
+// the ugens under test
+UGen u[0]; string names[0];
+fun UGen add( UGen x, string name ) { u << x; names << name; return x; }
+add( new Phasor, "Phasor" ) $ Phasor @=> Phasor ph; 220 => ph.freq;
+add( new SinOsc, "SinOsc" ) $ SinOsc @=> SinOsc si; 440 => si.freq;
+add( new TriOsc, "TriOsc" ) $ TriOsc @=> TriOsc tr; 330 => tr.freq; .3 => tr.width;
+add( new SawOsc, "SawOsc" ) $ SawOsc @=> SawOsc sa; 550 => sa.freq;
+add( new PulseOsc, "PulseOsc" ) $ PulseOsc @=> PulseOsc pu; 660 => pu.freq; .2 => pu.width;
+add( new SqrOsc, "SqrOsc" ) $ SqrOsc @=> SqrOsc sq; 770 => sq.freq;
+add( new SinOsc, "SinOsc (FM)" ) $ SinOsc @=> SinOsc fm; 300 => fm.freq; 2 => fm.sync;
+add( new BLSawOsc, "BLSawOsc" ) $ BLSawOsc @=> BLSawOsc bsa; 250 => bsa.freq;
+add( new BLTriOsc, "BLTriOsc" ) $ BLTriOsc @=> BLTriOsc btr; 350 => btr.freq;
+add( new BLPulseOsc, "BLPulseOsc" ) $ BLPulseOsc @=> BLPulseOsc bpu; 450 => bpu.freq;
+add( new BLSqrOsc, "BLSqrOsc" ) $ BLSqrOsc @=> BLSqrOsc bsq; 150 => bsq.freq;
+add( new LPF, "LPF" ) $ LPF @=> LPF lp; 1000 => lp.freq; 2 => lp.Q;
+add( new HPF, "HPF" ) $ HPF @=> HPF hp; 3000 => hp.freq; 1 => hp.Q;
+add( new BPF, "BPF" ) $ BPF @=> BPF bp; 2000 => bp.freq; 4 => bp.Q;
+add( new BRF, "BRF" ) $ BRF @=> BRF br; 1500 => br.freq; 3 => br.Q;
+add( new ResonZ, "ResonZ" ) $ ResonZ @=> ResonZ rz; 800 => rz.freq; 10 => rz.Q;
+add( new BiQuad, "BiQuad" ) $ BiQuad @=> BiQuad bq; .99 => bq.prad; 1000 => bq.pfreq; 1 => bq.eqzs;
+add( n, "Noise" );
+add( new Impulse, "Impulse" ) $ Impulse @=> Impulse im;
+add( new Step, "Step" ) $ Step @=> Step st; .5 => st.next;
+
+// filters take the noise; an oscillator takes a sine (FM)
+n => lp; n => hp; n => bp; n => br; n => rz; n => bq;
+si => fm;
+
+// record each, sample by sample (LiSa ticks per sample either way)
+2048 => int N;
+LiSa rec[u.size()];
+for( 0 => int i; i < u.size(); i++ )
+{
+    u[i] => rec[i] => blackhole;
+    N::samp => rec[i].duration;
+    1 => rec[i].record;
+}
+
+// change parameters along the way (block boundaries fall here)
+for( 0 => int k; k < 8; k++ )
+{
+    // odd lengths, to end blocks early
+    N/8 - 3 => int len;
+    len::samp => now;
+    si.freq() * 1.1 => si.freq; tr.freq() * .9 => tr.freq;
+    pu.width() + .05 => pu.width; bsa.freq() * 1.2 => bsa.freq;
+    lp.freq() * 1.3 => lp.freq; bp.Q() + 1 => bp.Q; rz.freq() * 1.1 => rz.freq;
+    k * .1 - .3 => st.next; 1 - k * .2 => im.next;
+    3::samp => now;
+}
+for( 0 => int i; i < u.size(); i++ ) 0 => rec[i].record;
+
+// digest: every sample, to 2^-24
+for( 0 => int i; i < u.size(); i++ )
+{
+    0 => int h;
+    for( 0 => int s; s < N; s++ )
+    {
+        Math.round( rec[i].valueAt( s::samp ) * 16777216 ) $ int => int x;
+        ( h * 31 + x ) % 1000000007 => h;
+    }
+    <<< names[i], h >>>;
+}
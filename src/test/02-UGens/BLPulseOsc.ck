@@ -0,0 +1,6 @@
+BLPulseOsc u => blackhole;
+1::samp => now;
+u =< blackhole;
+null @=> u;
+
+<<< "success" >>>;
@@ -0,0 +1,6 @@
+BLSqrOsc u => blackhole;
+1::samp => now;
+u =< blackhole;
+null @=> u;
+
+<<< "success" >>>;
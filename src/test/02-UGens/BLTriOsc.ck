@@ -0,0 +1,6 @@
+BLTriOsc u => blackhole;
+1::samp => now;
+u =< blackhole;
+null @=> u;
+
+<<< "success" >>>;
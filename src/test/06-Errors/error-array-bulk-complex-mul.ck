@@ -0,0 +1,3 @@
+// complex[] has no mul(): multiplying per component is not complex multiplication
+complex z[2]; complex w[2];
+z.mul( w );
@@ -0,0 +1,19 @@
+// a counting loop over a member array, rebinding it (as this.a)
+// partway through: a[i] must still be bounds-checked (--optimize:2)
+class Foo
+{
+    float a[];
+
+    fun void go()
+    {
+        for( 0 => int i; i < a.size(); i++ )
+        {
+            if( i == 5 ) [1.0] @=> this.a;
+            <<< a[i] >>>;
+        }
+    }
+}
+
+Foo foo;
+new float[10] @=> foo.a;
+foo.go();
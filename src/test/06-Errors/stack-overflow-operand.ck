@@ -0,0 +1,7 @@
+// operand stack overflow: each call leaves a vec4 on the
+// operand stack, which fills up before the memory stack
+fun vec4 overflow( vec4 v )
+{
+    return v + overflow( v );
+}
+overflow( @(1,2,3,4) );
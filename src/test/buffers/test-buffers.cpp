@@ -0,0 +1,149 @@
+//-----------------------------------------------------------------------------
+// file: test-buffers.cpp
+// desc: stress test for the circular buffers in util_buffers.h that device
+//       and host threads hand data to the VM through; several threads put
+//       at once, and the reader checks that nothing is lost, duplicated,
+//       reordered (per writer), or torn
+//
+//       CBufferMulti  -- any number of writers, one reader (e.g., the VM
+//                        message queue, HID device operations)
+//       CBufferSimple -- one writer, one reader
+//
+//       USAGE (see makefile)
+//         make test
+//         ./test-buffers [elements per writer]
+//
+//       prints "success" and exits 0 if every check passes
+//-----------------------------------------------------------------------------
+#include "chuck_def.h"
+#include "util_buffers.h"
+
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+using namespace std;
+
+
+//-----------------------------------------------------------------------------
+// the rest of chuck is not linked in; these stand in for what the buffer
+// code references (none of it is reached by this test)
+//-----------------------------------------------------------------------------
+void EM_log( t_CKINT, c_constr, ... ) { }
+void EM_pushlog() { }
+void EM_poplog() { }
+void ck_usleep( t_CKUINT microseconds ) { this_thread::sleep_for( chrono::microseconds( microseconds ) ); }
+void Chuck_Event::queue_broadcast( CBufferSimple * event_buffer ) { }
+
+
+// elements each writer puts
+static t_CKUINT g_count = 200000;
+// failures seen
+static t_CKUINT g_failures = 0;
+
+// an element several words wide, to catch torn reads
+struct Wide
+{
+    t_CKUINT writer;
+    t_CKUINT seq;
+    t_CKUINT check[2];
+};
+
+// what check[] must hold
+static t_CKUINT checksum( t_CKUINT writer, t_CKUINT seq, t_CKUINT i )
+{ return (writer * 2654435761UL) ^ (seq * 40503UL) ^ i; }
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: writer()
+// desc: put g_count elements, in order, retrying while the buffer is full
+//-----------------------------------------------------------------------------
+template <typename BUFFER>
+static void writer( BUFFER * buffer, t_CKUINT who )
+{
+    Wide w;
+    for( t_CKUINT seq = 0; seq < g_count; seq++ )
+    {
+        w.writer = who; w.seq = seq;
+        w.check[0] = checksum( who, seq, 0 );
+        w.check[1] = checksum( who, seq, 1 );
+        // full: the reader will make room
+        while( !buffer->put( &w, 1 ) ) this_thread::yield();
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: run()
+// desc: 'writers' threads putting into one buffer, this thread reading
+//-----------------------------------------------------------------------------
+template <typename BUFFER>
+static void run( const char * name, t_CKUINT writers, t_CKUINT size )
+{
+    BUFFER buffer;
+    vector<thread> threads;
+    vector<t_CKUINT> next( writers, 0 );
+    t_CKUINT got = 0, failures = 0;
+    Wide w[16];
+
+    buffer.initialize( size, sizeof(Wide) );
+    for( t_CKUINT i = 0; i < writers; i++ )
+        threads.push_back( thread( writer<BUFFER>, &buffer, i ) );
+
+    while( got < writers * g_count )
+    {
+        t_CKUINT n = buffer.get( w, 16 );
+        if( !n ) { this_thread::yield(); continue; }
+        for( t_CKUINT i = 0; i < n; i++, got++ )
+        {
+            // from a writer, next in its order, and whole
+            if( w[i].writer >= writers || w[i].seq != next[w[i].writer] ||
+                w[i].check[0] != checksum( w[i].writer, w[i].seq, 0 ) ||
+                w[i].check[1] != checksum( w[i].writer, w[i].seq, 1 ) )
+            {
+                if( failures++ < 5 )
+                    fprintf( stderr, "%s: bad element: writer %lu seq %lu (expected %lu)\n",
+                             name, (unsigned long)w[i].writer, (unsigned long)w[i].seq,
+                             w[i].writer < writers ? (unsigned long)next[w[i].writer] : 0UL );
+                if( w[i].writer < writers ) next[w[i].writer] = w[i].seq + 1;
+                continue;
+            }
+            next[w[i].writer]++;
+        }
+    }
+
+    for( t_CKUINT i = 0; i < writers; i++ ) threads[i].join();
+    // nothing more
+    if( buffer.get( w, 1 ) ) { fprintf( stderr, "%s: extra element\n", name ); failures++; }
+
+    fprintf( stderr, "%s: %lu writer(s), %lu elements: %s\n", name, (unsigned long)writers,
+             (unsigned long)got, failures ? "FAILED" : "ok" );
+    g_failures += failures;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: main()
+// desc: entry point
+//-----------------------------------------------------------------------------
+int main( int argc, char ** argv )
+{
+    if( argc > 1 ) g_count = strtoul( argv[1], NULL, 10 );
+
+    // one writer, one reader
+    run<CBufferSimple>( "CBufferSimple", 1, 64 );
+    // several writers, small and large buffers (small: mostly full)
+    run<CBufferMulti>( "CBufferMulti", 4, 8 );
+    run<CBufferMulti>( "CBufferMulti", 4, 1024 );
+    run<CBufferMulti>( "CBufferMulti", 8, 64 );
+
+    if( g_failures ) return 1;
+    printf( "\"success\" :(string)\n" );
+    return 0;
+}
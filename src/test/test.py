@@ -12,6 +12,18 @@ failures = 0
 successes = 0
 skipped = 0
 skipTests = {}
+# tests of code that only some flags reach, run again with each set of
+# flags listed for them (as well as without) | 1.5.1.7
+testFlags = {
+    "220-optimize-fold.ck": [["--optimize:2"]],
+    "221-jit-loops.ck": [["--dispatch:jit"]],
+    "223-array-unchecked.ck": [["--optimize:2"], ["--optimize:2", "--dispatch:threaded"]],
+    "226-reclaim.ck": [["--reclaim:4"]],
+    "240-ugen-threads.ck": [["--adaptive:64", "--threads:3"], ["--adaptive:16", "--threads:2"]],
+    "241-ugen-tickv.ck": [["--adaptive:64"], ["--adaptive:7"]],
+    "error-array-rebind-member.ck": [["--optimize:2"]],
+    "stack-overflow-operand.ck": [["--optimize:2"]],
+}
 
 
 def handle_directory(dir, exe):
@@ -30,15 +42,17 @@ def handle_directory(dir, exe):
         if os.path.isfile(path):
             if os.path.splitext(filename)[1] == ".ck":
                 run_test(exe, path, filename, 0)
+                for flags in testFlags.get(filename, []):
+                    run_test(exe, path, filename, 0, flags)
         elif os.path.isdir(path) and filename[0] != '.':
             handle_directory(path, exe)
 
 
-def run_test(exe, path, filename, attempt):
+def run_test(exe, path, filename, attempt, flags=[]):
     global successes
     global skipped
 
-    print("> %s %s" % (exe, path))
+    print("> %s %s" % (" ".join([exe] + flags), path))
 
     if filename in skipTests:
         skipped += 1
@@ -52,7 +66,7 @@ def run_test(exe, path, filename, attempt):
         # for color terminal text) from showing up in chuck output;
         # FYI chuck implicitly checks for TTY; if not will disable printing
         # escape codes; but leaving this note here FYI
-        result = subprocess.check_output([exe, "--silent", "--chugin-load:off", "%s" % path], stderr=subprocess.STDOUT).decode("utf-8")
+        result = subprocess.check_output([exe, "--silent", "--chugin-load:off"] + flags + ["%s" % path], stderr=subprocess.STDOUT).decode("utf-8")
 
         if result.strip().endswith(("\"success\" :(string)",)):
             successes += 1
@@ -65,16 +79,16 @@ def run_test(exe, path, filename, attempt):
                     answer = answerFile.read()
 
                 if answer.replace("\r\n", "\n") != result.replace("\r\n", "\n"):
-                    handle_failure(exe, path, filename, attempt, result)
+                    handle_failure(exe, path, filename, attempt, result, flags)
                 else:
                     successes += 1
             else:
-                handle_failure(exe, path, filename, attempt, result)
+                handle_failure(exe, path, filename, attempt, result, flags)
     except subprocess.CalledProcessError as e:
-        handle_failure(exe, path, filename, attempt, e.output)
+        handle_failure(exe, path, filename, attempt, e.output, flags)
 
 
-def handle_failure(exe, path, filename, attempt, error_string):
+def handle_failure(exe, path, filename, attempt, error_string, flags=[]):
     # We'll attempt up to run the test at most this more times
     retry_attempts_for_failed_tests = 2
 
@@ -83,8 +97,8 @@ def handle_failure(exe, path, filename, attempt, error_string):
 
     if attempt < retry_attempts_for_failed_tests:
         time.sleep(sleep_interval_between_runs_seconds)
-        print("Retrying test: %s %s" % (exe, path))
-        run_test(exe, path, filename, attempt + 1)
+        print("Retrying test: %s %s" % (" ".join([exe] + flags), path))
+        run_test(exe, path, filename, attempt + 1, flags)
     else:
         fail(filename, error_string)
 